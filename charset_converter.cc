@@ -1,14 +1,16 @@
 #include <string>
 #include <utility>
 #include <unordered_set>
+#include <cstring>
 
 #include <boost/locale/encoding.hpp>
-#include <boost/optional.hpp>
 
 #include "charset_converter.h"
 #include "converter_data.h"
 #include "fonts.h"
 #include "common.h"
+#include "utf.h"
+#include "cjk_charsets.h"
 
 using namespace std;
 using namespace boost::locale::conv;
@@ -24,11 +26,11 @@ namespace
     }
 }
 
-CharsetConverter::CharsetConverter() noexcept : encode(), charset(nullptr)
+CharsetConverter::CharsetConverter() noexcept : encode(), charset(nullptr), cjk_charset(nullptr)
 {
 }
 
-CharsetConverter::CharsetConverter(const std::string &encoding_arg) : encoding(encoding_arg)
+CharsetConverter::CharsetConverter(const std::string &encoding_arg) : encoding(encoding_arg), cjk_charset(nullptr)
 {
     if (encoding.empty())
     {
@@ -50,15 +52,18 @@ CharsetConverter::CharsetConverter(const std::string &encoding_arg) : encoding(e
         encode = MAC_EXPERT;
         charset = nullptr;
     }
-    else if (encoding == "/Identity-H" || encoding == "/Identity-V" || !encoding2charset.count(encoding))
+    else if (encoding == "/Identity-H" || encoding == "/Identity-V" || !get_predefined_charset(encoding, charset))
     {
         encode = IDENTITY;
         charset = nullptr;
     }
     else
     {
-        charset = encoding2charset.at(encoding);
-        encode = charset? OTHER : UTF8;
+        if (!charset) encode = UTF8;
+        else if (strcmp(charset, "UTF-16be") == 0) encode = UTF16BE;
+        else if (strcmp(charset, "UTF-32be") == 0) encode = UTF32BE;
+        else if ((cjk_charset = get_cjk_charset(charset))) encode = CJK;
+        else encode = OTHER;
     }
 }
 
@@ -99,22 +104,39 @@ pair<string, float> CharsetConverter::get_string(const string &s, const Fonts &f
     case UTF8:
         return make_pair(s, fonts.get_width(s));
     case IDENTITY:
-        return make_pair(to_utf<char>(s, "UTF-16be"), get_width_identity(s, fonts));
+        return make_pair(utf16be2utf8(s), get_width_identity(s, fonts));
     case DEFAULT:
     case MAC_EXPERT:
     case MAC_ROMAN:
     case WIN:
     {
-        const unordered_map<unsigned int, string> &standard_encoding = standard_encodings.at(encode);
+        const encoding_table_t &table = standard_encodings[encode];
         string str;
         str.reserve(s.length());
         for (char c : s)
         {
-            auto it = standard_encoding.find(static_cast<unsigned char>(c));
-            if (it != standard_encoding.end()) str.append(it->second);
+            const symbol_t &symbol = table[static_cast<unsigned char>(c)];
+            if (symbol.length != symbol_t::NO_SYMBOL) str.append(standard_symbols + symbol.offset, symbol.length);
         }
         return make_pair(std::move(str), fonts.get_width(s));
     }
+    case UTF16BE:
+        return make_pair(utf16be2utf8(s), fonts.get_width(s));
+    case UTF32BE:
+    {
+        string str;
+        str.reserve(s.length());
+        append_utf32be(str, s.data(), s.length());
+        return make_pair(std::move(str), fonts.get_width(s));
+    }
+    case CJK:
+    {
+        string str;
+        str.reserve(s.length() + s.length() / 2);
+        append_cjk(str, s, *cjk_charset);
+        return make_pair(std::move(str), fonts.get_width(s));
+    }
+    //stateful ISO-2022 charsets and charsets with 4 bytes codes
     case OTHER:
         return make_pair(to_utf<char>(s, charset), fonts.get_width(s));
     default:
@@ -122,13 +144,19 @@ pair<string, float> CharsetConverter::get_string(const string &s, const Fonts &f
     }
 }
 
-boost::optional<string> CharsetConverter::get_char(char c) const
+const encoding_table_t& CharsetConverter::get_char_table() const
+{
+    return standard_encodings[is_simple()? encode : DEFAULT];
+}
+
+const char* CharsetConverter::get_symbols() const
+{
+    return standard_symbols;
+}
+
+bool CharsetConverter::is_simple() const
 {
-    PDFEncode_t enc = (encode == MAC_EXPERT || encode == MAC_ROMAN || encode == WIN)? encode : DEFAULT;
-    const unordered_map<unsigned int, string> &standard_encoding = standard_encodings.at(enc);
-    auto it = standard_encoding.find(static_cast<unsigned char>(c));
-    if (it != standard_encoding.end()) return it->second;
-    return boost::none;
+    return encode == DEFAULT || encode == MAC_EXPERT || encode == MAC_ROMAN || encode == WIN;
 }
 
 bool CharsetConverter::is_empty() const
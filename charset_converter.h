@@ -4,9 +4,8 @@
 #include <string>
 #include <utility>
 
-#include <boost/optional.hpp>
-
 #include "converter_data.h"
+#include "cjk_charsets.h"
 #include "fonts.h"
 
 class CharsetConverter
@@ -15,13 +14,18 @@ public:
     CharsetConverter() noexcept;
     explicit CharsetConverter(const std::string &encoding);
     std::pair<std::string, float> get_string(const std::string &s, const Fonts &fonts) const;
-    boost::optional<std::string> get_char(char c) const;
+    //table and symbols for single codes: standard encoding or StandardEncoding for other encodings
+    const encoding_table_t& get_char_table() const;
+    const char* get_symbols() const;
+    //true if string is decoded by get_char_table()
+    bool is_simple() const;
     bool is_empty() const;
     bool is_vertical() const;
 private:
     const std::string encoding;
     PDFEncode_t encode;
     const char* charset;
+    const cjk_node_t *cjk_charset;
 };
 
 #endif //CHARSET_CONVERTER_H
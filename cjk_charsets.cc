@@ -0,0 +1,59 @@
+#include <string>
+#include <cstdint>
+#include <utility>
+
+#include "cjk_charsets.h"
+#include "utf.h"
+
+using namespace std;
+
+namespace
+{
+    //entry of node: code point, NO_CODE, CHILD + index of node for the next byte
+    //or SKIP + number of bytes to skip for invalid code
+    enum : uint16_t { NO_CODE = 0xFFFF, CHILD = 0xD800, SKIP = 0xDC00, SKIP_LAST = 0xDFFF };
+
+    #include "cjk_tables.h"
+
+    uint16_t get_entry(const cjk_node_t &node, unsigned char c)
+    {
+        if (c < node.first || c > node.last) return NO_CODE;
+        return cjk_codes[node.offset + c - node.first];
+    }
+}
+
+const cjk_node_t* get_cjk_charset(const string &charset)
+{
+    for (const pair<const char*, unsigned int> &p : cjk_charsets)
+    {
+        if (charset == p.first) return &cjk_nodes[p.second];
+    }
+    return nullptr;
+}
+
+void append_cjk(string &result, const string &s, const cjk_node_t &root)
+{
+    for (size_t i = 0; i < s.length();)
+    {
+        const cjk_node_t *node = &root;
+        size_t j = i;
+        uint16_t entry;
+        for (entry = get_entry(*node, s[j]); entry >= CHILD && entry < SKIP && ++j < s.length();)
+        {
+            node = &cjk_nodes[entry - CHILD];
+            entry = get_entry(*node, s[j]);
+        }
+        if (entry >= SKIP && entry <= SKIP_LAST)
+        {
+            i += entry - SKIP;
+            continue;
+        }
+        if (entry == NO_CODE || (entry >= CHILD && entry < SKIP))
+        {
+            ++i;
+            continue;
+        }
+        append_utf8(result, entry);
+        i = j + 1;
+    }
+}
@@ -0,0 +1,20 @@
+#ifndef CJK_CHARSETS_H
+#define CJK_CHARSETS_H
+
+#include <string>
+#include <cstdint>
+
+//node of compiled multi-byte charset: entries for bytes first..last start at cjk_codes[offset]
+struct cjk_node_t
+{
+    uint8_t first;
+    uint8_t last;
+    uint32_t offset;
+};
+
+//returns root node of compiled charset or nullptr if charset is not compiled
+const cjk_node_t* get_cjk_charset(const std::string &charset);
+//appends string in compiled charset converted to utf8. Invalid or incomplete code is skipped by one byte
+void append_cjk(std::string &result, const std::string &s, const cjk_node_t &root);
+
+#endif //CJK_CHARSETS_H
@@ -2,12 +2,20 @@
 #include <utility>
 #include <vector>
 #include <algorithm>
+#include <map>
+#include <limits>
+#include <iterator>
+#include <cstdint>
+#include <memory>
+#include <cstring>
 
 #include <boost/optional.hpp>
 
 #include "object_storage.h"
 #include "common.h"
 #include "cmap.h"
+#include "utf.h"
+#include "font_file2.h"
 
 using namespace std;
 
@@ -30,7 +38,7 @@ namespace
     {
         sizes[0] = 0;
         size_t i = 0;
-        for (size_t j = 1; j < cmap_t::MAX_CODE_LENGTH + 1; ++j)
+        for (size_t j = 1; j < cmap_data_t::MAX_CODE_LENGTH + 1; ++j)
         {
             if (!sizes[j]) continue;
             sizes[i] = j;
@@ -152,7 +160,107 @@ namespace
         if (byte == 0) n = '\x01' + n;
     }
 
-    size_t get_bfrange(const string &stream, size_t offset, cmap_t &cmap)
+    bool is_in_ranges(const map<unsigned int, pair<unsigned int, string>> &ranges, unsigned int code)
+    {
+        auto it = ranges.upper_bound(code);
+        if (it == ranges.begin()) return false;
+        return (--it)->second.first >= code;
+    }
+
+    void add_code(cmap_data_t &cmap, const string &code, string &&target)
+    {
+        if (code.length() > cmap_data_t::MAX_CODE_LENGTH) return;
+        cmap.sizes[code.length()] = 1;
+        //code is already defined by earlier bfrange
+        if (is_in_ranges(cmap.ranges[code.length()], string2num(code))) return;
+        cmap.utf_map.emplace(code, make_pair(cmap_data_t::NOT_CONVERTED, std::move(target)));
+    }
+
+    //target can be incremented arithmetically if its last character is complete and valid utf16be
+    bool is_range_target(const string &target)
+    {
+        if (target.length() % 2) return false;
+        for (size_t i = 0; i < target.length(); i += 2)
+        {
+            unsigned char c = target[i];
+            if (c >= 0xDC && c <= 0xDF) return false;
+            if (c < 0xD8 || c > 0xDB) continue;
+            if (i + 2 >= target.length()) return false;
+            c = target[i + 2];
+            if (c < 0xDC || c > 0xDF) return false;
+            i += 2;
+        }
+        return true;
+    }
+
+    string get_range_target(const string &target, unsigned int inc)
+    {
+        string result = target;
+        result.back() += inc;
+        return result;
+    }
+
+    //inserts codes [first, last] of the same length not covered by earlier ranges
+    void add_range(cmap_data_t &cmap, size_t length, unsigned int first, unsigned int last, const string &target)
+    {
+        map<unsigned int, pair<unsigned int, string>> &ranges = cmap.ranges[length];
+        auto it = ranges.upper_bound(first);
+        if (it != ranges.begin() && prev(it)->second.first >= first) --it;
+        for (uint64_t code = first; code <= last; ++it)
+        {
+            if (it == ranges.end() || it->first > last)
+            {
+                ranges.emplace(code, make_pair(last, get_range_target(target, code - first)));
+                break;
+            }
+            if (it->first > code)
+            {
+                ranges.emplace(code, make_pair(it->first - 1, get_range_target(target, code - first)));
+            }
+            code = max<uint64_t>(code, uint64_t(it->second.first) + 1);
+        }
+    }
+
+    uint64_t get_code_value(const string &code)
+    {
+        size_t start = trim_leading_zeroes(code);
+        if (start == code.length()) return 0;
+        if (code.length() - start > sizeof(uint32_t)) return numeric_limits<uint64_t>::max();
+        return string2num(code.substr(start));
+    }
+
+    void add_bfrange(cmap_data_t &cmap, const string &first, const string &second, const string &target)
+    {
+        // 9.10.3 ToUnicode CMaps
+        // When defining ranges of this type, the value of the last byte in the string shall be less than or equal to
+        // 255 − (srcCode2 − srcCode1). This ensures that the last byte of the string shall not be incremented past 255;
+        // otherwise, the result of mapping is undefined.
+        // Range is cut after the code mapped to the last byte 255
+        if (first.length() > cmap_data_t::MAX_CODE_LENGTH) return;
+        const uint64_t lo = string2num(first);
+        const uint64_t hi = min(get_code_value(second), lo + 255 - static_cast<unsigned char>(target.back()));
+        //codes which don't fit into the length of first code get one more byte, like 0xFF -> 0x0100
+        for (size_t length = first.length(); length <= cmap_data_t::MAX_CODE_LENGTH; ++length)
+        {
+            const uint64_t length_lo = (length == first.length())? lo : (uint64_t(1) << (8 * (length - 1)));
+            const uint64_t length_hi = min(hi, (uint64_t(1) << (8 * length)) - 1);
+            if (length_lo > length_hi) break;
+            cmap.sizes[length] = 1;
+            if (is_range_target(target))
+            {
+                add_range(cmap, length, length_lo, length_hi, get_range_target(target, length_lo - lo));
+                continue;
+            }
+            for (uint64_t code = length_lo; code <= length_hi; ++code)
+            {
+                string n = num2string(code);
+                n = string(length - min(length, n.length()), 0) + n.substr(n.length() - min(length, n.length()));
+                add_code(cmap, n, get_range_target(target, code - lo));
+            }
+        }
+    }
+
+    size_t get_bfrange(const string &stream, size_t offset, cmap_data_t &cmap)
     {
         const string first = convert2string(get_token(stream, offset));
         const string second = convert2string(get_token(stream, offset));
@@ -162,7 +270,7 @@ namespace
         case token_t::HEX:
         case token_t::DEC:
         {
-            string third = convert2string(third_token);
+            const string third = convert2string(third_token);
             if (third.empty()) throw pdf_error(FUNC_STRING + "third string is empty");
             // 9.10.3 ToUnicode CMaps
             // Likewise, mappings after the beginbfrange operator may
@@ -171,17 +279,7 @@ namespace
             // srcCode1 srcCode2 dstString
             // endbfrange
             // In this case, the last byte of the string shall be incremented for each consecutive code in the source code range
-            unsigned char &last_byte = reinterpret_cast<unsigned char&>(third.back());
-            for (string n = first; is_less_equal(n, second); inc(n), ++last_byte)
-            {
-                cmap.utf_map.emplace(n, make_pair(cmap_t::NOT_CONVERTED, third));
-                cmap.sizes[n.length()] = 1;
-                // 9.10.3 ToUnicode CMaps
-                // When defining ranges of this type, the value of the last byte in the string shall be less than or equal to
-                // 255 − (srcCode2 − srcCode1). This ensures that the last byte of the string shall not be incremented past 255;
-                // otherwise, the result of mapping is undefined.
-                if (last_byte == 255) break;
-            }
+            add_bfrange(cmap, first, second, third);
             break;
         }
         case token_t::ARRAY:
@@ -189,9 +287,7 @@ namespace
             size_t token_offset = 0;
             for (string n = first; is_less_equal(n, second); inc(n))
             {
-                cmap.utf_map.emplace(n, make_pair(cmap_t::NOT_CONVERTED,
-                                                  convert2string(get_token(third_token.val, token_offset))));
-                cmap.sizes[n.length()] = 1;
+                add_code(cmap, n, convert2string(get_token(third_token.val, token_offset)));
             }
             break;
         }
@@ -220,13 +316,12 @@ namespace
         return boost::none;
     }
 
-    size_t get_bfchar(const string &stream, size_t offset, cmap_t &cmap)
+    size_t get_bfchar(const string &stream, size_t offset, cmap_data_t &cmap)
     {
         const boost::optional<string> src = try_get_string(stream, offset);
         const boost::optional<string> dst = try_get_string(stream, offset);
         if (!src || !dst) return offset + 1;
-        cmap.utf_map.emplace(*src, make_pair(cmap_t::NOT_CONVERTED, *dst));
-        cmap.sizes[src->length()] = 1;
+        add_code(cmap, *src, string(*dst));
         return offset + 1;
     }
 
@@ -239,17 +334,95 @@ namespace
 
         return boost::none;
     }
+
+    //image is header followed by tables in order of table_id_t. Chars go last, so other tables stay aligned
+    enum table_id_t { TARGETS, CODES1, PAGES2, CODES2, CODES3, CODES4,
+                      RANGES /* RANGES + n for codes of n bytes */,
+                      SEGMENTS = RANGES + cmap_t::MAX_CODE_LENGTH + 1, SYMBOLS, GLYPHS, TABLES_NUM };
+    constexpr size_t element_sizes[TABLES_NUM] = {sizeof(cmap_t::target_t),
+                                                  sizeof(uint32_t), sizeof(uint32_t), sizeof(uint32_t),
+                                                  sizeof(cmap_t::long_code_t), sizeof(cmap_t::long_code_t),
+                                                  sizeof(cmap_t::range_t), sizeof(cmap_t::range_t),
+                                                  sizeof(cmap_t::range_t), sizeof(cmap_t::range_t),
+                                                  sizeof(cmap_t::range_t),
+                                                  sizeof(truetype_segment_t), sizeof(char), sizeof(char)};
+    enum : uint32_t { VERTICAL = 1, TRUETYPE = 2 };
+
+    struct image_header_t
+    {
+        uint32_t size;
+        uint32_t flags;
+        uint32_t sizes_num;
+        unsigned char sizes[cmap_t::MAX_CODE_LENGTH];
+        uint32_t nums[TABLES_NUM];
+    };
+    static_assert(sizeof(image_header_t) % sizeof(uint32_t) == 0 && sizeof(cmap_t::target_t) % sizeof(uint32_t) == 0 &&
+                  sizeof(truetype_segment_t) % sizeof(uint32_t) == 0, "image tables must stay aligned");
+
+    alignas(uint64_t) const image_header_t empty_image = {sizeof(image_header_t), 0, 0, {}, {}};
+
+    //tables of cmap before they are put to image
+    struct tables_t
+    {
+        string symbols;
+        vector<cmap_t::target_t> targets;
+        vector<uint32_t> codes1;
+        vector<uint32_t> pages2;
+        vector<uint32_t> codes2;
+        vector<cmap_t::long_code_t> codes3;
+        vector<cmap_t::long_code_t> codes4;
+        vector<cmap_t::range_t> ranges[cmap_t::MAX_CODE_LENGTH + 1];
+        vector<truetype_segment_t> segments;
+        string glyphs;
+    };
+
+    vector<uint64_t> make_image(const tables_t &tables, uint32_t flags, const vector<unsigned char> &sizes)
+    {
+        image_header_t header = empty_image;
+        const void *data[TABLES_NUM] = {tables.targets.data(), tables.codes1.data(), tables.pages2.data(),
+                                        tables.codes2.data(), tables.codes3.data(), tables.codes4.data()};
+        header.nums[TARGETS] = tables.targets.size();
+        header.nums[CODES1] = tables.codes1.size();
+        header.nums[PAGES2] = tables.pages2.size();
+        header.nums[CODES2] = tables.codes2.size();
+        header.nums[CODES3] = tables.codes3.size();
+        header.nums[CODES4] = tables.codes4.size();
+        for (size_t n = 0; n <= cmap_t::MAX_CODE_LENGTH; ++n)
+        {
+            data[RANGES + n] = tables.ranges[n].data();
+            header.nums[RANGES + n] = tables.ranges[n].size();
+        }
+        data[SEGMENTS] = tables.segments.data();
+        header.nums[SEGMENTS] = tables.segments.size();
+        data[SYMBOLS] = tables.symbols.data();
+        header.nums[SYMBOLS] = tables.symbols.length();
+        data[GLYPHS] = tables.glyphs.data();
+        header.nums[GLYPHS] = tables.glyphs.length();
+        header.flags = flags;
+        header.sizes_num = sizes.size();
+        copy(sizes.begin(), sizes.end(), header.sizes);
+        size_t size = sizeof(header);
+        for (size_t i = 0; i < TABLES_NUM; ++i) size += header.nums[i] * element_sizes[i];
+        if (size > numeric_limits<uint32_t>::max()) throw pdf_error(FUNC_STRING + "cmap is too big");
+        header.size = size;
+        vector<uint64_t> result((size + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0);
+        char *image = reinterpret_cast<char*>(result.data());
+        memcpy(image, &header, sizeof(header));
+        size_t offset = sizeof(header);
+        for (size_t i = 0; i < TABLES_NUM; ++i)
+        {
+            if (header.nums[i] == 0) continue;
+            memcpy(image + offset, data[i], header.nums[i] * element_sizes[i]);
+            offset += header.nums[i] * element_sizes[i];
+        }
+        return result;
+    }
 }
 
-cmap_t get_cmap(const string &doc,
-                const ObjectStorage &storage,
-                const pair<unsigned int, unsigned int> &cmap_id_gen,
-                const dict_t &decrypt_data)
+cmap_t get_cmap(const string &stream)
 {
     State_t state = NONE;
-    const string stream = get_stream(doc, cmap_id_gen, storage, decrypt_data);
-    cmap_t result;
-    result.is_vertical = false;
+    cmap_data_t result;
     for (size_t start = stream.find_first_not_of(" \t\n\r"), end = stream.find_first_of(" \t\n\r", start);
          start != string::npos;
          start = stream.find_first_not_of(" \t\n\r", end), end = stream.find_first_of(" \t\n\r", start))
@@ -286,5 +459,256 @@ cmap_t get_cmap(const string &doc,
         start = end + 1;
     }
     get_sizes(result.sizes);
+    return cmap_t(result);
+}
+
+cmap_t::cmap_t() noexcept : symbols(""), is_vertical(false), image(nullptr)
+{
+}
+
+cmap_t::cmap_t(const truetype_data_t &data)
+{
+    tables_t tables;
+    tables.segments = data.segments;
+    tables.glyphs = data.glyphs;
+    storage = make_image(tables, TRUETYPE, vector<unsigned char>(1, sizeof(uint16_t)));
+    set_tables(reinterpret_cast<const char*>(storage.data()), storage.size() * sizeof(uint64_t));
+}
+
+cmap_t::cmap_t(const char *image_arg, size_t image_size, std::shared_ptr<const void> &&owner_arg) :
+               owner(std::move(owner_arg))
+{
+    set_tables(image_arg, image_size);
+}
+
+cmap_t::cmap_t(cmap_t &&arg) noexcept = default;
+
+size_t cmap_t::get_size() const
+{
+    size_t result = sizeof(*this) + storage.capacity() * sizeof(uint64_t) + sizes.capacity();
+    if (truetype) result += truetype->get_size();
     return result;
 }
+
+pair<const char*, size_t> cmap_t::get_image() const
+{
+    const char *result = image? image : reinterpret_cast<const char*>(&empty_image);
+    uint32_t size;
+    memcpy(&size, result, sizeof(size));
+    return make_pair(result, (size + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t));
+}
+
+cmap_t::~cmap_t() = default;
+
+cmap_t::cmap_t(const cmap_data_t &data)
+{
+    vector<unsigned char> code_sizes;
+    for (unsigned char n : data.sizes)
+    {
+        if (n) code_sizes.push_back(n);
+    }
+    tables_t tables;
+    for (const pair<const string, pair<cmap_data_t::converted_status_t, string>> &p : data.utf_map)
+    {
+        const string &code = p.first;
+        //codes of other lengths are never looked up
+        if (std::find(code_sizes.begin(), code_sizes.end(), code.length()) == code_sizes.end()) continue;
+        const string target = (p.second.first == cmap_data_t::NOT_CONVERTED)? utf16be2utf8(p.second.second) :
+                                                                              p.second.second;
+        uint32_t target_id = tables.targets.size();
+        tables.targets.push_back(target_t{static_cast<uint32_t>(tables.symbols.length()),
+                                          static_cast<uint32_t>(target.length()),
+                                          static_cast<uint32_t>(utf8_length(target))});
+        tables.symbols.append(target);
+        unsigned int n = string2num(code);
+        switch (code.length())
+        {
+        case 1:
+            if (tables.codes1.empty()) tables.codes1.resize(CODES_NUM, NO_TARGET);
+            tables.codes1[n] = target_id;
+            break;
+        case 2:
+        {
+            if (tables.pages2.empty()) tables.pages2.resize(CODES_NUM, NO_TARGET);
+            uint32_t &page = tables.pages2[n >> 8];
+            if (page == NO_TARGET)
+            {
+                page = tables.codes2.size() / CODES_NUM;
+                tables.codes2.resize(tables.codes2.size() + CODES_NUM, NO_TARGET);
+            }
+            tables.codes2[page * CODES_NUM + (n & 0xFF)] = target_id;
+            break;
+        }
+        case 3:
+            tables.codes3.push_back(long_code_t{n, target_id});
+            break;
+        case 4:
+            tables.codes4.push_back(long_code_t{n, target_id});
+            break;
+        }
+    }
+    auto less_code = [](const long_code_t &c1, const long_code_t &c2) { return c1.code < c2.code; };
+    sort(tables.codes3.begin(), tables.codes3.end(), less_code);
+    sort(tables.codes4.begin(), tables.codes4.end(), less_code);
+    for (unsigned char n : code_sizes)
+    {
+        tables.ranges[n].reserve(data.ranges[n].size());
+        for (const pair<const unsigned int, pair<unsigned int, string>> &p : data.ranges[n])
+        {
+            //target is valid utf16be, its last character is 1 unit or surrogates pair
+            const string &target = p.second.second;
+            size_t last_length = (target.length() >= 4 && (static_cast<unsigned char>(target[target.length() - 4]) & 0xFC) == 0xD8)?
+                                 4 : 2;
+            uint32_t last_char = string2num(target.substr(target.length() - 2));
+            if (last_length == 4)
+            {
+                uint32_t high = string2num(target.substr(target.length() - 4, 2));
+                last_char = 0x10000 + ((high - 0xD800) << 10) + (last_char - 0xDC00);
+            }
+            const string prefix = utf16be2utf8(target.substr(0, target.length() - last_length));
+            tables.ranges[n].push_back(range_t{p.first, p.second.first, static_cast<uint32_t>(tables.targets.size()),
+                                               last_char});
+            tables.targets.push_back(target_t{static_cast<uint32_t>(tables.symbols.length()),
+                                              static_cast<uint32_t>(prefix.length()),
+                                              static_cast<uint32_t>(utf8_length(prefix) + 1)});
+            tables.symbols.append(prefix);
+        }
+    }
+    storage = make_image(tables, data.is_vertical? VERTICAL : 0, code_sizes);
+    set_tables(reinterpret_cast<const char*>(storage.data()), storage.size() * sizeof(uint64_t));
+}
+
+void cmap_t::set_tables(const char *image_arg, size_t image_size)
+{
+    if (image_size < sizeof(image_header_t) || reinterpret_cast<uintptr_t>(image_arg) % sizeof(uint64_t) != 0)
+    {
+        throw pdf_error(FUNC_STRING + "wrong image");
+    }
+    image_header_t header;
+    memcpy(&header, image_arg, sizeof(header));
+    if (header.size > image_size || header.sizes_num > MAX_CODE_LENGTH)
+    {
+        throw pdf_error(FUNC_STRING + "wrong image header");
+    }
+    const char *data[TABLES_NUM];
+    size_t offset = sizeof(header);
+    for (size_t i = 0; i < TABLES_NUM; ++i)
+    {
+        data[i] = image_arg + offset;
+        offset += header.nums[i] * element_sizes[i];
+        if (offset > header.size) throw pdf_error(FUNC_STRING + "wrong image size");
+    }
+    image = image_arg;
+    is_vertical = header.flags & VERTICAL;
+    sizes.assign(header.sizes, header.sizes + header.sizes_num);
+    for (unsigned char n : sizes)
+    {
+        if (n == 0 || n > MAX_CODE_LENGTH) throw pdf_error(FUNC_STRING + "wrong code length " + to_string(n));
+    }
+    symbols = data[SYMBOLS];
+    targets = table_t<target_t>{reinterpret_cast<const target_t*>(data[TARGETS]), header.nums[TARGETS]};
+    codes1 = table_t<uint32_t>{reinterpret_cast<const uint32_t*>(data[CODES1]), header.nums[CODES1]};
+    pages2 = table_t<uint32_t>{reinterpret_cast<const uint32_t*>(data[PAGES2]), header.nums[PAGES2]};
+    codes2 = table_t<uint32_t>{reinterpret_cast<const uint32_t*>(data[CODES2]), header.nums[CODES2]};
+    codes3 = table_t<long_code_t>{reinterpret_cast<const long_code_t*>(data[CODES3]), header.nums[CODES3]};
+    codes4 = table_t<long_code_t>{reinterpret_cast<const long_code_t*>(data[CODES4]), header.nums[CODES4]};
+    for (size_t n = 0; n <= MAX_CODE_LENGTH; ++n)
+    {
+        ranges[n] = table_t<range_t>{reinterpret_cast<const range_t*>(data[RANGES + n]), header.nums[RANGES + n]};
+    }
+
+    //image can come from file, so lookups are checked to stay inside of tables
+    for (const target_t &target : targets)
+    {
+        if (static_cast<size_t>(target.offset) + target.length > header.nums[SYMBOLS])
+        {
+            throw pdf_error(FUNC_STRING + "wrong target offset");
+        }
+    }
+    if ((!codes1.empty() && codes1.size != CODES_NUM) || (!pages2.empty() && pages2.size != CODES_NUM) ||
+        codes2.size % CODES_NUM != 0)
+    {
+        throw pdf_error(FUNC_STRING + "wrong codes table size");
+    }
+    auto check_target = [this](uint32_t target_id)
+    {
+        if (target_id != NO_TARGET && target_id >= targets.size) throw pdf_error(FUNC_STRING + "wrong target");
+    };
+    for (uint32_t target_id : codes1) check_target(target_id);
+    for (uint32_t target_id : codes2) check_target(target_id);
+    for (const long_code_t &code : codes3) check_target(code.target);
+    for (const long_code_t &code : codes4) check_target(code.target);
+    for (uint32_t page : pages2)
+    {
+        if (page != NO_TARGET && page >= codes2.size / CODES_NUM) throw pdf_error(FUNC_STRING + "wrong codes page");
+    }
+    for (const table_t<range_t> &code_ranges : ranges)
+    {
+        for (const range_t &range : code_ranges)
+        {
+            if (range.target >= targets.size) throw pdf_error(FUNC_STRING + "wrong range target");
+        }
+    }
+    if (header.flags & TRUETYPE)
+    {
+        truetype.reset(new TrueTypeCmap(reinterpret_cast<const truetype_segment_t*>(data[SEGMENTS]),
+                                        header.nums[SEGMENTS], data[GLYPHS], header.nums[GLYPHS]));
+    }
+}
+
+bool cmap_t::find(const string &s, size_t i, symbol_t &symbol) const
+{
+    for (unsigned char n : sizes)
+    {
+        if (s.length() - i < n) break;
+        unsigned int code = 0;
+        for (size_t j = i; j < i + n; ++j) code = (code << 8) | static_cast<unsigned char>(s[j]);
+        if (find(code, n, symbol)) return true;
+    }
+    return false;
+}
+
+bool cmap_t::find(unsigned int code, unsigned char n, symbol_t &symbol) const
+{
+    if (truetype) return n == sizeof(uint16_t) && truetype->find(code, symbol);
+    uint32_t target_id = NO_TARGET;
+    switch (n)
+    {
+    case 1:
+        if (!codes1.empty()) target_id = codes1[code];
+        break;
+    case 2:
+    {
+        if (pages2.empty()) break;
+        uint32_t page = pages2[code >> 8];
+        if (page != NO_TARGET) target_id = codes2[page * CODES_NUM + (code & 0xFF)];
+        break;
+    }
+    default:
+    {
+        const table_t<long_code_t> &codes = (n == 3)? codes3 : codes4;
+        auto it = lower_bound(codes.begin(), codes.end(), code,
+                              [](const long_code_t &c, unsigned int val) { return c.code < val; });
+        if (it != codes.end() && it->code == code) target_id = it->target;
+        break;
+    }
+    }
+    uint32_t last_char = NO_CHAR;
+    if (target_id == NO_TARGET)
+    {
+        const table_t<range_t> &code_ranges = ranges[n];
+        auto it = upper_bound(code_ranges.begin(), code_ranges.end(), code,
+                              [](unsigned int val, const range_t &r) { return val < r.first; });
+        if (it == code_ranges.begin() || (--it)->last < code) return false;
+        target_id = it->target;
+        last_char = it->last_char + (code - it->first);
+    }
+    const target_t &target = targets[target_id];
+    symbol.utf8 = symbols + target.offset;
+    symbol.length = target.length;
+    symbol.last_char = last_char;
+    symbol.utf8_length = target.utf8_length;
+    symbol.code = code;
+    symbol.code_length = n;
+    return true;
+}
@@ -2,30 +2,142 @@
 #define CMAP_H
 
 #include <unordered_map>
+#include <map>
 #include <vector>
 #include <string>
 #include <utility>
+#include <memory>
+#include <cstdint>
 
 #include "object_storage.h"
 #include "common.h"
 
-
-struct cmap_t
+//cmap as it is collected by parsers: code -> target
+struct cmap_data_t
 {
     enum converted_status_t { CONVERTED, NOT_CONVERTED};
     enum {MAX_CODE_LENGTH = 4 /* 9.7.6.2 */ };
 
-    cmap_t() : sizes(MAX_CODE_LENGTH + 1, 0)
+    cmap_data_t() : sizes(MAX_CODE_LENGTH + 1, 0), is_vertical(false)
     {
     }
+
     std::unordered_map<std::string, std::pair<converted_status_t, std::string>> utf_map;
+    //bfranges for each code length: first code -> (last code, utf16be target of first code).
+    //Ranges don't overlap and don't contain codes of utf_map defined after them
+    std::map<unsigned int, std::pair<unsigned int, std::string>> ranges[MAX_CODE_LENGTH + 1];
+    //code lengths to try, shortest first. Zero entries are unused
+    std::vector<unsigned char> sizes;
+    bool is_vertical;
+};
+
+class TrueTypeCmap;
+struct truetype_data_t;
+
+//cmap compiled for decoding. All targets are converted to utf8 on construction, lookups don't allocate and
+//don't modify anything, so compiled cmap can be shared read-only.
+//Tables are kept in one block of memory (image) without pointers, so image can be written to file and mapped
+//by other process. cmap of TrueType font program is resolved on demand by TrueTypeCmap instead, it caches found codes
+struct cmap_t
+{
+    enum {MAX_CODE_LENGTH = cmap_data_t::MAX_CODE_LENGTH, CODES_NUM = 256 };
+    enum : uint32_t { NO_TARGET = 0xFFFFFFFF, NO_CHAR = 0xFFFFFFFF };
+    //utf8 target in symbols. For ranges it is the part before the last character
+    struct target_t
+    {
+        uint32_t offset;
+        uint32_t length;
+        uint32_t utf8_length;
+    };
+    //code of 3 or 4 bytes
+    struct long_code_t
+    {
+        uint32_t code;
+        uint32_t target;
+    };
+    //codes range. Code first + n is mapped to target followed by character last_char + n
+    struct range_t
+    {
+        uint32_t first;
+        uint32_t last;
+        uint32_t target;
+        uint32_t last_char;
+    };
+    //found code. Its utf8 symbol is utf8 followed by last_char unless last_char is NO_CHAR
+    struct symbol_t
+    {
+        const char *utf8;
+        uint32_t length;
+        uint32_t last_char;
+        uint32_t utf8_length;
+        unsigned int code;
+        unsigned char code_length;
+    };
+    //table in image
+    template <class T> struct table_t
+    {
+        const T* begin() const
+        {
+            return data;
+        }
+        const T* end() const
+        {
+            return data + size;
+        }
+        bool empty() const
+        {
+            return size == 0;
+        }
+        const T& operator[](size_t i) const
+        {
+            return data[i];
+        }
+        const T *data;
+        uint32_t size;
+    };
+
+    cmap_t() noexcept;
+    explicit cmap_t(const cmap_data_t &data);
+    explicit cmap_t(const truetype_data_t &data);
+    //cmap over image of image_size bytes returned by get_image(), owner keeps image alive.
+    //Throws pdf_error if tables of image are inconsistent
+    cmap_t(const char *image_arg, size_t image_size, std::shared_ptr<const void> &&owner_arg);
+    cmap_t(cmap_t &&arg) noexcept;
+    ~cmap_t();
+    //memory held by cmap in bytes, images owned by others are not counted
+    size_t get_size() const;
+    //image of tables aligned to 8 bytes, empty cmap has no image
+    std::pair<const char*, size_t> get_image() const;
+    //looks for the code at position i. Returns false if code is not mapped
+    bool find(const std::string &s, size_t i, symbol_t &symbol) const;
+    //looks for the code of n bytes. Returns false if code is not mapped
+    bool find(unsigned int code, unsigned char n, symbol_t &symbol) const;
+
+    const char *symbols;
+    table_t<target_t> targets;
+    //1 byte code -> target
+    table_t<uint32_t> codes1;
+    //first byte of 2 bytes code -> page of CODES_NUM targets in codes2
+    table_t<uint32_t> pages2;
+    table_t<uint32_t> codes2;
+    //3 and 4 bytes codes sorted by code
+    table_t<long_code_t> codes3;
+    table_t<long_code_t> codes4;
+    //ranges for each code length sorted by first code. Codes above are looked up first
+    table_t<range_t> ranges[MAX_CODE_LENGTH + 1];
     std::vector<unsigned char> sizes;
     bool is_vertical;
+private:
+    void set_tables(const char *image_arg, size_t image_size);
+
+    const char *image;
+    //image of compiled cmap or nothing if image is owned by owner
+    std::vector<uint64_t> storage;
+    std::shared_ptr<const void> owner;
+    std::unique_ptr<TrueTypeCmap> truetype;
 };
 
-extern cmap_t get_cmap(const std::string &doc,
-                       const ObjectStorage &storage,
-                       const std::pair<unsigned int, unsigned int> &cmap_id_gen,
-                       const dict_t &decrypt_data);
+//stream is decoded ToUnicode CMap
+extern cmap_t get_cmap(const std::string &stream);
 
 #endif //CMAP_H
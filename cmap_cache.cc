@@ -0,0 +1,173 @@
+#include <string>
+#include <memory>
+#include <mutex>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <cstdint>
+
+#include "cmap_cache.h"
+#include "cmap.h"
+#include "font_file.h"
+#include "font_file2.h"
+#include "cmap_file.h"
+#include "pdf_extractor.h"
+
+using namespace std;
+
+namespace
+{
+    //parser and hashes of the stream
+    cmap_key_t get_key(CmapCache::cmap_type_t type, const string &s)
+    {
+        const pair<uint64_t, uint64_t> hash = get_hash(s.data(), s.length());
+        return cmap_key_t{hash.first, hash.second, s.length(), static_cast<uint32_t>(type)};
+    }
+
+    cmap_t parse(CmapCache::cmap_type_t type, string &&stream)
+    {
+        switch (type)
+        {
+        case CmapCache::TO_UNICODE:
+            return get_cmap(stream);
+        case CmapCache::FONT_FILE:
+            return get_FontFile(stream);
+        case CmapCache::FONT_FILE2:
+            return get_FontFile2(stream);
+        }
+        throw pdf_error(FUNC_STRING + "wrong cmap type " + to_string(type));
+    }
+}
+
+CmapCache::CmapCache() : limit(0), bytes(0), hits(0), misses(0), file_hits(0)
+{
+}
+
+CmapCache& CmapCache::get_instance()
+{
+    static CmapCache cache;
+    return cache;
+}
+
+void CmapCache::set_limit(size_t limit_arg)
+{
+    lock_guard<mutex> lock(cache_mutex);
+    limit = limit_arg;
+    evict();
+}
+
+pdf_extractor_cache_stats_t CmapCache::get_stats() const
+{
+    lock_guard<mutex> lock(cache_mutex);
+    return pdf_extractor_cache_stats_t{hits, misses, entries.size(), bytes, limit, file_hits,
+                                       file? file->get_entries_num() : 0};
+}
+
+shared_ptr<const cmap_t> CmapCache::get_cmap(cmap_type_t type, string &&stream)
+{
+    shared_ptr<const CmapFile> mapped;
+    {
+        lock_guard<mutex> lock(cache_mutex);
+        if (limit == 0 && !file) return make_shared<const cmap_t>(parse(type, std::move(stream)));
+        mapped = file;
+    }
+    const cmap_key_t key = get_key(type, stream);
+    {
+        lock_guard<mutex> lock(cache_mutex);
+        auto it = entries.find(key);
+        if (it != entries.end())
+        {
+            ++hits;
+            lru.splice(lru.begin(), lru, it->second.lru_it);
+            return it->second.cmap;
+        }
+    }
+    //stream is parsed without lock, so several threads can parse the same stream and the first result is kept
+    shared_ptr<const cmap_t> cmap = mapped? mapped->find(key) : nullptr;
+    const bool from_file = static_cast<bool>(cmap);
+    if (!from_file) cmap = make_shared<const cmap_t>(parse(type, std::move(stream)));
+    const size_t size = cmap->get_size();
+    lock_guard<mutex> lock(cache_mutex);
+    if (from_file) ++file_hits;
+    else ++misses;
+    if (size > limit) return cmap;
+    auto it = entries.find(key);
+    if (it != entries.end()) return it->second.cmap;
+    lru.push_front(key);
+    entries.emplace(key, entry_t{cmap, size, lru.begin()});
+    bytes += size;
+    evict();
+    return cmap;
+}
+
+bool CmapCache::load_file(const string &path)
+{
+    shared_ptr<const CmapFile> new_file;
+    try
+    {
+        new_file = make_shared<const CmapFile>(path);
+    }
+    catch (const pdf_error&)
+    {
+        return false;
+    }
+    lock_guard<mutex> lock(cache_mutex);
+    file = std::move(new_file);
+    return true;
+}
+
+void CmapCache::save_file(const string &path, size_t max_bytes) const
+{
+    vector<pair<cmap_key_t, shared_ptr<const cmap_t>>> cmaps;
+    shared_ptr<const CmapFile> mapped;
+    {
+        lock_guard<mutex> lock(cache_mutex);
+        cmaps.reserve(entries.size());
+        for (const cmap_key_t &key : lru) cmaps.emplace_back(key, entries.at(key).cmap);
+        mapped = file;
+    }
+    if (mapped)
+    {
+        unordered_set<cmap_key_t, key_hash_t> keys;
+        for (const pair<cmap_key_t, shared_ptr<const cmap_t>> &p : cmaps) keys.insert(p.first);
+        for (const cmap_key_t &key : mapped->get_keys())
+        {
+            if (keys.count(key)) continue;
+            shared_ptr<const cmap_t> cmap = mapped->find(key);
+            if (cmap) cmaps.emplace_back(key, std::move(cmap));
+        }
+    }
+    CmapFile::write(path, cmaps, max_bytes);
+}
+
+void CmapCache::evict()
+{
+    while (bytes > limit && !lru.empty())
+    {
+        auto it = entries.find(lru.back());
+        bytes -= it->second.size;
+        entries.erase(it);
+        lru.pop_back();
+    }
+}
+
+void pdf_extractor_set_cache_limit(size_t bytes)
+{
+    CmapCache::get_instance().set_limit(bytes);
+}
+
+bool pdf_extractor_load_cache_file(const string &path)
+{
+    return CmapCache::get_instance().load_file(path);
+}
+
+void pdf_extractor_save_cache_file(const string &path, size_t max_bytes)
+{
+    CmapCache::get_instance().save_file(path, max_bytes);
+}
+
+pdf_extractor_cache_stats_t pdf_extractor_get_cache_stats()
+{
+    return CmapCache::get_instance().get_stats();
+}
@@ -0,0 +1,62 @@
+#ifndef CMAP_CACHE_H
+#define CMAP_CACHE_H
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <list>
+#include <unordered_map>
+#include <cstdint>
+
+#include "cmap.h"
+#include "cmap_file.h"
+#include "pdf_extractor.h"
+
+//process-wide cache of compiled cmaps shared by all documents. Cmaps are keyed by parser and hash of decoded stream,
+//least recently used ones are evicted when held bytes exceed the limit. Cache is disabled while limit is 0.
+//Cmaps missing in memory are looked up in mapped file of cmaps saved by this or other process before they are parsed
+class CmapCache
+{
+public:
+    enum cmap_type_t { TO_UNICODE, FONT_FILE, FONT_FILE2 };
+
+    static CmapCache& get_instance();
+    void set_limit(size_t limit_arg);
+    pdf_extractor_cache_stats_t get_stats() const;
+    //returns cached cmap or parses stream and caches the result
+    std::shared_ptr<const cmap_t> get_cmap(cmap_type_t type, std::string &&stream);
+    //maps file of cmaps instead of the previous one. Returns false if file doesn't exist or can't be used
+    bool load_file(const std::string &path);
+    //writes cmaps of memory and of mapped file, the most recently used ones first, while file fits max_bytes
+    void save_file(const std::string &path, size_t max_bytes) const;
+private:
+    struct key_hash_t
+    {
+        size_t operator()(const cmap_key_t &key) const
+        {
+            return key.hash1;
+        }
+    };
+    struct entry_t
+    {
+        std::shared_ptr<const cmap_t> cmap;
+        size_t size;
+        std::list<cmap_key_t>::iterator lru_it;
+    };
+
+    CmapCache();
+    void evict();
+
+    mutable std::mutex cache_mutex;
+    size_t limit;
+    size_t bytes;
+    size_t hits;
+    size_t misses;
+    size_t file_hits;
+    std::shared_ptr<const CmapFile> file;
+    //most recently used key first
+    std::list<cmap_key_t> lru;
+    std::unordered_map<cmap_key_t, entry_t, key_hash_t> entries;
+};
+
+#endif //CMAP_CACHE_H
@@ -0,0 +1,203 @@
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <fstream>
+#include <atomic>
+#include <mutex>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "cmap_file.h"
+#include "cmap.h"
+#include "common.h"
+
+#ifndef LIB_VERSION_STRING
+#define LIB_VERSION_STRING "unknown"
+#endif
+
+using namespace std;
+
+namespace
+{
+    const char MAGIC[8] = {'P', 'D', 'F', 'X', 'C', 'M', 'A', 'P'};
+    //must be increased when image of cmap_t or layout of file is changed
+    enum : uint32_t { FORMAT_VERSION = 1, BYTE_ORDER_MARK = 0x01020304 };
+    const char LIBRARY_VERSION[16] = LIB_VERSION_STRING;
+
+    atomic<unsigned int> temp_files_num(0);
+
+    uint64_t mix(uint64_t h, uint64_t val, uint64_t multiplier)
+    {
+        h = (h ^ val) * multiplier;
+        return h ^ (h >> 29);
+    }
+}
+
+pair<uint64_t, uint64_t> get_hash(const char *data, size_t length)
+{
+    enum : uint64_t { MULTIPLIER1 = 0x9E3779B97F4A7C15ULL, MULTIPLIER2 = 0xC2B2AE3D27D4EB4FULL };
+    uint64_t h1 = length;
+    uint64_t h2 = ~h1;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t))
+    {
+        uint64_t val;
+        memcpy(&val, data + i, sizeof(val));
+        h1 = mix(h1, val, MULTIPLIER1);
+        h2 = mix(h2, val, MULTIPLIER2);
+    }
+    uint64_t tail = 0;
+    memcpy(&tail, data + i, length - i);
+    return make_pair(mix(h1, tail, MULTIPLIER1), mix(h2, tail, MULTIPLIER2));
+}
+
+CmapFile::CmapFile(const string &path) : size(0), entries(nullptr), entries_num(0)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw pdf_error(FUNC_STRING + "can't open " + path);
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(file_header_t))
+    {
+        close(fd);
+        throw pdf_error(FUNC_STRING + "wrong size of " + path);
+    }
+    size = st.st_size;
+    void *p = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) throw pdf_error(FUNC_STRING + "can't map " + path);
+    const size_t mapped_size = size;
+    data = shared_ptr<const char>(static_cast<const char*>(p),
+                                  [mapped_size](const char *p) { munmap(const_cast<char*>(p), mapped_size); });
+    file_header_t header;
+    memcpy(&header, data.get(), sizeof(header));
+    if (memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.byte_order != BYTE_ORDER_MARK ||
+        header.format_version != FORMAT_VERSION ||
+        memcmp(header.library_version, LIBRARY_VERSION, sizeof(LIBRARY_VERSION)) != 0)
+    {
+        throw pdf_error(FUNC_STRING + path + " is written by other version");
+    }
+    if (header.file_size != size || header.entries_num > (size - sizeof(header)) / sizeof(entry_t))
+    {
+        throw pdf_error(FUNC_STRING + path + " is damaged");
+    }
+    entries = reinterpret_cast<const entry_t*>(data.get() + sizeof(header));
+    entries_num = header.entries_num;
+    cmaps.resize(entries_num);
+    is_checked.resize(entries_num, false);
+}
+
+shared_ptr<const cmap_t> CmapFile::find(const cmap_key_t &key) const
+{
+    auto get_key = [](const entry_t &entry) { return cmap_key_t{entry.hash1, entry.hash2, entry.length, entry.type}; };
+    const entry_t *it = lower_bound(entries, entries + entries_num, key,
+                                    [&](const entry_t &entry, const cmap_key_t &val) { return get_key(entry) < val; });
+    if (it == entries + entries_num || !(get_key(*it) == key)) return nullptr;
+    const size_t i = it - entries;
+    lock_guard<mutex> lock(cmaps_mutex);
+    if (!is_checked[i])
+    {
+        cmaps[i] = get_cmap(*it);
+        is_checked[i] = true;
+    }
+    return cmaps[i];
+}
+
+shared_ptr<const cmap_t> CmapFile::get_cmap(const entry_t &entry) const
+{
+    const size_t images_offset = sizeof(file_header_t) + entries_num * sizeof(entry_t);
+    if (entry.offset < images_offset || entry.offset > size || entry.size > size - entry.offset) return nullptr;
+    if (get_hash(data.get() + entry.offset, entry.size).first != entry.checksum) return nullptr;
+    try
+    {
+        return make_shared<const cmap_t>(data.get() + entry.offset, entry.size, shared_ptr<const void>(data));
+    }
+    catch (const pdf_error&)
+    {
+        return nullptr;
+    }
+}
+
+vector<cmap_key_t> CmapFile::get_keys() const
+{
+    vector<const entry_t*> sorted;
+    sorted.reserve(entries_num);
+    for (size_t i = 0; i < entries_num; ++i) sorted.push_back(&entries[i]);
+    sort(sorted.begin(), sorted.end(), [](const entry_t *e1, const entry_t *e2) { return e1->rank < e2->rank; });
+    vector<cmap_key_t> result;
+    result.reserve(entries_num);
+    for (const entry_t *entry : sorted)
+    {
+        result.push_back(cmap_key_t{entry->hash1, entry->hash2, entry->length, entry->type});
+    }
+    return result;
+}
+
+size_t CmapFile::get_entries_num() const
+{
+    return entries_num;
+}
+
+void CmapFile::write(const string &path, const vector<pair<cmap_key_t, shared_ptr<const cmap_t>>> &cmaps,
+                     size_t max_bytes)
+{
+    vector<entry_t> new_entries;
+    vector<pair<const char*, size_t>> images;
+    size_t file_size = sizeof(file_header_t);
+    for (const pair<cmap_key_t, shared_ptr<const cmap_t>> &p : cmaps)
+    {
+        pair<const char*, size_t> image = p.second->get_image();
+        if (file_size + sizeof(entry_t) + image.second > max_bytes) continue;
+        file_size += sizeof(entry_t) + image.second;
+        const cmap_key_t &key = p.first;
+        new_entries.push_back(entry_t{key.hash1, key.hash2, key.length, key.type,
+                                      static_cast<uint32_t>(new_entries.size()), 0, image.second,
+                                      get_hash(image.first, image.second).first});
+        images.push_back(image);
+    }
+    //images are 8 bytes aligned, they are written in order of use
+    size_t offset = sizeof(file_header_t) + new_entries.size() * sizeof(entry_t);
+    for (entry_t &entry : new_entries)
+    {
+        entry.offset = offset;
+        offset += entry.size;
+    }
+    file_header_t header;
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.format_version = FORMAT_VERSION;
+    header.byte_order = BYTE_ORDER_MARK;
+    memcpy(header.library_version, LIBRARY_VERSION, sizeof(LIBRARY_VERSION));
+    header.entries_num = new_entries.size();
+    header.file_size = file_size;
+    vector<entry_t> sorted = new_entries;
+    sort(sorted.begin(), sorted.end(), [](const entry_t &e1, const entry_t &e2)
+    {
+        return cmap_key_t{e1.hash1, e1.hash2, e1.length, e1.type} < cmap_key_t{e2.hash1, e2.hash2, e2.length, e2.type};
+    });
+
+    const string temp_path = path + ".tmp" + to_string(getpid()) + '_' + to_string(temp_files_num++);
+    {
+        ofstream out(temp_path, ios::binary | ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(sorted.data()), sorted.size() * sizeof(entry_t));
+        for (const pair<const char*, size_t> &image : images) out.write(image.first, image.second);
+        out.close();
+        if (!out)
+        {
+            remove(temp_path.c_str());
+            throw pdf_error(FUNC_STRING + "can't write " + temp_path);
+        }
+    }
+    if (rename(temp_path.c_str(), path.c_str()) != 0)
+    {
+        remove(temp_path.c_str());
+        throw pdf_error(FUNC_STRING + "can't rename " + temp_path + " to " + path);
+    }
+}
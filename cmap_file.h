@@ -0,0 +1,91 @@
+#ifndef CMAP_FILE_H
+#define CMAP_FILE_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <mutex>
+#include <cstdint>
+
+#include "cmap.h"
+
+//key of compiled cmap: parser and hashes of decoded stream
+struct cmap_key_t
+{
+    bool operator==(const cmap_key_t &key) const
+    {
+        return hash1 == key.hash1 && hash2 == key.hash2 && length == key.length && type == key.type;
+    }
+    bool operator<(const cmap_key_t &key) const
+    {
+        if (hash1 != key.hash1) return hash1 < key.hash1;
+        if (hash2 != key.hash2) return hash2 < key.hash2;
+        if (length != key.length) return length < key.length;
+        return type < key.type;
+    }
+    uint64_t hash1;
+    uint64_t hash2;
+    uint64_t length;
+    uint32_t type;
+};
+
+//two independent 64 bit hashes of data, 8 bytes at a time
+std::pair<uint64_t, uint64_t> get_hash(const char *data, size_t length);
+
+//file of compiled cmaps shared by processes. File is mapped read-only, cmaps are found by binary search of key
+//and used in place, so nothing is parsed or copied. Image of entry is checked once, on its first lookup, and cmap over
+//it is kept while file is mapped. File written by other version of library is not used
+class CmapFile
+{
+public:
+    //throws pdf_error if file can't be mapped, is damaged or was written by other version of library
+    explicit CmapFile(const std::string &path);
+    //returns cmap over mapped image or nullptr if there is no such key or image is damaged. Thread safe
+    std::shared_ptr<const cmap_t> find(const cmap_key_t &key) const;
+    //keys of file, the most recently used ones first
+    std::vector<cmap_key_t> get_keys() const;
+    size_t get_entries_num() const;
+    //writes cmaps in given order until file reaches max_bytes, cmaps which don't fit are skipped.
+    //File is written next to path and renamed, so processes which mapped old file keep using it
+    static void write(const std::string &path,
+                      const std::vector<std::pair<cmap_key_t, std::shared_ptr<const cmap_t>>> &cmaps,
+                      size_t max_bytes);
+private:
+    struct file_header_t
+    {
+        char magic[8];
+        uint32_t format_version;
+        uint32_t byte_order;
+        char library_version[16];
+        uint64_t entries_num;
+        uint64_t file_size;
+    };
+    //entries are sorted by key, images follow them
+    struct entry_t
+    {
+        uint64_t hash1;
+        uint64_t hash2;
+        uint64_t length;
+        uint32_t type;
+        //0 for the most recently used cmap at time of writing
+        uint32_t rank;
+        uint64_t offset;
+        uint64_t size;
+        //hash of image, damaged image is parsed again
+        uint64_t checksum;
+    };
+
+    std::shared_ptr<const cmap_t> get_cmap(const entry_t &entry) const;
+
+    std::shared_ptr<const char> data;
+    size_t size;
+    const entry_t *entries;
+    size_t entries_num;
+    mutable std::mutex cmaps_mutex;
+    //cmaps of entries in order of entries, they are set on the first lookup. Damaged entry stays nullptr
+    mutable std::vector<std::shared_ptr<const cmap_t>> cmaps;
+    mutable std::vector<bool> is_checked;
+};
+
+#endif //CMAP_FILE_H
@@ -746,14 +746,6 @@ float get_dict_val(const dict_t &dict, const string &key, float def)
     return (it == dict.end())? def : stof(it->second.first);
 }
 
-size_t utf8_length(const string &s)
-{
-    size_t len = 0;
-    //Count all first-bytes (the ones that don't match 10xxxxxx).
-    for (char c : s) len += (c & 0xc0) != 0x80;
-    return len;
-}
-
 matrix_t operator*(const matrix_t &m1, const matrix_t &m2)
 {
     return matrix_t{m2[0] * m1[0] + m2[2] * m1[1],
@@ -83,7 +83,6 @@ array_t get_array_data(const std::string &buffer, size_t offset);
 std::pair<float, float> apply_matrix_norm(const matrix_t &matrix, float x, float y);
 unsigned int get_dict_val(const dict_t &dict, const std::string &key, unsigned int def);
 float get_dict_val(const dict_t &dict, const std::string &key, float def);
-size_t utf8_length(const std::string &s);
 size_t get_nearest_regex(const std::string &buffer, const char *regex, const char *regex_reverse, size_t pos);
 std::pair<size_t, size_t> get_both_regex(const std::string &buffer, const char *regex, const char *regex_reverse, size_t pos);
 matrix_t operator*(const matrix_t &m1, const matrix_t &m2);
@@ -138,13 +137,13 @@ template <class T> T pop(std::vector<T> &st)
 }
 
 template <class T1, class T2>
-int binary_search(const std::vector<std::pair<T1, T2>> *arr, int l, int r, const T1 &x)
+int binary_search(const std::pair<T1, T2> *arr, int l, int r, const T1 &x)
 {
     while (l <= r)
     {
         int m = l + (r - l) / 2;
-        if ((*arr)[m].first == x) return m;
-        if ((*arr)[m].first < x) l = m + 1;
+        if (arr[m].first == x) return m;
+        if (arr[m].first < x) l = m + 1;
         else r = m - 1;
     }
     return -1;
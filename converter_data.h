@@ -2,16 +2,28 @@
 #define CONVERTER_DATA_H
 
 #include <string>
-#include <unordered_map>
-#include <map>
-
-enum PDFEncode_t {DEFAULT, MAC_EXPERT, MAC_ROMAN, WIN, IDENTITY, OTHER, UTF8, NONE};
-extern const std::unordered_map<unsigned int, std::string> standard_encoding;
-extern const std::unordered_map<unsigned int, std::string> mac_roman_encoding;
-extern const std::unordered_map<unsigned int, std::string> mac_expert_encoding;
-extern const std::unordered_map<unsigned int, std::string> win_ansi_encoding;
-extern const std::unordered_map<std::string, const char*> encoding2charset;
-extern const std::map<PDFEncode_t, const std::unordered_map<unsigned int, std::string>&> standard_encodings;
+#include <array>
+
+#include <stdint.h>
+
+enum PDFEncode_t {DEFAULT, MAC_EXPERT, MAC_ROMAN, WIN, IDENTITY, OTHER, UTF8, UTF16BE, UTF32BE, CJK, NONE};
+enum { CODES_NUM = 256, STANDARD_ENCODINGS_NUM = WIN + 1 };
+
+//utf8 symbol for one byte code, stored in symbols blob
+struct symbol_t
+{
+    enum : uint8_t { NO_SYMBOL = 0xFF /* code is not mapped */ };
+    uint16_t offset;
+    uint8_t length;
+};
+
+using encoding_table_t = std::array<symbol_t, CODES_NUM>;
+
+//charset of predefined CMap, nullptr for utf8. Returns false if encoding is not predefined
+bool get_predefined_charset(const std::string &encoding, const char *&charset);
+//symbols blob and tables for DEFAULT, MAC_EXPERT, MAC_ROMAN and WIN encodings
+extern const char standard_symbols[];
+extern const std::array<encoding_table_t, STANDARD_ENCODINGS_NUM> standard_encodings;
 
 
 #endif //CONVERTER_DATA_H
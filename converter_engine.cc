@@ -2,12 +2,13 @@
 #include <string>
 #include <vector>
 
-#include <boost/optional.hpp>
-
 #include "converter_engine.h"
 #include "coordinates.h"
 #include "fonts.h"
 #include "common.h"
+#include "cmap.h"
+#include "converter_data.h"
+#include "utf.h"
 
 using namespace std;
 
@@ -16,52 +17,140 @@ ConverterEngine::ConverterEngine(CharsetConverter &&charset_converter_arg,
                                  ToUnicodeConverter &&to_unicode_converter_arg) :
     charset_converter(std::move(charset_converter_arg)),
     diff_converter(std::move(diff_converter_arg)),
-    to_unicode_converter(std::move(to_unicode_converter_arg))
+    to_unicode_converter(std::move(to_unicode_converter_arg)),
+    vertical(charset_converter.is_vertical() || (!to_unicode_converter.is_empty() && to_unicode_converter.is_vertical())),
+    decoder(get_decoder())
 {
 }
 
-bool ConverterEngine::is_vertical() const
+ConverterEngine::ConverterEngine() : ConverterEngine(CharsetConverter(), DiffConverter(), ToUnicodeConverter())
 {
-    if (charset_converter.is_vertical()) return true;
-    if (to_unicode_converter.is_empty()) return false;
-    return to_unicode_converter.is_vertical();
 }
 
-text_chunk_t ConverterEngine::get_string(const string &s, Coordinates &coordinates, float Tj, const Fonts &fonts) const
+ConverterEngine::decoder_t ConverterEngine::get_decoder() const
 {
+    const bool diff = !diff_converter.is_empty();
     if (to_unicode_converter.is_empty())
     {
-        pair<string, float> p = diff_converter.is_empty()? charset_converter.get_string(s, fonts) :
-                                                           diff_converter.get_string(s, fonts);
-        return coordinates.adjust_coordinates(std::move(p.first), s.length(), p.second, Tj, fonts);
+        if (diff) return &decode_table<true>;
+        return charset_converter.is_simple()? &decode_table<false> : &decode_charset;
+    }
+    const vector<unsigned char> &sizes = to_unicode_converter.get_cmap().sizes;
+    switch ((sizes.size() == 1)? sizes[0] : 0)
+    {
+    case 1:
+        return diff? &decode_to_unicode<true, 1> : &decode_to_unicode<false, 1>;
+    case 2:
+        return diff? &decode_to_unicode<true, 2> : &decode_to_unicode<false, 2>;
+    default:
+        return diff? &decode_to_unicode<true, 0> : &decode_to_unicode<false, 0>;
+    }
+}
 
+//Differences skip unmapped and empty symbols and count only widths of decoded symbols,
+//standard encodings count widths of all codes
+template <bool DIFF> float ConverterEngine::decode_table(const ConverterEngine &engine,
+                                                         const string &s,
+                                                         const Fonts &fonts,
+                                                         string &decoded,
+                                                         size_t &len)
+{
+    const encoding_table_t &table = DIFF? engine.diff_converter.get_char_table() :
+                                          engine.charset_converter.get_char_table();
+    const char *symbols = DIFF? engine.diff_converter.get_symbols() : engine.charset_converter.get_symbols();
+    decoded.reserve(s.length());
+    float width = 0;
+    for (char c : s)
+    {
+        const symbol_t &symbol = table[static_cast<unsigned char>(c)];
+        if (symbol.length == symbol_t::NO_SYMBOL || (DIFF && symbol.length == 0)) continue;
+        decoded.append(symbols + symbol.offset, symbol.length);
+        if (DIFF) width += fonts.get_width(static_cast<unsigned char>(c));
     }
-    string decoded;
-    float decoded_width = 0;
-    size_t len = 0;
+    len = s.length();
+    return DIFF? width : fonts.get_width(s);
+}
+
+float ConverterEngine::decode_charset(const ConverterEngine &engine,
+                                      const string &s,
+                                      const Fonts &fonts,
+                                      string &decoded,
+                                      size_t &len)
+{
+    pair<string, float> p = engine.charset_converter.get_string(s, fonts);
+    decoded = std::move(p.first);
+    len = s.length();
+    return p.second;
+}
+
+//codes which are not mapped or mapped to empty string are decoded by Differences or base encoding byte by byte
+template <bool DIFF, unsigned char CODE_LENGTH> float ConverterEngine::decode_to_unicode(const ConverterEngine &engine,
+                                                                                         const string &s,
+                                                                                         const Fonts &fonts,
+                                                                                         string &decoded,
+                                                                                         size_t &len)
+{
+    const cmap_t &cmap = engine.to_unicode_converter.get_cmap();
+    const encoding_table_t &table = DIFF? engine.diff_converter.get_char_table() :
+                                          engine.charset_converter.get_char_table();
+    const char *symbols = DIFF? engine.diff_converter.get_symbols() : engine.charset_converter.get_symbols();
+    float width = 0;
+    len = 0;
+    cmap_t::symbol_t symbol;
     for (size_t i = 0; i < s.length();)
     {
-        pair<string, float> decoded_symbol = to_unicode_converter.custom_decode_symbol(s, i, fonts);
-        if (decoded_symbol.first.empty())
+        bool found;
+        if (CODE_LENGTH == 0)
         {
-            boost::optional<string> c = (diff_converter.is_empty())? charset_converter.get_char(s[i]) :
-                                                                     diff_converter.get_char(s[i]);
-            if (c)
+            found = cmap.find(s, i, symbol);
+        }
+        else
+        {
+            found = s.length() - i >= CODE_LENGTH;
+            if (found)
             {
-                decoded += *c;
-                decoded_width += fonts.get_width(static_cast<unsigned char>(s[i]));
-                ++len;
+                unsigned int code = static_cast<unsigned char>(s[i]);
+                if (CODE_LENGTH == 2) code = (code << 8) | static_cast<unsigned char>(s[i + 1]);
+                found = cmap.find(code, CODE_LENGTH, symbol);
             }
-            ++i;
         }
-        else
+        if (found)
         {
-            decoded_width += decoded_symbol.second;
-            len += utf8_length(decoded_symbol.first);
-            decoded += std::move(decoded_symbol.first);
+            i += symbol.code_length;
+            if (symbol.length != 0 || symbol.last_char != cmap_t::NO_CHAR)
+            {
+                decoded.append(symbol.utf8, symbol.length);
+                if (symbol.last_char != cmap_t::NO_CHAR) append_utf8(decoded, symbol.last_char);
+                width += fonts.get_width(symbol.code);
+                len += symbol.utf8_length;
+                continue;
+            }
         }
+        //after code mapped to empty string i can reach s.length(), then s[i] is '\0'
+        const unsigned char c = s[i];
+        const symbol_t &fallback = table[c];
+        if (fallback.length != symbol_t::NO_SYMBOL)
+        {
+            decoded.append(symbols + fallback.offset, fallback.length);
+            width += fonts.get_width(c);
+            ++len;
+        }
+        ++i;
     }
-    return coordinates.adjust_coordinates(std::move(decoded), len, decoded_width, Tj, fonts);
+    return width;
+}
+
+bool ConverterEngine::is_vertical() const
+{
+    return vertical;
+}
+
+text_chunk_t ConverterEngine::get_string(const string &s, Coordinates &coordinates, float Tj, const Fonts &fonts) const
+{
+    string decoded;
+    size_t len = 0;
+    float width = decoder(*this, s, fonts, decoded, len);
+    return coordinates.adjust_coordinates(std::move(decoded), len, width, Tj, fonts);
 }
 
 vector<text_chunk_t> ConverterEngine::get_strings_from_array(const string &array,
@@ -15,7 +15,7 @@ public:
     ConverterEngine(CharsetConverter &&charset_converter_arg,
                     DiffConverter &&diff_converter_arg,
                     ToUnicodeConverter &&to_unicode_converter_arg);
-    ConverterEngine() = default;
+    ConverterEngine();
     bool is_vertical() const;
     text_chunk_t get_string(const std::string &s, Coordinates &coordinates, float Tj, const Fonts &fonts) const;
     std::vector<text_chunk_t> get_strings_from_array(const std::string &array,
@@ -23,9 +23,36 @@ public:
                                                      const Fonts &fonts) const;
 
 private:
+    //decodes string to utf8, returns its width and sets number of decoded symbols
+    using decoder_t = float (*)(const ConverterEngine &engine,
+                                const std::string &s,
+                                const Fonts &fonts,
+                                std::string &decoded,
+                                size_t &len);
+    decoder_t get_decoder() const;
+    template <bool DIFF> static float decode_table(const ConverterEngine &engine,
+                                                   const std::string &s,
+                                                   const Fonts &fonts,
+                                                   std::string &decoded,
+                                                   size_t &len);
+    static float decode_charset(const ConverterEngine &engine,
+                                const std::string &s,
+                                const Fonts &fonts,
+                                std::string &decoded,
+                                size_t &len);
+    //CODE_LENGTH is 0 if cmap has codes of different lengths
+    template <bool DIFF, unsigned char CODE_LENGTH> static float decode_to_unicode(const ConverterEngine &engine,
+                                                                                  const std::string &s,
+                                                                                  const Fonts &fonts,
+                                                                                  std::string &decoded,
+                                                                                  size_t &len);
+
     const CharsetConverter charset_converter;
     const DiffConverter diff_converter;
     const ToUnicodeConverter to_unicode_converter;
+    //decoder and flags are chosen once per font
+    bool vertical;
+    decoder_t decoder;
 };
 
 #endif //CONVERTER_ENGINE_H
@@ -6,6 +6,7 @@
 #include <utility>
 
 #include "common.h"
+#include "utf.h"
 #include "fonts.h"
 
 struct coordinates_t
@@ -31,42 +32,26 @@ struct coordinates_t
     float y1;
 };
 
-struct text_t
+//string shown by one operator: its box and number of characters
+struct run_t
 {
-    text_t(std::string &&text_arg, const coordinates_t &coordinates_arg) noexcept :
-           coordinates(coordinates_arg), text(std::move(text_arg))
-    {
-    }
-
-    explicit text_t(const coordinates_t &coordinates_arg) : coordinates(coordinates_arg)
-    {
-    }
-
-    bool operator==(const text_t &obj) const
-    {
-        if (!(coordinates == obj.coordinates)) return false;
-        return text == obj.text;
-    }
-
-    text_t& operator=(text_t &&arg) = default;
-    text_t& operator=(const text_t &arg) = default;
-    text_t(text_t &&arg) = default;
-    text_t(const text_t &arg) = default;
-
     coordinates_t coordinates;
-    std::string text;
+    size_t string_len;
 };
 
+//runs following each other on one line. Layout compares neighbour chunks by their first and last runs
 struct text_chunk_t
 {
-    text_chunk_t() : is_empty(true)
+    text_chunk_t() : string_len(0), is_empty(true)
     {
     }
 
     text_chunk_t(std::string &&text_arg, coordinates_t &&coordinates_arg) :
                  coordinates(std::move(coordinates_arg)),
-                 texts{text_t(std::move(text_arg), coordinates)},
-                 string_len(utf8_length(texts[0].text)),
+                 text(std::move(text_arg)),
+                 string_len(utf8_length(text)),
+                 first_run{coordinates, string_len},
+                 last_run(first_run),
                  is_empty(false)
     {
     }
@@ -79,8 +64,10 @@ struct text_chunk_t
     text_chunk_t& operator=(text_chunk_t &&arg)
     {
         coordinates = std::move(arg.coordinates);
-        texts = std::move(arg.texts);
+        text = std::move(arg.text);
         string_len = arg.string_len;
+        first_run = arg.first_run;
+        last_run = arg.last_run;
         is_empty = arg.is_empty;
         arg.is_empty = true;
         return *this;
@@ -90,8 +77,10 @@ struct text_chunk_t
 
     text_chunk_t(text_chunk_t &&arg) :
                  coordinates(std::move(arg.coordinates)),
-                 texts(std::move(arg.texts)),
+                 text(std::move(arg.text)),
                  string_len(arg.string_len),
+                 first_run(arg.first_run),
+                 last_run(arg.last_run),
                  is_empty(arg.is_empty)
     {
         arg.is_empty = true;
@@ -106,8 +95,11 @@ struct text_chunk_t
     }
 
     coordinates_t coordinates;
-    std::vector<text_t> texts;
+    //text of runs, words are separated by space
+    std::string text;
     size_t string_len;
+    run_t first_run;
+    run_t last_run;
     bool is_empty;
 };
 
@@ -1,15 +1,14 @@
-#include <unordered_map>
 #include <string>
 #include <utility>
 #include <algorithm>
-
-#include <boost/optional.hpp>
+#include <array>
 
 #include "diff_converter.h"
 #include "common.h"
 #include "object_storage.h"
 #include "fonts.h"
 #include "converter_data.h"
+#include "glyph_names.h"
 
 using namespace std;
 namespace
@@ -28,10 +27,18 @@ DiffConverter::DiffConverter() noexcept : empty(true)
 {
 }
 
-DiffConverter::DiffConverter(unordered_map<unsigned int, string> &&difference_map_arg):
-                             difference_map(std::move(difference_map_arg)),
-                             empty(false)
+DiffConverter::DiffConverter(const array<pair<const char*, size_t>, CODES_NUM> &code2symbol) : empty(false)
 {
+    for (size_t i = 0; i < code2symbol.size(); ++i)
+    {
+        if (!code2symbol[i].first)
+        {
+            codes[i] = symbol_t{0, symbol_t::NO_SYMBOL};
+            continue;
+        }
+        codes[i] = symbol_t{static_cast<uint16_t>(symbols.length()), static_cast<uint8_t>(code2symbol[i].second)};
+        symbols.append(code2symbol[i].first, code2symbol[i].second);
+    }
 }
 
 DiffConverter DiffConverter::get_converter(const dict_t &dictionary,
@@ -43,12 +50,19 @@ DiffConverter DiffConverter::get_converter(const dict_t &dictionary,
 
     const array_t array_data = get_array_or_indirect_array(differences, storage);
 
-    unordered_map<unsigned int, string> code2symbol = standard_encodings.at(encoding);
+    array<pair<const char*, size_t>, CODES_NUM> code2symbol;
+    const encoding_table_t &base_encoding = standard_encodings[encoding];
+    for (size_t i = 0; i < code2symbol.size(); ++i)
+    {
+        const symbol_t &symbol = base_encoding[i];
+        if (symbol.length == symbol_t::NO_SYMBOL) code2symbol[i] = make_pair(nullptr, 0);
+        else code2symbol[i] = make_pair(standard_symbols + symbol.offset, symbol.length);
+    }
 
     auto start_it = find_if(array_data.begin(),
                             array_data.end(),
                             [](const pair<string, pdf_object_t> &p) { return (p.second == VALUE)? true : false;});
-    if (start_it == array_data.end()) return DiffConverter(std::move(code2symbol));
+    if (start_it == array_data.end()) return DiffConverter(code2symbol);
     unsigned int code = strict_stoul(start_it->first);
 
     for (auto it = start_it; it != array_data.end(); ++it)
@@ -62,8 +76,8 @@ DiffConverter DiffConverter::get_converter(const dict_t &dictionary,
             break;
         case NAME_OBJECT:
         {
-            auto it = symbol_table.find(symbol.first);
-            if (it != symbol_table.end()) code2symbol[code] = it->second;
+            pair<const char*, size_t> glyph = get_glyph_symbol(symbol.first);
+            if (glyph.first && code < CODES_NUM) code2symbol[code] = glyph;
             ++code;
             break;
         }
@@ -72,7 +86,7 @@ DiffConverter DiffConverter::get_converter(const dict_t &dictionary,
         }
 
     }
-    return DiffConverter(std::move(code2symbol));
+    return DiffConverter(code2symbol);
 }
 
 pair<string, float> DiffConverter::get_string(const string &s, const Fonts &fonts) const
@@ -82,28 +96,27 @@ pair<string, float> DiffConverter::get_string(const string &s, const Fonts &font
         float width = 0;
         for (char c : s)
         {
-            auto it = difference_map.find(static_cast<unsigned char>(c));
-            if (it != difference_map.end() && !it->second.empty())
+            const symbol_t &symbol = codes[static_cast<unsigned char>(c)];
+            if (symbol.length != symbol_t::NO_SYMBOL && symbol.length != 0)
             {
-                str.append(it->second);
+                str.append(symbols, symbol.offset, symbol.length);
                 width += fonts.get_width(static_cast<unsigned char>(c));
             }
         }
         return make_pair(std::move(str), width);
 }
 
-boost::optional<string> DiffConverter::get_char(char c) const
+const encoding_table_t& DiffConverter::get_char_table() const
 {
-    auto it = difference_map.find(static_cast<unsigned char>(c));
-    if (it != difference_map.end()) return it->second;
-    return boost::none;
+    return codes;
+}
+
+const char* DiffConverter::get_symbols() const
+{
+    return symbols.data();
 }
 
 bool DiffConverter::is_empty() const
 {
     return empty;
 }
-
-const std::unordered_map<string, string> DiffConverter::symbol_table = {
-    #include "symbol_table.h"
-};
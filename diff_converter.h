@@ -1,31 +1,33 @@
 #ifndef DIFF_CONVERTER
 #define DIFF_CONVERTER
 
-#include <unordered_map>
 #include <string>
 #include <utility>
-
-#include <boost/optional.hpp>
+#include <array>
 
 #include "fonts.h"
 #include "object_storage.h"
 #include "common.h"
+#include "converter_data.h"
 
 class DiffConverter
 {
 public:
     DiffConverter() noexcept;
-    explicit DiffConverter(std::unordered_map<unsigned int, std::string> &&difference_map_arg);
-    boost::optional<std::string> get_char(char c) const;
+    //code2symbol: utf8 symbol and its length for every code, nullptr if code is not mapped
+    explicit DiffConverter(const std::array<std::pair<const char*, size_t>, CODES_NUM> &code2symbol);
+    //table and symbols for single codes
+    const encoding_table_t& get_char_table() const;
+    const char* get_symbols() const;
     std::pair<std::string, float> get_string(const std::string &s, const Fonts &fonts) const;
     bool is_empty() const;
     static DiffConverter get_converter(const dict_t &dictionary,
                                        const std::pair<std::string, pdf_object_t> &differences,
                                        const ObjectStorage &storage);
 private:
-    const std::unordered_map<unsigned int, std::string> difference_map;
+    std::string symbols;
+    encoding_table_t codes;
     bool empty;
-    static const std::unordered_map<std::string, std::string> symbol_table;
 };
 
 #endif //DIFF_CONVERTER
@@ -0,0 +1,165 @@
+//generated by gen_encoding_tables.pl
+constexpr char standard_symbols[] =
+    " !\042#$%\342\200\231()*+,-./0123456789:;<=>"
+    "\077@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\134]^"
+    "_\342\200\230abcdefghijklmnopqrstuvwxyz{|"
+    "}~\302\241\302\242\302\243\342\201\204\302\245\306\222\302\247\302\244'\342\200\234\302\253\342\200\271\342\200\272\357"
+    "\254\201\357\254\202\342\200\223\342\200\240\342\200\241\302\267\302\266\342\200\242\342\200\232\342\200\236\342\200\235\302\273"
+    "\342\200\246\342\200\260\302\277`\302\264\313\206\313\234\302\257\313\230\313\231\302\250\313\232\302\270\313\235\313\233\313"
+    "\207\342\200\224\303\206\302\252\305\201\303\230\305\222\302\272\303\246\304\261\305\202\303\270\305\223\303\237\357\234\241\357"
+    "\233\270\357\236\242\357\234\244\357\233\244\357\234\246\357\237\241\342\201\275\342\201\276..\357\233\236\357\234\277\357"
+    "\237\260\302\274\302\275\302\276\342\205\233\342\205\234\342\205\235\342\205\236\342\205\223\342\205\224fffifl"
+    "ffiffl\342\202\215\342\202\216\357\233\266\357\233\245\357\235\240\342\202\241\357\233\234\357\233\235\357\233"
+    "\276\357\233\251\357\233\240\357\237\240\357\237\242\357\237\244\357\237\243\357\237\245\357\237\247\357\237\251\357\237\250\357"
+    "\237\252\357\237\253\357\237\255\357\237\254\357\237\256\357\237\257\357\237\261\357\237\263\357\237\262\357\237\264\357\237\266"
+    "\357\237\265\357\237\272\357\237\271\357\237\273\357\237\274\342\201\270\342\202\204\342\202\203\342\202\206\342\202\210\342\201"
+    "\267\357\233\275\357\233\237\357\236\250\357\233\265\357\233\260\342\202\205\357\233\241\357\233\247\357\237\275\357\233\243\357"
+    "\237\276\342\202\211\342\202\200\357\233\277\357\237\246\357\237\270\357\236\277\342\202\201\357\233\271\357\236\270\357\233\272"
+    "\342\200\222\357\233\246\357\236\241\357\237\277\357\233\254\357\233\261\357\233\263\357\233\255\357\233\262\357\233\253\357\233"
+    "\256\357\233\273\357\233\264\357\236\257\357\233\252\342\201\277\357\233\257\357\233\242\357\233\250\357\233\267\357\233\274&"
+    "\303\204\303\205\303\207\303\211\303\221\303\226\303\234\303\241\303\240\303\242\303\244\303\243\303\245\303\247\303\251\303\250"
+    "\303\252\303\253\303\255\303\254\303\256\303\257\303\261\303\263\303\262\303\264\303\266\303\265\303\272\303\271\303\273\303\274"
+    "\302\260\302\256\302\251\342\204\242\342\211\240\342\210\236\302\261\342\211\244\342\211\245\302\265\342\210\202\342\210\221\342"
+    "\210\217\317\200\342\210\253\316\251\302\254\342\210\232\342\211\210\342\210\206\303\200\303\203\303\225\303\267\342\227\212\303"
+    "\277\305\270\342\202\254\302\271\303\202\303\212\303\201\303\213\303\210\303\215\303\216\303\217\303\214\303\223\303\224\357\243"
+    "\277\303\222\303\232\303\233\303\231\342\202\254\305\240\305\275\305\241\305\276\302\246\302\262\302\263\302\271\303\220\303\227"
+    "\303\235\303\236\303\260\303\275\303\276";
+
+constexpr std::array<encoding_table_t, STANDARD_ENCODINGS_NUM> standard_encodings = {{
+    //DEFAULT
+    {{
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, 1}, {1, 1}, {2, 1}, {3, 1}, {4, 1}, {5, 1}, {5, 1}, {6, 3}, 
+      {9, 1}, {10, 1}, {11, 1}, {12, 1}, {13, 1}, {14, 1}, {15, 1}, {16, 1}, 
+      {17, 1}, {18, 1}, {19, 1}, {20, 1}, {21, 1}, {22, 1}, {23, 1}, {24, 1}, 
+      {25, 1}, {26, 1}, {27, 1}, {28, 1}, {29, 1}, {30, 1}, {31, 1}, {32, 1}, 
+      {33, 1}, {34, 1}, {35, 1}, {36, 1}, {37, 1}, {38, 1}, {39, 1}, {40, 1}, 
+      {41, 1}, {42, 1}, {43, 1}, {44, 1}, {45, 1}, {46, 1}, {47, 1}, {48, 1}, 
+      {49, 1}, {50, 1}, {51, 1}, {52, 1}, {53, 1}, {54, 1}, {55, 1}, {56, 1}, 
+      {57, 1}, {58, 1}, {59, 1}, {60, 1}, {61, 1}, {62, 1}, {63, 1}, {64, 1}, 
+      {65, 3}, {68, 1}, {69, 1}, {70, 1}, {71, 1}, {72, 1}, {73, 1}, {74, 1}, 
+      {75, 1}, {76, 1}, {77, 1}, {78, 1}, {79, 1}, {80, 1}, {81, 1}, {82, 1}, 
+      {83, 1}, {84, 1}, {85, 1}, {86, 1}, {87, 1}, {88, 1}, {89, 1}, {90, 1}, 
+      {91, 1}, {92, 1}, {93, 1}, {94, 1}, {95, 1}, {96, 1}, {97, 1}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {98, 2}, {100, 2}, {102, 2}, {104, 3}, {107, 2}, {109, 2}, {111, 2}, 
+      {113, 2}, {115, 1}, {116, 3}, {119, 2}, {121, 3}, {124, 3}, {127, 3}, {130, 3}, 
+      {0, symbol_t::NO_SYMBOL}, {133, 3}, {136, 3}, {139, 3}, {142, 2}, {0, symbol_t::NO_SYMBOL}, {144, 2}, {146, 3}, 
+      {149, 3}, {152, 3}, {155, 3}, {158, 2}, {160, 3}, {163, 3}, {0, symbol_t::NO_SYMBOL}, {166, 2}, 
+      {0, symbol_t::NO_SYMBOL}, {168, 1}, {169, 2}, {171, 2}, {173, 2}, {175, 2}, {177, 2}, {179, 2}, 
+      {181, 2}, {0, symbol_t::NO_SYMBOL}, {183, 2}, {185, 2}, {0, symbol_t::NO_SYMBOL}, {187, 2}, {189, 2}, {191, 2}, 
+      {193, 3}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {196, 2}, {0, symbol_t::NO_SYMBOL}, {198, 2}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {200, 2}, {202, 2}, {204, 2}, {206, 2}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {208, 2}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {210, 2}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {212, 2}, {214, 2}, {216, 2}, {218, 2}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}}},
+    //MAC_EXPERT
+    {{
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, 1}, {220, 3}, {223, 3}, {226, 3}, {229, 3}, {232, 3}, {235, 3}, {238, 3}, 
+      {241, 3}, {244, 3}, {247, 2}, {15, 1}, {249, 0}, {14, 1}, {15, 1}, {104, 3}, 
+      {17, 1}, {18, 1}, {19, 1}, {20, 1}, {21, 1}, {22, 1}, {23, 1}, {24, 1}, 
+      {25, 1}, {26, 1}, {27, 1}, {28, 1}, {0, symbol_t::NO_SYMBOL}, {249, 3}, {0, symbol_t::NO_SYMBOL}, {252, 3}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {255, 3}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {258, 2}, 
+      {260, 2}, {262, 2}, {264, 3}, {267, 3}, {270, 3}, {273, 3}, {276, 3}, {279, 3}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {282, 2}, {284, 2}, 
+      {286, 2}, {288, 3}, {291, 3}, {294, 3}, {0, symbol_t::NO_SYMBOL}, {297, 3}, {300, 3}, {303, 3}, 
+      {306, 3}, {34, 1}, {35, 1}, {36, 1}, {37, 1}, {38, 1}, {39, 1}, {40, 1}, 
+      {41, 1}, {42, 1}, {43, 1}, {44, 1}, {45, 1}, {46, 1}, {47, 1}, {48, 1}, 
+      {49, 1}, {50, 1}, {51, 1}, {52, 1}, {53, 1}, {54, 1}, {55, 1}, {56, 1}, 
+      {57, 1}, {58, 1}, {59, 1}, {309, 3}, {312, 3}, {315, 3}, {318, 3}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {321, 3}, {324, 3}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {238, 3}, 
+      {327, 3}, {330, 3}, {333, 3}, {336, 3}, {339, 3}, {342, 3}, {345, 3}, {348, 3}, 
+      {351, 3}, {354, 3}, {357, 3}, {360, 3}, {363, 3}, {366, 3}, {369, 3}, {372, 3}, 
+      {375, 3}, {378, 3}, {381, 3}, {384, 3}, {387, 3}, {390, 3}, {393, 3}, {396, 3}, 
+      {0, symbol_t::NO_SYMBOL}, {399, 3}, {402, 3}, {405, 3}, {408, 3}, {411, 3}, {414, 3}, {417, 3}, 
+      {0, symbol_t::NO_SYMBOL}, {420, 3}, {405, 3}, {0, symbol_t::NO_SYMBOL}, {423, 3}, {0, symbol_t::NO_SYMBOL}, {426, 3}, {429, 3}, 
+      {432, 3}, {0, symbol_t::NO_SYMBOL}, {435, 3}, {438, 3}, {441, 3}, {0, symbol_t::NO_SYMBOL}, {444, 3}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {447, 3}, {0, symbol_t::NO_SYMBOL}, {450, 3}, {453, 3}, {456, 3}, {459, 3}, {462, 3}, 
+      {465, 3}, {468, 3}, {471, 3}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {474, 3}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {477, 3}, 
+      {480, 3}, {483, 3}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {486, 3}, {0, symbol_t::NO_SYMBOL}, 
+      {489, 3}, {0, symbol_t::NO_SYMBOL}, {18, 1}, {19, 1}, {20, 1}, {21, 1}, {22, 1}, {23, 1}, 
+      {24, 1}, {25, 1}, {17, 1}, {0, symbol_t::NO_SYMBOL}, {492, 3}, {495, 3}, {498, 3}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {501, 3}, {504, 3}, {507, 3}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {510, 3}, {513, 3}, {516, 3}, {519, 3}, {522, 3}, {525, 3}, {528, 3}, 
+      {531, 3}, {534, 3}, {537, 3}, {540, 3}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}}},
+    //MAC_ROMAN
+    {{
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, 1}, {1, 1}, {2, 1}, {3, 1}, {4, 1}, {5, 1}, {543, 1}, {115, 1}, 
+      {9, 1}, {10, 1}, {11, 1}, {12, 1}, {249, 0}, {14, 1}, {15, 1}, {16, 1}, 
+      {17, 1}, {18, 1}, {19, 1}, {20, 1}, {21, 1}, {22, 1}, {23, 1}, {24, 1}, 
+      {25, 1}, {26, 1}, {27, 1}, {28, 1}, {29, 1}, {30, 1}, {31, 1}, {32, 1}, 
+      {33, 1}, {34, 1}, {35, 1}, {36, 1}, {37, 1}, {38, 1}, {39, 1}, {40, 1}, 
+      {41, 1}, {42, 1}, {43, 1}, {44, 1}, {45, 1}, {46, 1}, {47, 1}, {48, 1}, 
+      {49, 1}, {50, 1}, {51, 1}, {52, 1}, {53, 1}, {54, 1}, {55, 1}, {56, 1}, 
+      {57, 1}, {58, 1}, {59, 1}, {60, 1}, {61, 1}, {62, 1}, {63, 1}, {64, 1}, 
+      {168, 1}, {68, 1}, {69, 1}, {70, 1}, {71, 1}, {72, 1}, {73, 1}, {74, 1}, 
+      {75, 1}, {76, 1}, {77, 1}, {78, 1}, {79, 1}, {80, 1}, {81, 1}, {82, 1}, 
+      {83, 1}, {84, 1}, {85, 1}, {86, 1}, {87, 1}, {88, 1}, {89, 1}, {90, 1}, 
+      {91, 1}, {92, 1}, {93, 1}, {94, 1}, {95, 1}, {96, 1}, {97, 1}, {0, symbol_t::NO_SYMBOL}, 
+      {544, 2}, {546, 2}, {548, 2}, {550, 2}, {552, 2}, {554, 2}, {556, 2}, {558, 2}, 
+      {560, 2}, {562, 2}, {564, 2}, {566, 2}, {568, 2}, {570, 2}, {572, 2}, {574, 2}, 
+      {576, 2}, {578, 2}, {580, 2}, {582, 2}, {584, 2}, {586, 2}, {588, 2}, {590, 2}, 
+      {592, 2}, {594, 2}, {596, 2}, {598, 2}, {600, 2}, {602, 2}, {604, 2}, {606, 2}, 
+      {136, 3}, {608, 2}, {100, 2}, {102, 2}, {111, 2}, {146, 3}, {144, 2}, {218, 2}, 
+      {610, 2}, {612, 2}, {614, 3}, {169, 2}, {181, 2}, {617, 3}, {196, 2}, {202, 2}, 
+      {620, 3}, {623, 2}, {625, 3}, {628, 3}, {107, 2}, {631, 2}, {633, 3}, {636, 3}, 
+      {639, 3}, {642, 2}, {644, 3}, {198, 2}, {206, 2}, {647, 2}, {208, 2}, {214, 2}, 
+      {166, 2}, {98, 2}, {649, 2}, {651, 3}, {109, 2}, {654, 3}, {657, 3}, {119, 2}, 
+      {158, 2}, {160, 3}, {0, 1}, {660, 2}, {662, 2}, {664, 2}, {204, 2}, {216, 2}, 
+      {133, 3}, {193, 3}, {116, 3}, {155, 3}, {65, 3}, {6, 3}, {666, 2}, {668, 3}, 
+      {671, 2}, {673, 2}, {104, 3}, {675, 5}, {121, 3}, {124, 3}, {127, 3}, {130, 3}, 
+      {139, 3}, {142, 2}, {149, 3}, {152, 3}, {163, 3}, {680, 2}, {682, 2}, {684, 2}, 
+      {686, 2}, {688, 2}, {690, 2}, {692, 2}, {694, 2}, {696, 2}, {698, 2}, {700, 2}, 
+      {702, 3}, {705, 2}, {707, 2}, {709, 2}, {711, 2}, {210, 2}, {171, 2}, {173, 2}, 
+      {175, 2}, {177, 2}, {179, 2}, {183, 2}, {185, 2}, {187, 2}, {189, 2}, {191, 2}}},
+    //WIN
+    {{
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, {0, symbol_t::NO_SYMBOL}, 
+      {0, 1}, {1, 1}, {33, 1}, {3, 1}, {4, 1}, {5, 1}, {543, 1}, {115, 1}, 
+      {9, 1}, {10, 1}, {11, 1}, {12, 1}, {249, 0}, {14, 1}, {15, 1}, {16, 1}, 
+      {17, 1}, {18, 1}, {19, 1}, {20, 1}, {21, 1}, {22, 1}, {23, 1}, {24, 1}, 
+      {25, 1}, {26, 1}, {27, 1}, {28, 1}, {29, 1}, {30, 1}, {31, 1}, {32, 1}, 
+      {33, 1}, {34, 1}, {35, 1}, {36, 1}, {37, 1}, {38, 1}, {39, 1}, {40, 1}, 
+      {41, 1}, {42, 1}, {43, 1}, {44, 1}, {45, 1}, {46, 1}, {47, 1}, {48, 1}, 
+      {49, 1}, {50, 1}, {51, 1}, {52, 1}, {53, 1}, {54, 1}, {55, 1}, {56, 1}, 
+      {57, 1}, {58, 1}, {59, 1}, {60, 1}, {61, 1}, {62, 1}, {63, 1}, {64, 1}, 
+      {168, 1}, {68, 1}, {69, 1}, {70, 1}, {71, 1}, {72, 1}, {73, 1}, {74, 1}, 
+      {75, 1}, {76, 1}, {77, 1}, {78, 1}, {79, 1}, {80, 1}, {81, 1}, {82, 1}, 
+      {83, 1}, {84, 1}, {85, 1}, {86, 1}, {87, 1}, {88, 1}, {89, 1}, {90, 1}, 
+      {91, 1}, {92, 1}, {93, 1}, {94, 1}, {95, 1}, {96, 1}, {97, 1}, {146, 3}, 
+      {713, 3}, {146, 3}, {149, 3}, {109, 2}, {152, 3}, {160, 3}, {136, 3}, {139, 3}, 
+      {171, 2}, {163, 3}, {716, 2}, {121, 3}, {204, 2}, {146, 3}, {718, 2}, {146, 3}, 
+      {146, 3}, {65, 3}, {6, 3}, {116, 3}, {155, 3}, {146, 3}, {133, 3}, {193, 3}, 
+      {173, 2}, {614, 3}, {720, 2}, {124, 3}, {216, 2}, {146, 3}, {722, 2}, {673, 2}, 
+      {0, 1}, {98, 2}, {100, 2}, {102, 2}, {113, 2}, {107, 2}, {724, 2}, {111, 2}, 
+      {181, 2}, {612, 2}, {198, 2}, {119, 2}, {649, 2}, {14, 1}, {610, 2}, {175, 2}, 
+      {608, 2}, {623, 2}, {726, 2}, {728, 2}, {169, 2}, {631, 2}, {144, 2}, {142, 2}, 
+      {185, 2}, {730, 2}, {206, 2}, {158, 2}, {258, 2}, {260, 2}, {262, 2}, {166, 2}, 
+      {660, 2}, {684, 2}, {680, 2}, {662, 2}, {544, 2}, {546, 2}, {196, 2}, {548, 2}, 
+      {688, 2}, {550, 2}, {682, 2}, {686, 2}, {696, 2}, {690, 2}, {692, 2}, {694, 2}, 
+      {732, 2}, {552, 2}, {705, 2}, {698, 2}, {700, 2}, {664, 2}, {554, 2}, {734, 2}, 
+      {202, 2}, {711, 2}, {707, 2}, {709, 2}, {556, 2}, {736, 2}, {738, 2}, {218, 2}, 
+      {560, 2}, {558, 2}, {562, 2}, {566, 2}, {564, 2}, {568, 2}, {208, 2}, {570, 2}, 
+      {574, 2}, {572, 2}, {576, 2}, {578, 2}, {582, 2}, {580, 2}, {584, 2}, {586, 2}, 
+      {740, 2}, {588, 2}, {592, 2}, {590, 2}, {594, 2}, {598, 2}, {596, 2}, {666, 2}, 
+      {214, 2}, {602, 2}, {600, 2}, {604, 2}, {606, 2}, {742, 2}, {744, 2}, {671, 2}}}
+}};
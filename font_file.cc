@@ -1,20 +1,17 @@
 #include <string>
 #include <utility>
-#include <unordered_map>
 #include <vector>
 
 #include "common.h"
 #include "cmap.h"
+#include "glyph_names.h"
 
 using namespace std;
 
 string get_name2unicode(const string &name)
 {
-    static const unordered_map<string, string> name2unicode = {
-          #include "symbol_table.h"
-    };
-    auto it = name2unicode.find(name);
-    if (it != name2unicode.end()) return it->second;
+    pair<const char*, size_t> glyph = get_glyph_symbol(name);
+    if (glyph.first) return string(glyph.first, glyph.second);
     return "";
 }
 
@@ -23,14 +20,9 @@ void get_binary(string &source)
     for (char &c : source) c -= '0';
 }
 
-cmap_t get_FontFile(const string &doc,
-                    const ObjectStorage &storage,
-                    const pair<unsigned int, unsigned int> &cmap_id_gen,
-                    const dict_t &decrypt_data)
+cmap_t get_FontFile(const string &stream)
 {
-        const string stream = get_stream(doc, cmap_id_gen, storage, decrypt_data);
-        cmap_t cmap;
-        cmap.is_vertical = false;
+        cmap_data_t cmap;
         vector<string> st;
         for (size_t i = skip_comments(stream, 0, false);
              i != string::npos && i < stream.length();
@@ -42,16 +34,16 @@ cmap_t get_FontFile(const string &doc,
                 st.push_back(std::move(token));
                 continue;
             }
-            if (token == "eexec" && st.back() == "currentfile") return cmap;
+            if (token == "eexec" && st.back() == "currentfile") return cmap_t(cmap);
             if (token == "put")
             {
                 const string result = get_name2unicode(pop(st));
                 string source = pop(st);
                 get_binary(source);
-                cmap.utf_map.emplace(source, make_pair(cmap_t::CONVERTED, result));
+                cmap.utf_map.emplace(source, make_pair(cmap_data_t::CONVERTED, result));
                 continue;
             }
             st.push_back(std::move(token));
         }
-        return cmap;
+        return cmap_t(cmap);
 }
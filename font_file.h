@@ -6,12 +6,11 @@
 
 #include "object_storage.h"
 #include "common.h"
+#include "cmap.h"
 
 
-cmap_t get_FontFile(const std::string &doc,
-                    const ObjectStorage &storage,
-                    const std::pair<unsigned int, unsigned int> &cmap_id_gen,
-                    const dict_t &decrypt_data);
+//stream is decoded Type 1 font program
+cmap_t get_FontFile(const std::string &stream);
 
 
 #endif //FONT_FILE_H
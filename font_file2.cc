@@ -1,30 +1,171 @@
 #include <string>
 #include <utility>
 #include <vector>
-#include <limits>
 #include <algorithm>
+#include <limits>
+#include <atomic>
+#include <mutex>
+#include <array>
+#include <cstdint>
 
 #include "object_storage.h"
 #include "common.h"
 #include "cmap.h"
+#include "font_file2.h"
 
 using namespace std;
 
 //https://docs.microsoft.com/en-us/typography/opentype/spec/otff
 //https://developer.apple.com/fonts/TrueType-Reference-Manual/RM06/Chap6cmap.html
-void get_format0_data(cmap_t &cmap, const string &stream, size_t off);
-void get_format2_data(cmap_t &cmap, const string &stream, size_t off);
-void get_format4_data(cmap_t &cmap, const string &stream, size_t off);
-void get_format6_data(cmap_t &cmap, const string &stream, size_t off);
-void get_format12_data(cmap_t &cmap, const string &stream, size_t off);
-
-cmap_t get_FontFile2(const string &doc,
-                     const ObjectStorage &storage,
-                     const pair<unsigned int, unsigned int> &cmap_id_gen,
-                     const dict_t &decrypt_data)
+
+namespace
+{
+    template <class T> vector<T> get_array(const string &stream, size_t &off, uint16_t num)
+    {
+        vector<T> result;
+        result.reserve(num);
+        for (uint16_t i = 0; i < num; ++i, off += sizeof(T)) result.push_back(get_integer<T>(stream, off));
+        return result;
+    }
+
+    //code 0 is not mapped
+    uint32_t get_char(uint32_t c)
+    {
+        return (c == 0)? cmap_t::NO_CHAR : c;
+    }
+
+    //character of c converted as utf16be string of num2string(c). Its first unit is converted and the rest is skipped,
+    //surrogate is skipped completely
+    uint32_t get_char_utf16(uint32_t c)
+    {
+        uint32_t unit = (c > 0xFFFF)? c >> 8 : c;
+        return (unit >= 0xD800 && unit <= 0xDFFF)? cmap_t::NO_CHAR : unit;
+    }
+
+    //gids of DELTA segment are [first + delta, last + delta] modulo 2^32, values out of 2 bytes are never looked up.
+    //Returns ranges of them below 2^16, range is empty if its first value is above the last one
+    array<pair<uint64_t, uint64_t>, 2> get_delta_gids(const truetype_segment_t &segment)
+    {
+        enum : uint64_t { GID_MAX = 0xFFFF, WRAP = 1ULL << 32 };
+        const uint64_t first = static_cast<uint64_t>(segment.first) + segment.delta;
+        const uint64_t last = static_cast<uint64_t>(segment.last) + segment.delta;
+        array<pair<uint64_t, uint64_t>, 2> result;
+        result[0] = make_pair(first, min(last, static_cast<uint64_t>(GID_MAX)));
+        result[1] = make_pair(max(first, static_cast<uint64_t>(WRAP)), min(last, static_cast<uint64_t>(WRAP + GID_MAX)));
+        return result;
+    }
+
+    //copies num (at least 1) glyph ids at off to glyphs of data, returns their offset there
+    uint32_t add_glyphs(const string &stream, size_t off, size_t num, truetype_data_t &data)
+    {
+        get_integer<uint16_t>(stream, off + (num - 1) * sizeof(uint16_t));
+        uint32_t result = data.glyphs.length();
+        data.glyphs.append(stream, off, num * sizeof(uint16_t));
+        return result;
+    }
+
+    void add_format12(const string &stream, size_t off, truetype_data_t &data)
+    {
+        off += sizeof(uint16_t) * 2 + sizeof(uint32_t) * 2;
+        uint32_t n_groups = get_integer<uint32_t>(stream, off);
+        off += sizeof(uint32_t);
+        for (uint32_t i = 0; i < n_groups; ++i)
+        {
+            uint32_t start_char_code = get_integer<uint32_t>(stream, off);
+            off += sizeof(uint32_t);
+            uint32_t end_char_code = get_integer<uint32_t>(stream, off);
+            off += sizeof(uint32_t);
+            uint32_t start_glyph_code = get_integer<uint32_t>(stream, off);
+            off += sizeof(uint32_t);
+            //char c is mapped to c + start_glyph_code
+            if (start_char_code <= end_char_code)
+            {
+                data.segments.push_back(truetype_segment_t{truetype_segment_t::DELTA, start_char_code, end_char_code,
+                                                           start_glyph_code, 0});
+            }
+        }
+    }
+
+    void add_format4(const string &stream, size_t off, truetype_data_t &data)
+    {
+        enum { FINAL_ENC_VAL = 0xFFFF };
+        off += sizeof(uint16_t) * 3;
+        uint16_t seg_count = get_integer<uint16_t>(stream, off) / 2;
+        off += sizeof(uint16_t) * 4;
+        vector<uint16_t> ecs = get_array<uint16_t>(stream, off, seg_count);
+        off += sizeof(uint16_t);
+        vector<uint16_t> scs = get_array<uint16_t>(stream, off, seg_count);
+        vector<int16_t> idds = get_array<int16_t>(stream, off, seg_count);
+        size_t pos = off;
+        vector<uint16_t> idrs = get_array<uint16_t>(stream, off, seg_count);
+        for (uint16_t i = 0; i < seg_count; ++i)
+        {
+            if (ecs[i] == FINAL_ENC_VAL || scs[i] > ecs[i]) continue;
+            const uint32_t delta = static_cast<int32_t>(idds[i]);
+            if (idrs[i])
+            {
+                uint32_t glyphs = add_glyphs(stream, pos + idrs[i], ecs[i] - scs[i] + 1, data);
+                data.segments.push_back(truetype_segment_t{truetype_segment_t::GLYPHS, scs[i], ecs[i], delta, glyphs});
+            }
+            else
+            {
+                data.segments.push_back(truetype_segment_t{truetype_segment_t::DELTA, scs[i], ecs[i], delta, 0});
+            }
+        }
+    }
+
+    //1 byte codes are never looked up
+    void add_format0(const string &stream, size_t off)
+    {
+        off += sizeof(uint16_t) * 3;
+        get_integer<char>(stream, off + 255);
+    }
+
+    void add_format2(const string &stream, size_t off, truetype_data_t &data)
+    {
+        enum { SUBHEADER_KEYS_NUM = 256 };
+        off += sizeof(uint16_t) * 3;
+        vector<uint16_t> subheader_keys = get_array<uint16_t>(stream, off, SUBHEADER_KEYS_NUM);
+        vector<uint16_t> first_bytes(numeric_limits<uint16_t>::max() / 8 + 1, 0);
+        for (size_t i = 0; i < subheader_keys.size(); ++i) first_bytes[subheader_keys[i] / 8] = i;
+        uint16_t ndhrs = *max_element(subheader_keys.begin(), subheader_keys.end()) / 8 + 1;
+        for (uint16_t i = 0; i < ndhrs; ++i)
+        {
+            uint16_t first_code = get_integer<uint16_t>(stream, off);
+            off += sizeof(uint16_t);
+            uint16_t entry_count = get_integer<uint16_t>(stream, off);
+            off += sizeof(uint16_t);
+            int16_t id_delta = get_integer<uint16_t>(stream, off);
+            off += sizeof(int16_t);
+            uint16_t id_range_offset = get_integer<uint16_t>(stream, off);
+            off += sizeof(uint16_t);
+            if (entry_count == 0) continue;
+            //all entries of subheader are mapped to the same glyph id, so only the first one is reachable
+            uint16_t gid = get_integer<uint16_t>(stream, off - sizeof(uint16_t) + id_range_offset);
+            if (gid != 0) gid += id_delta;
+            uint16_t first = first_code + (first_bytes[i] << 8);
+            data.segments.push_back(truetype_segment_t{truetype_segment_t::DELTA, first, first,
+                                                       static_cast<uint32_t>(gid) - first, 0});
+        }
+    }
+
+    void add_format6(const string &stream, size_t off, truetype_data_t &data)
+    {
+        off += sizeof(uint16_t) * 3;
+        uint16_t first_code = get_integer<uint16_t>(stream, off);
+        off += sizeof(uint16_t);
+        uint16_t entry_count = get_integer<uint16_t>(stream, off);
+        off += sizeof(uint16_t);
+        if (entry_count == 0) return;
+        uint32_t glyphs = add_glyphs(stream, off, entry_count, data);
+        uint32_t last_code = first_code + entry_count - 1;
+        data.segments.push_back(truetype_segment_t{truetype_segment_t::GLYPHS_UTF16, first_code, last_code, 0, glyphs});
+    }
+}
+
+cmap_t get_FontFile2(const string &stream)
 {
     enum { TAG_SIZE = 4 };
-    const string stream = get_stream(doc, cmap_id_gen, storage, decrypt_data);
     uint16_t tables_num = get_integer<uint16_t>(stream, sizeof(uint32_t));
     uint16_t i = 0;
     for (i = 0; i < tables_num; ++i)
@@ -43,168 +184,153 @@ cmap_t get_FontFile2(const string &doc,
     {
         mapping_offsets.push_back(table_offset + get_integer<uint32_t>(stream, offset));
     }
-    cmap_t result;
-    result.is_vertical = false;
+    truetype_data_t data;
+    //only formats 0, 4 and 6 define 2 bytes codes, otherwise codes are never looked up
+    bool codes = false;
     for (size_t off : mapping_offsets)
     {
         uint16_t format_id = get_integer<uint16_t>(stream, off);
-        if (format_id == 0) get_format0_data(result, stream, off);
-        if (format_id == 2) get_format2_data(result, stream, off);
-        if (format_id == 4) get_format4_data(result, stream, off);
-        if (format_id == 6) get_format6_data(result, stream, off);
-        if (format_id == 12) get_format12_data(result, stream, off);
+        if (format_id == 0)
+        {
+            codes = true;
+            add_format0(stream, off);
+        }
+        if (format_id == 2) add_format2(stream, off, data);
+        if (format_id == 4)
+        {
+            codes = true;
+            add_format4(stream, off, data);
+        }
+        if (format_id == 6)
+        {
+            codes = true;
+            add_format6(stream, off, data);
+        }
+        if (format_id == 12) add_format12(stream, off, data);
     }
-    return result;
-}
-
-template <class T> vector<T> get_array(const string &stream, size_t &off, uint16_t num)
-{
-    vector<T> result;
-    result.reserve(num);
-    for (uint16_t i = 0; i < num; ++i, off += sizeof(T)) result.push_back(get_integer<T>(stream, off));
-    return result;
+    if (!codes) return cmap_t();
+    return cmap_t(data);
 }
 
-string get_utf8(uint32_t c)
+TrueTypeCmap::TrueTypeCmap(const truetype_segment_t *segments_arg, size_t segments_num_arg,
+                           const char *glyphs_arg, size_t glyphs_length_arg) :
+                           segments(segments_arg), segments_num(segments_num_arg), glyphs(glyphs_arg),
+                           index_bound(0)
 {
-    union
-    {
-        uint32_t v;
-        char str[sizeof(uint32_t)];
-    } u;
-    u.v = c;
-    string result;
-    bool write = false;
-    for (int i = sizeof(uint32_t) - 1; i >= 0; --i)
+    for (atomic<uint64_t> &entry : cache) entry.store(0, memory_order_relaxed);
+    for (size_t i = 0; i < segments_num; ++i)
     {
-        if (u.str[i] != 0) write = true;
-        if (write) result.push_back(u.str[i]);
+        const truetype_segment_t &segment = segments[i];
+        if (segment.type > truetype_segment_t::GLYPHS_UTF16) throw pdf_error(FUNC_STRING + "wrong segment type");
+        if (segment.type == truetype_segment_t::DELTA) continue;
+        if (segment.first > segment.last ||
+            segment.glyphs + (static_cast<size_t>(segment.last - segment.first) + 1) * sizeof(uint16_t) >
+            glyphs_length_arg)
+        {
+            throw pdf_error(FUNC_STRING + "wrong glyphs offset");
+        }
     }
-    return result;
-}
-
-void get_format12_data(cmap_t &cmap, const string &stream, size_t off)
-{
-    off += sizeof(uint16_t) * 2 + sizeof(uint32_t) * 2;
-    uint32_t n_groups = get_integer<uint32_t>(stream, off);
-    off += sizeof(uint32_t);
-    for (uint32_t i = 0; i < n_groups; ++i)
+    for (size_t i = 0; i < segments_num && index_bound < GIDS_NUM; ++i)
     {
-        uint32_t start_char_code = get_integer<uint32_t>(stream, off);
-        off += sizeof(uint32_t);
-        uint32_t end_char_code = get_integer<uint32_t>(stream, off);
-        off += sizeof(uint32_t);
-        uint32_t start_glyph_code = get_integer<uint32_t>(stream, off);
-        off += sizeof(uint32_t);
-        for (uint32_t c = start_char_code; c <= end_char_code; ++c)
+        const truetype_segment_t &segment = segments[i];
+        if (segment.type != truetype_segment_t::DELTA)
+        {
+            index_bound += segment.last - segment.first + 1;
+            continue;
+        }
+        for (const pair<uint64_t, uint64_t> &range : get_delta_gids(segment))
         {
-            cmap.utf_map.emplace(num2string(c + start_glyph_code), make_pair(cmap_t::CONVERTED, get_utf8(c)));
+            if (range.first <= range.second) index_bound += range.second - range.first + 1;
         }
     }
+    index_bound = min(index_bound, static_cast<size_t>(GIDS_NUM));
 }
 
-void get_format4_data(cmap_t &cmap, const string &stream, size_t off)
+//every segment maps a gid at most once, so it adds up to GIDS_NUM entries
+void TrueTypeCmap::make_index() const
 {
-    cmap.sizes[0] = sizeof(uint16_t);
-    enum { FINAL_ENC_VAL = 0xFFFF };
-    off += sizeof(uint16_t) * 3;
-    uint16_t seg_count = get_integer<uint16_t>(stream, off) / 2;
-    off += sizeof(uint16_t) * 4;
-    vector<uint16_t> ecs = get_array<uint16_t>(stream, off, seg_count);
-    off += sizeof(uint16_t);
-    vector<uint16_t> scs = get_array<uint16_t>(stream, off, seg_count);
-    vector<int16_t> idds = get_array<int16_t>(stream, off, seg_count);
-    size_t pos = off;
-    vector<uint16_t> idrs = get_array<uint16_t>(stream, off, seg_count);
-    for (uint16_t i = 0; i < seg_count; ++i)
-    {
-        if (ecs[i] == FINAL_ENC_VAL) continue;
-        if (idrs[i])
+    //entries are added in segments order, so stable sort keeps the first one of every gid in front
+    auto compact = [this]()
+    {
+        stable_sort(index.begin(), index.end(), [](const pair<uint32_t, uint32_t> &a, const pair<uint32_t, uint32_t> &b)
+                                                {
+                                                    return a.first < b.first;
+                                                });
+        index.erase(unique(index.begin(), index.end(), [](const pair<uint32_t, uint32_t> &a,
+                                                          const pair<uint32_t, uint32_t> &b)
+                                                       {
+                                                           return a.first == b.first;
+                                                       }), index.end());
+    };
+    size_t added = 0;
+    for (size_t i = 0; i < segments_num && added < MAX_INDEX_ENTRIES; ++i)
+    {
+        const size_t index_size = index.size();
+        const truetype_segment_t &segment = segments[i];
+        if (segment.type == truetype_segment_t::DELTA)
         {
-            size_t off2 = pos + idrs[i];
-            for (uint32_t c = scs[i]; c <= ecs[i]; ++c, off2 += sizeof(uint16_t))
+            for (const pair<uint64_t, uint64_t> &range : get_delta_gids(segment))
             {
-                cmap.utf_map.emplace(num2string(get_integer<uint16_t>(stream, off2) + idds[i]),
-                                     make_pair(cmap_t::CONVERTED, get_utf8(c)));
+                for (uint64_t v = range.first; v <= range.second; ++v)
+                {
+                    const uint32_t gid = static_cast<uint32_t>(v);
+                    index.emplace_back(gid, get_char(gid - segment.delta));
+                }
             }
         }
         else
         {
-            for (uint32_t c = scs[i]; c <= ecs[i]; ++c)
+            const unsigned char *ids = reinterpret_cast<const unsigned char*>(glyphs + segment.glyphs);
+            for (uint32_t code = segment.first; code <= segment.last; ++code, ids += sizeof(uint16_t))
             {
-                cmap.utf_map.emplace(num2string(c + idds[i]), make_pair(cmap_t::CONVERTED, get_utf8(c)));
+                const uint32_t gid = static_cast<uint32_t>((ids[0] << 8) | ids[1]) + segment.delta;
+                if (gid >= GIDS_NUM) continue;
+                index.emplace_back(gid, (segment.type == truetype_segment_t::GLYPHS)? get_char(code) :
+                                                                                      get_char_utf16(code));
             }
         }
+        added += index.size() - index_size;
+        if (index.size() > 2 * GIDS_NUM) compact();
     }
+    compact();
+    index.shrink_to_fit();
 }
 
-void get_format0_data(cmap_t &cmap, const string &stream, size_t off)
+//index is counted before it is built, so size of cached cmap doesn't change
+size_t TrueTypeCmap::get_size() const
 {
-    cmap.sizes[0] = sizeof(uint16_t);
-    off += sizeof(uint16_t) * 3;
-    for (size_t i = 0; i < 256; ++i)
-    {
-        cmap.utf_map.emplace(string(1, get_integer<char>(stream, off + i)),
-                             make_pair(cmap_t::NOT_CONVERTED, num2string(i & 0xFF)));
-
-    }
+    return sizeof(*this) + index_bound * sizeof(pair<uint32_t, uint32_t>);
 }
 
-void get_format2_data(cmap_t &cmap, const string &stream, size_t off)
+//symbol is the character alone, as if it is the last character of range
+bool TrueTypeCmap::find(unsigned int gid, cmap_t::symbol_t &symbol) const
 {
-    enum { SUBHEADER_KEYS_NUM = 256 };
-    off += sizeof(uint16_t) * 3;
-    vector<uint16_t> subheader_keys = get_array<uint16_t>(stream, off, SUBHEADER_KEYS_NUM);
-    if (subheader_keys.empty()) return;
-    vector<uint16_t> first_bytes(numeric_limits<uint16_t>::max() / 8, 0);;
-    for (size_t i = 0; i < subheader_keys.size(); ++i) first_bytes[subheader_keys[i] / 8] = i;
-    uint16_t ndhrs = *max_element(subheader_keys.begin(), subheader_keys.end()) / 8 + 1;
-    struct subheader_t
-    {
-        uint16_t first_code;
-        uint16_t entry_count;
-        int16_t id_delta;
-        size_t id_range_offset;
-    };
-    vector<subheader_t> hdrs;
-    hdrs.reserve(ndhrs);
-    for (uint16_t i = 0; i < ndhrs; ++i)
+    atomic<uint64_t> &entry = cache[gid % CACHE_SIZE];
+    uint64_t val = entry.load(memory_order_relaxed);
+    if (!(val & VALID) || ((val >> GID_SHIFT) & 0xFFFF) != gid)
     {
-        uint16_t first_code = get_integer<uint16_t>(stream, off);
-        off += sizeof(uint16_t);
-        uint16_t entry_count = get_integer<uint16_t>(stream, off);
-        off += sizeof(uint16_t);
-        int16_t id_delta = get_integer<uint16_t>(stream, off);
-        off += sizeof(int16_t);
-        uint16_t id_range_offset = get_integer<uint16_t>(stream, off);
-        off += sizeof(uint16_t);
-        hdrs.push_back(subheader_t{first_code, entry_count, id_delta, off - sizeof(uint16_t) + id_range_offset});
-        for (size_t i = 0; i < hdrs.size(); ++i)
-        {
-            if (hdrs[i].entry_count == 0) continue;
-            uint16_t first = hdrs[i].first_code + (first_bytes[i] << 8);
-            for (size_t j = 0; j < hdrs[i].entry_count; ++j)
-            {
-                uint16_t gid = get_integer<uint16_t>(stream, hdrs[i].id_range_offset);
-                if (gid != 0) gid += hdrs[i].id_delta;
-                cmap.utf_map.emplace(num2string(gid), make_pair(cmap_t::CONVERTED, get_utf8(first + j)));
-            }
-        }
+        uint32_t c = cmap_t::NO_CHAR;
+        val = (find_char(gid, c)? FOUND : 0) | VALID | (static_cast<uint64_t>(gid) << GID_SHIFT) | c;
+        entry.store(val, memory_order_relaxed);
     }
+    if (!(val & FOUND)) return false;
+    symbol.utf8 = "";
+    symbol.length = 0;
+    symbol.last_char = static_cast<uint32_t>(val);
+    symbol.utf8_length = (symbol.last_char == cmap_t::NO_CHAR)? 0 : 1;
+    symbol.code = gid;
+    symbol.code_length = sizeof(uint16_t);
+    return true;
 }
 
-void get_format6_data(cmap_t &cmap, const string &stream, size_t off)
+bool TrueTypeCmap::find_char(uint32_t gid, uint32_t &c) const
 {
-    cmap.sizes[0] = sizeof(uint16_t);
-    off += sizeof(uint16_t) * 3;
-    uint16_t first_code = get_integer<uint16_t>(stream, off);
-    off += sizeof(uint16_t);
-    uint16_t entry_count = get_integer<uint16_t>(stream, off);
-    off += sizeof(uint16_t);
-    for (uint16_t i = 0; i < entry_count; ++i, off += sizeof(uint16_t))
-    {
-        cmap.utf_map.emplace(num2string(get_integer<uint16_t>(stream, off)),
-                             make_pair(cmap_t::NOT_CONVERTED, num2string(i + first_code)));
-
-    }
+    call_once(index_flag, [this]() { make_index(); });
+    auto it = lower_bound(index.begin(), index.end(), gid, [](const pair<uint32_t, uint32_t> &p, uint32_t v)
+                                                           {
+                                                               return p.first < v;
+                                                           });
+    if (it == index.end() || it->first != gid) return false;
+    c = it->second;
+    return true;
 }
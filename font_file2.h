@@ -3,15 +3,75 @@
 
 #include <string>
 #include <utility>
+#include <vector>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <cstdint>
 
 #include "object_storage.h"
 #include "common.h"
+#include "cmap.h"
 
+//chars first..last of TrueType cmap mapped to glyph ids
+struct truetype_segment_t
+{
+    enum type_t : uint32_t { DELTA /* char is gid - delta */,
+                             GLYPHS /* gid - delta is in glyph ids array */,
+                             GLYPHS_UTF16 /* gid is in glyph ids array, char is converted from utf16be */ };
+    uint32_t type;
+    uint32_t first;
+    uint32_t last;
+    uint32_t delta;
+    //offset of glyph ids array in glyphs
+    uint32_t glyphs;
+};
 
-cmap_t get_FontFile2(const std::string &doc,
-                     const ObjectStorage &storage,
-                     const std::pair<unsigned int, unsigned int> &cmap_id_gen,
-                     const dict_t &decrypt_data);
+//cmap table of TrueType font program compiled from subtables
+struct truetype_data_t
+{
+    //segments of all subtables in order, the first one containing gid wins
+    std::vector<truetype_segment_t> segments;
+    //big endian glyph ids arrays of segments
+    std::string glyphs;
+};
+
+//lookup in compiled TrueType cmap. Codes of the font are glyph ids, they are mapped back to characters
+//on demand and found characters are kept in small direct-mapped cache. The first cache miss builds index
+//of glyph ids, the next ones are binary search in it. Cache entries are atomic words and index is built once,
+//so cmap can be shared between threads. Segments and glyphs are not owned
+class TrueTypeCmap
+{
+public:
+    //throws pdf_error if glyph ids arrays of segments are out of glyphs
+    TrueTypeCmap(const truetype_segment_t *segments_arg, size_t segments_num_arg,
+                 const char *glyphs_arg, size_t glyphs_length_arg);
+    bool find(unsigned int gid, cmap_t::symbol_t &symbol) const;
+    //memory held by lookup in bytes
+    size_t get_size() const;
+private:
+    //gids are 2 bytes codes. Index is compacted when it has more than 2 * GIDS_NUM entries and segments
+    //after MAX_INDEX_ENTRIES added entries are not indexed, so crafted font can't exhaust memory or time
+    enum { CACHE_SIZE = 256, GIDS_NUM = 0x10000, MAX_INDEX_ENTRIES = 16 * GIDS_NUM };
+    //cache entry: character (NO_CHAR if gid is mapped to empty string), gid, FOUND and VALID flags
+    enum : uint64_t { GID_SHIFT = 32, FOUND = 1ULL << 48, VALID = 1ULL << 49 };
+
+    bool find_char(uint32_t gid, uint32_t &c) const;
+    void make_index() const;
+
+    const truetype_segment_t *segments;
+    size_t segments_num;
+    const char *glyphs;
+    //(glyph id, character) sorted by glyph id, character of the first segment mapping glyph id wins
+    mutable std::vector<std::pair<uint32_t, uint32_t>> index;
+    mutable std::once_flag index_flag;
+    //number of entries of index, up to GIDS_NUM
+    size_t index_bound;
+    mutable std::array<std::atomic<uint64_t>, CACHE_SIZE> cache;
+};
+
+//stream is decoded font program
+cmap_t get_FontFile2(const std::string &stream);
 
 
 #endif //FONT_FILE2_H
@@ -14,31 +14,72 @@ using namespace std;
 namespace
 {
     enum { DESCENDANT_ARRAY_NUM = 1 };
+
+    struct standard_widths_t
+    {
+        const char *font;
+        const pair<unsigned int, float> *widths;
+        size_t size;
+    };
+
+    #include "standard_widths.h"
+
+    //looks for font in table sorted by font name
+    template <class T, size_t N> const T* find_standard_font(const T (&fonts)[N], const string &font)
+    {
+        const T *it = lower_bound(fonts, fonts + N, font,
+                                  [](const T &p, const string &val) { return val.compare(p.font) > 0; });
+        if (it == fonts + N || font != it->font) return nullptr;
+        return it;
+    }
 }
 
-Fonts::Fonts(const ObjectStorage &storage, const dict_t &fonts_dict): rise(RISE_DEFAULT)
+Fonts::Fonts(Cache &cache_arg, const dict_t &fonts_dict):
+             cache(&cache_arg),
+             font_refs(fonts_dict),
+             current_font(nullptr),
+             rise(RISE_DEFAULT)
 {
-        for (const dict_t::value_type &p : fonts_dict)
-        {
-            dict_t font_dict = get_dict_or_indirect_dict(p.second, storage);
-            Font_type_t type = insert_type(p.first, font_dict);
-            if (type == TYPE_3) insert_matrix_type3(p.first, font_dict);
-            insert_descendant(font_dict, storage);
-            dictionary_per_font.emplace(p.first, font_dict);
-            auto it = font_dict.find("/FontDescriptor");
-            const dict_t desc_dict = (it == font_dict.end())? dict_t() : get_dict_or_indirect_dict(it->second, storage);
-
-            it = font_dict.find("/BaseFont");
-            string base_font;
-            if (it != font_dict.end()) base_font = it->second.first;
-            insert_widths(storage, p.first, desc_dict, base_font);
-            insert_height(p.first, desc_dict, storage, base_font);
-            insert_descent(p.first, desc_dict, font_dict, base_font, type, storage);
-            insert_ascent(p.first, desc_dict, font_dict, base_font, type, storage);
-        }
 }
 
-void Fonts::insert_descendant(dict_t &font, const ObjectStorage &storage)
+Fonts::Cache::Cache(const ObjectStorage &storage_arg) : storage(storage_arg)
+{
+}
+
+const Fonts::font_data_t& Fonts::Cache::get_font(const pair<string, pdf_object_t> &font_ref)
+{
+    if (font_ref.second == INDIRECT_OBJECT)
+    {
+        unsigned int id = get_id_gen(font_ref.first).first;
+        auto it = indirect_fonts.find(id);
+        if (it != indirect_fonts.end()) return it->second;
+        return indirect_fonts.emplace(id, make_font(font_ref)).first->second;
+    }
+    auto it = direct_fonts.find(font_ref.first);
+    if (it != direct_fonts.end()) return it->second;
+    return direct_fonts.emplace(font_ref.first, make_font(font_ref)).first->second;
+}
+
+Fonts::font_data_t Fonts::Cache::make_font(const pair<string, pdf_object_t> &font_ref) const
+{
+    dict_t font_dict = get_dict_or_indirect_dict(font_ref, storage);
+    Font_type_t type = get_type(font_dict);
+    const matrix_t font_matrix = (type == TYPE_3)? get_matrix_type3(font_dict) : IDENTITY_MATRIX;
+    insert_descendant(font_dict);
+    auto it = font_dict.find("/FontDescriptor");
+    const dict_t desc_dict = (it == font_dict.end())? dict_t() : get_dict_or_indirect_dict(it->second, storage);
+
+    it = font_dict.find("/BaseFont");
+    string base_font;
+    if (it != font_dict.end()) base_font = it->second.first;
+    pair<Widths, float> widths = get_widths(font_dict, desc_dict, base_font);
+    float height = get_height(desc_dict, base_font);
+    float descent = get_descent(desc_dict, font_dict, base_font, type);
+    float ascent = get_ascent(desc_dict, font_dict, base_font, type);
+    return font_data_t(std::move(font_dict), type, font_matrix, std::move(widths), height, descent, ascent);
+}
+
+void Fonts::Cache::insert_descendant(dict_t &font) const
 {
     const string type = font.at("/Subtype").first;
     if (type != "/Type0") return;
@@ -54,11 +95,12 @@ void Fonts::insert_descendant(dict_t &font, const ObjectStorage &storage)
 
 float Fonts::get_width(unsigned int code) const
 {
-    const vector<pair<unsigned int, float>> *font_width = *widths.at(current_font);
-    if (font_width->empty()) return default_width.at(current_font) * get_scales().first;
-    int i = binary_search(font_width, 0, font_width->size() - 1, code);
-    if (i == -1) return default_width.at(current_font) * get_scales().first;
-    return (*font_width)[i].second * get_scales().first;
+    validate_current_font();
+    const Widths &font_width = current_font->widths;
+    if (font_width.size() == 0) return current_font->default_width * current_font->scales.first;
+    int i = binary_search(font_width.data(), 0, font_width.size() - 1, code);
+    if (i == -1) return current_font->default_width * current_font->scales.first;
+    return font_width.data()[i].second * current_font->scales.first;
 }
 
 float Fonts::get_width(const string &s) const
@@ -68,16 +110,13 @@ float Fonts::get_width(const string &s) const
     return result;
 }
 
-void Fonts::insert_widths_from_w(const ObjectStorage &storage, const string &font_name, const string &base_font)
+pair<Fonts::Widths, float> Fonts::Cache::get_widths_from_w(const dict_t &font, const string &base_font) const
 {
-    const dict_t &font = dictionary_per_font.at(font_name);
-    default_width.emplace(font_name, get_dict_val(font, "/DW", DW_DEFAULT));
+    float default_width = get_dict_val(font, "/DW", DW_DEFAULT);
     auto it = font.find("/W");
     if (it == font.end())
     {
-        standard_widths.count(base_font)? widths.emplace(font_name, Widths(&standard_widths.at(base_font))) :
-                                          widths.emplace(font_name, Widths());
-        return;
+        return make_pair(get_standard_widths(base_font), default_width);
     }
     array_t result = get_array_or_indirect_array(it->second, storage);
     for (array_t::value_type &p : result)
@@ -85,8 +124,8 @@ void Fonts::insert_widths_from_w(const ObjectStorage &storage, const string &fon
         if (p.second == INDIRECT_OBJECT) p = get_indirect_object_data(p.first, storage);
     }
 
-    widths.emplace(font_name, Widths());
-    vector<pair<unsigned int, float>> *font_width = *widths[font_name];
+    Widths widths;
+    vector<pair<unsigned int, float>> *font_width = *widths;
     font_width->reserve(result.size());
 
     for (size_t i = 0; i < result.size();)
@@ -120,26 +159,23 @@ void Fonts::insert_widths_from_w(const ObjectStorage &storage, const string &fon
         }
     }
     sort(font_width->begin(), font_width->end());
+    return make_pair(std::move(widths), default_width);
 }
 
-void Fonts::insert_widths_from_widths(const ObjectStorage &storage,
-                                      const string &font_name,
-                                      const dict_t &font_desc,
-                                      const string &base_font)
+pair<Fonts::Widths, float> Fonts::Cache::get_widths_from_widths(const dict_t &font,
+                                                                const dict_t &font_desc,
+                                                                const string &base_font) const
 {
-    const dict_t &font = dictionary_per_font.at(font_name);
     unsigned int first_char = get_dict_val(font, "/FirstChar", FIRST_CHAR_DEFAULT);
-    default_width.emplace(font_name, get_dict_val(font_desc, "/MissingWidth", MISSING_WIDTH_DEFAULT));
+    float default_width = get_dict_val(font_desc, "/MissingWidth", MISSING_WIDTH_DEFAULT);
     auto it = font.find("/Widths");
     if (it == font.end())
     {
-        standard_widths.count(base_font)? widths.emplace(font_name, Widths(&standard_widths.at(base_font))) :
-                                          widths.emplace(font_name, Widths());
-        return;
+        return make_pair(get_standard_widths(base_font), default_width);
     }
     const array_t result = get_array_or_indirect_array(it->second, storage);
-    widths.emplace(font_name, Widths());
-    vector<pair<unsigned int, float>> *font_width = *widths[font_name];
+    Widths widths;
+    vector<pair<unsigned int, float>> *font_width = *widths;
     font_width->reserve(result.size());
     for (unsigned int i = 0; i < result.size(); ++i)
     {
@@ -148,23 +184,22 @@ void Fonts::insert_widths_from_widths(const ObjectStorage &storage,
         font_width->emplace_back(i + first_char, stof(val));
     }
     sort(font_width->begin(), font_width->end());
+    return make_pair(std::move(widths), default_width);
 }
 
-void Fonts::insert_widths(const ObjectStorage &storage,
-                          const string &font_name,
-                          const dict_t &font_desc,
-                          const string &base_font)
+pair<Fonts::Widths, float> Fonts::Cache::get_widths(const dict_t &font,
+                                                    const dict_t &font_desc,
+                                                    const string &base_font) const
 {
-    const string type = dictionary_per_font.at(font_name).at("/Subtype").first;
+    const string type = font.at("/Subtype").first;
     if (type == "/CIDFontType0" || type == "/CIDFontType2" || type == "/Type0")
     {
-        insert_widths_from_w(storage, font_name, base_font);
-        return;
+        return get_widths_from_w(font, base_font);
     }
-    insert_widths_from_widths(storage, font_name, font_desc, base_font);
+    return get_widths_from_widths(font, font_desc, base_font);
 }
 
-void Fonts::insert_matrix_type3(const string &font_name, const dict_t &font)
+matrix_t Fonts::Cache::get_matrix_type3(const dict_t &font) const
 {
     const pair<string, pdf_object_t> p = font.at("/FontMatrix");
     if (p.second != ARRAY) throw pdf_error(FUNC_STRING + "/FontMatrix must be ARRAY. Type=" + to_string(p.second) +
@@ -179,18 +214,13 @@ void Fonts::insert_matrix_type3(const string &font_name, const dict_t &font)
                                                      to_string(data[i].second) + " value=" + data[i].first);
         matrix[i] = stof(data[i].first);
     }
-    font_matrix_type_3.emplace(font_name, std::move(matrix));
+    return matrix;
 }
 
-Fonts::Font_type_t Fonts::insert_type(const string &font_name, const dict_t &font)
+Fonts::Font_type_t Fonts::Cache::get_type(const dict_t &font) const
 {
     const string type = font.at("/Subtype").first;
-    if (type == "/Type3")
-    {
-        types.emplace(font_name, TYPE_3);
-        return TYPE_3;
-    }
-    types.emplace(font_name, OTHER);
+    if (type == "/Type3") return TYPE_3;
     return OTHER;
 }
 
@@ -204,162 +234,166 @@ float Fonts::get_rise() const
     return rise;
 }
 
-void Fonts::insert_height(const string &font_name,
-                          const dict_t &font_desc,
-                          const ObjectStorage &storage,
-                          const string &base_font)
+void Fonts::reset_text_state()
+{
+    current_font = nullptr;
+    rise = RISE_DEFAULT;
+}
+
+void Fonts::set_text_state(const Fonts &parent)
+{
+    current_font = parent.current_font;
+    rise = parent.rise;
+}
+
+float Fonts::Cache::get_height(const dict_t &font_desc, const string &base_font) const
 {
     auto it = font_desc.find("/FontBBox");
     if (it == font_desc.end())
     {
-        auto it = std_metrics.find(base_font);
-        if (it == std_metrics.end())
-        {
-            heights.emplace(font_name, Fonts::NO_HEIGHT);
-            return;
-        }
-        heights.emplace(font_name, it->second.height);
-        return;
+        const font_metric_t *metric = get_std_metric(base_font);
+        if (!metric) return Fonts::NO_HEIGHT;
+        return metric->height;
     }
     const array_t array = get_array_or_indirect_array(it->second, storage);
-    heights.emplace(font_name, stof(array.at(3).first) - stof(array.at(1).first));
+    return stof(array.at(3).first) - stof(array.at(1).first);
 }
 
-void Fonts::insert_descent(const string &font_name,
-                           const dict_t &font_desc,
-                           const dict_t &font,
-                           const string &base_font,
-                           Font_type_t type,
-                           const ObjectStorage &storage)
+float Fonts::Cache::get_descent(const dict_t &font_desc,
+                                const dict_t &font,
+                                const string &base_font,
+                                Font_type_t type) const
 {
     auto it = font_desc.find("/Descent");
-    if (it != font_desc.end())
-    {
-        descents.emplace(font_name, stof(it->second.first));
-        return;
-    }
+    if (it != font_desc.end()) return stof(it->second.first);
     if (type == TYPE_3)
     {
         auto it = font.find("/FontBBox");
         if (it != font.end())
         {
             const array_t array = get_array_or_indirect_array(it->second, storage);
-            descents.emplace(font_name, stof(array.at(1).first));
-            return;
+            return stof(array.at(1).first);
         }
     }
 
-    auto it2 = std_metrics.find(base_font);
-    if (it2 != std_metrics.end())
-    {
-        descents.emplace(font_name, it2->second.descent);
-        return;
-    }
+    const font_metric_t *metric = get_std_metric(base_font);
+    if (metric) return metric->descent;
 
-    descents.emplace(font_name, Fonts::NO_DESCENT);
+    return Fonts::NO_DESCENT;
 }
 
-void Fonts::insert_ascent(const string &font_name,
-                          const dict_t &font_desc,
-                          const dict_t &font,
-                          const string &base_font,
-                          Font_type_t type,
-                          const ObjectStorage &storage)
+float Fonts::Cache::get_ascent(const dict_t &font_desc,
+                               const dict_t &font,
+                               const string &base_font,
+                               Font_type_t type) const
 {
     auto it = font_desc.find("/Ascent");
-    if (it != font_desc.end())
-    {
-        ascents.emplace(font_name, stof(it->second.first));
-        return;
-    }
+    if (it != font_desc.end()) return stof(it->second.first);
     if (type == TYPE_3)
     {
         auto it = font.find("/FontBBox");
         if (it != font.end())
         {
             const array_t array = get_array_or_indirect_array(it->second, storage);
-            ascents.emplace(font_name, stof(array.at(3).first));
-            return;
+            return stof(array.at(3).first);
         }
     }
 
-    auto it2 = std_metrics.find(base_font);
-    if (it2 != std_metrics.end())
-    {
-        ascents.emplace(font_name, it2->second.ascent);
-        return;
-    }
+    const font_metric_t *metric = get_std_metric(base_font);
+    if (metric) return metric->ascent;
 
-    ascents.emplace(font_name, Fonts::NO_ASCENT);
+    return Fonts::NO_ASCENT;
 }
 
 float Fonts::get_height() const
 {
     validate_current_font();
-    float height = heights.at(current_font);
+    float height = current_font->height;
     if (height == NO_HEIGHT) return get_ascent() - get_descent();
-    return height * get_scales().second;
+    return height * current_font->scales.second;
 }
 
 float Fonts::get_descent() const
 {
     validate_current_font();
-    return descents.at(current_font) * get_scales().second;
+    return current_font->descent * current_font->scales.second;
 }
 
 float Fonts::get_ascent() const
 {
     validate_current_font();
-    return ascents.at(current_font) * get_scales().second;
+    return current_font->ascent * current_font->scales.second;
 }
 
 const dict_t& Fonts::get_current_font_dictionary() const
 {
     validate_current_font();
-    return dictionary_per_font.at(current_font);
+    return current_font->dictionary;
+}
+
+const Fonts::font_data_t& Fonts::get_current_font() const
+{
+    validate_current_font();
+    return *current_font;
 }
 
 void Fonts::set_current_font(const string &font)
 {
-    current_font = font;
+    current_font = nullptr;
+    auto it = fonts.find(font);
+    if (it != fonts.end())
+    {
+        current_font = it->second;
+        return;
+    }
+    auto it2 = font_refs.find(font);
+    if (it2 == font_refs.end()) throw pdf_error(FUNC_STRING + "font " + font + " is not found in resources");
+    current_font = &cache->get_font(it2->second);
+    fonts.emplace(font, current_font);
 }
 
 void Fonts::validate_current_font() const
 {
-    if (current_font.empty()) throw pdf_error(FUNC_STRING + "current font is not set");
+    if (!current_font) throw pdf_error(FUNC_STRING + "current font is not set");
 }
 
 pair<float, float> Fonts::get_scales() const
 {
-    if (types.at(current_font) == OTHER) return make_pair(HSCALE_NO_TYPE_3, VSCALE_NO_TYPE_3);
-    return apply_matrix_norm(font_matrix_type_3.at(current_font), 1, 1);
+    validate_current_font();
+    return current_font->scales;
 }
 
 const float Fonts::VSCALE_NO_TYPE_3 = 0.001;
 const float Fonts::HSCALE_NO_TYPE_3 = 0.001;
 const float Fonts::NO_HEIGHT = 0;
-const float Fonts::NO_DESCENT = 0;
 const float Fonts::RISE_DEFAULT = 0;
-const float Fonts::NO_ASCENT = 0;
 const unsigned int Fonts::FIRST_CHAR_DEFAULT = 0;
 const float Fonts::MISSING_WIDTH_DEFAULT = 0;
 const float Fonts::DW_DEFAULT = 1000;
-const unordered_map<string, Fonts::font_metric_t> Fonts::std_metrics = {
-    {"/Courier", font_metric_t(627, -194, 1052)},
-    {"/Courier-Bold", font_metric_t(627, -194, 1060)},
-    {"/Courier-BoldOblique", font_metric_t(627, -194, 1060)},
-    {"/Courier-Oblique", font_metric_t(627, -194, 1052)},
-    {"/Helvetica", font_metric_t(718, -207, 1156)},
-    {"/Helvetica-Bold", font_metric_t(718, -207, 1190)},
-    {"/Helvetica-BoldOblique", font_metric_t(718, -207, 1190)},
-    {"/Helvetica-Oblique", font_metric_t(718, -207, 1156)},
-    {"/Symbol", font_metric_t(NO_ASCENT, NO_DESCENT, 1303)},
-    {"/Times-Bold", font_metric_t(683, -217, 1153)},
-    {"/Times-BoldItalic", font_metric_t(683, -217, 1139)},
-    {"/Times-Italic", font_metric_t(683, -217, 1100)},
-    {"/Times-Roman", font_metric_t(683, -217, 1116)},
-    {"/ZapfDingbats", font_metric_t(NO_ASCENT, NO_DESCENT, 963)}};
-
-const unordered_map<string, vector<pair<unsigned int, float>>> Fonts::standard_widths =
-    #include "standard_widths.h"
-    ;
+
+const Fonts::font_metric_t* Fonts::get_std_metric(const string &base_font)
+{
+    //sorted by font name
+    static constexpr font_metric_t std_metrics[] = {{"/Courier", 627, -194, 1052},
+                                                    {"/Courier-Bold", 627, -194, 1060},
+                                                    {"/Courier-BoldOblique", 627, -194, 1060},
+                                                    {"/Courier-Oblique", 627, -194, 1052},
+                                                    {"/Helvetica", 718, -207, 1156},
+                                                    {"/Helvetica-Bold", 718, -207, 1190},
+                                                    {"/Helvetica-BoldOblique", 718, -207, 1190},
+                                                    {"/Helvetica-Oblique", 718, -207, 1156},
+                                                    {"/Symbol", NO_ASCENT, NO_DESCENT, 1303},
+                                                    {"/Times-Bold", 683, -217, 1153},
+                                                    {"/Times-BoldItalic", 683, -217, 1139},
+                                                    {"/Times-Italic", 683, -217, 1100},
+                                                    {"/Times-Roman", 683, -217, 1116},
+                                                    {"/ZapfDingbats", NO_ASCENT, NO_DESCENT, 963}};
+    return find_standard_font(std_metrics, base_font);
+}
+
+Fonts::Widths Fonts::get_standard_widths(const string &base_font)
+{
+    const standard_widths_t *widths = find_standard_font(standard_widths, base_font);
+    if (!widths) return Widths();
+    return Widths(widths->widths, widths->size);
+}
@@ -6,140 +6,93 @@
 #include <array>
 #include <utility>
 #include <unordered_map>
-#include <new>
+#include <vector>
 
 #include "object_storage.h"
 #include "common.h"
 
 class Fonts
 {
+private:
+    class Widths;
 public:
-    Fonts(const ObjectStorage &storage, const dict_t &fonts_dict);
+    enum Font_type_t { TYPE_3, OTHER };
+    //font record. It is built once per font object and shared by all resources referencing this font
+    struct font_data_t;
+    //document-wide storage of font records, keyed by font object id
+    class Cache;
+
+    Fonts(Cache &cache_arg, const dict_t &fonts_dict);
     const dict_t& get_current_font_dictionary() const;
+    const font_data_t& get_current_font() const;
     float get_height() const;
     void set_current_font(const std::string &font_arg);
     void set_rise(float rise_arg);
     float get_rise() const;
+    //text state (current font and rise) of page start
+    void reset_text_state();
+    //text state of parent content, form is drawn with it
+    void set_text_state(const Fonts &parent);
     float get_descent() const;
     float get_ascent() const;
     std::pair<float, float> get_scales() const;
     float get_width(unsigned int code) const;
     float get_width(const std::string &s) const;
 private:
-    enum Font_type_t { TYPE_3, OTHER };
-    Font_type_t insert_type(const std::string &font_name, const dict_t &font_desc);
-    void insert_descendant(dict_t &font, const ObjectStorage &storage);
-    void insert_descent(const std::string &font_name,
-                        const dict_t &font_desc,
-                        const dict_t &font,
-                        const std::string &base_font,
-                        Font_type_t type,
-                        const ObjectStorage &storage);
-    void insert_ascent(const std::string &font_name,
-                       const dict_t &font_desc,
-                       const dict_t &font,
-                       const std::string &base_font,
-                       Font_type_t type,
-                       const ObjectStorage &storage);
-    void insert_height(const std::string &font_name,
-                       const dict_t &font_desc,
-                       const ObjectStorage &storage,
-                       const std::string &base_font);
     void validate_current_font() const;
-    void insert_matrix_type3(const std::string &font_name, const dict_t &font_desc);
-    void insert_widths(const ObjectStorage &storage,
-                       const std::string &font_name,
-                       const dict_t &font_desc,
-                       const std::string &base_font);
-    void insert_widths_from_widths(const ObjectStorage &storage,
-                                   const std::string &font_name,
-                                   const dict_t &font_desc,
-                                   const std::string &base_font);
-    void insert_widths_from_w(const ObjectStorage &storage, const std::string &font_name, const std::string &base_font);
 
     struct font_metric_t
     {
-        font_metric_t(float ascent_arg, float descent_arg, float height_arg) noexcept :
-                      ascent(ascent_arg),
-                      descent(descent_arg),
-                      height(height_arg)
-        {
-        }
+        const char *font;
         float ascent;
         float descent;
         float height;
     };
 
+    //widths sorted by code. They are either built for font or point to widths of standard font
     class Widths
     {
     public:
-        Widths() : widths(new std::vector<std::pair<unsigned int, float>>), to_be_deleted(true)
-        {
-        }
-
-        Widths(const std::vector<std::pair<unsigned int, float>> *arg) noexcept :
-               widths(const_cast<std::vector<std::pair<unsigned int, float>>*>(arg)), to_be_deleted(false)
-        {
-        }
-
-        ~Widths() noexcept
-        {
-            if (to_be_deleted) delete widths;
-        }
-
-        Widths(Widths &&arg) : widths(arg.widths), to_be_deleted(arg.to_be_deleted)
+        Widths() noexcept : standard(nullptr), standard_size(0)
         {
-            arg.widths = nullptr;
-            arg.to_be_deleted = false;
         }
 
-        Widths(const Widths &arg) : to_be_deleted(arg.to_be_deleted)
+        Widths(const std::pair<unsigned int, float> *standard_arg, size_t standard_size_arg) noexcept :
+               standard(standard_arg), standard_size(standard_size_arg)
         {
-            if (to_be_deleted)
-            {
-                widths = new std::vector<std::pair<unsigned int, float>>;
-                *widths = *arg.widths;
-                return;
-            }
-            widths = arg.widths;
         }
 
+        Widths(Widths &&arg) = default;
+        Widths(const Widths &arg) = delete;
         Widths& operator=(const Widths &arg) = delete;
         Widths& operator=(Widths &&arg) = delete;
 
-        const std::vector<std::pair<unsigned int, float>>* operator->() const
+        //widths to be filled
+        std::vector<std::pair<unsigned int, float>>* operator*()
         {
-            return widths;
+            return &widths;
         }
 
-        std::vector<std::pair<unsigned int, float>>* operator->()
+        const std::pair<unsigned int, float>* data() const
         {
-            return widths;
+            return standard? standard : widths.data();
         }
 
-        const std::vector<std::pair<unsigned int, float>>* operator*() const
+        size_t size() const
         {
-            return widths;
-        }
-
-        std::vector<std::pair<unsigned int, float>>* operator*()
-        {
-            return widths;
+            return standard? standard_size : widths.size();
         }
     private:
-        std::vector<std::pair<unsigned int, float>> *widths;
-        bool to_be_deleted;
+        std::vector<std::pair<unsigned int, float>> widths;
+        const std::pair<unsigned int, float> *standard;
+        size_t standard_size;
     };
 
-    std::string current_font;
-    std::map<std::string, dict_t> dictionary_per_font;
-    std::map<std::string, float> heights;
-    std::map<std::string, float> descents;
-    std::map<std::string, float> ascents;
-    std::map<std::string, Font_type_t> types;
-    std::map<std::string, Widths> widths;
-    std::map<std::string, float> default_width;
-    std::map<std::string, matrix_t> font_matrix_type_3;
+    Cache *cache;
+    //font name -> font object. Font record is taken from cache on first set_current_font
+    dict_t font_refs;
+    std::map<std::string, const font_data_t*> fonts;
+    const font_data_t *current_font;
     float rise;
 
     static const float VSCALE_NO_TYPE_3;
@@ -148,11 +101,73 @@ private:
     static const float MISSING_WIDTH_DEFAULT;
     static const float DW_DEFAULT;
     static const float NO_HEIGHT;
-    static const float NO_DESCENT;
+    static constexpr float NO_DESCENT = 0;
     static const float RISE_DEFAULT;
-    static const float NO_ASCENT;
-    static const std::unordered_map<std::string, font_metric_t> std_metrics;
-    static const std::unordered_map<std::string, std::vector<std::pair<unsigned int, float>>> standard_widths;
+    static constexpr float NO_ASCENT = 0;
+    static const font_metric_t* get_std_metric(const std::string &base_font);
+    static Widths get_standard_widths(const std::string &base_font);
+};
+
+struct Fonts::font_data_t
+{
+    font_data_t(dict_t &&dictionary_arg,
+                Font_type_t type_arg,
+                const matrix_t &font_matrix_arg,
+                std::pair<Widths, float> &&widths_arg,
+                float height_arg,
+                float descent_arg,
+                float ascent_arg) :
+                dictionary(std::move(dictionary_arg)),
+                type(type_arg),
+                scales((type == OTHER)? std::make_pair(HSCALE_NO_TYPE_3, VSCALE_NO_TYPE_3) :
+                                        apply_matrix_norm(font_matrix_arg, 1, 1)),
+                widths(std::move(widths_arg.first)),
+                default_width(widths_arg.second),
+                height(height_arg),
+                descent(descent_arg),
+                ascent(ascent_arg)
+    {
+    }
+
+    dict_t dictionary;
+    Font_type_t type;
+    std::pair<float, float> scales;
+    Widths widths;
+    float default_width;
+    float height;
+    float descent;
+    float ascent;
+};
+
+class Fonts::Cache
+{
+public:
+    explicit Cache(const ObjectStorage &storage_arg);
+    const font_data_t& get_font(const std::pair<std::string, pdf_object_t> &font_ref);
+private:
+    font_data_t make_font(const std::pair<std::string, pdf_object_t> &font_ref) const;
+    Font_type_t get_type(const dict_t &font) const;
+    void insert_descendant(dict_t &font) const;
+    float get_descent(const dict_t &font_desc,
+                      const dict_t &font,
+                      const std::string &base_font,
+                      Font_type_t type) const;
+    float get_ascent(const dict_t &font_desc,
+                     const dict_t &font,
+                     const std::string &base_font,
+                     Font_type_t type) const;
+    float get_height(const dict_t &font_desc, const std::string &base_font) const;
+    matrix_t get_matrix_type3(const dict_t &font) const;
+    std::pair<Widths, float> get_widths(const dict_t &font, const dict_t &font_desc, const std::string &base_font) const;
+    std::pair<Widths, float> get_widths_from_widths(const dict_t &font,
+                                                    const dict_t &font_desc,
+                                                    const std::string &base_font) const;
+    std::pair<Widths, float> get_widths_from_w(const dict_t &font, const std::string &base_font) const;
+
+    const ObjectStorage &storage;
+    std::unordered_map<unsigned int, font_data_t> indirect_fonts;
+    //fonts defined directly in resource dictionary, keyed by font dictionary
+    std::unordered_map<std::string, font_data_t> direct_fonts;
 };
 
 #endif
@@ -0,0 +1,33 @@
+#include <string>
+#include <utility>
+#include <cstdint>
+
+#include "glyph_names.h"
+
+using namespace std;
+
+namespace
+{
+    //name and symbol are stored in glyph_blob
+    struct glyph_t
+    {
+        uint32_t name_offset;
+        uint32_t symbol_offset;
+        uint8_t name_length;
+        uint8_t symbol_length;
+    };
+
+    #include "glyph_table.h"
+}
+
+pair<const char*, size_t> get_glyph_symbol(const string &name)
+{
+    //bucket seed places every name of the bucket into its own slot
+    const uint32_t seed = glyph_seeds[glyph_name_hash(name.data(), name.length(), 0) % GLYPH_BUCKETS];
+    const glyph_t &glyph = glyphs[glyph_name_hash(name.data(), name.length(), seed) % GLYPHS_NUM];
+    if (name.compare(0, string::npos, glyph_blob + glyph.name_offset, glyph.name_length) != 0)
+    {
+        return make_pair(nullptr, 0);
+    }
+    return make_pair(glyph_blob + glyph.symbol_offset, glyph.symbol_length);
+}
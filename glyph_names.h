@@ -0,0 +1,19 @@
+#ifndef GLYPH_NAMES_H
+#define GLYPH_NAMES_H
+
+#include <string>
+#include <utility>
+#include <cstdint>
+
+//seeded FNV-1a hash of glyph names, shared with tools/gen_glyph_table.cc
+inline uint32_t glyph_name_hash(const char *s, size_t len, uint32_t seed)
+{
+    uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (size_t i = 0; i < len; ++i) h = (h ^ static_cast<unsigned char>(s[i])) * 16777619u;
+    return h ^ (h >> 15);
+}
+
+//utf8 symbol and its length for glyph name like "/Adieresis", nullptr if name is unknown
+std::pair<const char*, size_t> get_glyph_symbol(const std::string &name);
+
+#endif //GLYPH_NAMES_H
@@ -0,0 +1,6300 @@
+//generated by tools/gen_glyph_table.cc
+enum : uint32_t { GLYPHS_NUM = 4243, GLYPH_BUCKETS = 1061 };
+
+constexpr char glyph_blob[] =
+    "/kiromeetorusquare\343\214\226/ehookabove"
+    "\341\272\273/Ycircumflex\305\266/beta\316\262/ninedev"
+    "a\340\245\257/noonghunnaarabic\332\272/seenmedi"
+    "alarabic\357\272\264/Acute\357\233\211/eightsuperi"
+    "or\342\201\270/whitecornerbracketleftvert"
+    "ical\357\271\203/adblgrave\310\201/khokhwaithai"
+    "\340\270\204/ffl\357\254\204/zparen\342\222\265/afii10029\320\233"
+    "/AEmacron\307\242/sixcircle\342\221\245/d/afii1"
+    "0083\321\201/zayinhebrew\327\226/alefarabic\330"
+    "\247/periodsmall\357\271\222/:/tatweelarabic"
+    "\331\200/ninegujarati\340\253\257/sixgujarati\340\253"
+    "\254/theta1\317\221/asmallhiragana\343\201\201/rin"
+    "vertedbreve\310\223/glottalstopreverse"
+    "dsuperior\313\244/afii10090\321\210/asymptot"
+    "icallyequal\342\211\203/Ucircumflex\303\233/idi"
+    "eresisacute\341\270\257/uhiragana\343\201\206/nonb"
+    "reakingspace\302\240/ideographicfinanc"
+    "ialcircle\343\212\226/gereshaccenthebrew\326"
+    "\234/zeroinferior\342\202\200/chbopomofo\343\204\224/"
+    "lcircumflexbelow\341\270\275/onecircleinv"
+    "ersesansserif\342\236\212/ntilde\303\261/twoper"
+    "iod\342\222\211/Psicyrillic\321\260/Asmall\357\235\241/k"
+    "monospace\357\275\213/oogurmukhi\340\250\223/qmono"
+    "space\357\275\221/phieuphkorean\343\205\215/aogone"
+    "k\304\205/tikeutparenkorean\343\210\202/Lcircle"
+    "\342\223\201/afii57694\357\254\252/Z/horizontalbar"
+    "\342\200\225/rieulyeorinhieuhkorean\343\205\255/xb"
+    "opomofo\343\204\222/muhiragana\343\202\200/Ohookab"
+    "ove\341\273\216/ringbelowcmb\314\245/aumatragur"
+    "mukhi\340\251\214/Yhook\306\263/hatafqamats1b\326\263"
+    "/questiondown\302\277/controlSTX\001/Ocir"
+    "cle\342\223\204/btopbar\306\203/deleteright\342\214\246/"
+    "Alpha\316\221/Dhook\306\212/ohorntilde\341\273\241/pa"
+    "renrightaltonearabic\357\264\277/kagujara"
+    "ti\340\252\225/sacutedotaccent\341\271\245/seenara"
+    "bic\330\263/thousandsseparatorpersian\331"
+    "\254/fouroldstyle\357\234\264/ninehackarabic"
+    "\331\251/braceleftbt\357\243\263/Ifraktur\342\204\221/pu"
+    "katakana\343\203\227/vadeva\340\244\265/dnblock\342\226\204"
+    "/afii57455\331\217/Hbrevebelow\341\270\252/zcir"
+    "cumflex\341\272\221/sioscieuckorean\343\205\276/ap"
+    "ple\357\243\277/kmcubedsquare\343\216\246/zerogurm"
+    "ukhi\340\251\246/afii10049\320\257/Acircumflexg"
+    "rave\341\272\246/afii57802/Icaron\307\217/Ecirc"
+    "le\342\222\272/reshhebrew\327\250/hatafpatahqua"
+    "rterhebrew\326\262/noonjeeminitialarab"
+    "ic\357\263\222/Adieresiscyrillic\323\222/Ncircl"
+    "e\342\223\203/twopersian\333\262/afii10043\320\251/za"
+    "qefqatanhebrew\326\224/Wcircle\342\223\214/hehe"
+    "brew\327\224/Shchacyrillic/samekhdages"
+    "h\357\255\201/echarmenian\325\245/Stigmagreek\317\232"
+    "/munahlefthebrew\326\243/ssanghieuhkor"
+    "ean\343\206\205/registersans\357\243\250/gjecyrill"
+    "ic\321\223/afii57448\331\210/wekatakana\343\203\261/a"
+    "fii57658\327\203/afii10050\322\220/tehmedial"
+    "arabic\357\272\230/guramusquare\343\214\230/afii10"
+    "021\320\224/block\342\226\210/Tonefive\306\274/afii57"
+    "444\331\204/supersetnotequal\342\212\213/afii57"
+    "797\326\270/Ainvertedbreve\310\202/tehhahini"
+    "tialarabic\357\262\242/notequal\342\211\240/Jcircl"
+    "e\342\222\277/hiriq2d\326\264/vecyrillic\320\262/Omeg"
+    "aroundcyrillic\321\272/kiroguramusquar"
+    "e\343\214\225/tackdown\342\212\244/fivegurmukhi\340\251\253"
+    "/yoyingthai\340\270\215/fourteenperiod\342\222\225"
+    "/Ecedillabreve\341\270\234/tusmallkatakan"
+    "ahalfwidth\357\275\257/dbsquare\343\217\210/upsilo"
+    "n\317\205/qubutsquarterhebrew\326\273/ezhrev"
+    "ersed\306\271/onemonospace\357\274\221/fivehack"
+    "arabic\331\245/Uring\305\256/zretroflexhook\312"
+    "\220/propersuperset\342\212\203/afii10038\320\244/"
+    "chedescenderabkhasiancyrillic\322\277/"
+    "qamatsqatanquarterhebrew/iigurmu"
+    "khi\340\250\210/dotkatakana\343\203\273/lagujarati"
+    "\340\252\262/tserenarrowhebrew\326\265/Iacutesm"
+    "all\357\237\255/Edot\304\226/tccurl\312\250/bracketri"
+    "ght]/eightgujarati\340\253\256/ihookabove"
+    "\341\273\211/Shacyrillic\320\250/sixarabic\331\246/db"
+    "langlebracketleft\343\200\212/syouwaerasq"
+    "uare\343\215\274/Bcircle\342\222\267/xmonospace\357\275\230"
+    "/ideographicsunparen\343\210\260/mturned\311"
+    "\257/sixcircleinversesansserif\342\236\217/S"
+    "F490000\342\225\231/florin\306\222/phieuphcircl"
+    "ekorean\343\211\254/pdotaccent\341\271\227/Ocircum"
+    "flexgrave\341\273\222/minus\342\210\222/shin\327\251/omg"
+    "ujarati\340\253\220/ocyrillic\320\276/S/Cheabkh"
+    "asiancyrillic\322\274/Ezhreversed\306\270/Nc"
+    "edilla\305\205/kakatakana\343\202\253/notlessno"
+    "requal\342\211\260/pmsquare\343\217\230/jhagurmukh"
+    "i\340\250\235/afii57415/kabengali\340\246\225/llla"
+    "deva\340\244\264/Kabashkircyrillic\322\240/arro"
+    "wupdownbase\342\206\250/SF190000\342\225\241/fivem"
+    "onospace\357\274\225/tagujarati\340\252\244/mekata"
+    "kanahalfwidth\357\276\222/spade\342\231\240/tokata"
+    "kana\343\203\210/amacron\304\201/ainarabic\330\271/pe"
+    "rcentsmall\357\271\252/slashmonospace\357\274\217/"
+    "udieresis\303\274/udieresismacron\307\226/so"
+    "katakanahalfwidth\357\275\277/quotedblmon"
+    "ospace\357\274\202/arrowheaddownmod\313\205/wow"
+    "aenthai\340\270\247/eacute\303\251/hiriqquarter"
+    "hebrew/hehfinalaltonearabic\357\256\247/q"
+    "uotedblprimereversed\343\200\235/asterisk"
+    "*/male\342\231\202/tsere/theharabic\330\253/uci"
+    "rcumflexbelow\341\271\267/wasmallhiragana"
+    "\343\202\216/ringhalfleft\312\277/cdsquare\343\217\205/a"
+    "fii57665\327\221/siosacirclekorean\343\211\264/"
+    "alefpatahhebrew\357\254\256/shaddakasraar"
+    "abic\357\261\242/4/ndotaccent\341\271\205/percenta"
+    "rabic\331\252/sevenhangzhou\343\200\247/dittoma"
+    "rk\343\200\203/Tcommaaccent\305\242/Upsilonhook"
+    "symbol\317\222/copyrightserif\357\233\231/zohir"
+    "agana\343\201\236/hiriqnarrowhebrew/rvoca"
+    "licdeva\340\244\213/Nlinebelow\341\271\210/Zstroke"
+    "\306\265/tenperiod\342\222\221/Uhornhookabove\341\273"
+    "\254/Ohornhookabove\341\273\236/tthagurmukhi"
+    "\340\250\240/tehmarbutafinalarabic\357\272\224/Ton"
+    "etwo\306\247/wakatakanahalfwidth\357\276\234/af"
+    "ii57432\330\270/uptackbelowcmb\314\235/Jaarm"
+    "enian\325\201/asmallkatakana\343\202\241/corner"
+    "bracketrighthalfwidth\357\275\243/Xdieres"
+    "is\341\272\214/etnahtalefthebrew\326\221/Ghook\306"
+    "\223/sindothebrew\327\202/tahfinalarabic\357"
+    "\273\202/Adotmacron\307\240/sparen\342\222\256/exclam"
+    "left!/cedillacmb\314\247/afii57440/kap"
+    "yeounphieuphkorean\343\206\204/Lcedilla\304\273"
+    "/rhook\311\275/bqsquare\343\217\203/aeacute\307\275/w"
+    "hitestar\342\230\206/raarmenian\325\274/Uhorn\306\257"
+    "/afii10033\320\237/iucyrillic\321\216/rrehar"
+    "abic\332\221/odotbelow\341\273\215/Q/upsilondie"
+    "resis\317\213/afii61573\342\200\254/yehhamzaabo"
+    "vefinalarabic\357\272\212/gukatakana\343\202\260/U"
+    "invertedbreve\310\226/ugurmukhi\340\250\211/lak"
+    "khangyaothai\340\271\205/ascript\311\221/Nowarm"
+    "enian\325\206/semicolonsmall\357\271\224/alefqa"
+    "matshebrew\357\254\257/union\342\210\252/finaltsad"
+    "ihebrew\327\245/bokatakana\343\203\234/logicala"
+    "nd\342\210\247/habengali\340\246\271/afii10026\320\230/k"
+    "hagujarati\340\252\226/lamalefhamzabelowi"
+    "solatedarabic\357\273\271/fl\357\254\202/Dslash\304\220/"
+    "sukunarabic\331\222/ideographiclowcirc"
+    "le\343\212\246/chagurmukhi\340\250\233/kekatakanah"
+    "alfwidth\357\275\271/arrowdblleft\342\207\220/brac"
+    "ketrighttp\357\243\271/arrowleftwhite\342\207\246/"
+    "Nsmall\357\235\256/ideographiccallparen\343\210"
+    "\272/ideographichighcircle\343\212\244/multi"
+    "ply\303\227/addakgurmukhi\340\251\261/Ncommaacc"
+    "ent/afii61575\342\200\256/pansioskorean\343\205"
+    "\277/yasmallhiragana\343\202\203/mvmegasquar"
+    "e\343\216\271/Pdotaccent\341\271\226/ekatakana\343\202\250/"
+    "macroncmb\314\204/IUcyrillic\320\256/nlegrig"
+    "htlong\306\236/tonebarhighmod\313\246/Gstrok"
+    "e\307\244/question\077/nieuncirclekorean\343"
+    "\211\241/twoinferior\342\202\202/shinsindothebr"
+    "ew\357\254\253/bracketleftbt\357\243\260/ssuperior"
+    "\357\233\262/twogujarati\340\253\250/sixsuperior\342\201"
+    "\266/blackrectangle\342\226\254/sevenarabic\331"
+    "\247/arrowleft\342\206\220/ninecircle\342\221\250/Aci"
+    "rcumflexdotbelow\341\272\254/mokatakanaha"
+    "lfwidth\357\276\223/fourmonospace\357\274\224/shad"
+    "e\342\226\222/tencircle\342\221\251/lmonospace\357\275\214/"
+    "peezisquare\343\214\273/afii57416\330\250/igrav"
+    "e\303\254/Voarmenian\325\210/acircumflexdotb"
+    "elow\341\272\255/mansyonsquare\343\215\207/Kmonosp"
+    "ace\357\274\253/sosothai\340\270\213/ninecircleinv"
+    "ersesansserif\342\236\222/segolquarterheb"
+    "rew\326\266/schwadieresiscyrillic\323\233/ba"
+    "katakana\343\203\220/gokatakana\343\202\264/mmonos"
+    "pace\357\275\215/wavyunderscorevertical\357\270"
+    "\264/yuslittleiotifiedcyrillic\321\251/ha"
+    "katakana\343\203\217/tonebarextrahighmod\313"
+    "\245/fi\357\254\201/vhook\312\213/aekorean\343\205\220/squa"
+    "recc\343\217\204/Yacutesmall\357\237\275/upsilondi"
+    "eresistonos\316\260/centigrade\342\204\203/oneb"
+    "engali\340\247\247/jehfinalarabic\357\256\213/colo"
+    "ntriangularmod\313\220/Fourroman\342\205\243/ro"
+    "katakanahalfwidth\357\276\233/olehebrew\326\253"
+    "/yerahbenyomolefthebrew\326\252/tippig"
+    "urmukhi\340\251\260/saraaathai\340\270\262/wihirag"
+    "ana\343\202\220/afii57417\330\251/twothai\340\271\222/ut"
+    "ilde\305\251/kparen\342\222\246/Gbreve\304\236/bdotbe"
+    "low\341\270\205/0/Uhungarumlautcyrillic\323\262"
+    "/Edotaccent/khaharabic\330\256/hyphens"
+    "mall\357\271\243/registerserif\357\233\232/filledr"
+    "ect/Lslash\305\201/asteriskmath\342\210\227/afi"
+    "i10087\321\205/dcaron\304\217/chekhakassianc"
+    "yrillic\323\214/s/mahapakhlefthebrew\326\244"
+    "/zlinebelow\341\272\225/iideva\340\244\210/ideogra"
+    "phicresourceparen\343\210\276/threeinferi"
+    "or\342\202\203/qofhebrew\327\247/whitediamond\342\227"
+    "\207/shadelight\342\226\221/vehinitialarabic"
+    "\357\255\254/ringhalfleftarmenian\325\231/noonj"
+    "eemisolatedarabic\357\261\213/asteriskmon"
+    "ospace\357\274\212/maichattawathai\340\271\213/per"
+    "iodarmenian\326\211/rvocalicvowelsignb"
+    "engali\340\247\203/acaron\307\216/yosmallhiraga"
+    "na\343\202\207/Enghecyrillic\322\244/dadeva\340\244\246/"
+    "jis\343\200\204/rvocalicvowelsigndeva\340\245\203/"
+    "Tiwnarmenian\325\217/Yiwnarmenian\325\222/co"
+    "rnerbracketlefthalfwidth\357\275\242/five"
+    "roman\342\205\264/bracerightmid\357\243\275/Omegag"
+    "reek\316\251/pefinaldageshhebrew\357\255\203/nn"
+    "abengali\340\246\243/bullseye\342\227\216/ubreve\305\255"
+    "/SF200000\342\225\242/kiyeoksioskorean\343\204\263"
+    "/horncmb\314\233/asciicircummonospace\357"
+    "\274\276/seveneighths\342\205\236/Rdotbelowmacr"
+    "on\341\271\234/questionarmenian\325\236/rdotbel"
+    "ow\341\271\233/overlinecenterline\357\271\212/icyr"
+    "illic\321\226/yehbarreefinalarabic\357\256\257/"
+    "Circumflexsmall\357\233\266/jagujarati\340\252\234"
+    "/Adieresissmall\357\237\244/tikeutcirclek"
+    "orean\343\211\242/space /tekatakana\343\203\206/pa"
+    "iyannoithai\340\270\257/dhagurmukhi\340\250\247/re"
+    "shdageshhebrew\357\255\210/icircle\342\223\230/uub"
+    "engali\340\246\212/sarauthai\340\270\270/SF070000\342"
+    "\224\264/afii57669\327\225/asterisksmall\357\271\241/"
+    "rieulcirclekorean\343\211\243/Chevertical"
+    "strokecyrillic\322\270/four/usmallkata"
+    "kanahalfwidth\357\275\251/wynn\306\277/khahmedi"
+    "alarabic\357\272\250/sixpersian\333\266/superse"
+    "t/Yicyrillic\320\207/tonesix\306\205/gdotacc"
+    "ent\304\241/club\342\231\243/sheeninitialarabic"
+    "\357\272\267/afii10103/nundagesh\357\255\200/fagur"
+    "mukhi\340\251\236/afii57514/jcircle\342\223\231/mo"
+    "hmsquare\343\217\201/itildebelow\341\270\255/Yusbi"
+    "giotifiedcyrillic\321\254/Emacron\304\222/id"
+    "eographicsuperviseparen\343\210\274/ssagu"
+    "jarati\340\252\267/nkatakana\343\203\263/lcommaacc"
+    "ent\304\274/tipehalefthebrew\326\226/control"
+    "SI\017/yuslittlecyrillic\321\247/reviamug"
+    "rashhebrew\326\227/rcedilla\305\227/contouri"
+    "ntegral\342\210\256/kokatakana\343\202\263/notcont"
+    "ains\342\210\214/Hoarmenian\325\200/clickalveol"
+    "ar\307\202/ktsquare\343\217\217/Macronsmall\357\236\257/"
+    "estimated\342\204\256/bikatakana\343\203\223/rhook"
+    "turned\311\273/thirteenparen\342\222\200/questi"
+    "ondownsmall\357\236\277/scommaaccent\310\231/Ez"
+    "hcaron\307\256/tihiragana\343\201\241/xeharmeni"
+    "an\325\255/siosnieunkorean\343\205\273/quoterig"
+    "ht\342\200\231/mieumpieupkorean\343\205\256/bcircl"
+    "e\342\223\221/colonmonospace\357\274\232/orthogona"
+    "l\342\210\237/zerodeva\340\245\246/pieupparenkorea"
+    "n\343\210\205/Chekhakassiancyrillic\323\213/arr"
+    "owupright\342\206\227/revlogicalnot\342\214\220/ez"
+    "h\312\222/obarred\311\265/squareverticalfill"
+    "\342\226\245/patahnarrowhebrew\326\267/dieresis"
+    "tonos\316\205/aacute\303\241/Hcedilla\341\270\250/uko"
+    "rean\343\205\234/dadfinalarabic\357\272\276/haalto"
+    "nearabic\333\201/chaarmenian\325\271/khieukh"
+    "parenkorean\343\210\212/iterationhiragana"
+    "\343\202\235/Decyrillic/dalarabic\330\257/tavda"
+    "gesh\357\255\212/cornerbracketleft\343\200\214/rlo"
+    "ngleg\311\274/tdieresis\341\272\227/qubutswideh"
+    "ebrew/hokatakanahalfwidth\357\276\216/mas"
+    "quare\343\216\203/afii10037\320\243/gravelowmod"
+    "\313\216/izhitsadblgravecyrillic\321\267/yos"
+    "mallkatakanahalfwidth\357\275\256/hieuhap"
+    "arenkorean\343\210\233/nikhahitthai\340\271\215/to"
+    "armenian\325\251/afii10054\320\205/tortoises"
+    "hellbracketrightsmall\357\271\236/Hcircle"
+    "\342\222\275/KBsquare\343\216\205/ttagujarati\340\252\237/p"
+    "lus+/ghemiddlehookcyrillic\322\225/qaf"
+    "finalarabic\357\273\226/nyagurmukhi\340\250\236/we"
+    "hiragana\343\202\221/arrowleftoverright\342\207"
+    "\206/usmallhiragana\343\201\205/gscript\311\241/qa"
+    "matsnarrowhebrew/afii10099\321\222/iec"
+    "yrillic\320\265/badeva\340\244\254/Gsmall\357\235\247/id"
+    "eographicearthparen\343\210\257/Ssmall\357\235\263"
+    "/sentosquare\343\214\243/eturned\307\235/shbopo"
+    "mofo\343\204\225/whitecornerbracketrightv"
+    "ertical\357\271\204/centinferior\357\233\237/afii1"
+    "0059\320\212/SF430000\342\225\220/Einvertedbrev"
+    "e\310\206/tsere1e/qamatsde/behfinalara"
+    "bic\357\272\220/fmonospace\357\275\206/female\342\231\200/A"
+    "ogonek\304\204/sixteencircle\342\221\257/Dotacc"
+    "entsmall\357\233\267/%/perispomenigreekcm"
+    "b\315\202/infinity\342\210\236/Djecyrillic\320\202/Bd"
+    "otaccent\341\270\202/iivowelsigngujarati\340"
+    "\253\200/twelveroman\342\205\273/ucyrillic\321\203/ei"
+    "ghtdeva\340\245\256/ddabengali\340\246\241/yagurmu"
+    "khi\340\250\257/Elevenroman\342\205\252/danda\340\245\244/e"
+    "xclamdown\302\241/Gjecyrillic\320\203/vikata"
+    "kana\343\203\270/greatermonospace\357\274\236/rreh"
+    "finalarabic\357\256\215/arrowdashright\342\207\242"
+    "/arrowrightdblstroke\342\207\217/tekataka"
+    "nahalfwidth\357\276\203/blacklowerrighttr"
+    "iangle\342\227\242/Horicoptic\317\250/vavholamh"
+    "ebrew\357\255\213/afii57796/sakatakana\343\202\265"
+    "/Qcircle\342\223\206/nieunpansioskorean\343\205"
+    "\250/whiterightpointingtriangle\342\226\267/"
+    "nokatakanahalfwidth\357\276\211/kturned\312\236"
+    "/khieukhkorean\343\205\213/arrowrightover"
+    "left\342\207\204/hehmedialaltonearabic\357\256\251"
+    "/dotbelowcomb\314\243/squarekmcapital\343"
+    "\217\216/yeharabic\331\212/afii10193\321\237/hohir"
+    "agana\343\201\273/invcircle\342\227\231/Icircle\342\222\276"
+    "/gafmedialarabic\357\256\225/afii57446\331\206/"
+    "dammaarabic/cosquare\343\217\207/yuyekore"
+    "an\343\206\213/augurmukhi\340\250\224/Yiarmenian\325\205"
+    "/controlVT\013/pecyrillic\320\277/fourguj"
+    "arati\340\253\252/rieulaparenkorean\343\210\221/ho"
+    "okabovecomb\314\211/breveinvertedbelow"
+    "cmb\314\257/yohiragana\343\202\210/|/jeeminitia"
+    "larabic\357\272\237/Ycircle\342\223\216/Shimacopti"
+    "c\317\254/uogonek\305\263/patah1d/rightangle"
+    "/ideographiccentrecircle\343\212\245/SF06"
+    "0000\342\224\254/H18533\342\227\217/het\327\227/uparen\342\222"
+    "\260/blackdownpointingtriangle\342\226\274/s"
+    "hinhebrew/samekhdageshhebrew/OE\305"
+    "\222/finalmem\327\235/three/zhedieresiscy"
+    "rillic\323\235/ocaron\307\222/centsuperior\357\233"
+    "\240/SF540000\342\225\252/invsmileface\342\230\273/mo"
+    "hiragana\343\202\202/cstretched\312\227/Llinebe"
+    "low\341\270\272/copyright\302\251/commasuperior"
+    "\357\233\242/afii10028\320\232/Zaarmenian\324\266/eig"
+    "htbengali\340\247\256/zstroke\306\266/(/spaceha"
+    "ckarabic/parenleftsuperior\342\201\275/ot"
+    "cyrillic\321\277/vavdagesh65\357\254\265/utilde"
+    "acute\341\271\271/topatakthai\340\270\217/shagujar"
+    "ati\340\252\266/f/afii57511\331\271/twoparen\342\221\265"
+    "/sixteenparen\342\222\203/Uogonek\305\262/pehme"
+    "dialarabic\357\255\231/blackuppointingsma"
+    "lltriangle\342\226\264/fehmedialarabic\357\273\224"
+    "/T/bhagurmukhi\340\250\255/ghadeva\340\244\230/Ken"
+    "armenian\324\277/ebopomofo\343\204\234/mieumpan"
+    "sioskorean\343\205\260/etildebelow\341\270\233/Rco"
+    "mmaaccent\305\226/pakatakana\343\203\221/dollar"
+    "$/yehhamzaabovearabic\330\246/tonetwo\306"
+    "\250/lvocalicdeva\340\244\214/yacute\303\275/grave"
+    "`/ysuperior\312\270/afii57842\327\200/bracke"
+    "trightex\357\243\272/babengali\340\246\254/rieulti"
+    "keutkorean\343\205\252/lamalefisolatedara"
+    "bic\357\273\273/Schwa\306\217/Oneroman\342\205\240/Odblg"
+    "rave\310\214/sosuathai\340\270\252/acircumflext"
+    "ilde\341\272\253/tav\327\252/dalethebrew\327\223/tehi"
+    "ragana\343\201\246/shacyrillic/wokatakana"
+    "halfwidth\357\275\246/ustraightcyrillic\322\257"
+    "/percentmonospace\357\274\205/afii10076\320\272"
+    "/hatafqamatsnarrowhebrew/Ohm\342\204\246/"
+    "gravedeva\340\245\223/rabengali\340\246\260/dargah"
+    "ebrew\326\247/Icircumflexsmall\357\237\256/notp"
+    "recedes\342\212\200/Odblacute\305\220/nohiragan"
+    "a\343\201\256/oinvertedbreve\310\217/tchehiniti"
+    "alarabic\357\255\274/Vdotbelow\341\271\276/voicedi"
+    "terationkatakana\343\203\276/ideographicr"
+    "eachparen\343\211\203/khieukhacirclekorea"
+    "n\343\211\270/ghainfinalarabic\357\273\216/nineben"
+    "gali\340\247\257/phieuphparenkorean\343\210\214/an"
+    "oteleia\316\207/controlESC\033/ideographi"
+    "cexcellentcircle\343\212\235/elevenroman\342"
+    "\205\272/kcircle\342\223\232/afii57689/equivale"
+    "nce\342\211\241/zakatakana\343\202\266/Lcaron\304\275/te"
+    "hhahisolatedarabic\357\260\214/kikatakana"
+    "halfwidth\357\275\267/SF280000\342\225\233/afii100"
+    "56/fourdeva\340\245\252/shindageshshindot"
+    "\357\254\254/ocircumflex\303\264/sixroman\342\205\265/hc"
+    "ircumflex\304\245/invbullet\342\227\230/bullet\342"
+    "\200\242/fivearabic/Theta\316\230/obopomofo\343"
+    "\204\233/ismallhiragana\343\201\203/longs\305\277/koo"
+    "posquare\343\214\236/hcircle\342\223\227/yehhamzaa"
+    "bovemedialarabic\357\272\214/karoriisquar"
+    "e\343\214\215/omonospace\357\275\217/arrowboth\342\206\224/"
+    "mirisquare\343\215\211/sukatakanahalfwidt"
+    "h\357\275\275/Rdblgrave\310\220/afii57398/lezh\311"
+    "\256/SF380000\342\225\232/acutebelowcmb\314\227/gh"
+    "ook\311\240/Oslashacute\307\276/aavowelsignd"
+    "eva\340\244\276/pssquare\343\216\260/kdotbelow\341\270\263/"
+    "dzcurl\312\245/cyrFlex\357\233\222/minuscircle\342"
+    "\212\226/ae\303\246/finalmemhebrew/wmonospac"
+    "e\357\275\227/alefmaksuramedialarabic\357\273\264/"
+    "apaatosquare\343\214\200/7/napostrophe\305\211/"
+    "afii10020\320\223/Dzhecyrillic\320\217/omacr"
+    "ongrave\341\271\221/tcommaaccent\305\243/rieult"
+    "hieuthkorean\343\204\276/slongdotaccent\341\272"
+    "\233/eng\305\213/acutecmb\314\201/cheharmenian\325"
+    "\263/uhookabove\341\273\247/eharmenian\325\247/khi"
+    "eukhaparenkorean\343\210\230/seventeenpar"
+    "en\342\222\204/braceright}/ring\313\232/etilde\341"
+    "\272\275/okorean\343\205\227/afii57413\330\245/equals"
+    "mall\357\271\246/Udieresiscyrillic\323\260/osma"
+    "llkatakanahalfwidth\357\275\253/pacute\341\271\225"
+    "/twogurmukhi\340\251\250/chochanthai\340\270\210/o"
+    "superior\357\233\260/asteriskarabic\331\255/yci"
+    "rcumflex\305\267/x/P/Gcedilla\304\242/Ocircu"
+    "mflexdotbelow\341\273\230/lessoverequal\342\211"
+    "\246/pieuptikeutkorean\343\205\263/Ghemiddle"
+    "hookcyrillic\322\224/fivecircle\342\221\244/tri"
+    "aglf\342\227\204/vcircle\342\223\245/merkhahebrew\326"
+    "\245/telishagedolahebrew\326\240/afii5747"
+    "0\331\207/fivethai\340\271\225/Macute\341\270\276/afii57"
+    "798/Iotadieresis\316\252/phinthuthai\340\270"
+    "\272/arrowdown\342\206\223/fiveoldstyle\357\234\265/r"
+    "ehfinalarabic\357\272\256/questionarabic\330"
+    "\237/lvocalicvowelsigndeva\340\245\242/Imacr"
+    "on\304\252/Eacute\303\211/Ocircumflexhookabo"
+    "ve\341\273\224/Uhungarumlaut\305\260/lbar\306\232/con"
+    "trolHT\011/two/Gcircumflex\304\234/dagurm"
+    "ukhi\340\250\246/laminitialarabic\357\273\237/eigh"
+    "toldstyle\357\234\270/therefore\342\210\264/sarait"
+    "hai\340\270\264/hehmedialarabic\357\273\254/pagedo"
+    "wn\342\207\237/DZ\307\261/hiriqhebrew/Chi\316\247/ele"
+    "venperiod\342\222\222/endash\342\200\223/Toarmenia"
+    "n\324\271/eopenreversedhook\311\235/dagesh\326\274"
+    "/}/quotereversed\342\200\233/sioscircleko"
+    "rean\343\211\246/shindothebrew\327\201/mssquare"
+    "\343\216\263/rvocalicbengali\340\246\213/twentyhan"
+    "gzhou\345\215\204/shevanarrowhebrew\326\260/die"
+    "resiscmb\314\210/commaarabic\330\214/Fmonosp"
+    "ace\357\274\246/dammatanaltonearabic\331\214/os"
+    "hortvowelsigndeva\340\245\212/DieresisAcu"
+    "te\357\233\214/afii57803/hagurmukhi\340\250\271/Pi"
+    "\316\240/periodinferior\357\233\247/ksicyrillic"
+    "\321\257/adotmacron\307\241/dezh\312\244/sevendeva"
+    "\340\245\255/sohiragana\343\201\235/sheva15/eighti"
+    "nferior\342\202\210/afii57807/esuperior\357\233"
+    "\254/Chedescendercyrillic\322\266/)/gacut"
+    "e\307\265/coarmenian\326\201/maichattawalowl"
+    "eftthai\357\242\225/nagurmukhi\340\250\250/A/rlong"
+    "legturned\311\272/thagurmukhi\340\250\245/Omega"
+    "cyrillic\321\240/tsadi\327\246/yinyang\342\230\257/es"
+    "hortdeva\340\244\216/fmsquare\343\216\231/Udieresi"
+    "sacute\307\227/afii57666\327\222/vavholam/te"
+    "hinitialarabic\357\272\227/ninesuperior\342\201"
+    "\271/Gmacron\341\270\240/yehinitialarabic\357\273\263"
+    "/numero\342\204\226/fourthtonechinese\313\213/l"
+    "linebelow\341\270\273/afii10061\320\214/gikatak"
+    "ana\343\202\256/aybarmenian\325\241/afii61289\342\204"
+    "\223/seventeenperiod\342\222\230/Iocyrillic\320"
+    "\201/alef\327\220/tehmarbutaarabic/toneba"
+    "rmidmod\313\247/uugujarati\340\252\212/yusbigcy"
+    "rillic\321\253/ideographicfireparen\343\210\253"
+    "/aamatragurmukhi\340\250\276/veharabic\332\244/"
+    "period./Hadescendercyrillic\322\262/Vc"
+    "ircle\342\223\213/sheva2e/Mturned\306\234/shadd"
+    "akasratanarabic\357\261\237/zainfinalarab"
+    "ic\357\272\260/sdotaccent\341\271\241/Chaarmenian\325"
+    "\211/ekatakanahalfwidth\357\275\264/tortoise"
+    "shellbracketleftsmall\357\271\235/imacron"
+    "\304\253/fourbengali\340\247\252/whitetortoises"
+    "hellbracketright\343\200\231/Egrave\303\210/udb"
+    "lacute\305\261/asteriskaltonearabic/Ie"
+    "brevecyrillic\323\226/tsecyrillic\321\206/bl"
+    "ackrightpointingtriangle\342\226\266/blac"
+    "ksquare\342\226\240/dbllowline\342\200\227/anbopom"
+    "ofo\343\204\242/bhook\311\223/afii10048/circlem"
+    "ultiply\342\212\227/nhookretroflex\311\263/soft"
+    "hyphen\302\255/phi\317\206/zhedescendercyril"
+    "lic\322\227/squarehorizontalfill\342\226\244/pa"
+    "hiragana\343\201\261/O/Ethsmall\357\237\260/Jecyri"
+    "llic\320\210/jabengali\340\246\234/Abrevetilde\341"
+    "\272\264/sacute\305\233/hyphensuperior\357\233\246/bu"
+    "hiragana\343\201\266/dblanglebracketright"
+    "\343\200\213/numeralsigngreek\315\264/qubuts31/"
+    "wring\341\272\230/6/waekorean\343\205\231/segol2c/"
+    "afii57401/Zedescendercyrillic\322\230/"
+    "afii10047\320\255/omicron\316\277/alefmaddaa"
+    "bovefinalarabic\357\272\202/ieungaparenko"
+    "rean\343\210\225/intisquare\343\214\205/muasquare\343"
+    "\216\202/shaddaarabic\331\221/idieresis\303\257/as"
+    "criptturned\311\222/shagurmukhi\340\250\266/ilu"
+    "yhebrew\326\254/uragurmukhi\340\251\263/Ringsma"
+    "ll\357\233\274/quotesingle'/Ydotaccent\341\272\216"
+    "/ninepersian\333\271/holam\326\271/hoonsquar"
+    "e\343\215\202/rieulsioskorean\343\204\275/telephon"
+    "eblack\342\230\216/afii57690/Ghestrokecyr"
+    "illic\322\222/abreve\304\203/Yuslittlecyrill"
+    "ic\321\246/zehiragana\343\201\234/sadfinalarabi"
+    "c\357\272\272/shabengali\340\246\266/acircle\342\223\220/db"
+    "larrowright\342\207\222/afii10068\320\263/gamma"
+    "superior\313\240/squareorthogonalcross"
+    "hatchfill\342\226\246/Udblgrave\310\224/mugsqua"
+    "re\343\216\215/control\342\214\203/odieresiscyrill"
+    "ic\323\247/dotlessj\357\232\276/tdotaccent\341\271\253/e"
+    "grave\303\250/ideographnamecircle\343\212\224/a"
+    "raeakorean\343\206\215/Abrevecyrillic\323\220/a"
+    "rrowvertex\357\243\246/afii10019\320\222/svsqua"
+    "re\343\217\234/aininitialarabic\357\273\213/afii10"
+    "052/whitetortoiseshellbracketlef"
+    "t\343\200\230/radicalex\357\243\245/caronbelowcmb\314"
+    "\254/plusbelowcmb\314\237/Deicoptic\317\256/ide"
+    "ographiclaborcircle\343\212\230/ohorndotb"
+    "elow\341\273\243/lefttackbelowcmb\314\230/molsq"
+    "uare\343\217\226/fourparen\342\221\267/Ndotbelow\341\271"
+    "\206/soliduslongoverlaycmb\314\270/Yhooka"
+    "bove\341\273\266/hatafsegolquarterhebrew\326"
+    "\261/Dzecyrillic/akorean\343\205\217/parenle"
+    "ft/njecyrillic\321\232/Pacute\341\271\224/Rcaro"
+    "n\305\230/Ydotbelow\341\273\264/isuperior\357\233\255/om"
+    "icrontonos\317\214/Tmonospace\357\274\264/bhade"
+    "va\340\244\255/llagujarati\340\252\263/imatragurmu"
+    "khi\340\250\277/afii10101\321\224/Escyrillic\320\241/"
+    "SF210000\342\225\226/dddhadeva\340\245\234/ideogra"
+    "phiciterationmark\343\200\205/acutetonecm"
+    "b\315\201/ghainmedialarabic\357\273\220/eogonek"
+    "\304\231/Oogonek\307\252/afii57794/pointingi"
+    "ndexrightwhite\342\230\236/squarekm\343\216\236/ab"
+    "engali\340\246\205/ellipsisvertical\342\213\256/sl"
+    "ash/jeharabic\332\230/pashtahebrew\326\231/w"
+    "asmallkatakana\343\203\256/Gdotaccent\304\240/A"
+    "brevehookabove\341\272\262/barmonospace\357\275"
+    "\234/nieunacirclekorean\343\211\257/blacksmi"
+    "lingface/colonsmall\357\271\225/uudeva\340\244\212"
+    "/afii57392\331\240/yuikorean\343\206\214/quoted"
+    "blbase\342\200\236/afii57445\331\205/thagujarat"
+    "i\340\252\245/pieupsiostikeutkorean\343\205\265/U/"
+    "Ocircumflex\303\224/clicklateral\307\201/kop"
+    "pacyrillic\322\201/hatafpatahnarrowheb"
+    "rew/ucircumflex\303\273/underscoredbl/"
+    "yosmallkatakana\343\203\247/Scommaaccent\310"
+    "\230/Lj\307\210/hatafqamatswidehebrew/afi"
+    "i10146\321\242/tehmeemisolatedarabic\357\260"
+    "\216/mbopomofo\343\204\207/v/alphatonos\316\254/sa"
+    "darabic\330\265/hiriq/huhiragana\343\201\265/fi"
+    "fteenparen\342\222\202/Koppagreek\317\236/Cheha"
+    "rmenian\325\203/pohiragana\343\201\275/spadesui"
+    "twhite\342\231\244/tildeoverlaycmb\314\264/rfis"
+    "hhookreversed\311\277/tsadihebrew/doch"
+    "adathai\340\270\216/ecircumflexdotbelow\341\273"
+    "\207/Tonesix\306\204/ainfinalarabic\357\273\212/Ye"
+    "rudieresiscyrillic\323\270/rhotichookm"
+    "od\313\236/afii57505/angle\342\210\240/triagup\342"
+    "\226\262/greaterequalorless\342\213\233/aadeva\340"
+    "\244\206/lowlinecmb\314\262/titlocyrilliccmb"
+    "\322\203/NJ\307\212/Klinebelow\341\270\264/holamhebre"
+    "w/fahrenheit\342\204\211/gimeldagesh\357\254\262/m"
+    "cubedsquare\343\216\245/rparen\342\222\255/zmonosp"
+    "ace\357\275\232/AEacute\307\274/cagujarati\340\252\232/c"
+    "ommaarmenian\325\235/controlCAN\030/dpare"
+    "n\342\222\237/ninemonospace\357\274\231/hahiragana"
+    "\343\201\257/eth\303\260/Kappa\316\232/integralex\357\243\265/"
+    "afii57682\327\242/ahiragana\343\201\202/sheicop"
+    "tic\317\243/afii57680\327\240/twosuperior\302\262/"
+    "tukatakana\343\203\204/threeoldstyle\357\234\263/f"
+    "ivebengali\340\247\253/memhebrew\327\236/maitai"
+    "khuleftthai\357\242\211/Aacutesmall\357\237\241/pe"
+    "riodmonospace\357\274\216/afii10195\321\263/hsu"
+    "perior\312\260/M/Ocyrillic\320\236/Agrave\303\200/"
+    "Njecyrillic/reflexsuperset\342\212\207/sq"
+    "uarediagonalcrosshatchfill\342\226\251/af"
+    "ii57422/qarneyparahebrew\326\237/lamal"
+    "efhamzaabovefinalarabic\357\273\270/rho\317\201"
+    "/fathalowarabic\331\216/qamats/increme"
+    "nt\342\210\206/cmsquaredsquare\343\216\240/n/yesie"
+    "ungkorean\343\206\201/oneinferior\342\202\201/yehh"
+    "amzaaboveinitialarabic\357\272\213/Omicro"
+    "n\316\237/Omicrontonos\316\214/Otildedieresi"
+    "s\341\271\216/cdotaccent\304\213/tabengali\340\246\244/a"
+    "fii10073\320\267/lessmonospace\357\274\234/four"
+    "teenparen\342\222\201/peharabic\331\276/sixteen"
+    "currencydenominatorbengali\340\247\271/do"
+    "ttedcircle\342\227\214/afii57421\330\255/l/qama"
+    "tshebrew/heart\342\231\245/sterling\302\243/ecy"
+    "rillic/tehfinalarabic\357\272\226/viramad"
+    "eva\340\245\215/ddotaccent\341\270\213/twonumerato"
+    "rbengali\340\247\265/oangthai\340\270\255/afii5740"
+    "9\330\241/gpasquare\343\216\254/ampersandmonosp"
+    "ace\357\274\206/aleph\342\204\265/ideographicprint"
+    "circle\343\212\236/parenrightbt\357\243\270/yesieu"
+    "ngsioskorean\343\206\202/controlCR\015/Abrev"
+    "eacute\341\272\256/tildebelowcmb\314\260/rcomma"
+    "accent/sixgurmukhi\340\251\254/Udieresisc"
+    "aron\307\231/ayin/ssangtikeutkorean\343\204\270"
+    "/jadeva\340\244\234/yparen\342\222\264/Hcircumflex"
+    "\304\244/rhosymbolgreek\317\261/oneideograph"
+    "icparen\343\210\240/HPsquare\343\217\213/lj\307\211/fcir"
+    "cle\342\223\225/eopenreversed\311\234/quotedblp"
+    "rime\343\200\236/acircumflexhookabove\341\272\251/"
+    "dlsquare\343\216\227/commareversedabovecm"
+    "b\314\224/tsuperior\357\233\263/nmsquare\343\216\232/fin"
+    "alpe\327\243/tavdageshhebrew/controlSY"
+    "N\026/ideographicrightcircle\343\212\250/kor"
+    "oniscmb\315\203/pagujarati\340\252\252/rrvocali"
+    "cgujarati\340\253\240/finalkafhebrew\327\232/ni"
+    "euncieuckorean\343\204\265/gagujarati\340\252\227/"
+    "heartsuitwhite\342\231\241/ideographicnam"
+    "eparen\343\210\264/notelementof\342\210\211/mieumc"
+    "irclekorean\343\211\244/weierstrass\342\204\230/af"
+    "ii57534\333\225/tortoiseshellbracketle"
+    "ft\343\200\224/Abreve\304\202/afii300\342\200\217/zagurm"
+    "ukhi\340\251\233/kihiragana\343\201\215/afii10042/"
+    "kvsquare\343\216\270/maithoupperleftthai\357"
+    "\242\215/anglebracketright\343\200\211/tetsecyr"
+    "illic\322\265/Kastrokecyrillic\322\236/Gdot/"
+    "upblock\342\226\200/mahapakhhebrew/uvowel"
+    "signbengali\340\247\201/alefmaddaaboveara"
+    "bic\330\242/vavhebrew/Zhebrevecyrillic"
+    "\323\201/ukatakanahalfwidth\357\275\263/afii100"
+    "30\320\234/zdot\305\274/llvocalicvowelsignbe"
+    "ngali\340\247\243/phook\306\245/gmacron\341\270\241/Icyr"
+    "illic\320\206/ieungparenkorean\343\210\207/four"
+    "arabic\331\244/tuhiragana\343\201\244/Edotbelow"
+    "\341\272\270/whitecornerbracketright\343\200\217/j"
+    "caron\307\260/meetorusquare\343\215\215/Fhook\306\221"
+    "/yoddageshhebrew\357\254\271/saraiileftth"
+    "ai\357\242\206/afii10039\320\245/dehihebrew\326\255/t"
+    "hreeperiod\342\222\212/oacute\303\263/onegujara"
+    "ti\340\253\247/Wacute\341\272\202/section\302\247/saraet"
+    "hai\340\271\200/meemarabic/afii57457/five"
+    "ideographicparen\343\210\244/merkhalefthe"
+    "brew/tbar\305\247/lmiddletilde\311\253/lambd"
+    "a\316\273/kiyeokaparenkorean\343\210\216/dadara"
+    "bic\330\266/candrabindugujarati\340\252\201/Elc"
+    "yrillic/noonarabic/Etilde\341\272\274/enc"
+    "yrillic\320\275/akatakana\343\202\242/duhiragan"
+    "a\343\201\245/Xeharmenian\324\275/omegatonos\317\216/"
+    "sevenparen\342\221\272/arrowdblup\342\207\221/hata"
+    "fsegol30/SF050000\342\224\274/ecandraguja"
+    "rati\340\252\215/kcaron\307\251/Adieresismacron"
+    "\307\236/tetdageshhebrew\357\254\270/controlENQ"
+    "\005/fiveeighths\342\205\235/afii57795/pieup"
+    "aparenkorean\343\210\223/Cmonospace\357\274\243/om"
+    "acronacute\341\271\223/lvocalicbengali\340\246\214"
+    "/Ahookabove\341\272\242/ideographiccommal"
+    "eft\357\275\244/whiteleftpointingsmalltri"
+    "angle\342\227\203/ubopomofo\343\204\250/epsilon\316\265/"
+    "R/sevenoldstyle\357\234\267/Ocircumflexac"
+    "ute\341\273\220/mpasquare\343\216\253/arrowright\342\206"
+    "\222/makatakana\343\203\236/Hsmall\357\235\250/period"
+    "superior\357\233\250/ocandragujarati\340\252\221/e"
+    "openclosed\312\232/sixparen\342\221\271/arrowup"
+    "dnbse/musicalnote\342\231\252/won\342\202\251/twen"
+    "typeriod\342\222\233/musicsharpsign\342\231\257/za"
+    "yindagesh\357\254\266/afii57670/holamnarr"
+    "owhebrew/bracketleft[/Oacutesmal"
+    "l\357\237\263/thophuthaothai\340\270\222/Chedieres"
+    "iscyrillic\323\264/edeva\340\244\217/Igrave\303\214/n"
+    "paren\342\222\251/aideva\340\244\220/pcircle\342\223\237/3/"
+    "gershayimaccenthebrew\326\236/khokhait"
+    "hai\340\270\202/Cacute\304\206/ydieresis\303\277/SF39"
+    "0000\342\225\224/threedeva\340\245\251/cruzeiro\342\202\242"
+    "/tpalatalhook\306\253/overscore\302\257/chec"
+    "yrillic\321\207/thieuthacirclekorean\343\211"
+    "\271/Zacute\305\271/squarewhitewithsmallb"
+    "lack\342\226\243/parenleftex\357\243\254/jhagujara"
+    "ti\340\252\235/afii57426\330\262/tonebarextralo"
+    "wmod\313\251/rukatakanahalfwidth\357\276\231/ls"
+    "quare/tortoiseshellbracketleftve"
+    "rtical\357\270\271/Esdescendercyrillic\322\252/"
+    "centoldstyle\357\236\242/verticallinemod\313"
+    "\210/afii57412\330\244/gheupturncyrillic\322"
+    "\221/nwsquare\343\216\273/sdotbelow\341\271\243/taisy"
+    "ouerasquare\343\215\275/aemacron\307\243/vokata"
+    "kana\343\203\272/hbar\304\247/Eth\303\220/tedescender"
+    "cyrillic\322\255/iotalatin\311\251/zcircle\342\223"
+    "\251/dhook\311\227/-/ieungacirclekorean\343\211"
+    "\265/phieuphacirclekorean\343\211\272/ndotbe"
+    "low\341\271\207/Otildeacute\341\271\214/twocirclei"
+    "nversesansserif\342\236\213/hookcmb/dmacr"
+    "on\304\221/Ksicyrillic\321\256/guhiragana\343\201\220"
+    "/threequartersemdash\357\233\236/afii5743"
+    "3/ainvertedbreve\310\203/Acircumflexac"
+    "ute\341\272\244/gradient\342\210\207/sevenbengali\340"
+    "\247\255/afii57667/irigurmukhi\340\251\262/dz\307\263"
+    "/arrowtabright\342\207\245/ypogegrammenig"
+    "reekcmb\315\205/qamatsqatanwidehebrew/"
+    "eightroman\342\205\267/udeva\340\244\211/Kheicopti"
+    "c\317\246/noonfinalarabic\357\273\246/angleleft"
+    "\342\214\251/istroke\311\250/enspace\342\200\202/saraile"
+    "ftthai\357\242\205/afii57434\330\272/fournumera"
+    "torbengali\340\247\267/qamats29/Xdotaccen"
+    "t\341\272\212/firsttonechinese\313\211/lessequa"
+    "l\342\211\244/afii10070/wsuperior\312\267/Kehar"
+    "menian\325\224/iivowelsigndeva\340\245\200/smil"
+    "eface\342\230\272/patah/daletdagesh\357\254\263/wh"
+    "iteleftpointingtriangle\342\227\201/daguj"
+    "arati\340\252\246/overlinedashed\357\271\211/mmsqu"
+    "aredsquare\343\216\237/hatafqamats34/SF53"
+    "0000\342\225\253/asterism\342\201\202/ngabengali\340\246"
+    "\231/Fsmall\357\235\246/tenparen\342\221\275/Peharmen"
+    "ian\325\212/commaturnedmod\312\273/sheqelheb"
+    "rew\342\202\252/mem/dieresisacute\357\233\227/sabe"
+    "ngali\340\246\270/arrowdashdown\342\207\243/2/lowl"
+    "inecenterline\357\271\216/fivehangzhou\343\200\245"
+    "/rradeva\340\244\261/commareversedmod\312\275/R"
+    "invertedbreve\310\222/kwsquare\343\216\276/afii"
+    "57839\326\275/khokhonthai\340\270\205/uhorndotb"
+    "elow\341\273\261/Koppacyrillic\322\200/arrowdow"
+    "nright\342\206\230/SF500000\342\225\230/Ereversedc"
+    "yrillic/tagurmukhi\340\250\244/carriagere"
+    "turn\342\206\265/ucaron\307\224/acircumflexgrav"
+    "e\341\272\247/Dcaron\304\216/sigma1\317\202/siluqhebr"
+    "ew/fifteenperiod\342\222\226/yabengali\340\246\257"
+    "/blacklenticularbracketright\343\200\221/"
+    "Oacute\303\223/six/afii61352/afii57430"
+    "/overlinedblwavy\357\271\214/Tedescenderc"
+    "yrillic\322\254/cieucparenkorean\343\210\210/mi"
+    "hiragana\343\201\277/mulsquare\343\216\225/pekatak"
+    "ana\343\203\232/guillemotleft\302\253/theta\316\270/l"
+    "amed\327\234/threequarters\302\276/bihiragan"
+    "a\343\201\263/afii08941\342\202\244/rrvocalicbenga"
+    "li\340\247\240/blackuppointingtriangle/af"
+    "ii61664\342\200\214/aivowelsigngujarati\340\253"
+    "\210/maichattawaupperleftthai\357\242\223/da"
+    "dinitialarabic\357\272\277/guilsinglright"
+    "\342\200\272/umacrondieresis\341\271\273/seveninfe"
+    "rior\342\202\207/Sevenroman\342\205\246/patahhebre"
+    "w/Ghadarmenian\325\202/ideographicmoon"
+    "paren\343\210\252/mvsquare\343\216\267/Cdotaccent\304"
+    "\212/afii57718\327\262/squarebelowcmb\314\273/s"
+    "haarmenian\325\267/E/obarreddieresiscy"
+    "rillic\323\253/Ccedillasmall\357\237\247/Tshecy"
+    "rillic\320\213/hehfinalalttwoarabic\357\273\252"
+    "/maichattawalowrightthai\357\242\224/ocir"
+    "cumflexacute\341\273\221/eightideographic"
+    "paren\343\210\247/Zhearmenian\324\272/Itilde\304\250/"
+    "ostrokeacute\307\277/secondtonechinese"
+    "\313\212/thieuthparenkorean\343\210\213/afii577"
+    "23/ibreve\304\255/ccircle\342\223\222/Kcedilla\304"
+    "\266/kjecyrillic\321\234/yodhebrew\327\231/beta"
+    "symbolgreek\317\220/mparen\342\222\250/afii5751"
+    "2\332\210/aimatragurmukhi\340\251\210/dkshade\342\226"
+    "\223/ltshade/fofathai\340\270\235/tildeopera"
+    "tor\342\210\274/khook\306\231/nbopomofo\343\204\213/brev"
+    "ecmb\314\206/jecyrillic\321\230/pieupsioskor"
+    "ean\343\205\204/afii57793/greaterorless\342\211"
+    "\267/ampersand&/jhabengali\340\246\235/uuvow"
+    "elsignbengali\340\247\202/Lcommaaccent/SF"
+    "230000\342\225\243/omegacyrillic\321\241/sihira"
+    "gana\343\201\227/controlGS\035/Wmonospace\357\274\267"
+    "/beharabic/dzcaron\307\206/middot\302\267/lf"
+    "block\342\226\214/yetivhebrew\326\232/rittorusq"
+    "uare\343\215\221/twelveparen\342\221\277/uvowelsig"
+    "ngujarati\340\253\201/ideographicrepresen"
+    "tparen\343\210\271/ldotbelow\341\270\267/holam32/b"
+    "racerightbt\357\243\276/rieulkorean\343\204\271/ni"
+    "neoldstyle\357\234\271/vagurmukhi\340\250\265/gamm"
+    "alatinsmall\311\243/nieunaparenkorean\343"
+    "\210\217/divides\342\210\243/ddadeva\340\244\241/eokorea"
+    "n\343\205\223/tshecyrillic\321\233/kahookcyrill"
+    "ic\323\204/y/greater>/afii57677/qubuts"
+    "25/eiotifiedcyrillic\321\245/Sdotbelow"
+    "\341\271\242/tilde\313\234/bilabialclick\312\230/Atil"
+    "de\303\203/parenrightmonospace\357\274\211/comm"
+    "aaccent\357\233\203/tthabengali\340\246\240/oneeig"
+    "hth\342\205\233/dihiragana\343\201\242/afii57419/o"
+    "ubopomofo\343\204\241/saraueethai\340\270\267/meiz"
+    "ierasquare\343\215\276/Sheicoptic\317\242/vturn"
+    "ed\312\214/wbsquare\343\217\235/afii10147\321\262/con"
+    "trolSUB\032/Dz\307\262/kapyeounssangpieup"
+    "korean\343\205\271/Gecyrillic/sixdeva\340\245\254/"
+    "q/hdieresis\341\270\247/lladeva\340\244\263/isshar"
+    "bengali\340\247\272/Pcircle\342\223\205/qamatsqata"
+    "nnarrowhebrew/ssadeva\340\244\267/Udieres"
+    "is\303\234/whitedownpointingsmalltrian"
+    "gle\342\226\277/afii57686/afii10040\320\246/rmo"
+    "nospace\357\275\222/wparen\342\222\262/Odieresis\303\226"
+    "/Eacutesmall\357\237\251/Zecyrillic\320\227/Uho"
+    "rntilde\341\273\256/zcurl\312\221/afii10060/Uci"
+    "rcle\342\223\212/eematragurmukhi\340\251\207/'/ssa"
+    "ngsioskorean\343\205\206/rdotaccent\341\271\231/it"
+    "ilde\304\251/bobaimaithai\340\270\232/hikatakan"
+    "ahalfwidth\357\276\213/afii10097\321\217/thetas"
+    "ymbolgreek/twothirds\342\205\224/thzsquar"
+    "e\343\216\224/zahinitialarabic\357\273\207/vmonosp"
+    "ace\357\275\226/emptyset\342\210\205/pikatakana\343\203\224"
+    "/Usmall\357\235\265/prolongedkana\343\203\274/shad"
+    "dadammatanarabic\357\261\236/parenright/f"
+    "inalnun\327\237/quoteleft\342\200\230/ij\304\263/vaka"
+    "takana\343\203\267/ssangieungkorean\343\206\200/db"
+    "langlebracketleftvertical\357\270\275/ang"
+    "lebracketleftvertical\357\270\277/onedeva"
+    "\340\245\247/Zeta\316\226/afii10106\321\231/zekatakan"
+    "a\343\202\274/Uhorndotbelow\341\273\260/Odieresiss"
+    "mall\357\237\266/verticallineabovecmb\314\215/c"
+    "andrabinducmb\314\220/Kacute\341\270\260/kuhira"
+    "gana\343\201\217/tau\317\204/meemmeemisolatedar"
+    "abic\357\261\210/approxequal\342\211\210/lessorequ"
+    "ivalent\342\211\262/Oslash\303\230/tesh\312\247/siluq"
+    "lefthebrew/Wcircumflex\305\264/betdage"
+    "sh\357\254\261/twodotenleader\342\200\245/rikataka"
+    "nahalfwidth\357\276\230/nuhiragana\343\201\254/cli"
+    "ckretroflex\307\203/ragujarati\340\252\260/abre"
+    "vehookabove\341\272\263/notgreaternorless"
+    "\342\211\271/.notdef/prescription\342\204\236/dabe"
+    "ngali\340\246\246/afii10095\321\215/madeva\340\244\256/e"
+    "xclam/divisionslash\342\210\225/thehmedia"
+    "larabic\357\272\234/shindageshsindot\357\254\255/m"
+    "ekatakana\343\203\241/Ccaron\304\214/qamatswide"
+    "hebrew/plusmonospace\357\274\213/udieresi"
+    "sbelow\341\271\263/dohiragana\343\201\251/less</ze"
+    "cyrillic/piwrarmenian\326\203/colon/c/"
+    "p/zero/afii10046\320\254/Ercyrillic\320\240/"
+    "hatafqamatshebrew/yiwnarmenian\326\202"
+    "/hieuhkorean\343\205\216/Coarmenian\325\221/kah"
+    "iragana\343\201\213/dukatakana\343\203\205/exclams"
+    "mall\357\234\241/sadinitialarabic\357\272\273/blin"
+    "ebelow\341\270\207/afii10063\357\233\204/khzsquare"
+    "\343\216\221/tet\327\230/rrvocalicdeva\340\245\240/paren"
+    "rightsuperior\342\201\276/lamalefmaddaabo"
+    "vefinalarabic\357\273\266/qparen\342\222\254/Shaar"
+    "menian\325\207/otilde\303\265/afii61574\342\200\255/S"
+    "F040000\342\224\230/Gmonospace\357\274\247/lochula"
+    "thai\340\270\254/alefhamzaabovearabic\330\243/s"
+    "haddafathaarabic\357\261\240/qamats33/Ogo"
+    "neksmall\357\233\273/sagujarati\340\252\270/wacute"
+    "\341\272\203/ercyrillic\321\200/Gcircle\342\222\274/ovow"
+    "elsigndeva\340\245\213/Feicoptic\317\244/eightc"
+    "ircle\342\221\247/ramshorn\311\244/Shhacyrillic"
+    "\322\272/ecandradeva\340\244\215/congruent\342\211\205/p"
+    "abengali\340\246\252/slong/SF080000\342\224\234/eo"
+    "pen\311\233/ideographicenterpriseparen"
+    "\343\210\275/nabla/Hungarumlaut\357\233\217/wdotbe"
+    "low\341\272\211/Lcircumflexbelow\341\270\274/Yeric"
+    "yrillic\320\253/iishortcyrillic\320\271/trad"
+    "emarksans\357\243\252/guillemotright\302\273/ps"
+    "ilipneumatacyrilliccmb\322\206/yikorea"
+    "n\343\205\242/upsilonlatin\312\212/bracelefttp\357"
+    "\243\261/ringhalfrightcentered\313\222/Uhorn"
+    "acute\341\273\250/whitelenticularbracketl"
+    "eft\343\200\226/r/ecircle\342\223\224/dblgravecmb\314"
+    "\217/rturnedsuperior\312\264/pemiddlehook"
+    "cyrillic\322\247/squareupperrighttolow"
+    "erleftfill\342\226\250/aubopomofo\343\204\240/grav"
+    "etonecmb\315\200/mokatakana\343\203\242/dblvert"
+    "icalbar\342\200\226/glottalstop\312\224/seventh"
+    "ai\340\271\227/sevenhackarabic/Chedescend"
+    "erabkhasiancyrillic\322\276/rieulkiyeo"
+    "kkorean\343\204\272/kukatakana\343\202\257/quotele"
+    "ftreversed/wdotaccent\341\272\207/Deltagr"
+    "eek\316\224/meemfinalarabic\357\273\242/sadmedi"
+    "alarabic\357\272\274/nehiragana\343\201\255/segolw"
+    "idehebrew/ncommaaccent\305\206/tahinit"
+    "ialarabic\357\273\203/sofpasuqhebrew/iguj"
+    "arati\340\252\207/Acircumflexhookabove\341\272\250"
+    "/udieresiscyrillic\323\261/ohorngrave\341"
+    "\273\235/tikeutkorean\343\204\267/tortoiseshell"
+    "bracketrightvertical\357\270\272/thabenga"
+    "li\340\246\245/Ytilde\341\273\270/Liwnarmenian\324\274/a"
+    "fii10051/noonghunnafinalarabic\357\256"
+    "\237/dotbelowcmb/gcircumflex\304\235/oneh"
+    "ackarabic\331\241/blackleftpointingpoi"
+    "nter/wakorean\343\205\230/whitesmilingfac"
+    "e/psi\317\210/pointingindexleftwhite\342\230"
+    "\234/notsuperset\342\212\205/aivowelsignbeng"
+    "ali\340\247\210/Mmonospace\357\274\255/tavdages/Ec"
+    "ircumflexhookabove\341\273\202/dbllowline"
+    "cmb\314\263/evowelsignbengali\340\247\207/Psi\316\250"
+    "/idieresiscyrillic\323\245/afii57410/i"
+    "ntegral\342\210\253/hdotbelow\341\270\245/glottals"
+    "topreversed\312\225/afii10036\320\242/fivegu"
+    "jarati\340\253\253/lameddageshhebrew\357\254\274/E"
+    "monospace\357\274\245/rieulpieupsioskorea"
+    "n\343\205\253/maihanakatthai\340\270\261/mumsquare"
+    "\343\216\233/srsquare\343\217\233/Pecyrillic/cyrfl"
+    "ex\357\233\225/yeokorean\343\205\225/pieupacirclek"
+    "orean\343\211\263/ymonospace\357\275\231/Lslashsma"
+    "ll\357\233\271/\042/guilsinglleft\342\200\271/qofdage"
+    "shhebrew\357\255\207/gahiragana\343\201\214/obenga"
+    "li\340\246\223/timescircle/eshsquatrevers"
+    "ed\312\205/plussuperior\342\201\272/Vewarmenian"
+    "\325\216/thanthakhatlowrightthai\357\242\227/id"
+    "blgrave\310\211/siosparenkorean\343\210\206/not"
+    "subset\342\212\204/atmonospace\357\274\240/hotspri"
+    "ngs\342\231\250/Jmonospace\357\274\252/hasquare\343\217\212"
+    "/afii57668/ideographicleftcircle"
+    "\343\212\247/Ccedillaacute\341\270\210/adotbelow\341\272"
+    "\241/macute\341\270\277/ihiragana\343\201\204/fourgur"
+    "mukhi\340\251\252/hatafsegol17/germandbls"
+    "\303\237/ivowelsignbengali\340\246\277/Ccircle\342"
+    "\222\270/tahiragana\343\201\237/magujarati\340\252\256/e"
+    "scyrillic/Nhookleft\306\235/ramiddledi"
+    "agonalbengali\340\247\260/postalmark\343\200\222/o"
+    "i\306\243/nunhebrew/Zsmall\357\235\272/ldotacce"
+    "nt\305\200/oslashacute/kheicoptic\317\247/an"
+    "glebracketrightvertical\357\271\200/~/che"
+    "dieresiscyrillic\323\265/aleffinalarab"
+    "ic\357\272\216/Ocenteredtilde\306\237/sevenpers"
+    "ian\333\267/Btopbar\306\202/scircumflex\305\235/bd"
+    "otaccent\341\270\203/Sacutedotaccent\341\271\244/N"
+    "dotaccent\341\271\204/controlSOT\002/Scircle"
+    "\342\223\210/saraothai\340\271\202/ssangkiyeokkore"
+    "an\343\204\262/afii10072\320\266/hekatakanahalf"
+    "width\357\276\215/kohmsquare\343\217\200/maitrilow"
+    "rightthai\357\242\221/dblintegral\342\210\254/yehn"
+    "oonfinalarabic\357\262\224/Lacute\304\271/lowli"
+    "nedashed\357\271\215/twodeva\340\245\250/lameddage"
+    "sh/xdieresis\341\272\215/Bhook\306\201/lamalefh"
+    "amzabelowfinalarabic\357\273\272/SF450000"
+    "\342\225\247/Dieresis\357\233\213/product\342\210\217/masor"
+    "acirclehebrew\326\257/ghagurmukhi\340\250\230/f"
+    "ourperiod\342\222\213/iigujarati\340\252\210/usmal"
+    "lkatakana\343\202\245/Delta/ratio\342\210\266/circ"
+    "le\342\227\213/lhookretroflex\311\255/ukcyrilli"
+    "c\321\271/rieulpieupkorean\343\204\274/Upsilond"
+    "ieresis\316\253/edot\304\227/divide\303\267/afii57"
+    "683/omegatitlocyrillic\321\275/rihirag"
+    "ana\343\202\212/lamalefmaddaaboveisolated"
+    "arabic\357\273\265/khadeva\340\244\226/numbersignm"
+    "onospace\357\274\203/afii57681\327\241/Hungarum"
+    "lautsmall\357\233\270/Beta\316\222/Idotaccent\304\260"
+    "/betrafehebrew\357\255\214/threemonospace"
+    "\357\274\223/controlFF\014/beamedsixteenthno"
+    "tes\342\231\254/cieucacirclekorean\343\211\266/dak"
+    "atakana\343\203\200/yokorean\343\205\233/pagurmukh"
+    "i\340\250\252/afii10104\321\227/afii57508/tsadi"
+    "dagesh\357\255\206/finalnunhebrew/dhabeng"
+    "ali\340\246\247/Zcircle\342\223\217/kekatakana\343\202\261/"
+    "sixhangzhou\343\200\246/wohiragana\343\202\222/had"
+    "escendercyrillic\322\263/cdot/yen\302\245/Kc"
+    "ommaaccent/afii57414/ugrave\303\271/co"
+    "ntrolDEL\177/zaarmenian\325\246/arrowhead"
+    "leftmod\313\202/yuhiragana\343\202\206/H/tipeha"
+    "hebrew/diamondsuitwhite\342\231\242/korea"
+    "nstandardsymbol\343\211\277/kashidaautono"
+    "sidebearingarabic/eightthai\340\271\230/a"
+    "fii10058\320\211/sixperiod\342\222\215/nieunsio"
+    "skorean\343\205\247/umacroncyrillic\323\257/Til"
+    "desmall\357\233\276/bbopomofo\343\204\205/nun/jhad"
+    "eva\340\244\235/rahiragana\343\202\211/thousandcyr"
+    "illic\322\202/thothanthai\340\270\220/sevenmono"
+    "space\357\274\227/fparen\342\222\241/afii10110\321\236/V"
+    "tilde\341\271\274/obreve\305\217/Menarmenian\325\204/"
+    "rtblock\342\226\220/ghainarabic/afii10064"
+    "\357\233\205/Khook\306\230/eshcurl\312\206/twomonospa"
+    "ce\357\274\222/esmallkatakanahalfwidth\357\275\252"
+    "/pointingindexupwhite\342\230\235/primemo"
+    "d\312\271/threethai\340\271\223/tparen\342\222\257/Ohorn"
+    "grave\341\273\234/Khacyrillic/ushortcyril"
+    "lic/wonmonospace\357\277\246/LJ\307\207/phophun"
+    "gthai\340\270\234/caron\313\207/clickdental\307\200/E"
+    "circumflexdotbelow\341\273\206/hcedilla\341\270"
+    "\251/acute\302\264/chochingthai\340\270\211/liwnar"
+    "menian\325\254/deltaturned\306\215/Umacroncy"
+    "rillic\323\256/bet/Etatonos\316\211/Rdotbelo"
+    "w\341\271\232/uinvertedbreve\310\227/ezhtail\306\272/"
+    "afii10069\320\264/patah11/oopen\311\224/eibo"
+    "pomofo\343\204\237/percent/]/Kahookcyrill"
+    "ic\323\203/Tecyrillic/onegurmukhi\340\251\247/a"
+    "fii57695/minute\342\200\262/arrowdbldown\342"
+    "\207\223/zadeva\340\245\233/circumflex\313\206/ldotbe"
+    "lowmacron\341\270\271/afii57452/Ldotaccen"
+    "t\304\277/afii57456\331\220/pehiragana\343\201\272/Ai"
+    "ecyrillic\323\224/pieupsioskiyeokkorea"
+    "n\343\205\264/Wdotbelow\341\272\210/Nineroman\342\205\250/a"
+    "grave\303\240/afii10196\321\265/iotatonos\316\257/"
+    "softsigncyrillic\321\214/Dlinebelow\341\270\216"
+    "/edotbelow\341\272\271/afii10080/ytilde\341\273"
+    "\271/Dcircumflexbelow\341\270\222/pwsquare\343\216"
+    "\272/controlBS/controlNAK\025/rakataka"
+    "nahalfwidth\357\276\227/Ukcyrillic\321\270/Gcar"
+    "on\307\246/pe\327\244/tbopomofo\343\204\212/dsuperior"
+    "\357\233\253/hturned\311\245/ocircle\342\223\236/bracket"
+    "leftex\357\243\257/Dieresissmall\357\236\250/contr"
+    "olETB\027/AEsmall\357\237\246/takatakanahalf"
+    "width\357\276\200/chieuchcirclekorean\343\211\251/"
+    "lamhahinitialarabic\357\263\212/tikatakan"
+    "a\343\203\201/kafinitialarabic\357\273\233/dblarch"
+    "invertedbelowcmb\314\253/nikatakana\343\203\213"
+    "/Ocaron\307\221/afii57399/triagrt\342\226\272/a"
+    "cyrillic\320\260/herutusquare\343\214\271/semiv"
+    "oicedmarkkana\343\202\234/ideographicfina"
+    "ncialparen\343\210\266/cieucuparenkorean\343"
+    "\210\234/dcedilla\341\270\221/approxequalorimag"
+    "e\342\211\222/greateroverequal\342\211\247/Ecircum"
+    "flex\303\212/Gcommaaccent/lesssmall\357\271\244"
+    "/hehinitialaltonearabic\357\256\250/Iicyr"
+    "illic/acutelowmod\313\217/sheenarabic\330"
+    "\264/Hbar\304\246/cmcubedsquare\343\216\244/dotacc"
+    "ent\313\231/fofanthai\340\270\237/kadescendercy"
+    "rillic\322\233/dtopbar\306\214/candrabindude"
+    "va\340\244\201/Imonospace\357\274\251/iivowelsignb"
+    "engali\340\247\200/integraltop\342\214\240/hieuhac"
+    "irclekorean\343\211\273/llvocalicbengali\340"
+    "\247\241/gbreve\304\237/dageshhebrew/Tdotacc"
+    "ent\341\271\252/hookpalatalizedbelowcmb\314\241"
+    "/ayinaltonehebrew\357\254\240/siostikeutk"
+    "orean\343\205\274/dorusquare\343\214\246/ideograph"
+    "suncircle\343\212\220/circlewithrighthalf"
+    "black\342\227\221/Caron\357\233\212/_/Echarmenian\324"
+    "\265/omdeva\340\245\220/Rlinebelow\341\271\236/contro"
+    "lDC3\023/Zcircumflex\341\272\220/parenlefttp"
+    "\357\243\253/iparen\342\222\244/tenideographicpare"
+    "n\343\210\251/nieunparenkorean\343\210\201/paampss"
+    "quare\343\216\200/mcircle\342\223\234/Obreve\305\216/mus"
+    "icflatsign\342\231\255/Tbar\305\246/phisymbolgr"
+    "eek\317\225/sixteenperiod\342\222\227/hatafsego"
+    "lwidehebrew/lambdastroke\306\233/yring"
+    "\341\272\231/abrevedotbelow\341\272\267/tahmediala"
+    "rabic\357\273\204/Odotbelow\341\273\214/figuredash"
+    "\342\200\222/afii10053\320\204/rragurmukhi\340\251\234/o"
+    "nepersian\333\261/finalkafdageshhebrew"
+    "\357\254\272/afii10066\320\261/oomatragurmukhi\340"
+    "\251\213/shademedium/nagujarati\340\252\250/tho"
+    "usandsseparatorarabic/yod/Ljecyr"
+    "illic/Ecircumflexbelow\341\270\230/ngongu"
+    "thai\340\270\207/afii57443\331\203/radical\342\210\232/u"
+    "/L/ttehinitialarabic\357\255\250/ghadarme"
+    "nian\325\262/Ldotbelowmacron\341\270\270/maitho"
+    "lowrightthai\357\242\216/wturned\312\215/Pmonos"
+    "pace\357\274\260/AE\303\206/hukatakana\343\203\225/Egrav"
+    "esmall\357\237\250/arrowupleftofdown\342\207\205/Y"
+    "acute\303\235/ttehfinalarabic\357\255\247/tcheh"
+    "arabic\332\206/uhornhookabove\341\273\255/siosp"
+    "ieupkorean\343\205\275/nnagujarati\340\252\243/fin"
+    "altsadi/ereversed\311\230/ccircumflex\304"
+    "\211/shinshindot/minusbelowcmb\314\240/na"
+    "deva\340\244\250/hatafsegol/cbopomofo\343\204\230/"
+    "cmonospace\357\275\203/uumatragurmukhi\340\251\202"
+    "/tusmallhiragana\343\201\243/qubutshebrew"
+    "/because\342\210\265/saraaimaimalaithai\340\271"
+    "\204/sigma\317\203/gstroke\307\245/sdotbelowdot"
+    "accent\341\271\251/ieungkorean\343\205\207/elevenp"
+    "aren\342\221\276/sukatakana\343\202\271/emacrongra"
+    "ve\341\270\225/Macron\357\233\220/ideographicstock"
+    "paren\343\210\261/deleteleft\342\214\253/kadeva\340\244\225"
+    "/afii10102\321\225/gcaron\307\247/ringhalfle"
+    "ftbelowcmb\314\234/khorakhangthai\340\270\206/e"
+    "circumflexbelow\341\270\231/mdotaccent\341\271\201"
+    "/glottalstopstroke\312\241/dblprimemod"
+    "\312\272/afii57717\327\261/hyphen/Rfraktur\342\204"
+    "\234/gehiragana\343\201\222/Caronsmall\357\233\265/w/"
+    "Ismall\357\235\251/yyadeva\340\245\237/rukatakana\343"
+    "\203\253/thehfinalarabic\357\272\232/squarekg\343\216"
+    "\217/venus/pehfinalarabic\357\255\227/visarg"
+    "abengali\340\246\203/blacksmallsquare\342\226\252/"
+    "fisheye\342\227\211/anusvaradeva\340\244\202/dialy"
+    "tikatonos/Omacrongrave\341\271\220/luthai"
+    "\340\270\246/Benarmenian\324\262/Dcircle\342\222\271/fra"
+    "ction\342\201\204/hieuhcirclekorean\343\211\255/mh"
+    "ook\311\261/Omegatonos\316\217/ghhagurmukhi\340"
+    "\251\232/Nmonospace\357\274\256/quotesinglbase\342"
+    "\200\232/*/`/fourcircle\342\221\243/sevensuperi"
+    "or\342\201\267/Eightroman\342\205\247/ocircumflexg"
+    "rave\341\273\223/zayindageshhebrew/gravem"
+    "onospace\357\275\200/dalfinalarabic\357\272\252/gh"
+    "zsquare\343\216\223/angleright\342\214\252/middled"
+    "otkatakanahalfwidth\357\275\245/trademark"
+    "\342\204\242/controlDC4\024/he/hatafqamats28"
+    "/SF110000\342\224\202/adieresis\303\244/oogonek"
+    "macron\307\255/endescendercyrillic\322\243/f"
+    "ive/nuktadeva\340\244\274/oneperiod\342\222\210/af"
+    "ii10035/daletdageshhebrew/bstrok"
+    "e\306\200/fivedeva\340\245\253/finalkaf/onethir"
+    "d\342\205\223/tchehmedialarabic\357\255\275/khhade"
+    "va\340\245\231/aturned\311\220/numbersignsmall\357"
+    "\271\237/dbopomofo\343\204\211/vehfinalarabic\357\255"
+    "\253/aulengthmarkbengali\340\247\227/behmeem"
+    "isolatedarabic\357\260\210/backslash\134/waw"
+    "arabic/udattadeva\340\245\221/postalmarkf"
+    "ace\343\200\240/colonmonetary\342\202\241/noonnoon"
+    "finalarabic\357\262\215/aigurmukhi\340\250\220/voa"
+    "rmenian\325\270/sagurmukhi\340\250\270/mussquar"
+    "e\343\216\262/uacute\303\272/nineteenparen\342\222\206/j"
+    "paren\342\222\245/@/ycircle\342\223\250/Euro\342\202\254/ni"
+    "neteencircle\342\221\262/afii57673/ccedil"
+    "la\303\247/benarmenian\325\242/numeralsignlo"
+    "wergreek\315\265/mikatakana\343\203\237/angkhan"
+    "khuthai\340\271\232/nineroman\342\205\270/gershayi"
+    "mhebrew\327\264/iacute\303\255/yr\306\246/eightcir"
+    "cleinversesansserif\342\236\221/tonsquare"
+    "\343\214\247/acutedeva\340\245\224/reflexsubset\342\212\206"
+    "/nineteenperiod\342\222\232/tevirlefthebr"
+    "ew\326\233/holamwidehebrew/SF270000\342\225\234"
+    "/afii57423/chadeva\340\244\233/zarqahebre"
+    "w\326\230/Gimarmenian\324\263/eparen\342\222\240/bar/"
+    "abrevegrave\341\272\261/thonangmonthothai"
+    "\340\270\221/segol/hangulfiller\343\205\244/eightp"
+    "aren\342\221\273/ninethai\340\271\231/afii57400\331\250/"
+    "Utildebelow\341\271\264/afii10057/eightee"
+    "ncircle\342\221\261/ecircumflexhookabove\341"
+    "\273\203/aleflamedhebrew\357\255\217/lammeemhah"
+    "initialarabic\357\266\210/Oogonekmacron\307\254"
+    "/udieresisacute\307\230/Thorn\303\236/sixinf"
+    "erior\342\202\206/underscorevertical\357\270\263/h"
+    "linebelow\341\272\226/tildecmb\314\203/bparen\342\222"
+    "\235/rlinebelow\341\271\237/engbopomofo\343\204\245/e"
+    "smallhiragana\343\201\207/saraathai\340\270\260/Io"
+    "ta\316\231/rupeemarkbengali\340\247\262/nonenth"
+    "ai\340\270\223/qamats1a/gabengali\340\246\227/icir"
+    "cumflex\303\256/pieupcieuckorean\343\205\266/un"
+    "derscore/arrowdashup\342\207\241/imonospa"
+    "ce\357\275\211/kcalsquare\343\216\211/Schwadieresi"
+    "scyrillic\323\232/enbopomofo\343\204\243/ainmed"
+    "ialarabic\357\273\214/vekatakana\343\203\271/twelv"
+    "eperiod\342\222\223/zerooldstyle\357\234\260/Ustra"
+    "ightcyrillic\322\256/mukatakanahalfwid"
+    "th\357\276\221/nnagurmukhi\340\250\243/j/forall\342\210\200"
+    "/dcroat/wcircle\342\223\246/musicalnotedb"
+    "l\342\231\253/philatin\311\270/projective\342\214\205/si"
+    "xideographicparen\343\210\245/rcircle\342\223\241/"
+    "rupiah\357\233\235/Encyrillic\320\235/Udieresis"
+    "below\341\271\262/Ksmall\357\235\253/afii57395\331\243/s"
+    "fthyphen/glottalstopinverted\312\226/h"
+    "ehaltonearabic/lamedhebrew/dhagu"
+    "jarati\340\252\247/uvowelsigndeva\340\245\201/comp"
+    "ass\342\230\274/tehjeemisolatedarabic\357\260\213/"
+    "kaf\327\233/blackstar\342\230\205/universal/har"
+    "poonrightbarbup\342\207\200/Acaron\307\215/tevi"
+    "rhebrew/Eharmenian\324\267/tecyrillic\321"
+    "\202/wekorean\343\205\236/Vsmall\357\235\266/sekataka"
+    "na\343\202\273/twentycircle\342\221\263/kirosquare"
+    "\343\214\224/ygrave\341\273\263/geometricallyequal"
+    "\342\211\221/decimalseparatorarabic\331\253/par"
+    "enrighttp\357\243\266/registered\302\256/Rho\316\241/"
+    "a/ff\357\254\200/dollarsuperior\357\233\244/epsilo"
+    "ntonos\316\255/haabkhasiancyrillic\322\251/r"
+    "vocalicvowelsigngujarati\340\253\203/geka"
+    "takana\343\202\262/voicedmarkkanahalfwidt"
+    "h\357\276\236/aavowelsignbengali\340\246\276/Atild"
+    "esmall\357\237\243/mieumacirclekorean\343\211\262/"
+    "xsuperior\313\243/gcedilla\304\243/Smonospac"
+    "e\357\274\263/exclammonospace\357\274\201/zinorheb"
+    "rew\326\256/yukatakanahalfwidth\357\276\225/Qmo"
+    "nospace\357\274\261/nakatakana\343\203\212/Dtopbar"
+    "\306\213/uring\305\257/yehthreedotsbelowarab"
+    "ic\333\221/controlDLE\020/kesmallkatakana"
+    "\343\203\266/squarelog\343\217\222/eighthnotebeame"
+    "d/house\342\214\202/chagujarati\340\252\233/rieulk"
+    "iyeoksioskorean\343\205\251/Tretroflexhoo"
+    "k\306\256/dollarmonospace\357\274\204/otildedie"
+    "resis\341\271\217/upsilontonos\317\215/thadeva\340"
+    "\244\245/yadeva\340\244\257/gimeldageshhebrew/a"
+    "rrowdashleft\342\207\240/hatafqamats/nieu"
+    "nkorean\343\204\264/nssquare\343\216\261/afii57449"
+    "\331\211/lamlamhehisolatedarabic\357\267\262/ma"
+    "iekupperleftthai\357\242\212/Sdotaccent\341\271"
+    "\240/nikatakanahalfwidth\357\276\206/upperdo"
+    "thebrew\327\204/tadeva\340\244\244/eighteenperi"
+    "od\342\222\231/pvsquare\343\216\264/twoarabic\331\242/be"
+    "cyrillic/arrowupdn\342\206\225/alefmaksur"
+    "afinalarabic\357\273\260/pasquare\343\216\251/five"
+    "persian\333\265/afii10831\357\233\207/hiriqwide"
+    "hebrew/ncircumflexbelow\341\271\213/yahir"
+    "agana\343\202\204/ikatakana\343\202\244/zerowidthj"
+    "oiner\357\273\277/seharmenian\325\275/qamatsqua"
+    "rterhebrew/afii10062\320\216/Hdotaccen"
+    "t\341\270\242/umonospace\357\275\225/afii10044\320\252/b"
+    "raceleftsmall\357\271\233/blackupperleftt"
+    "riangle\342\227\244/sorusithai\340\270\251/psicyri"
+    "llic\321\261/afii57806/ecircumflexacut"
+    "e\341\272\277/z/obarredcyrillic\323\251/ttehmed"
+    "ialarabic\357\255\251/khokhuatthai\340\270\203/sar"
+    "aueleftthai\357\242\207/cent\302\242/Iotaafrica"
+    "n\306\226/meeminitialarabic\357\273\243/takatak"
+    "ana\343\202\277/bahiragana\343\201\260/maitrithai\340"
+    "\271\212/zcaron\305\276/hyphenmonospace\357\274\215/d"
+    "ong\342\202\253/exclamdownsmall\357\236\241/largec"
+    "ircle\342\227\257/openbullet\342\227\246/whitesqua"
+    "re\342\226\241/hatafpatahhebrew/auvowelsi"
+    "gnbengali\340\247\214/zayin/radoverssquar"
+    "e\343\216\256/nukatakana\343\203\214/eightpersian\333"
+    "\270/pluscircle\342\212\225/glottalstoprever"
+    "sedmod\313\201/yoddagesh/bindigurmukhi"
+    "\340\250\202/notsucceeds\342\212\201/qamats1c/Gheu"
+    "pturncyrillic/horicoptic\317\251/momat"
+    "hai\340\270\241/curlyor\342\213\216/alefmaksuraara"
+    "bic/tikatakanahalfwidth\357\276\201/ikata"
+    "kanahalfwidth\357\275\262/afii57506/Ecaro"
+    "n\304\232/lolingthai\340\270\245/Obarredcyrilli"
+    "c\323\250/ideographicwoodparen\343\210\255/afii"
+    "10088/Vmonospace\357\274\266/feicoptic\317\245/"
+    "brevebelowcmb\314\256/betdageshhebrew/"
+    "phabengali\340\246\253/Ncircumflexbelow\341\271"
+    "\212/kukatakanahalfwidth\357\275\270/Dcroat/"
+    "ereversedcyrillic/holam19/afii10"
+    "034/eighteenparen\342\222\205/ecedillabre"
+    "ve\341\270\235/thirteenperiod\342\222\224/keharmen"
+    "ian\326\204/Yusbigcyrillic\321\252/Epsilonto"
+    "nos\316\210/hatafpatahwidehebrew/rhabe"
+    "ngali\340\247\235/sixthai\340\271\226/bridgeinvert"
+    "edbelowcmb\314\272/overlinecmb\314\205/Scaro"
+    "ndotaccent\341\271\246/Ostrokeacute/maith"
+    "othai\340\271\211/ismallkatakanahalfwidth"
+    "\357\275\250/alefdageshhebrew\357\254\260/behnoonf"
+    "inalarabic\357\261\255/Esmall\357\235\245/notless\342"
+    "\211\256/Tlinebelow\341\271\256/vagujarati\340\252\265/s"
+    "hadedark/katahiraprolongmarkhalf"
+    "width\357\275\260/ddhagujarati\340\252\242/Idieres"
+    "is\303\217/greatersmall\357\271\245/wgrave\341\272\201/e"
+    "ighthackarabic/glottalinvertedst"
+    "roke\306\276/Ymonospace\357\274\271/tsere12/glo"
+    "ttalstopmod\313\200/uugurmukhi\340\250\212/Ogra"
+    "ve\303\222/Kdotbelow\341\270\262/ubengali\340\246\211/Ob"
+    "arreddieresiscyrillic\323\252/enhookcy"
+    "rillic\323\210/endashvertical\357\270\262/Ydier"
+    "esis\305\270/chook\306\210/etnahtafoukhhebre"
+    "w/segoltahebrew\326\222/kbopomofo\343\204\216/d"
+    "blanglebracketrightvertical\357\270\276/i"
+    "deographichaveparen\343\210\262/yokatakan"
+    "ahalfwidth\357\276\226/clubsuitblack/Pemi"
+    "ddlehookcyrillic\322\246/rcaron\305\231/seen"
+    "initialarabic\357\272\263/ttagurmukhi\340\250\237/"
+    "afii10075/Caarmenian\324\276/Oinverted"
+    "breve\310\216/Kcaron\307\250/weokorean\343\205\235/ke"
+    "hiragana\343\201\221/squaremil\343\217\225/Idot/Oh"
+    "orndotbelow\341\273\242/rrvocalicvowelsig"
+    "ndeva\340\245\204/ovowelsignbengali\340\247\213/yo"
+    "yakthai\340\270\242/lamaleffinalarabic\357\273\274"
+    "/dieresisgrave\357\233\230/shaddadammaara"
+    "bic\357\261\241/maitrilowleftthai\357\242\222/IJ\304\262"
+    "/arrowdblright/Zdotbelow\341\272\222/nyab"
+    "engali\340\246\236/dblgrave\357\233\226/Ecircumfle"
+    "xgrave\341\273\200/fourhackarabic/heharab"
+    "ic/gereshmuqdamhebrew\326\235/Emacrona"
+    "cute\341\270\226/kafdagesh\357\254\273/nlinebelow\341"
+    "\271\211/tavhebrew/udblgrave\310\225/saraaet"
+    "hai\340\271\201/vuhiragana\343\202\224/afii57841\326\277"
+    "/Acutesmall\357\236\264/ideographicfestiv"
+    "alparen\343\211\200/Ibreve\304\254/thanthakhatu"
+    "pperleftthai\357\242\226/arrowdownleft\342\206\231"
+    "/jcircumflex\304\265/merkhakefulalefth"
+    "ebrew\326\246/klinebelow\341\270\265/shindagesh"
+    "\357\255\211/ebreve\304\225/dikatakana\343\203\202/contr"
+    "olFS\034/araeaekorean\343\206\216/gdot/doubl"
+    "eyodpatah\357\254\237/Dcedilla\341\270\220/kastrok"
+    "ecyrillic\322\237/Iishortcyrillic\320\231/sa"
+    "rauuthai\340\270\271/Agravesmall\357\237\240/paren"
+    "leftsmall\357\271\231/nekatakana\343\203\215/nukta"
+    "bengali\340\246\274/yerahbenyomohebrew/ya"
+    "adosquare\343\215\216/Rcedilla/\134/udieresi"
+    "scaron\307\232/oneroman\342\205\260/khomutthai\340"
+    "\271\233/nyadeva\340\244\236/qubuts/kiyeokkorea"
+    "n\343\204\261/kabashkircyrillic\322\241/hihirag"
+    "ana\343\201\262/sun/qamats27/kcommaaccent"
+    "\304\267/Xcircle\342\223\215/tildecomb/gimel/pe"
+    "rafehebrew\357\255\216/Udieresissmall\357\237\274/"
+    "b/yakatakanahalfwidth\357\276\224/cornerb"
+    "racketrightvertical\357\271\202/hehiragan"
+    "a\343\201\270/9/zerosuperior\342\201\260/whiteuppo"
+    "intingsmalltriangle\342\226\265/onehangzh"
+    "ou\343\200\241/anusvarabengali\340\246\202/kohirag"
+    "ana\343\201\223/gihiragana\343\201\216/gmonospace\357"
+    "\275\207/$/clear\342\214\247/kafrafehebrew\357\255\215/F"
+    "circle\342\222\273/aringbelow\341\270\201/Ebreve\304\224"
+    "/caarmenian\325\256/threesuperior\302\263/Mc"
+    "ircle\342\223\202/quotedblleft\342\200\234/ideogra"
+    "phiccongratulationparen\343\210\267/okata"
+    "kana\343\202\252/ghabengali\340\246\230/macron/KKs"
+    "quare\343\217\215/zeroarabic/vav/zahfinal"
+    "arabic\357\273\206/onearabic/okatakanahal"
+    "fwidth\357\275\265/heartsuitblack/fadeva\340"
+    "\245\236/khagurmukhi\340\250\226/twelvecircle\342\221"
+    "\253/nooninitialarabic\357\273\247/sevencirc"
+    "leinversesansserif\342\236\220/lammeemini"
+    "tialarabic\357\263\214/kikatakana\343\202\255/ezhc"
+    "url\312\223/pieupkiyeokkorean\343\205\262/Aybar"
+    "menian\324\261/Jcircumflex\304\264/mehiragan"
+    "a\343\202\201/ringhalfleftcentered\313\223/tiwn"
+    "armenian\325\277/Ohorn\306\240/oe\305\223/arrowupl"
+    "eft\342\206\226/Ddotaccent\341\270\212/Csmall\357\235\243/g"
+    "angiacoptic\317\253/avagrahadeva\340\244\275/af"
+    "ii10023/Ogravesmall\357\237\262/viramaben"
+    "gali\340\247\215/edieresis\303\253/emdash\342\200\224/sc"
+    "edilla\305\237/rekatakanahalfwidth\357\276\232/"
+    "yehmeeminitialarabic\357\263\235/yiarmeni"
+    "an\325\265/brokenbar\302\246/pedagesh\357\255\204/plu"
+    "smod\313\226/afii10109/tretroflexhook\312"
+    "\210/tturned\312\207/kapyeounpieupkorean\343"
+    "\205\270/poplathai\340\270\233/qof/pisymbolgree"
+    "k\317\226/uhornacute\341\273\251/circlewithleft"
+    "halfblack\342\227\220/Tsmall\357\235\264/kenarmeni"
+    "an\325\257/abrevetilde\341\272\265/candrabindub"
+    "engali\340\246\201/iotadieresis\317\212/SF01000"
+    "0\342\224\214/dotaccentcmb\314\207/padeva\340\244\252/Xi"
+    "\316\236/Yuslittleiotifiedcyrillic\321\250/g"
+    "paren\342\222\242/adieresiscyrillic\323\223/aci"
+    "rcumflex\303\242/parenleftmonospace\357\274\210"
+    "/mufsquare\343\216\214/shindageshshindoth"
+    "ebrew/Amacron\304\200/dalet/arighthalf"
+    "ring\341\272\232/Psmall\357\235\260/plusminus\302\261/oc"
+    "andravowelsigndeva\340\245\211/dieresis\302\250"
+    "/LL\357\232\277/maihanakatleftthai\357\242\204/Tho"
+    "rnsmall\357\237\276/ideographicstudyparen"
+    "\343\210\273/bmonospace\357\275\202/esmallkatakana"
+    "\343\202\247/oparen\342\222\252/Ddotbelow\341\270\214/fehar"
+    "menian\326\206/triagdn/fourinferior\342\202\204"
+    "/hatafpatah2f/twostroke\306\273/schwah"
+    "ook\311\232/perthousand\342\200\260/thirteencir"
+    "cle\342\221\254/eta\316\267/afii57397/ldot/magu"
+    "rmukhi\340\250\256/ninehangzhou\343\200\251/eightg"
+    "urmukhi\340\251\256/ordfeminine\302\252/dblGrav"
+    "e\357\233\223/controlRS\036/ivowelsigngujara"
+    "ti\340\252\277/nyagujarati\340\252\236/chevertical"
+    "strokecyrillic\322\271/thehinitialarab"
+    "ic\357\272\233/twohangzhou\343\200\242/Tenroman\342\205\251"
+    "/Mdotaccent\341\271\200/Izhitsadblgravecy"
+    "rillic\321\266/afii10148\321\264/allequal\342\211\214"
+    "/bracketrightbt\357\243\273/Tcedilla/kaff"
+    "inalarabic\357\273\232/asciitilde/eightar"
+    "abic/Umonospace\357\274\265/circumflexbel"
+    "owcmb\314\255/kcedilla/controlUS\037/mdot"
+    "below\341\271\203/lira/paseqhebrew/Zcaron"
+    "small\357\233\277/nacute\305\204/afii57393/gafi"
+    "nitialarabic\357\256\224/kgreenlandic\304\270/h"
+    "aharabic/Upsilondieresishooksymb"
+    "olgreek\317\224/tethebrew/afii57664/Um"
+    "acron\305\252/segolhebrew/lamfinalarab"
+    "ic\357\273\236/controlSO\016/nieuntikeutkore"
+    "an\343\205\246/solidusshortoverlaycmb\314\267/d"
+    "dhabengali\340\246\242/Kacyrillic/holamqu"
+    "arterhebrew/arc\342\214\222/pieupcircleko"
+    "rean\343\211\245/caroncmb\314\214/corporationsq"
+    "uare\343\215\277/meemmeeminitialarabic\357\263\221"
+    "/aiecyrillic\323\225/afii00208/feharab"
+    "ic\331\201/getamark\343\200\223/circleplus/Oi\306\242"
+    "/lamjeeminitialarabic\357\263\211/approxi"
+    "matelyequal/gagurmukhi\340\250\227/minusp"
+    "lus\342\210\223/kagurmukhi\340\250\225/Gammaafrica"
+    "n\306\224/iinvertedbreve\310\213/blank\342\220\243/pr"
+    "oportion\342\210\267/arrowdownwhite\342\207\251/oc"
+    "ircumflexhookabove\341\273\225/Zcaron\305\275/s"
+    "uchthat\342\210\213/tildeverticalcmb\314\276/ya"
+    "smallkatakana\343\203\243/Feharmenian\325\226/r"
+    "hadeva\340\245\235/Acircumflex\303\202/afii5751"
+    "9\333\222/acircumflexacute\341\272\245/afii6316"
+    "7/Udieresisgrave\307\233/ocandradeva\340\244"
+    "\221/Brevesmall\357\233\264/Qsmall\357\235\261/seven/"
+    "sixmonospace\357\274\226/Acircumflextilde"
+    "\341\272\252/lagurmukhi\340\250\262/lessequalorgre"
+    "ater\342\213\232/thieuthkorean\343\205\214/afii100"
+    "86\321\204/sterlingmonospace\357\277\241/scircl"
+    "e\342\223\242/macronmonospace\357\277\243/gysquare"
+    "\343\217\211/ohornhookabove\341\273\237/uhorngrave"
+    "\341\273\253/dmonospace\357\275\204/whiterightpoin"
+    "tingsmalltriangle\342\226\271/omegaroundc"
+    "yrillic\321\273/blackleftpointingtrian"
+    "gle\342\227\200/zukatakana\343\202\272/hadeva\340\244\271/G"
+    "Bsquare\343\216\207/capslock\342\207\252/sikatakan"
+    "ahalfwidth\357\275\274/zbopomofo\343\204\227/ekore"
+    "an\343\205\224/hbopomofo\343\204\217/bsuperior\357\233\252/"
+    "hethebrew/Ccircumflex\304\210/lozenge\342"
+    "\227\212/tehnoonfinalarabic\357\261\263/afii100"
+    "96/afii57675/rakatakana\343\203\251/hataf"
+    "patah16/yicyrillic/pehinitialara"
+    "bic\357\255\230/strokelongoverlaycmb\314\266/da"
+    "armenian\325\244/abbreviationmarkarmen"
+    "ian\325\237/racute\305\225/circlepostalmark\343"
+    "\200\266/rrvocalicvowelsignbengali\340\247\204/"
+    "Utilde\305\250/Rsmallinvertedsuperior\312"
+    "\266/onecircle\342\221\240/huiitosquare\343\214\263/q"
+    "amats10/holam26/Zhecyrillic\320\226/af"
+    "ii57685/thieuthaparenkorean\343\210\231/p"
+    "eharmenian\325\272/omega\317\211/Otilde\303\225/m/"
+    "controlETX\003/udieresisgrave\307\234/Ari"
+    "ngsmall\357\237\245/phagujarati\340\252\253/o/whit"
+    "etelephone\342\230\217/zaqefgadolhebrew\326\225"
+    "/circumflexcmb\314\202/kiyeokacircleko"
+    "rean\343\211\256/ljecyrillic/hatafpatah23"
+    "/afii301\342\200\215/ideographicsocietypa"
+    "ren\343\210\263/arrowheadrightmod\313\203/mover"
+    "ssquare\343\216\247/chieuchacirclekorean\343"
+    "\211\267/afii10025/Ldot/Omacronacute\341\271"
+    "\222/segolnarrowhebrew/SF090000\342\224\244/"
+    "vavyodhebrew/kashidaautoarabic/z"
+    "okatakana\343\202\276/arrowup\342\206\221/wawfinal"
+    "arabic\357\273\256/qafinitialarabic\357\273\227/os"
+    "lash\303\270/phagurmukhi\340\250\253/pehebrew/t"
+    "ehmeeminitialarabic\357\262\244/blacklowe"
+    "rlefttriangle\342\227\243/uptackmod\313\224/squ"
+    "arecm\343\216\235/Ccedilla\303\207/xabovecmb\314\275/"
+    "afii10089/alefmaksurainitialarab"
+    "ic/Aringacute\307\272/Utildeacute\341\271\270/t"
+    "woroman\342\205\261/mieumparenkorean\343\210\204/p"
+    "arenrightsmall\357\271\232/afii57679/Gang"
+    "iacoptic\317\252/quoterightn/tteharabi"
+    "c/braceleftvertical\357\270\267/imacroncy"
+    "rillic\323\243/phi1/SF370000\342\225\237/totaot"
+    "hai\340\270\225/hatafqamatsquarterhebrew/"
+    "Rsmallinverted\312\201/afii10081/Eta\316\227"
+    "/sigmafinal/whitediamondcontaini"
+    "ngblacksmalldiamond\342\227\210/afii10832"
+    "\357\233\210/mieumsioskorean\343\205\257/verticall"
+    "inebelowcmb\314\251/wattosquare\343\215\227/mai"
+    "eklowrightthai\357\242\213/auvowelsigndev"
+    "a\340\245\214/SF100000\342\224\200/currency\302\244/tcir"
+    "cle\342\223\243/hehhamzaabovefinalarabic\357"
+    "\256\245/asmallkatakanahalfwidth\357\275\247/zi"
+    "katakana\343\202\270/dahiragana\343\201\240/vavvav"
+    "hebrew\327\260/yoyakorean\343\206\207/tetdagesh"
+    "/zedieresiscyrillic\323\237/acutecomb/"
+    "Otildesmall\357\237\265/edblgrave\310\205/downt"
+    "ackmod\313\225/egujarati\340\252\217/afii57418\330"
+    "\252/yaekorean\343\205\222/partialdiff\342\210\202/D/"
+    "munahhebrew/reharabic\330\261/arrowlef"
+    "tdbl/Grave\357\233\216/mwmegasquare\343\216\277/ma"
+    "iekthai\340\271\210/nowarmenian\325\266/Kjecyri"
+    "llic/macronlowmod\313\215/Gacute\307\264/kpa"
+    "square\343\216\252/wavedash\343\200\234/yuyeokorea"
+    "n\343\206\212/henghook\311\247/fongmanthai\340\271\217/T"
+    "circle\342\223\211/Efcyrillic/Ncaron\305\207/km"
+    "squaredsquare\343\216\242/thalfinalarabic"
+    "\357\272\254/parenrightvertical\357\270\266/Tau\316\244/"
+    "hukatakanahalfwidth\357\276\214/Fdotaccen"
+    "t\341\270\236/haitusquare\343\214\252/Racute\305\224/Bmo"
+    "nospace\357\274\242/kasraarabic/tikeutaci"
+    "rclekorean\343\211\260/IAcyrillic/gereshh"
+    "ebrew\327\263/Fitacyrillic/rdotbelowma"
+    "cron\341\271\235/threeparen\342\221\266/arrowleftd"
+    "blstroke\342\207\215/Kcircle\342\223\200/t/gimarme"
+    "nian\325\243/yehbarreearabic/bekatakan"
+    "a\343\203\231/intersection\342\210\251/braceex\357\243\264/"
+    "Iacute\303\215/dialytikatonoscmb\315\204/fiv"
+    "esuperior\342\201\265/hehhamzaaboveisolat"
+    "edarabic\357\256\244/comma,/yyabengali\340\247\237"
+    "/fehfinalarabic\357\273\222/bagurmukhi\340\250\254"
+    "/Upsilonafrican\306\261/H18551\342\226\253/yhoo"
+    "k\306\264/reharmenian\326\200/hehinitialarab"
+    "ic\357\273\253/whitecircleinverse/yukatak"
+    "ana\343\203\246/notgreaternorequal\342\211\261/esh"
+    "reversedloop\306\252///oneoldstyle\357\234\261/"
+    "kokaithai\340\270\201/Emacrongrave\341\270\224/sok"
+    "atakana\343\202\275/./osmallkatakana\343\202\251/p"
+    "lussmall\357\271\242/Umacrondieresis\341\271\272/i"
+    "deographicspecialparen\343\210\265/zainar"
+    "abic/hehfinalarabic/hikatakana\343\203"
+    "\222/threecircleinversesansserif\342\236\214"
+    "/sevengurmukhi\340\251\255/ddagujarati\340\252\241"
+    "/gravecomb\314\200/aibopomofo\343\204\236/kacyr"
+    "illic/SF440000\342\225\254/khahfinalarabi"
+    "c\357\272\246/threegurmukhi\340\251\251/afii57429/"
+    "iniarmenian\325\253/Ysmall\357\235\271/ypogegra"
+    "mmeni\315\272/abrevecyrillic\323\221/nineinf"
+    "erior\342\202\211/parenrightinferior\342\202\216/z"
+    "eta\316\266/ragurmukhi\340\250\260/ringhalfrigh"
+    "t\312\276/mugreek\316\274/rieulmieumkorean\343\204"
+    "\273/abbreviationsigndeva\340\245\260/fdotac"
+    "cent\341\270\237/shchacyrillic\321\211/xi\316\276/jag"
+    "urmukhi\340\250\234/esdescendercyrillic\322\253"
+    "/visargagujarati\340\252\203/tthagujarati"
+    "\340\252\240/afii10032/klsquare\343\216\230/ecaron"
+    "\304\233/sheva22/dotlessjstrokehook\312\204/"
+    "Chook\306\207/eopenreversedclosed\311\236/th"
+    "reegujarati\340\253\251/afii10067/dollars"
+    "mall\357\271\251/Hmonospace\357\274\250/bracketlef"
+    "ttp\357\243\256/threeeighths\342\205\234/=/thieuth"
+    "circlekorean\343\211\253/afii10027/Idiere"
+    "sisacute\341\270\256/twooldstyle\357\234\262/voice"
+    "dmarkkana\343\202\233/emphasismarkarmenia"
+    "n\325\233/jmonospace\357\275\212/squaremm\343\216\234/ya"
+    "gujarati\340\252\257/righttackbelowcmb\314\231/"
+    "evowelsigndeva\340\245\207/subsetnotequal"
+    "\342\212\212/supersetorequal/dekatakana\343\203"
+    "\207/Jsmall\357\235\252/mbsquare\343\217\224/e/hedage"
+    "shhebrew\357\254\264/khahinitialarabic\357\272\247"
+    "/iterationkatakana\343\203\275/chedescend"
+    "ercyrillic\322\267/SF470000\342\225\244/dollari"
+    "nferior\357\233\243/ddhadeva\340\244\242/mu\302\265/ther"
+    "eexists\342\210\203/nukatakanahalfwidth\357\276"
+    "\207/controlDC1\021/Ecircumflexsmall\357\237"
+    "\252/tonefive\306\275/Ecyrillic/viramaguj"
+    "arati\340\253\215/tikeutaparenkorean\343\210\220/r"
+    "fishhook\311\276/Lambda\316\233/ibopomofo\343\204\247"
+    "/filledbox/gravecmb/nabengali\340\246\250"
+    "/hungarumlaut\313\235/numbersign#/chie"
+    "uchparenkorean\343\210\211/jcrossedtail\312\235"
+    "/Odieresiscyrillic\323\246/fourcirclei"
+    "nversesansserif\342\236\215/alpha\316\261/zhear"
+    "menian\325\252/afii64937/pmonospace\357\275\220"
+    "/yukorean\343\205\240/zaharabic/nnadeva\340\244"
+    "\243/degree\302\260/underscorewavy\357\271\217/cie"
+    "uccirclekorean\343\211\250/odblacute\305\221/ve"
+    "hmedialarabic\357\255\255/sheqel/Abrevedo"
+    "tbelow\341\272\266/ohungarumlaut/SF260000"
+    "\342\225\235/yturned\312\216/Etildebelow\341\270\232/ome"
+    "galatinclosed\311\267/ffi\357\254\203/kappa\316\272/s"
+    "carondotaccent\341\271\247/Eiotifiedcyril"
+    "lic\321\244/braceleftmonospace\357\275\233/Iinv"
+    "ertedbreve\310\212/threehackarabic/reh"
+    "iragana\343\202\214/etarmenian\325\250/Oopen\306\206/"
+    "tcedilla/Hdieresis\341\270\246/segol1f/af"
+    "ii299\342\200\216/Ucircumflexbelow\341\271\266/sev"
+    "encircle\342\221\246/braceleftmid\357\243\262/iocy"
+    "rillic\321\221/oneparen\342\221\264/zeromonospa"
+    "ce\357\274\220/xdotaccent\341\272\213/Hardsigncyri"
+    "llic/dadmedialarabic\357\273\200/zerowidt"
+    "hnonjoiner/alefhamzaabovefinalar"
+    "abic\357\272\204/lxsquare\343\217\223/tusmallkatak"
+    "ana\343\203\203/nuktagurmukhi\340\250\274/whitedow"
+    "npointingtriangle\342\226\275/dieresisbel"
+    "owcmb\314\244/sixbengali\340\247\254/emonospace"
+    "\357\275\205/afii57676/makatakanahalfwidt"
+    "h\357\276\217/Emcyrillic/odblgrave\310\215/oogo"
+    "nek\307\253/vewarmenian\325\276/ideographicc"
+    "orrectcircle\343\212\243/ncircle\342\223\235/hdota"
+    "ccent\341\270\243/afii10092\321\212/greateroreq"
+    "uivalent\342\211\263/squareln\343\217\221/jsuperio"
+    "r\312\262/amsquare\343\217\202/afii10022\320\225/four"
+    "ideographicparen\343\210\243/anusvaraguja"
+    "rati\340\252\202/sevengujarati\340\253\255/blackdi"
+    "amond\342\227\206/Tworoman\342\205\241/Tdotbelow\341\271"
+    "\254/earth\342\231\201/anudattadeva\340\245\222/Y/Wgr"
+    "ave\341\272\200/ideographiccomma\343\200\201/qofda"
+    "gesh/Idieresiscyrillic\323\244/angbopo"
+    "mofo\343\204\244/eukorean\343\205\241/ecircumflex\303"
+    "\252/uhungarumlaut/ghhadeva\340\245\232/comm"
+    "aaboverightcmb\314\225/uhorntilde\341\273\257/b"
+    "racketrightmonospace\357\274\275/seventee"
+    "ncircle\342\221\260/sheenmedialarabic\357\272\270/"
+    "agujarati\340\252\205/qbopomofo\343\204\221/samekh"
+    "hebrew/nsuperior\342\201\277/qafarabic\331\202/"
+    "anglebracketleft\343\200\210/abreveacute\341"
+    "\272\257/lacute\304\272/yerudieresiscyrillic"
+    "\323\271/ideographwatercircle\343\212\214/halan"
+    "tgurmukhi\340\251\215/dlinebelow\341\270\217/Idier"
+    "esissmall\357\237\257/aring\303\245/sheva115/ap"
+    "proaches\342\211\220/twentyparen\342\222\207/rohir"
+    "agana\343\202\215/Raarmenian\325\214/abopomofo\343"
+    "\204\232/rbopomofo\343\204\226/Adieresis\303\204/Reha"
+    "rmenian\325\220/lbopomofo\343\204\214/echyiwnar"
+    "menian\326\207/cedilla\302\270/yokatakana\343\203\250"
+    "/Iogonek\304\256/palochkacyrillic\323\200/wc"
+    "ircumflex\305\265/Itildebelow\341\270\254/iicyr"
+    "illic\320\270/emcyrillic\320\274/afii57672/d"
+    "dotbelow\341\270\215/tildedoublecmb\315\240/afi"
+    "i57700/Sdotbelowdotaccent\341\271\250/Fiv"
+    "eroman\342\205\244/afii57799/controlEM\031/W"
+    "dotaccent\341\272\206/patahwidehebrew/MBs"
+    "quare\343\216\206/sekatakanahalfwidth\357\275\276/"
+    "yusmallkatakanahalfwidth\357\275\255/afii"
+    "57450/afii57431\330\267/ideographicclo"
+    "se\343\200\206/maitriupperleftthai\357\242\220/Eog"
+    "onek\304\230/nokatakana\343\203\216/ebengali\340\246\217"
+    "/jeemmedialarabic\357\272\240/idotbelow\341\273"
+    "\213/hhooksuperior\312\261/otildeacute\341\271\215"
+    "/coverkgsquare\343\217\206/fiveperiod\342\222\214/"
+    "Ygrave\341\273\262/semicolon;/dhadeva\340\244\247/"
+    "rturned\311\271/iota\316\271/audeva\340\244\224/damma"
+    "tanarabic/Iotatonos\316\212/hahinitial"
+    "arabic\357\272\243/foursuperior\342\201\264/yamakk"
+    "anthai\340\271\216/yehmedialarabic/double"
+    "yodpatahhebrew/commaturnedabovec"
+    "mb\314\222/SF410000\342\225\246/omega1/ohornacu"
+    "te\341\273\233/afii10084/dollaroldstyle\357\234"
+    "\244/curlyand\342\213\217/shevaquarterhebrew"
+    "/Omegatitlocyrillic\321\274/tonos\316\204/B/"
+    "zhebrevecyrillic\323\202/afii57671/cen"
+    "tmonospace\357\277\240/afii10098/J/dblove"
+    "rlinecmb\314\277/V/afii57678/tserewide"
+    "hebrew/ubar\312\211/ahookabove\341\272\243/nine"
+    "ideographicparen\343\210\250/taharabic/af"
+    "ii10082/Msmall\357\235\255/parenleftinfer"
+    "ior\342\202\215/Mu\316\234/kafdageshhebrew/macr"
+    "onbelowcmb\314\261/controlDC2\022/quotesi"
+    "nglemonospace\357\274\207/subsetorequal/k"
+    "habengali\340\246\226/fehinitialarabic\357\273\223"
+    "/verticalbar/Aacute\303\201/aibengali\340"
+    "\246\220/semivoicedmarkkanahalfwidth\357\276"
+    "\237/ampersandsmall\357\234\246/nundageshheb"
+    "rew/afii10108/overlinewavy\357\271\213/ap"
+    "aren\342\222\234/gecyrillic/gamma\316\263/ssang"
+    "cieuckorean\343\205\211/commainferior\357\233\241/"
+    "thook\306\255/ograve\303\262/+/blacklenticul"
+    "arbracketleft\343\200\220/ukatakana\343\202\246/yo"
+    "dyodpatahhebrew/ncaron\305\210/one/afi"
+    "i57394/Ldotbelow\341\270\266/Uacute\303\232/pho"
+    "phanthai\340\270\236/dbldanda\340\245\245/hatafseg"
+    "olnarrowhebrew/tthadeva\340\244\240/comma"
+    "abovecmb\314\223/heiseierasquare\343\215\273/na"
+    "hiragana\343\201\252/lslash\305\202/yesieungpan"
+    "sioskorean\343\206\203/Amonospace\357\274\241/ecan"
+    "dravowelsigndeva\340\245\205/kakatakanaha"
+    "lfwidth\357\275\266/quotedbl/hamzalowarab"
+    "ic/wdieresis\341\272\205/zdotaccent/afii1"
+    "0078/afii10079/Hdotbelow\341\270\244/bull"
+    "etinverse/dokatakana\343\203\211/chochoet"
+    "hai\340\270\214/aarusquare\343\214\203/ideographic"
+    "space\343\200\200/ttabengali\340\246\237/ideograph"
+    "iclaborparen\343\210\270/afii57705/afii57"
+    "396/franc\342\202\243/alefhebrew/fathatan"
+    "arabic\331\213/hookretroflexbelowcmb\314\242"
+    "/ghestrokecyrillic\322\223/questiongre"
+    "ek\315\276/oshortdeva\340\244\222/asciicircum^/"
+    "reversedtilde\342\210\275/emacron\304\223/I/poi"
+    "ntingindexdownwhite\342\230\237/Ezh\306\267/cal"
+    "square\343\216\210/</nu\316\275/ringhalfrightbe"
+    "lowcmb\314\271/nhiragana\343\202\223/parenlefta"
+    "ltonearabic\357\264\276/qadeva\340\245\230/lessorg"
+    "reater\342\211\266/rieulphieuphkorean\343\204\277/"
+    "rvocalicgujarati\340\252\213/ncedilla/vdo"
+    "tbelow\341\271\277/erbopomofo\343\204\246/enghecyr"
+    "illic\322\245/eegurmukhi\340\250\217/ruthai\340\270\244/"
+    "tchehfinalarabic\357\255\273/hakatakanaha"
+    "lfwidth\357\276\212/threecircle\342\221\242/khieuk"
+    "hcirclekorean\343\211\252/ccurl\311\225/Udblacu"
+    "te/ninearabic/imageorapproximate"
+    "lyequal\342\211\223/cyrBreve\357\233\221/bahtthai\340"
+    "\270\277/rupeesignbengali\340\247\263/rieulpare"
+    "nkorean\343\210\203/seenfinalarabic\357\272\262/em"
+    "acronacute\341\270\227/ccaron\304\215/puhiragan"
+    "a\343\201\267/efcyrillic/afii10031/gakata"
+    "kana\343\202\254/zerohackarabic/Vecyrilli"
+    "c/ayinhebrew/notelement/periodha"
+    "lfwidth\357\275\241/fiveinferior\342\202\205/dotma"
+    "th\342\213\205/ohookabove\341\273\217/tserehebrew/"
+    "gravebelowcmb\314\226/noonmeeminitiala"
+    "rabic\357\263\225/downtackbelowcmb\314\236/edot"
+    "accent/nineperiod\342\222\220/afii57687/i"
+    "acyrillic/palatalizationcyrillic"
+    "cmb\322\204/Tetsecyrillic\322\264/nhookleft\311"
+    "\262/etnahtafoukhlefthebrew/yusmall"
+    "katakana\343\203\245/dzaltone\312\243/vtilde\341\271\275"
+    "/alefhamzabelowfinalarabic\357\272\210/pi"
+    "eupthieuthkorean\343\205\267/thorn\303\276/adev"
+    "a\340\244\205/nikhahitleftthai\357\242\231/afii574"
+    "20\330\254/ogujarati\340\252\223/tortoiseshellb"
+    "racketright\343\200\225/dasiapneumatacyri"
+    "lliccmb\322\205/Uacutesmall\357\237\272/sakatak"
+    "anahalfwidth\357\275\273/nbspace/tonebarl"
+    "owmod\313\250/hohipthai\340\270\253/muchless\342\211\252"
+    "/hagujarati\340\252\271/parenrightex\357\243\267/y"
+    "asmallkatakanahalfwidth\357\275\254/hpare"
+    "n\342\222\243/mieumkorean\343\205\201/jeemarabic/m"
+    "aitholowleftthai\357\242\217/Sigma\316\243/;/sa"
+    "hiragana\343\201\225/Zhedescendercyrillic"
+    "\322\226/khhagurmukhi\340\251\231/telishaqetana"
+    "hebrew\326\251/eight/afii10846\323\231/uhung"
+    "arumlautcyrillic\323\263/vavdagesh/Ado"
+    "tbelow\341\272\240/hatafpatah/C/afii57513"
+    "/underscoremonospace\357\274\277/ideograp"
+    "hicmedicinecircle\343\212\251/tehjeeminit"
+    "ialarabic\357\262\241/Ubreve\305\254/precedes\342\211"
+    "\272/ideographicselfparen\343\211\202/eshort"
+    "vowelsigndeva\340\245\206/threenumeratorb"
+    "engali\340\247\266/afii57684/parenleftbt\357"
+    "\243\255/Acircle\342\222\266/#/Dzcaron\307\205/noonme"
+    "emisolatedarabic\357\261\216/succeeds\342\211\273/"
+    "asuperior\357\233\251/Ehookabove\341\272\272/qhook"
+    "\312\240/F/ddalarabic/decyrillic/rsupe"
+    "rior\357\233\261/Sacute\305\232/tcircumflexbelo"
+    "w\341\271\261/lmsquare\343\217\220/quarternote\342\231\251/"
+    "shevahebrew/gohiragana\343\201\224/afii57"
+    "388/bracerightmonospace\357\275\235/comma"
+    "small\357\271\220/denominatorminusonenume"
+    "ratorbengali\340\247\270/jeemfinalarabic\357"
+    "\272\236/delta\316\264/squaremg\343\216\216/sikatakan"
+    "a\343\202\267/strokeshortoverlaycmb\314\265/aub"
+    "engali\340\246\224/khacyrillic/dotlessi\304\261"
+    "/aabengali\340\246\206/kafmedialarabic\357\273\234"
+    "/Icircumflex\303\216/aagujarati\340\252\206/SF4"
+    "80000\342\225\245/qubutsnarrowhebrew/nkat"
+    "akanahalfwidth\357\276\235/W/tserequarter"
+    "hebrew/alefhamzabelowarabic/kacu"
+    "te\341\270\261/xparen\342\222\263/logicalnotrevers"
+    "ed/afii57451/afii10091/ideograph"
+    "earthcircle\343\212\217/hedagesh/parallel"
+    "\342\210\245/threepersian\333\263/hieuhparenkor"
+    "ean\343\210\215/hiriq21/dcircumflexbelow\341"
+    "\270\223/gcommaaccent/Wsmall\357\235\267/Ediere"
+    "sis\303\213/pageup\342\207\236/behmedialarabic\357"
+    "\272\222/,/commamonospace\357\274\214/daggerdbl"
+    "\342\200\241/finalpehebrew/rokatakana\343\203\255/"
+    "newsheqelsign/ivowelsigndeva\340\244\277/"
+    "yhookabove\341\273\267/afii10194\321\243/Vhook\306"
+    "\262/twocircle\342\221\241/similar/glottalst"
+    "opstrokereversed\312\242/ssangnieunkor"
+    "ean\343\205\245/cornerbracketleftvertical"
+    "\357\271\201/hamzaarabic/gimelhebrew/ikor"
+    "ean\343\205\243/ideographicperiod\343\200\202/bagu"
+    "jarati\340\252\254/whiteuppointingtriangl"
+    "e\342\226\263/ydotbelow\341\273\265/Zlinebelow\341\272\224/"
+    "diamond\342\231\246/existential/Esh\306\251/tha"
+    "larabic\330\260/moverssquaredsquare\343\216\250"
+    "/perpendicular\342\212\245/rekatakana\343\203\254/"
+    "evowelsigngujarati\340\253\207/zerothai\340\271"
+    "\220/OEsmall\357\233\272/ideographicmetalpar"
+    "en\343\210\256/parenleftvertical\357\270\265/maita"
+    "ikhuthai\340\271\207/Threeroman\342\205\242/eightp"
+    "eriod\342\222\217/smonospace\357\275\223/phosampha"
+    "othai\340\270\240/dcircle\342\223\223/thanthakhatt"
+    "hai\340\271\214/chieuchkorean\343\205\212/notparal"
+    "lel\342\210\246/Tsecyrillic/threehangzhou"
+    "\343\200\243/minusmod\313\227/ddhagurmukhi\340\250\242/b"
+    "ackslashmonospace\357\274\274/Omonospace\357"
+    "\274\257/Blinebelow\341\270\206/bracerighttp\357\243\274"
+    "/cagurmukhi\340\250\232/Aringbelow\341\270\200/Udi"
+    "eresismacron\307\225/fourthai\340\271\224/contr"
+    "olLF\012/Mdotbelow\341\271\202/schwa\311\231/paase"
+    "ntosquare\343\214\253/careof\342\204\205/Twelverom"
+    "an\342\205\253/afii57441/Oharmenian\325\225/Kad"
+    "escendercyrillic\322\232/ibengali\340\246\207/s"
+    "eagullbelowcmb\314\274/pokatakana\343\203\235/a"
+    "fii57636/iimatragurmukhi\340\251\200/iogo"
+    "nek\304\257/umacron\305\253/lamalefhamzaabov"
+    "eisolatedarabic\357\273\267/yakatakana\343\203\244"
+    "/lvocalicvowelsignbengali\340\247\242/pro"
+    "persubset\342\212\202/Ugrave\303\231/equalsuper"
+    "ior\342\201\274/behiragana\343\201\271/sehiragana\343"
+    "\201\233/memdagesh\357\254\276/Cdot/mwsquare\343\216\275"
+    "/H18543/onehalf\302\275/Gravesmall\357\235\240/"
+    "hekatakana\343\203\230/kafarabic/phadeva\340"
+    "\244\253/Omega/labengali\340\246\262/breveinver"
+    "teddoublecmb\315\241/afii57453\331\215/tackl"
+    "eft\342\212\243/zahiragana\343\201\226/ringcmb\314\212/h"
+    "oarmenian\325\260/saraiithai\340\270\265/clubsu"
+    "itwhite\342\231\247/second\342\200\263/ideographmo"
+    "oncircle\343\212\212/hekutaarusquare\343\214\266/z"
+    "dotbelow\341\272\223/patah2a/Lmonospace\357\274"
+    "\254/asciitildemonospace\357\275\236/pparen\342"
+    "\222\253/agurmukhi\340\250\205/roruathai\340\270\243/uma"
+    "tragurmukhi\340\251\201/ssangpieupkorean\343"
+    "\205\203/SF520000\342\225\223/zeropersian\333\260/hun"
+    "garumlautcmb\314\213/bethebrew/sarauee"
+    "leftthai\357\242\210/Schwacyrillic\323\230/afii"
+    "57645\326\276/jdotlessstroke\311\237/auvowel"
+    "signgujarati\340\253\214/sevenideographic"
+    "paren\343\210\246/ezhcaron\307\257/mmcubedsquar"
+    "e\343\216\243/muvsquare\343\216\266/Ereversed\306\216/Hz"
+    "square\343\216\220/sbopomofo\343\204\231/nnnadeva\340"
+    "\244\251/twobengali\340\247\250/reviahebrew/vpa"
+    "ren\342\222\261/cyrbreve\357\233\224/meemmedialara"
+    "bic\357\273\244/afii10045/Uhookabove\341\273\246/s"
+    "entisquare\343\214\242/Sixroman\342\205\245/ttadev"
+    "a\340\244\237/fbopomofo\343\204\210/Otcyrillic\321\276/s"
+    "ummation\342\210\221/Oslashsmall\357\237\270/aivow"
+    "elsigndeva\340\245\210/checkmark\342\234\223/Haabk"
+    "hasiancyrillic\322\250/siosaparenkorea"
+    "n\343\210\224/qadmahebrew\326\250/Ucaron\307\223/pata"
+    "hquarterhebrew/hokatakana\343\203\233/squ"
+    "areupperlefttolowerrightfill\342\226\247/"
+    "whitelenticularbracketright\343\200\227/E"
+    "open\306\220/behinitialarabic\357\272\221/gcirc"
+    "le\342\223\226/yoyaekorean\343\206\210/DZcaron\307\204/s"
+    "araaimaimuanthai\340\271\203/llvocalicdev"
+    "a\340\245\241/augujarati\340\252\224/hatafsegolheb"
+    "rew/djecyrillic/controlACK\006/Gsma"
+    "llhook\312\233/onenumeratorbengali\340\247\264/"
+    "sallallahoualayhewasallamarabic\357"
+    "\267\272/voicediterationhiragana\343\202\236/ja"
+    "armenian\325\261/Zmonospace\357\274\272/lparen\342"
+    "\222\247/afii10055/uuvowelsigngujarati"
+    "\340\253\202/rikatakana\343\203\252/sevenroman\342\205\266/"
+    "Ntilde\303\221/cheabkhasiancyrillic\322\275/"
+    "dagger\342\200\240/zedescendercyrillic\322\231/"
+    "peseta\342\202\247/hatafsegol24/Dsmall\357\235\244"
+    "/Osmall\357\235\257/iubopomofo\343\204\251/bulleto"
+    "perator\342\210\231/twoideographicparen\343\210"
+    "\241/iotadieresistonos\316\220/referencem"
+    "ark\342\200\273/teharabic/controlBEL\007/bla"
+    "ckcircle/Tcaron\305\244/breveinvertedc"
+    "mb\314\221/questionmonospace\357\274\237/xcircl"
+    "e\342\223\247/shinsindot/yusbigiotifiedcy"
+    "rillic\321\255/udotbelow\341\273\245/Ydieresiss"
+    "mall\357\237\277/afii10018\320\221/Edieresissma"
+    "ll\357\237\253/kasmallkatakana\343\203\265/ydotacc"
+    "ent\341\272\217/threeroman\342\205\262/Nu\316\235/miriba"
+    "arusquare\343\215\212/arrowrightheavy\342\236\236/"
+    "oharmenian\326\205/omacron\305\215/SF030000\342"
+    "\224\220/afii57458/lamarabic/behmeemin"
+    "itialarabic\357\262\237/utildebelow\341\271\265/ci"
+    "rcleot\342\212\231/ideographicwaterparen\343"
+    "\210\254/Thook\306\254/shindageshsindothebre"
+    "w/Ntildesmall\357\237\261/ocircumflexdotb"
+    "elow\341\273\231/birusquare\343\214\261/resh/afii1"
+    "0107/wawhamzaabovearabic/nine/ak"
+    "atakanahalfwidth\357\275\261/ccedillaacut"
+    "e\341\270\211/afii57716/Alphatonos\316\206/brac"
+    "ketleftmonospace\357\274\273/integralbt\342\214"
+    "\241/afii10085/bridgebelowcmb\314\252/Ima"
+    "croncyrillic\323\242/chi\317\207/colontriang"
+    "ularhalfmod\313\221/wikorean\343\205\237/Checyr"
+    "illic\320\247/sigmalunatesymbolgreek\317\262"
+    "/yoikorean\343\206\211/igurmukhi\340\250\207/ellip"
+    "sis\342\200\246/Ugravesmall\357\237\271/Lsmall\357\235\254/"
+    "adieresismacron\307\237/Rcircle\342\223\207/sar"
+    "aamthai\340\270\263/nekatakanahalfwidth\357\276"
+    "\210/threeideographicparen\343\210\242/sosal"
+    "athai\340\270\250/gadeva\340\244\227/iibengali\340\246\210/"
+    "eightmonospace\357\274\230/izhitsacyrilli"
+    "c/afii57454/leftangleabovecmb\314\232/"
+    "shalshelethebrew\326\223/SF400000\342\225\251/S"
+    "circumflex\305\234/logicalor\342\210\250/paragr"
+    "aph\302\266/Softsigncyrillic/thothungt"
+    "hai\340\270\226/elcyrillic\320\273/emdashvertic"
+    "al\357\270\261/mars/Bdotbelow\341\270\204/Zedieres"
+    "iscyrillic\323\236/nuktagujarati\340\252\274/1/"
+    "kasratanarabic/merkhakefulahebre"
+    "w/tlinebelow\341\271\257/mahiragana\343\201\276/pi"
+    "hiragana\343\201\264/fourpersian\333\264/kiyeok"
+    "circlekorean\343\211\240/afii10071/ecircu"
+    "mflextilde\341\273\205/equal/odieresis\303\266/"
+    "&/ghaininitialarabic\357\273\217/fivecirc"
+    "leinversesansserif\342\236\216/SF020000\342\224"
+    "\224/zuhiragana\343\201\232/equalmonospace\357\274"
+    "\235/SF510000\342\225\222/Wdieresis\341\272\204/afii6"
+    "1248/lbelt\311\254/yusmallhiragana\343\202\205/"
+    "zerogujarati\340\253\246/Acircumflexsmall"
+    "\357\237\242/Upsilontonos\316\216/cieuckorean\343\205"
+    "\210/sheenfinalarabic\357\272\266/Scaron\305\240/B"
+    "ecyrillic/uuvowelsigndeva\340\245\202/qam"
+    "atsqatanhebrew/ecircumflexgrave\341"
+    "\273\201/mabengali\340\246\256/sadeva\340\244\270/rightt"
+    "riangle\342\212\277/Endescendercyrillic\322\242"
+    "/afii57800/afii10192\357\233\206/telephon"
+    "e\342\204\241/wawhamzaabovefinalarabic\357\272\206"
+    "/tohiragana\343\201\250/ocandravowelsigng"
+    "ujarati\340\253\211/8/kafhebrew/pfsquare\343"
+    "\216\212/thothongthai\340\270\230/samekh/kokata"
+    "kanahalfwidth\357\275\272/euro/tsadidages"
+    "hhebrew/iebrevecyrillic\323\227/yekore"
+    "an\343\205\226/ninegurmukhi\340\251\257/ssabengali"
+    "\340\246\267/proportional\342\210\235/ghagujarati\340"
+    "\252\230/maqafhebrew/esh\312\203/cacute\304\207/zh"
+    "bopomofo\343\204\223/wakatakana\343\203\257/arrowu"
+    "pwhite\342\207\247/tokatakanahalfwidth\357\276\204"
+    "/ogonekcmb\314\250/fathaarabic/onesupe"
+    "rior\302\271/pbopomofo\343\204\206/pazerhebrew\326"
+    "\241/afii57411/sixoldstyle\357\234\266/hv\306\225/"
+    "radeva\340\244\260/dblarrowleft\342\207\224/hhook\311"
+    "\246/blackrightpointingpointer/nfsq"
+    "uare\343\216\213/finalkafdagesh/Uhorngrav"
+    "e\341\273\252/Acyrillic\320\220/blackupperright"
+    "triangle\342\227\245/Ihookabove\341\273\210/threeb"
+    "engali\340\247\251/afii57427/arrowheadupm"
+    "od\313\204/copyrightsans\357\243\251/afii57801/"
+    "lsuperior\357\233\256/afii10105/shinshind"
+    "othebrew/SF250000\342\225\227/afii57425/I"
+    "zhitsacyrillic/sheva/hiriq14/afi"
+    "i10041/breve\313\230/ismallkatakana\343\202\243"
+    "/h/yatcyrillic/sevenperiod\342\222\216/Ig"
+    "ravesmall\357\237\254/sioskorean\343\205\205/arrow"
+    "rightwhite\342\207\250/gaffinalarabic\357\256\223/"
+    "qafmedialarabic\357\273\230/cabengali\340\246\232/"
+    "Idotbelow\341\273\212/dblverticallineabov"
+    "ecmb\314\216/Yatcyrillic/semicolonarab"
+    "ic\330\233/rdblgrave\310\221/blacklenticular"
+    "bracketleftvertical\357\270\273/honokhukt"
+    "hai\340\270\256/cornerbracketright\343\200\215/sch"
+    "wacyrillic/dehiragana\343\201\247/Jheharm"
+    "enian\325\213/noonmedialarabic\357\273\250/zero"
+    "bengali\340\247\246/{/pi\317\200/onethai\340\271\221/ein"
+    "vertedbreve\310\207/aagurmukhi\340\250\206/shin"
+    "dageshhebrew/onequarter\302\274/thanth"
+    "akhatlowleftthai\357\242\230/etnahtahebre"
+    "w/Adblgrave\310\200/aavowelsigngujarat"
+    "i\340\252\276/cieucaparenkorean\343\210\226/Upsilo"
+    "n\316\245/i/afii10093\321\213/afii57804/rado"
+    "verssquaredsquare\343\216\257/semicolonmo"
+    "nospace\357\274\233/Ustraightstrokecyrill"
+    "ic\322\260/shevawidehebrew/spadesuitbl"
+    "ack/ugujarati\340\252\211/hypheninferior\357"
+    "\233\245/exclamarmenian\325\234/harpoonleftb"
+    "arbup\342\206\274/gafarabic\332\257/element\342\210\210/"
+    "Daarmenian\324\264/at/X/mieumaparenkor"
+    "ean\343\210\222/greaterequal\342\211\245/onefitted"
+    "\357\233\234/dzhecyrillic/Scedilla\305\236/H220"
+    "73/afii10017/Digammagreek\317\234/hyph"
+    "entwo\342\200\220/shook\312\202/integralbottom/"
+    "rieulhieuhkorean\343\205\200/afii10100/or"
+    "dmasculine\302\272/rafehebrew/ohorn\306\241/"
+    "ll\357\233\200/mhzsquare\343\216\222/afii57407/cho"
+    "changthai\340\270\212/Gamma\316\223/nakatakanah"
+    "alfwidth\357\276\205/g/amonospace\357\275\201/twod"
+    "otleadervertical\357\270\260/oekorean\343\205\232/"
+    "Ohornacute\341\273\232/zerowidthspace\342\200\213/"
+    "afii57929\312\274/DieresisGrave\357\233\215/tse"
+    "re2b/aigujarati\340\252\220/bukatakana\343\203\226"
+    "/nmonospace\357\275\216/angstrom\342\204\253/prime"
+    "reversed\342\200\265/verticallinelowmod\313\214"
+    "/hahmedialarabic\357\272\244/etatonos\316\256/h"
+    "ahfinalarabic\357\272\242/questionsmall\357\234"
+    "\277/twohackarabic/Phook\306\244/bracelef"
+    "t/yenmonospace\357\277\245/rrvocalicvowel"
+    "signgujarati\340\253\204/>/cadeva\340\244\232/four"
+    "roman\342\205\263/overline\342\200\276/bracerightv"
+    "ertical\357\270\270/kiyeokparenkorean\343\210\200/"
+    "afii10024/hmonospace\357\275\210/elevenci"
+    "rcle\342\221\252/!/sioskiyeokkorean\343\205\272/ch"
+    "abengali\340\246\233/N/ruhiragana\343\202\213/muka"
+    "takana\343\203\240/yehmeemisolatedarabic\357"
+    "\261\230/muwsquare\343\216\274/Ocircumflextilde"
+    "\341\273\226/afii57428/tmonospace\357\275\224/Bsma"
+    "ll\357\235\242/Cedillasmall\357\236\270/Piwrarmeni"
+    "an\325\223/k/Idblgrave\310\210/ts\312\246/fifteenc"
+    "ircle\342\221\256/kappasymbolgreek\317\260/Upsi"
+    "lonacutehooksymbolgreek\317\223/Zdot\305\273"
+    "/Sampigreek\317\240/hardsigncyrillic/s"
+    "caron\305\241/Istroke\306\227/shhacyrillic\322\273"
+    "/wahiragana\343\202\217/lamkhahinitialara"
+    "bic\357\263\213/afii10145/dzecyrillic/muc"
+    "hgreater\342\211\253/5/gbopomofo\343\204\215/afii5"
+    "7442/ehiragana\343\201\210/quotedblright\342"
+    "\200\235/Eng\305\212/periodcentered/uhorn\306\260/"
+    "bohiragana\343\201\274/vukatakana\343\203\264/yako"
+    "rean\343\205\221/llvocalicvowelsigndeva\340\245"
+    "\243/^/K/shimacoptic\317\255/segol13/whit"
+    "ebullet/menarmenian\325\264/nineparen\342"
+    "\221\274/rieulpansioskorean\343\205\254/memdage"
+    "shhebrew/notgreater\342\211\257/integralt"
+    "p/ecandravowelsigngujarati\340\253\205/Ed"
+    "blgrave\310\204/ehbopomofo\343\204\235/ohiragan"
+    "a\343\201\212/ideographmetalcircle\343\212\216/SF2"
+    "40000\342\225\221/rieulacirclekorean\343\211\261/f"
+    "ourteencircle\342\221\255/G/eighthangzhou"
+    "\343\200\250/Ecircumflextilde\341\273\204/notident"
+    "ical\342\211\242/phieuphaparenkorean\343\210\232/d"
+    "ammalowarabic/Aring\303\205/mikatakana"
+    "halfwidth\357\276\220/whitecornerbracketl"
+    "eft\343\200\216/Abrevegrave\341\272\260/Nacute\305\203/d"
+    "ecimalseparatorpersian/icaron\307\220/"
+    "vavdageshhebrew/afii10065/nvsqua"
+    "re\343\216\265/Ocircumflexsmall\357\237\264/pieupk"
+    "orean\343\205\202/dodekthai\340\270\224/propellor\342"
+    "\214\230/mlsquare\343\216\226/ideographicallian"
+    "ceparen\343\210\277/Etarmenian\324\270/Ucyrilli"
+    "c/rrabengali\340\247\234/kapyeounmieumkor"
+    "ean\343\205\261/Ucircumflexsmall\357\237\273/apost"
+    "rophemod/controlEOT\004/mu1/tcaron\305"
+    "\245/ladeva\340\244\262/bhabengali\340\246\255/afii57"
+    "381/ddalfinalarabic\357\256\211/ralowerdi"
+    "agonalbengali\340\247\261/nihiragana\343\201\253/v"
+    "isargadeva\340\244\203/lcaron\304\276/lcircle\342\223"
+    "\233/Kaverticalstrokecyrillic\322\234/lam"
+    "medialarabic\357\273\240/Scaronsmall\357\233\275/a"
+    "fii57674/afii10094/odeva\340\244\223/afii"
+    "10074/zihiragana\343\201\230/tdotbelow\341\271\255"
+    "/zacute\305\272/maieklowleftthai\357\242\214/af"
+    "ii57688/arrowdblboth/qcircle\342\223\240/"
+    "ieungcirclekorean\343\211\247/bracerights"
+    "mall\357\271\234/Rmonospace\357\274\262/Dmonospace"
+    "\357\274\244/sarauethai\340\270\266/ustraightstrok"
+    "ecyrillic\322\261/Xsmall\357\235\270/Ecircumfle"
+    "xacute\341\272\276/pedageshhebrew/ideva\340\244"
+    "\207/Dafrican\306\211/kaverticalstrokecyr"
+    "illic\322\235/Epsilon\316\225/fitacyrillic/Z"
+    "dotaccent/arrowhorizex\357\243\247/yodyod"
+    "hebrew/msuperior\357\233\257/blacklenticu"
+    "larbracketrightvertical\357\270\274/shade"
+    "va\340\244\266/\077/Ohorntilde\341\273\240/logicalnot"
+    "\302\254/maiyamokthai\340\271\206/Enhookcyrilli"
+    "c\323\207/nonuthai\340\270\231/Rsmall\357\235\262/threea"
+    "rabic/ucircle\342\223\244/deicoptic\317\257/ide"
+    "ographicsecretcircle\343\212\231/dargalef"
+    "thebrew/SF220000\342\225\225/tenroman\342\205\271/"
+    "atilde\303\243/fourhangzhou\343\200\244/ngadeva"
+    "\340\244\231/kasquare\343\216\204/rafe/afii57507/m"
+    "longlegturned\311\260/zhecyrillic/ngag"
+    "ujarati\340\252\231/ideographwoodcircle\343\212"
+    "\215/ocircumflextilde\341\273\227/ekonkargur"
+    "mukhi\340\251\264/SF460000\342\225\250/radsquare\343\216"
+    "\255/ideographiczero\343\200\207/suhiragana\343"
+    "\201\231/squaremsquared\343\216\241/onedotenlea"
+    "der\342\200\244/twodotleader/dtail\311\226/thot"
+    "hahanthai\340\270\227/afii57424/Nj\307\213/qubu"
+    "ts18/dzeabkhasiancyrillic\323\241/nasq"
+    "uare\343\216\201/tukatakanahalfwidth\357\276\202/I"
+    "niarmenian\324\273/fiveparen\342\221\270/Xmonos"
+    "pace\357\274\270/trademarkserif\357\233\233/afii57"
+    "403/cparen\342\222\236/whitesmallsquare/c"
+    "olonsign/jheharmenian\325\273/option\342\214"
+    "\245/Ohungarumlaut/wokatakana\343\203\262/ng"
+    "agurmukhi\340\250\231/Ushortcyrillic/Dzea"
+    "bkhasiancyrillic\323\240/osmallhiragan"
+    "a\343\201\211/nieunhieuhkorean\343\204\266/aringac"
+    "ute\307\273/SF360000\342\225\236/arrowtableft\342\207"
+    "\244/afii57509/Rdotaccent\341\271\230/afii10"
+    "077/Zhedieresiscyrillic\323\234/apostr"
+    "ophearmenian\325\232/whitecircle/ovowe"
+    "lsigngujarati\340\253\213/wikatakana\343\203\260/n"
+    "j\307\214/yehfinalarabic\357\273\262/ideographf"
+    "irecircle\343\212\213/atsmall\357\271\253/SF420000"
+    "\342\225\240/lcedilla/chieuchaparenkorean"
+    "\343\210\227/Udotbelow\341\273\244/Phi\316\246/yericyril"
+    "lic/zahmedialarabic\357\273\210/jbopomofo"
+    "\343\204\220/sixhackarabic/rhookturnedsup"
+    "erior\312\265/ddagurmukhi\340\250\241/ilde/excl"
+    "amdbl\342\200\274/Seharmenian\325\215/Omacron\305\214"
+    "/subset/yeorinhieuhkorean\343\206\206/bha"
+    "gujarati\340\252\255/Tcircumflexbelow\341\271\260/"
+    "Iecyrillic/Upsilon1/hbrevebelow\341"
+    "\270\253/ogonek\313\233/yotgreek\317\263";
+
+constexpr uint16_t glyph_seeds[GLYPH_BUCKETS] = {
+    95, 9, 4, 9, 27, 45, 5, 1, 5, 0, 251, 3,
+    152, 19, 16, 39, 3, 5, 0, 9, 22, 15, 1, 78,
+    76, 32, 7, 24, 8, 2, 4, 5, 5, 9, 1, 67,
+    6, 38, 11, 15, 3, 142, 21, 5, 11, 15, 29, 33,
+    124, 512, 3, 3, 175, 28, 7, 1, 7, 9, 41, 6,
+    97, 1, 88, 62, 117, 0, 28, 42, 34, 125, 12, 97,
+    53, 24, 13, 319, 1, 10, 5, 1, 3, 18, 8, 94,
+    10, 24, 18, 17, 2, 0, 22, 1, 13, 62, 37, 8,
+    49, 94, 1, 25, 356, 35, 69, 71, 2, 9, 3, 4,
+    156, 22, 2, 164, 54, 25, 222, 25, 70, 7, 50, 14,
+    291, 2, 50, 6, 36, 198, 62, 13, 20, 1, 6, 139,
+    4, 47, 4, 46, 27, 1, 48, 160, 105, 16, 64, 36,
+    31, 6, 28, 1, 82, 8, 2, 2, 2, 5, 5, 13,
+    21, 30, 2, 5, 42, 3, 1, 54, 4, 77, 9, 120,
+    141, 34, 17, 4, 117, 19, 11, 76, 3, 83, 11, 74,
+    7, 161, 40, 4, 333, 6, 80, 1, 42, 1, 59, 85,
+    3, 15, 79, 100, 61, 19, 30, 1, 144, 1, 113, 168,
+    1, 4, 1, 117, 4, 19, 117, 7, 49, 1, 4, 1,
+    29, 79, 3, 79, 17, 372, 2, 1, 22, 196, 100, 53,
+    3, 1, 19, 24, 1, 172, 2, 18, 32, 95, 176, 120,
+    103, 2, 60, 61, 5, 28, 22, 96, 11, 3, 158, 1,
+    4, 16, 8, 86, 28, 16, 28, 2, 1, 70, 207, 40,
+    2, 89, 0, 82, 53, 38, 7, 10, 1, 13, 3, 11,
+    18, 55, 89, 16, 157, 1, 6, 2, 16, 158, 1, 117,
+    1, 93, 71, 158, 15, 11, 173, 5, 87, 110, 13, 177,
+    3, 21, 64, 163, 4, 294, 109, 106, 132, 243, 271, 48,
+    59, 27, 64, 8, 4, 39, 210, 209, 1, 148, 55, 201,
+    1, 32, 66, 5, 16, 254, 48, 71, 48, 269, 6, 175,
+    84, 1, 97, 23, 8, 4, 340, 50, 13, 1, 46, 20,
+    57, 19, 361, 9, 294, 1, 34, 34, 3, 1, 41, 33,
+    11, 7, 252, 1, 89, 68, 3, 1, 19, 10, 116, 16,
+    71, 1, 1, 51, 1, 51, 22, 3, 2, 65, 5, 49,
+    38, 216, 48, 190, 7, 29, 18, 1, 10, 39, 20, 29,
+    237, 9, 157, 243, 193, 18, 222, 118, 97, 11, 196, 58,
+    1, 23, 20, 23, 113, 1, 5, 356, 163, 9, 5, 9,
+    19, 8, 23, 29, 2, 243, 24, 317, 180, 14, 4, 1,
+    13, 215, 459, 20, 7, 1, 27, 137, 41, 86, 375, 7,
+    11, 2, 173, 174, 4, 1, 2, 39, 3, 136, 469, 125,
+    2, 12, 828, 350, 9, 19, 1, 686, 23, 17, 79, 255,
+    5, 210, 74, 1, 54, 46, 178, 142, 1, 195, 496, 532,
+    549, 14, 7, 15, 144, 19, 204, 60, 2, 9, 178, 51,
+    36, 5, 29, 2, 168, 289, 87, 3, 17, 1, 418, 7,
+    9, 16, 1, 6, 42, 101, 4, 80, 170, 50, 257, 575,
+    98, 140, 366, 1, 86, 224, 453, 5, 179, 132, 7, 16,
+    229, 256, 56, 155, 897, 11, 2, 1, 75, 2, 10, 55,
+    5, 665, 5, 31, 268, 426, 2, 6, 14, 89, 1, 10,
+    20, 29, 402, 161, 10, 128, 4, 114, 42, 141, 17, 23,
+    5, 24, 267, 278, 358, 39, 87, 2, 1, 30, 1, 253,
+    74, 2, 603, 211, 607, 34, 1, 1, 369, 4, 44, 0,
+    3, 603, 10, 2, 9, 22, 5, 355, 85, 29, 79, 129,
+    1, 215, 22, 4, 497, 97, 419, 1, 1, 42, 408, 29,
+    3, 73, 250, 1, 1, 80, 30, 2, 27, 14, 195, 1,
+    624, 1, 15, 4, 2, 220, 126, 13, 2, 58, 5, 96,
+    205, 36, 307, 22, 352, 209, 69, 122, 264, 56, 17, 178,
+    40, 99, 2, 5, 296, 44, 15, 3, 32, 86, 0, 5,
+    160, 6, 1, 40, 144, 107, 1, 135, 110, 13, 51, 6,
+    129, 1, 11, 112, 41, 64, 3, 1904, 1, 356, 30, 327,
+    269, 132, 188, 154, 14, 45, 50, 32, 895, 14, 68, 282,
+    180, 21, 81, 38, 48, 373, 55, 558, 42, 165, 558, 40,
+    264, 237, 5, 0, 4, 9, 14, 141, 83, 7, 4, 43,
+    6, 16, 78, 203, 5, 2, 11, 1, 409, 223, 94, 62,
+    179, 2, 5, 82, 2, 3, 0, 348, 21, 21, 178, 1731,
+    13, 348, 93, 163, 5, 42, 270, 418, 30, 34, 0, 368,
+    451, 176, 10, 426, 154, 228, 65, 446, 1375, 10, 469, 121,
+    25, 378, 0, 13, 693, 96, 732, 1794, 1, 12, 2, 219,
+    487, 42, 29, 1, 78, 64, 207, 879, 41, 170, 3076, 75,
+    4, 34, 6, 90, 590, 419, 2, 1, 4, 68, 17, 620,
+    1697, 103, 1, 513, 1, 278, 193, 22, 53, 363, 95, 265,
+    73, 935, 38, 44, 410, 48, 420, 133, 10, 3, 121, 586,
+    1, 168, 32, 43, 2, 52, 122, 5, 104, 90, 498, 6,
+    71, 17, 210, 7, 2, 347, 59, 35, 2, 160, 223, 1,
+    1527, 296, 522, 198, 61, 103, 101, 1, 591, 6, 177, 7,
+    895, 184, 3, 268, 90, 784, 23, 2283, 969, 2, 115, 512,
+    1768, 22, 3, 861, 10, 149, 29, 1741, 0, 2, 904, 12,
+    606, 4, 276, 23, 46, 5, 37, 19, 539, 159, 461, 2,
+    701, 4, 1, 18, 65, 2228, 251, 1, 0, 41, 2, 1,
+    61, 33, 2, 111, 3, 2271, 71, 171, 42, 50, 38, 883,
+    110, 661, 2, 13, 11, 64, 480, 2, 1832, 395, 24, 44,
+    125, 1713, 1870, 11, 708, 169, 142, 15, 104, 3, 445, 1,
+    14, 51, 227, 138, 671, 619, 6, 38, 1377, 177, 853, 37,
+    3950, 525, 28, 15, 55, 334, 434, 27, 122, 35, 341, 10,
+    2, 2062, 183, 756, 1425, 172, 0, 246, 185, 368, 19, 713,
+    1169, 0, 110, 176, 424, 301, 2, 735, 2994, 20, 606, 6,
+    285, 384, 898, 763, 1, 28, 361, 3, 9, 38, 1, 9,
+    6, 80, 24, 87, 265, 1, 9, 22, 321, 1192, 265, 16,
+    0, 1911, 914, 93, 25, 604, 82, 649, 5, 73, 70, 228,
+    56, 35, 2, 30, 7, 176, 9247, 699, 1624, 658, 1979, 8,
+    2850, 1469, 1979, 6678, 13, 918, 118, 333, 399, 52, 16, 1,
+    701, 861, 59, 7, 612
+};
+
+constexpr glyph_t glyphs[GLYPHS_NUM] = {
+    {0, 18, 18, 3},
+    {21, 32, 11, 3},
+    {35, 47, 12, 2},
+    {49, 54, 5, 2},
+    {56, 65, 9, 3},
+    {68, 85, 17, 2},
+    {87, 104, 17, 3},
+    {107, 113, 6, 3},
+    {116, 130, 14, 3},
+    {133, 164, 31, 3},
+    {167, 177, 10, 2},
+    {179, 192, 13, 3},
+    {195, 199, 4, 3},
+    {202, 209, 7, 3},
+    {212, 222, 10, 2},
+    {224, 233, 9, 2},
+    {235, 245, 10, 3},
+    {248, 61, 2, 1},
+    {250, 260, 10, 2},
+    {262, 274, 12, 2},
+    {276, 287, 11, 2},
+    {289, 301, 12, 3},
+    {304, 305, 2, 1},
+    {306, 320, 14, 2},
+    {322, 335, 13, 3},
+    {338, 350, 12, 3},
+    {353, 360, 7, 2},
+    {362, 377, 15, 3},
+    {380, 395, 15, 2},
+    {397, 425, 28, 2},
+    {427, 437, 10, 2},
+    {439, 459, 20, 3},
+    {462, 474, 12, 2},
+    {476, 491, 15, 3},
+    {494, 504, 10, 3},
+    {507, 524, 17, 2},
+    {526, 553, 27, 3},
+    {556, 575, 19, 2},
+    {577, 590, 13, 3},
+    {593, 604, 11, 3},
+    {607, 624, 17, 3},
+    {627, 653, 26, 3},
+    {656, 663, 7, 2},
+    {665, 675, 10, 3},
+    {678, 690, 12, 2},
+    {692, 699, 7, 3},
+    {702, 713, 11, 3},
+    {716, 727, 11, 3},
+    {730, 741, 11, 3},
+    {744, 758, 14, 3},
+    {761, 769, 8, 2},
+    {771, 789, 18, 3},
+    {792, 800, 8, 3},
+    {803, 813, 10, 3},
+    {816, 817, 2, 1},
+    {818, 832, 14, 3},
+    {835, 858, 23, 3},
+    {861, 871, 10, 3},
+    {874, 885, 11, 3},
+    {888, 899, 11, 3},
+    {902, 915, 13, 2},
+    {917, 933, 16, 3},
+    {936, 942, 6, 2},
+    {944, 958, 14, 2},
+    {960, 973, 13, 2},
+    {975, 986, 11, 1},
+    {987, 995, 8, 3},
+    {998, 1006, 8, 2},
+    {1008, 1020, 12, 3},
+    {1023, 1029, 6, 2},
+    {1031, 1037, 6, 2},
+    {1039, 1050, 11, 3},
+    {1053, 1076, 23, 3},
+    {1079, 1090, 11, 3},
+    {1093, 1109, 16, 3},
+    {1112, 1123, 11, 2},
+    {1125, 1151, 26, 2},
+    {1153, 1166, 13, 3},
+    {1169, 1184, 15, 2},
+    {1186, 1198, 12, 3},
+    {1201, 1210, 9, 3},
+    {1213, 1224, 11, 3},
+    {1227, 1234, 7, 3},
+    {1237, 1245, 8, 3},
+    {1248, 1258, 10, 2},
+    {1260, 1272, 12, 3},
+    {1275, 1287, 12, 3},
+    {1290, 1306, 16, 3},
+    {1309, 1315, 6, 3},
+    {1318, 1332, 14, 3},
+    {1335, 1348, 13, 3},
+    {1351, 1361, 10, 2},
+    {1363, 1380, 17, 3},
+    {1383, 958, 10, 2},
+    {1393, 1400, 7, 2},
+    {1402, 1410, 8, 3},
+    {1413, 1424, 11, 2},
+    {1426, 1450, 24, 2},
+    {1452, 1474, 22, 3},
+    {1477, 1495, 18, 2},
+    {1497, 1505, 8, 3},
+    {1508, 1519, 11, 2},
+    {1521, 1531, 10, 2},
+    {1533, 1550, 17, 2},
+    {1552, 1560, 8, 3},
+    {1563, 1572, 9, 2},
+    {1574, 1531, 14, 2},
+    {1588, 1601, 13, 3},
+    {1604, 1616, 12, 2},
+    {1618, 1630, 12, 2},
+    {1632, 1648, 16, 2},
+    {1650, 1667, 17, 3},
+    {1670, 1683, 13, 3},
+    {1686, 1698, 12, 2},
+    {1700, 1710, 10, 2},
+    {1712, 1723, 11, 3},
+    {1726, 1736, 10, 2},
+    {1738, 1748, 10, 2},
+    {1750, 1766, 16, 3},
+    {1769, 1782, 13, 3},
+    {1785, 1795, 10, 2},
+    {1797, 1803, 6, 3},
+    {1806, 1815, 9, 2},
+    {1817, 1827, 10, 2},
+    {1829, 1846, 17, 3},
+    {1849, 1859, 10, 2},
+    {1861, 1876, 15, 2},
+    {1878, 1898, 20, 3},
+    {1901, 1910, 9, 3},
+    {1913, 1921, 8, 3},
+    {1924, 1932, 8, 2},
+    {1934, 1945, 11, 2},
+    {1947, 1966, 19, 2},
+    {1968, 1985, 17, 3},
+    {1988, 1997, 9, 3},
+    {2000, 2013, 13, 3},
+    {2016, 2027, 11, 3},
+    {2030, 2045, 15, 3},
+    {2048, 2062, 14, 3},
+    {2065, 2090, 25, 3},
+    {2093, 2102, 9, 3},
+    {2105, 2113, 8, 2},
+    {2115, 2135, 20, 2},
+    {2137, 2149, 12, 2},
+    {2151, 2164, 13, 3},
+    {2167, 2182, 15, 2},
+    {2184, 2190, 6, 2},
+    {2192, 2207, 15, 2},
+    {2209, 2224, 15, 3},
+    {2227, 2237, 10, 2},
+    {2239, 2269, 30, 2},
+    {2271, 1859, 25, 2},
+    {2296, 2307, 11, 3},
+    {2310, 2322, 12, 3},
+    {2325, 2336, 11, 3},
+    {2339, 2357, 18, 2},
+    {2359, 2371, 12, 3},
+    {2374, 2379, 5, 2},
+    {2381, 2388, 7, 2},
+    {2390, 2403, 13, 1},
+    {2404, 2418, 14, 3},
+    {2421, 2432, 11, 3},
+    {2435, 2447, 12, 2},
+    {2449, 2459, 10, 2},
+    {2461, 2481, 20, 3},
+    {2484, 2500, 16, 3},
+    {2503, 2511, 8, 3},
+    {2514, 2525, 11, 3},
+    {2528, 2548, 20, 3},
+    {2551, 2559, 8, 2},
+    {2561, 2587, 26, 3},
+    {2590, 2599, 9, 3},
+    {2602, 2609, 7, 2},
+    {2611, 2631, 20, 3},
+    {2634, 2645, 11, 3},
+    {2648, 2665, 17, 3},
+    {2668, 2674, 6, 3},
+    {2677, 2682, 5, 2},
+    {2684, 2695, 11, 3},
+    {2698, 2708, 10, 2},
+    {2710, 983, 2, 1},
+    {2712, 2733, 21, 2},
+    {2735, 2747, 12, 2},
+    {2749, 2758, 9, 2},
+    {2760, 2771, 11, 3},
+    {2774, 2790, 16, 3},
+    {2793, 2802, 9, 3},
+    {2805, 2817, 12, 3},
+    {2820, 287, 10, 2},
+    {2830, 2840, 10, 3},
+    {2843, 2852, 9, 3},
+    {2855, 2873, 18, 2},
+    {2875, 2891, 16, 3},
+    {2894, 2903, 9, 3},
+    {2906, 2920, 14, 3},
+    {2923, 2934, 11, 3},
+    {2937, 2957, 20, 3},
+    {2960, 2966, 6, 3},
+    {2969, 2980, 11, 3},
+    {2983, 2991, 8, 2},
+    {2993, 3003, 10, 2},
+    {3005, 3018, 13, 3},
+    {3021, 3036, 15, 3},
+    {3039, 3049, 10, 2},
+    {3051, 3067, 16, 2},
+    {3069, 3089, 20, 3},
+    {3092, 3110, 18, 3},
+    {3113, 3130, 17, 2},
+    {3132, 3143, 11, 3},
+    {3146, 3153, 7, 2},
+    {3155, 1932, 19, 2},
+    {3174, 3195, 21, 3},
+    {3198, 3220, 22, 3},
+    {3223, 3232, 9, 1},
+    {3233, 3238, 5, 3},
+    {3241, 2357, 6, 2},
+    {3247, 3258, 11, 2},
+    {3260, 3277, 17, 3},
+    {3280, 3296, 16, 3},
+    {3299, 3312, 13, 2},
+    {3314, 3323, 9, 3},
+    {3326, 3336, 10, 2},
+    {3338, 3356, 18, 3},
+    {3359, 3375, 16, 3},
+    {3378, 3396, 18, 3},
+    {3399, 812, 2, 1},
+    {3401, 3412, 11, 3},
+    {3415, 3429, 14, 2},
+    {3431, 3445, 14, 3},
+    {3448, 3458, 10, 3},
+    {3461, 3474, 13, 2},
+    {3476, 3494, 18, 2},
+    {3496, 3511, 15, 3},
+    {3514, 3525, 11, 3},
+    {3528, 1932, 18, 2},
+    {3546, 3559, 13, 3},
+    {3562, 3573, 11, 3},
+    {3576, 3584, 8, 2},
+    {3586, 3596, 10, 3},
+    {3599, 3614, 15, 3},
+    {3617, 3632, 15, 3},
+    {3635, 3648, 13, 3},
+    {3651, 3673, 22, 3},
+    {3676, 3684, 8, 2},
+    {3686, 3706, 20, 3},
+    {3709, 3719, 10, 2},
+    {3721, 3736, 15, 2},
+    {3738, 3749, 11, 2},
+    {3751, 3766, 15, 3},
+    {3769, 3797, 28, 3},
+    {3800, 3810, 10, 3},
+    {3813, 3831, 18, 2},
+    {3833, 3839, 6, 2},
+    {3841, 3854, 13, 2},
+    {3856, 3871, 15, 3},
+    {3874, 3885, 11, 2},
+    {3887, 3894, 7, 3},
+    {3897, 3908, 11, 1},
+    {3909, 3920, 11, 2},
+    {3922, 320, 10, 2},
+    {3932, 3954, 22, 3},
+    {3957, 3966, 9, 2},
+    {3968, 3974, 6, 2},
+    {3976, 3985, 9, 3},
+    {3988, 3996, 8, 2},
+    {3998, 4008, 10, 3},
+    {4011, 4022, 11, 2},
+    {4024, 4030, 6, 2},
+    {4032, 4042, 10, 2},
+    {4044, 4055, 11, 2},
+    {4057, 4068, 11, 2},
+    {4070, 4080, 10, 3},
+    {4083, 4084, 2, 1},
+    {4085, 4101, 16, 2},
+    {4103, 4113, 10, 3},
+    {4116, 4141, 25, 3},
+    {4144, 4155, 11, 3},
+    {4158, 4173, 15, 2},
+    {4175, 4185, 10, 3},
+    {4188, 4204, 16, 3},
+    {4207, 4215, 8, 2},
+    {4217, 4229, 12, 2},
+    {4231, 4246, 15, 3},
+    {4249, 4266, 17, 3},
+    {4269, 4275, 6, 3},
+    {4278, 4295, 17, 2},
+    {4297, 4308, 11, 3},
+    {4311, 4322, 11, 3},
+    {4325, 4335, 10, 3},
+    {4338, 4348, 10, 2},
+    {4350, 4362, 12, 3},
+    {4365, 4397, 32, 3},
+    {4400, 4403, 3, 3},
+    {4406, 4413, 7, 2},
+    {4415, 4427, 12, 2},
+    {4429, 4450, 21, 3},
+    {4453, 4465, 12, 3},
+    {4468, 4488, 20, 3},
+    {4491, 4504, 13, 3},
+    {4507, 4522, 15, 3},
+    {4525, 4540, 15, 3},
+    {4543, 4550, 7, 3},
+    {4553, 4574, 21, 3},
+    {4577, 4599, 22, 3},
+    {4602, 4611, 9, 2},
+    {4613, 4627, 14, 3},
+    {4630, 2758, 13, 2},
+    {4643, 4653, 10, 3},
+    {4656, 4670, 14, 3},
+    {4673, 4689, 16, 3},
+    {4692, 4705, 13, 3},
+    {4708, 4719, 11, 3},
+    {4722, 4732, 10, 3},
+    {4735, 4745, 10, 2},
+    {4747, 4758, 11, 2},
+    {4760, 4774, 14, 2},
+    {4776, 4791, 15, 2},
+    {4793, 4801, 8, 2},
+    {4803, 4812, 9, 1},
+    {4813, 4831, 18, 3},
+    {4834, 4846, 12, 3},
+    {4849, 4866, 17, 3},
+    {4869, 4883, 14, 3},
+    {4886, 4896, 10, 3},
+    {4899, 4911, 12, 3},
+    {4914, 4926, 12, 3},
+    {4929, 4944, 15, 3},
+    {4947, 4959, 12, 2},
+    {4961, 4971, 10, 3},
+    {4974, 4985, 11, 3},
+    {4988, 5008, 20, 3},
+    {5011, 5031, 20, 3},
+    {5034, 5048, 14, 3},
+    {5051, 5057, 6, 3},
+    {5060, 5070, 10, 3},
+    {5073, 5084, 11, 3},
+    {5087, 5099, 12, 3},
+    {5102, 5112, 10, 2},
+    {5114, 5121, 7, 2},
+    {5123, 5134, 11, 2},
+    {5136, 5156, 20, 3},
+    {5159, 5173, 14, 3},
+    {5176, 5187, 11, 3},
+    {5190, 5199, 9, 3},
+    {5202, 5229, 27, 3},
+    {5232, 5251, 19, 2},
+    {5253, 5275, 22, 2},
+    {5277, 5288, 11, 3},
+    {5291, 5302, 11, 3},
+    {5305, 5316, 11, 3},
+    {5319, 5342, 23, 3},
+    {5345, 5371, 26, 2},
+    {5373, 5384, 11, 3},
+    {5387, 5407, 20, 2},
+    {5409, 5412, 3, 3},
+    {5415, 5421, 6, 2},
+    {5423, 5432, 9, 3},
+    {5435, 5444, 9, 3},
+    {5447, 5459, 12, 3},
+    {5462, 5483, 21, 2},
+    {5485, 5496, 11, 3},
+    {5499, 5510, 11, 3},
+    {5513, 5528, 15, 3},
+    {5531, 5550, 19, 2},
+    {5552, 5562, 10, 3},
+    {5565, 5585, 20, 3},
+    {5588, 5598, 10, 2},
+    {5600, 5623, 23, 2},
+    {5625, 5639, 14, 3},
+    {5642, 5653, 11, 3},
+    {5656, 5667, 11, 3},
+    {5670, 5680, 10, 2},
+    {5682, 5690, 8, 3},
+    {5693, 5700, 7, 2},
+    {5702, 5709, 7, 3},
+    {5712, 5719, 7, 2},
+    {5721, 5731, 10, 3},
+    {5734, 218, 2, 1},
+    {5736, 5758, 22, 2},
+    {5760, 2379, 11, 2},
+    {5771, 5782, 11, 2},
+    {5784, 5796, 12, 3},
+    {5799, 5813, 14, 3},
+    {5816, 4944, 11, 3},
+    {5827, 5834, 7, 2},
+    {5836, 5849, 13, 3},
+    {5852, 5862, 10, 2},
+    {5864, 5871, 7, 2},
+    {5873, 5895, 22, 2},
+    {5897, 12, 2, 1},
+    {5899, 5918, 19, 2},
+    {5920, 5931, 11, 3},
+    {5934, 5941, 7, 3},
+    {5944, 5969, 25, 3},
+    {5972, 5986, 14, 3},
+    {5989, 5999, 10, 2},
+    {6001, 6014, 13, 3},
+    {6017, 6028, 11, 3},
+    {6031, 6048, 17, 3},
+    {6051, 6072, 21, 2},
+    {6074, 6097, 23, 3},
+    {6100, 6118, 18, 3},
+    {6121, 6137, 16, 3},
+    {6140, 6155, 15, 2},
+    {6157, 6182, 25, 3},
+    {6185, 6192, 7, 2},
+    {6194, 6210, 16, 3},
+    {6213, 6227, 14, 2},
+    {6229, 6236, 7, 3},
+    {6239, 6243, 4, 3},
+    {6246, 6268, 22, 3},
+    {6271, 6284, 13, 2},
+    {6286, 6299, 13, 2},
+    {6301, 6328, 27, 3},
+    {6331, 6341, 10, 3},
+    {6344, 6358, 14, 3},
+    {6361, 6372, 11, 2},
+    {6374, 6394, 20, 3},
+    {6397, 6408, 11, 3},
+    {6411, 6420, 9, 3},
+    {6423, 6430, 7, 2},
+    {6432, 6441, 9, 3},
+    {6444, 6461, 17, 3},
+    {6464, 6472, 8, 2},
+    {6474, 6495, 21, 3},
+    {6498, 6511, 13, 3},
+    {6514, 6530, 16, 3},
+    {6533, 6550, 17, 2},
+    {6552, 6562, 10, 3},
+    {6565, 6584, 19, 3},
+    {6587, 6597, 10, 2},
+    {6599, 6620, 21, 3},
+    {6623, 6639, 16, 3},
+    {6642, 6653, 11, 3},
+    {6656, 6671, 15, 3},
+    {6674, 6693, 19, 3},
+    {6696, 6702, 6, 1},
+    {6703, 6714, 11, 3},
+    {6717, 6731, 14, 3},
+    {6734, 6746, 12, 3},
+    {6749, 6766, 17, 3},
+    {6769, 6777, 8, 3},
+    {6780, 6790, 10, 3},
+    {6793, 6803, 10, 3},
+    {6806, 6815, 9, 3},
+    {6818, 6828, 10, 2},
+    {6830, 6844, 14, 3},
+    {6847, 6865, 18, 3},
+    {6868, 6894, 26, 2},
+    {6896, 812, 5, 1},
+    {6901, 6925, 24, 3},
+    {6928, 6933, 5, 2},
+    {6935, 6952, 17, 3},
+    {6955, 6966, 11, 2},
+    {6968, 2224, 9, 3},
+    {6977, 6988, 11, 2},
+    {6990, 6998, 8, 2},
+    {7000, 7011, 11, 2},
+    {7013, 7018, 5, 3},
+    {7021, 7040, 19, 3},
+    {7043, 6597, 10, 2},
+    {7053, 7063, 10, 3},
+    {7066, 7077, 11, 3},
+    {7080, 85, 10, 2},
+    {7090, 7098, 8, 3},
+    {7101, 7112, 11, 3},
+    {7115, 7127, 12, 3},
+    {7130, 7153, 23, 2},
+    {7155, 7163, 8, 2},
+    {7165, 7191, 26, 3},
+    {7194, 7206, 12, 3},
+    {7209, 7219, 10, 3},
+    {7222, 7235, 13, 2},
+    {7237, 7254, 17, 2},
+    {7256, 7266, 10, 1},
+    {7267, 7285, 18, 2},
+    {7287, 7306, 19, 2},
+    {7308, 7317, 9, 2},
+    {7319, 7335, 16, 3},
+    {7338, 7349, 11, 3},
+    {7352, 7364, 12, 3},
+    {7367, 7378, 11, 2},
+    {7380, 7394, 14, 2},
+    {7396, 7405, 9, 3},
+    {7408, 7420, 12, 3},
+    {7423, 7433, 10, 3},
+    {7436, 7447, 11, 3},
+    {7450, 7462, 12, 2},
+    {7464, 7478, 14, 3},
+    {7481, 7499, 18, 3},
+    {7502, 7515, 13, 2},
+    {7517, 7526, 9, 2},
+    {7528, 7539, 11, 3},
+    {7542, 7554, 12, 2},
+    {7556, 7572, 16, 3},
+    {7575, 7586, 11, 3},
+    {7589, 7606, 17, 3},
+    {7609, 7617, 8, 3},
+    {7620, 7635, 15, 3},
+    {7638, 7649, 11, 3},
+    {7652, 7661, 9, 3},
+    {7664, 7681, 17, 3},
+    {7684, 7706, 22, 2},
+    {7708, 7721, 13, 3},
+    {7724, 7738, 14, 3},
+    {7741, 7745, 4, 2},
+    {7747, 7755, 8, 2},
+    {7757, 7776, 19, 3},
+    {7779, 7797, 18, 2},
+    {7799, 7813, 14, 2},
+    {7815, 7822, 7, 2},
+    {7824, 7833, 9, 3},
+    {7836, 7844, 8, 3},
+    {7847, 7862, 15, 3},
+    {7865, 7880, 15, 2},
+    {7882, 7894, 12, 2},
+    {7896, 7915, 19, 3},
+    {7918, 7936, 18, 3},
+    {7939, 1795, 11, 2},
+    {7950, 7960, 10, 2},
+    {7962, 7972, 10, 3},
+    {7975, 7993, 18, 3},
+    {7996, 8005, 9, 2},
+    {8007, 8017, 10, 3},
+    {8020, 2135, 17, 2},
+    {8037, 8057, 20, 3},
+    {8060, 8069, 9, 3},
+    {8072, 8082, 10, 2},
+    {8084, 8096, 12, 2},
+    {8098, 8122, 24, 2},
+    {8124, 8149, 25, 3},
+    {8152, 8170, 18, 3},
+    {8173, 8186, 13, 3},
+    {8189, 8200, 11, 2},
+    {8202, 8212, 10, 2},
+    {8214, 8245, 31, 3},
+    {8248, 8256, 8, 3},
+    {8259, 8268, 9, 3},
+    {8271, 8283, 12, 3},
+    {8286, 8291, 5, 1},
+    {8292, 8314, 22, 2},
+    {8316, 8331, 15, 3},
+    {8334, 8346, 12, 3},
+    {8349, 8360, 11, 3},
+    {8363, 8382, 19, 3},
+    {8385, 8400, 15, 3},
+    {8403, 8411, 8, 2},
+    {8413, 1859, 19, 2},
+    {8432, 8442, 10, 2},
+    {8444, 8455, 11, 2},
+    {8457, 8464, 7, 3},
+    {8467, 8474, 7, 3},
+    {8477, 8499, 22, 3},
+    {8502, 8509, 7, 3},
+    {8512, 8524, 12, 3},
+    {8527, 8535, 8, 2},
+    {8537, 8548, 11, 3},
+    {8551, 8583, 32, 3},
+    {8586, 8599, 13, 3},
+    {8602, 8612, 10, 2},
+    {8614, 8623, 9, 3},
+    {8626, 8641, 15, 2},
+    {8643, 2357, 8, 2},
+    {8651, 1859, 9, 2},
+    {8660, 8675, 15, 3},
+    {8678, 8689, 11, 3},
+    {8692, 8699, 7, 3},
+    {8702, 8710, 8, 2},
+    {8712, 8726, 14, 3},
+    {8729, 8744, 15, 3},
+    {8747, 8748, 2, 1},
+    {8749, 8769, 20, 2},
+    {8771, 8780, 9, 3},
+    {8783, 8795, 12, 2},
+    {8797, 8808, 11, 3},
+    {8811, 8831, 20, 3},
+    {8834, 8846, 12, 3},
+    {8849, 8859, 10, 2},
+    {8861, 8871, 10, 3},
+    {8874, 8885, 11, 3},
+    {8888, 8899, 11, 3},
+    {8902, 8914, 12, 3},
+    {8917, 8923, 6, 3},
+    {8926, 8937, 11, 2},
+    {8939, 8951, 12, 2},
+    {8953, 8964, 11, 3},
+    {8967, 8984, 17, 3},
+    {8987, 9003, 16, 3},
+    {9006, 9021, 15, 3},
+    {9024, 9044, 20, 3},
+    {9047, 9067, 20, 3},
+    {9070, 9094, 24, 3},
+    {9097, 9108, 11, 2},
+    {9110, 9125, 15, 3},
+    {9128, 2135, 10, 2},
+    {9138, 9149, 11, 3},
+    {9152, 9160, 8, 3},
+    {9163, 9182, 19, 3},
+    {9185, 9212, 27, 3},
+    {9215, 9235, 20, 3},
+    {9238, 9246, 8, 2},
+    {9248, 9262, 14, 3},
+    {9265, 9284, 19, 3},
+    {9287, 9309, 22, 3},
+    {9312, 9325, 13, 2},
+    {9327, 9343, 16, 3},
+    {9346, 9356, 10, 2},
+    {9358, 9368, 10, 2},
+    {9370, 9381, 11, 3},
+    {9384, 9394, 10, 3},
+    {9397, 9405, 8, 3},
+    {9408, 9424, 16, 3},
+    {9427, 9437, 10, 2},
+    {9439, 1258, 12, 2},
+    {9451, 9460, 9, 3},
+    {9463, 9474, 11, 3},
+    {9477, 9488, 11, 3},
+    {9491, 9502, 11, 2},
+    {9504, 9514, 10, 1},
+    {9515, 9526, 11, 2},
+    {9528, 9541, 13, 3},
+    {9544, 9562, 18, 3},
+    {9565, 9579, 14, 2},
+    {9581, 9603, 22, 2},
+    {9605, 9616, 11, 3},
+    {9619, 9620, 2, 1},
+    {9621, 9639, 18, 3},
+    {9642, 9650, 8, 3},
+    {9653, 9665, 12, 2},
+    {9667, 9675, 8, 2},
+    {9677, 7797, 8, 2},
+    {9685, 7649, 11, 3},
+    {9696, 9720, 24, 3},
+    {9723, 9732, 9, 3},
+    {9735, 9742, 7, 3},
+    {9745, 9749, 4, 2},
+    {9751, 9758, 7, 3},
+    {9761, 9787, 26, 3},
+    {9790, 2682, 11, 2},
+    {9801, 1601, 19, 3},
+    {9820, 9823, 3, 2},
+    {9825, 9834, 9, 2},
+    {9836, 259, 6, 1},
+    {9842, 9862, 20, 2},
+    {9864, 9871, 7, 2},
+    {9873, 9886, 13, 3},
+    {9889, 9898, 9, 3},
+    {9901, 9914, 13, 3},
+    {9917, 9928, 11, 3},
+    {9931, 9942, 11, 2},
+    {9944, 9955, 11, 3},
+    {9958, 9968, 10, 2},
+    {9970, 9984, 14, 3},
+    {9987, 9997, 10, 2},
+    {9999, 10010, 11, 2},
+    {10012, 10025, 13, 3},
+    {10028, 10036, 8, 2},
+    {10038, 10039, 2, 1},
+    {10040, 6702, 16, 1},
+    {10056, 10074, 18, 3},
+    {10077, 10088, 11, 2},
+    {10090, 10102, 12, 3},
+    {10105, 10117, 12, 3},
+    {10120, 10132, 12, 3},
+    {10135, 10147, 12, 3},
+    {10150, 43, 2, 1},
+    {10152, 10162, 10, 2},
+    {10164, 10173, 9, 3},
+    {10176, 10189, 13, 3},
+    {10192, 10200, 8, 2},
+    {10202, 10218, 16, 3},
+    {10221, 10250, 29, 3},
+    {10253, 10269, 16, 3},
+    {10272, 984, 2, 1},
+    {10274, 10286, 12, 3},
+    {10289, 10297, 8, 3},
+    {10300, 10312, 12, 2},
+    {10314, 10324, 10, 3},
+    {10327, 10346, 19, 3},
+    {10349, 10361, 12, 3},
+    {10364, 10377, 13, 2},
+    {10379, 10390, 11, 3},
+    {10393, 10400, 7, 1},
+    {10401, 10421, 20, 2},
+    {10423, 10431, 8, 2},
+    {10433, 10446, 13, 3},
+    {10449, 10456, 7, 2},
+    {10458, 10464, 6, 1},
+    {10465, 10475, 10, 2},
+    {10477, 10487, 10, 2},
+    {10489, 10504, 15, 3},
+    {10507, 10517, 10, 3},
+    {10520, 10538, 18, 3},
+    {10541, 10563, 22, 3},
+    {10566, 10572, 6, 2},
+    {10574, 10583, 9, 3},
+    {10586, 10596, 10, 2},
+    {10598, 10608, 10, 3},
+    {10611, 10628, 17, 3},
+    {10631, 10635, 4, 2},
+    {10637, 10649, 12, 2},
+    {10651, 10662, 11, 3},
+    {10665, 437, 12, 2},
+    {10677, 10697, 20, 3},
+    {10700, 10718, 18, 2},
+    {10720, 10737, 17, 3},
+    {10740, 10750, 10, 2},
+    {10752, 958, 24, 2},
+    {10776, 10780, 4, 3},
+    {10783, 10793, 10, 3},
+    {10796, 10806, 10, 3},
+    {10809, 10821, 12, 2},
+    {10823, 10840, 17, 3},
+    {10843, 10855, 12, 3},
+    {10858, 10868, 10, 2},
+    {10870, 10881, 11, 3},
+    {10884, 10899, 15, 2},
+    {10901, 10920, 19, 3},
+    {10923, 10933, 10, 3},
+    {10936, 10960, 24, 3},
+    {10963, 10985, 22, 3},
+    {10988, 11009, 21, 3},
+    {11012, 11029, 17, 3},
+    {11032, 11044, 12, 3},
+    {11047, 11066, 19, 3},
+    {11069, 11079, 10, 2},
+    {11081, 11092, 11, 1},
+    {11093, 11120, 27, 3},
+    {11123, 11135, 12, 3},
+    {11138, 11146, 8, 3},
+    {11149, 2682, 10, 2},
+    {11159, 11171, 12, 3},
+    {11174, 11185, 11, 3},
+    {11188, 11195, 7, 2},
+    {11197, 11218, 21, 3},
+    {11221, 11241, 20, 3},
+    {11244, 11253, 9, 3},
+    {11256, 6988, 10, 2},
+    {11266, 11275, 9, 3},
+    {11278, 11296, 18, 3},
+    {11299, 11311, 12, 2},
+    {11313, 11322, 9, 3},
+    {11325, 11337, 12, 2},
+    {11339, 11349, 10, 3},
+    {11352, 11359, 7, 3},
+    {11362, 2182, 11, 2},
+    {11373, 11379, 6, 2},
+    {11381, 11391, 10, 3},
+    {11394, 11409, 15, 3},
+    {11412, 11418, 6, 2},
+    {11420, 11432, 12, 3},
+    {11435, 11443, 8, 3},
+    {11446, 11472, 26, 3},
+    {11475, 11489, 14, 3},
+    {11492, 11503, 11, 3},
+    {11506, 11516, 10, 3},
+    {11519, 11530, 11, 3},
+    {11533, 11553, 20, 3},
+    {11556, 11566, 10, 2},
+    {11568, 2459, 10, 2},
+    {11578, 11583, 5, 2},
+    {11585, 11594, 9, 3},
+    {11597, 11611, 14, 2},
+    {11613, 11619, 6, 2},
+    {11621, 11633, 12, 2},
+    {11635, 11651, 16, 3},
+    {11654, 11663, 9, 3},
+    {11666, 11676, 10, 3},
+    {11679, 11686, 7, 2},
+    {11688, 11696, 8, 3},
+    {11699, 11711, 12, 3},
+    {11714, 11717, 3, 2},
+    {11719, 9834, 15, 2},
+    {11734, 11745, 11, 3},
+    {11748, 11772, 24, 3},
+    {11775, 11788, 13, 3},
+    {11791, 809, 2, 1},
+    {11793, 11805, 12, 2},
+    {11807, 11817, 10, 2},
+    {11819, 11832, 13, 2},
+    {11834, 11847, 13, 3},
+    {11850, 11863, 13, 2},
+    {11865, 11884, 19, 3},
+    {11887, 11902, 15, 3},
+    {11905, 11909, 4, 2},
+    {11911, 11920, 9, 2},
+    {11922, 11935, 13, 2},
+    {11937, 11948, 11, 3},
+    {11951, 11962, 11, 2},
+    {11964, 11984, 20, 3},
+    {11987, 12002, 15, 3},
+    {12005, 12016, 11, 1},
+    {12017, 12022, 5, 2},
+    {12024, 12031, 7, 3},
+    {12034, 12042, 8, 3},
+    {12045, 12055, 10, 2},
+    {12057, 12068, 11, 3},
+    {12071, 12089, 18, 2},
+    {12091, 12115, 24, 3},
+    {12118, 12125, 7, 3},
+    {12128, 12140, 12, 3},
+    {12143, 12155, 12, 3},
+    {12158, 12168, 10, 3},
+    {12171, 12186, 15, 2},
+    {12188, 12200, 12, 2},
+    {12202, 46, 2, 1},
+    {12204, 679, 2, 1},
+    {12206, 12215, 9, 2},
+    {12217, 12237, 20, 3},
+    {12240, 12254, 14, 3},
+    {12257, 12275, 18, 3},
+    {12278, 12300, 22, 2},
+    {12302, 12313, 11, 3},
+    {12316, 12324, 8, 3},
+    {12327, 12335, 8, 3},
+    {12338, 12351, 13, 2},
+    {12353, 12373, 20, 2},
+    {12375, 12385, 10, 2},
+    {12387, 12396, 9, 3},
+    {12399, 12406, 7, 3},
+    {12409, 7797, 10, 2},
+    {12419, 12432, 13, 2},
+    {12434, 12446, 12, 3},
+    {12449, 12459, 10, 3},
+    {12462, 12475, 13, 3},
+    {12478, 12493, 15, 3},
+    {12496, 12511, 15, 2},
+    {12513, 12535, 22, 3},
+    {12538, 12546, 8, 2},
+    {12548, 12555, 7, 2},
+    {12557, 12578, 21, 3},
+    {12581, 12595, 14, 2},
+    {12597, 12602, 5, 2},
+    {12604, 12614, 10, 1},
+    {12615, 220, 4, 1},
+    {12619, 12631, 12, 2},
+    {12633, 12644, 11, 3},
+    {12647, 12664, 17, 3},
+    {12667, 12681, 14, 3},
+    {12684, 12694, 10, 3},
+    {12697, 12707, 10, 3},
+    {12710, 12726, 16, 3},
+    {12729, 12738, 9, 3},
+    {12741, 12744, 3, 2},
+    {12746, 1932, 12, 2},
+    {12758, 12762, 4, 2},
+    {12764, 12777, 13, 3},
+    {12780, 12787, 7, 3},
+    {12790, 12801, 11, 2},
+    {12803, 12821, 18, 2},
+    {12823, 12830, 7, 2},
+    {12832, 12016, 2, 1},
+    {12834, 12848, 14, 3},
+    {12851, 12868, 17, 3},
+    {12871, 12885, 14, 2},
+    {12887, 12896, 9, 3},
+    {12899, 12915, 16, 3},
+    {12918, 12933, 15, 3},
+    {12936, 12954, 18, 2},
+    {12956, 12968, 12, 2},
+    {12970, 12982, 12, 2},
+    {12984, 12995, 11, 3},
+    {12998, 13019, 21, 2},
+    {13021, 13041, 20, 3},
+    {13044, 13058, 14, 3},
+    {13061, 3854, 10, 2},
+    {13071, 13082, 11, 3},
+    {13085, 13088, 3, 2},
+    {13090, 13105, 15, 3},
+    {13108, 13120, 12, 2},
+    {13122, 13133, 11, 2},
+    {13135, 13140, 5, 2},
+    {13142, 13152, 10, 3},
+    {13155, 13166, 11, 3},
+    {13169, 12954, 8, 2},
+    {13177, 13191, 14, 3},
+    {13194, 12830, 10, 2},
+    {13204, 13214, 10, 3},
+    {13217, 13238, 21, 2},
+    {13240, 13241, 2, 1},
+    {13242, 13249, 7, 2},
+    {13251, 13262, 11, 2},
+    {13264, 13287, 23, 3},
+    {13290, 13301, 11, 3},
+    {13304, 108, 2, 1},
+    {13306, 13321, 15, 2},
+    {13323, 13335, 12, 3},
+    {13338, 13352, 14, 2},
+    {13354, 13360, 6, 2},
+    {13362, 13370, 8, 3},
+    {13373, 13384, 11, 3},
+    {13387, 13396, 9, 3},
+    {13399, 13414, 15, 2},
+    {13416, 13426, 10, 2},
+    {13428, 9125, 9, 3},
+    {13437, 13454, 17, 3},
+    {13457, 13470, 13, 3},
+    {13473, 13481, 8, 3},
+    {13484, 13501, 17, 3},
+    {13504, 13511, 7, 3},
+    {13514, 13532, 18, 2},
+    {13534, 13545, 11, 3},
+    {13548, 13558, 10, 2},
+    {13560, 13571, 11, 3},
+    {13574, 13586, 12, 2},
+    {13588, 13598, 10, 3},
+    {13601, 13617, 16, 3},
+    {13620, 13631, 11, 2},
+    {13633, 13638, 5, 2},
+    {13640, 5680, 17, 2},
+    {13657, 13671, 14, 2},
+    {13673, 13684, 11, 3},
+    {13687, 13702, 15, 2},
+    {13704, 13725, 21, 3},
+    {13728, 13744, 16, 3},
+    {13747, 13757, 10, 2},
+    {13759, 13766, 7, 1},
+    {13767, 13787, 20, 2},
+    {13789, 13797, 8, 3},
+    {13800, 12954, 8, 2},
+    {13808, 13816, 8, 2},
+    {13818, 13839, 21, 3},
+    {13842, 13858, 16, 3},
+    {13861, 13872, 11, 3},
+    {13875, 13887, 12, 2},
+    {13889, 13908, 19, 3},
+    {13911, 13941, 30, 3},
+    {13944, 13952, 8, 2},
+    {13954, 13966, 12, 3},
+    {13969, 14000, 31, 3},
+    {14003, 14010, 7, 2},
+    {14012, 14022, 10, 2},
+    {14024, 12186, 21, 2},
+    {14045, 14061, 16, 2},
+    {14063, 14075, 12, 2},
+    {14077, 14104, 27, 3},
+    {14107, 14119, 12, 3},
+    {14122, 14133, 11, 3},
+    {14136, 14147, 11, 3},
+    {14150, 14156, 6, 2},
+    {14158, 4758, 10, 2},
+    {14168, 14183, 15, 3},
+    {14186, 14201, 15, 2},
+    {14203, 14214, 11, 2},
+    {14216, 14220, 4, 2},
+    {14222, 14243, 21, 2},
+    {14245, 14266, 21, 3},
+    {14269, 14280, 11, 3},
+    {14283, 889, 2, 1},
+    {14285, 14294, 9, 3},
+    {14297, 14308, 11, 2},
+    {14310, 14320, 10, 3},
+    {14323, 14335, 12, 3},
+    {14338, 14345, 7, 2},
+    {14347, 14362, 15, 3},
+    {14365, 14376, 11, 3},
+    {14379, 14400, 21, 3},
+    {14403, 14420, 17, 2},
+    {14422, 2135, 9, 2},
+    {14431, 14437, 6, 3},
+    {14440, 810, 2, 1},
+    {14442, 14452, 10, 3},
+    {14455, 5251, 8, 2},
+    {14463, 1184, 10, 2},
+    {14473, 14493, 20, 2},
+    {14495, 14505, 10, 2},
+    {14507, 14515, 8, 2},
+    {14517, 14543, 26, 3},
+    {14546, 14564, 18, 3},
+    {14567, 14578, 11, 3},
+    {14581, 14591, 10, 3},
+    {14594, 14607, 13, 2},
+    {14609, 14619, 10, 2},
+    {14621, 14635, 14, 2},
+    {14637, 14649, 12, 3},
+    {14652, 14663, 11, 2},
+    {14665, 14677, 12, 3},
+    {14680, 14690, 10, 3},
+    {14693, 14705, 12, 1},
+    {14706, 14717, 11, 3},
+    {14720, 14732, 12, 2},
+    {14734, 14740, 6, 2},
+    {14742, 14753, 11, 3},
+    {14756, 14772, 16, 3},
+    {14775, 14790, 15, 3},
+    {14793, 10635, 10, 2},
+    {14803, 14821, 18, 2},
+    {14823, 14830, 7, 2},
+    {14832, 14850, 18, 2},
+    {14852, 14863, 11, 3},
+    {14866, 14881, 15, 3},
+    {14884, 14895, 11, 3},
+    {14898, 14906, 8, 3},
+    {14909, 14923, 14, 3},
+    {14926, 14936, 10, 2},
+    {14938, 14952, 14, 2},
+    {14954, 14985, 31, 3},
+    {14988, 14998, 10, 2},
+    {15000, 15010, 10, 3},
+    {15013, 15021, 8, 3},
+    {15024, 15042, 18, 2},
+    {15044, 15053, 9, 3},
+    {15056, 15067, 11, 3},
+    {15070, 15077, 7, 2},
+    {15079, 15099, 20, 3},
+    {15102, 15114, 12, 3},
+    {15117, 15132, 15, 2},
+    {15134, 15146, 12, 3},
+    {15149, 15159, 10, 2},
+    {15161, 15170, 9, 3},
+    {15173, 15190, 17, 3},
+    {15193, 8951, 10, 2},
+    {15203, 15233, 30, 3},
+    {15236, 15246, 10, 3},
+    {15249, 15263, 14, 2},
+    {15265, 15278, 13, 2},
+    {15280, 15290, 10, 2},
+    {15292, 15315, 23, 3},
+    {15318, 15332, 14, 3},
+    {15335, 15352, 17, 2},
+    {15354, 15364, 10, 3},
+    {15367, 15377, 10, 3},
+    {15380, 15390, 10, 3},
+    {15393, 15415, 22, 2},
+    {15417, 15428, 11, 3},
+    {15431, 15455, 24, 2},
+    {15457, 8212, 12, 2},
+    {15469, 15477, 8, 3},
+    {15480, 10039, 10, 1},
+    {15490, 15502, 12, 2},
+    {15504, 15511, 7, 3},
+    {15514, 15521, 7, 2},
+    {15523, 15533, 10, 3},
+    {15536, 15546, 10, 3},
+    {15549, 15562, 13, 2},
+    {15564, 15575, 11, 3},
+    {15578, 15586, 8, 3},
+    {15589, 15601, 12, 3},
+    {15604, 15619, 15, 3},
+    {15622, 15632, 10, 2},
+    {15634, 15645, 11, 2},
+    {15647, 15656, 9, 3},
+    {15659, 15669, 10, 3},
+    {15672, 15697, 25, 3},
+    {15700, 15713, 13, 2},
+    {15715, 15733, 18, 3},
+    {15736, 15744, 8, 2},
+    {15746, 15754, 8, 2},
+    {15756, 2357, 10, 2},
+    {15766, 15790, 24, 3},
+    {15793, 15802, 9, 3},
+    {15805, 15814, 9, 3},
+    {15817, 15834, 17, 3},
+    {15837, 0, 6, 1},
+    {15843, 15853, 10, 2},
+    {15855, 15868, 13, 2},
+    {15870, 15886, 16, 3},
+    {15889, 15900, 11, 2},
+    {15902, 15918, 16, 3},
+    {15921, 15934, 13, 3},
+    {15937, 15956, 19, 3},
+    {15959, 9914, 17, 3},
+    {15976, 15987, 11, 3},
+    {15990, 15997, 7, 3},
+    {16000, 16010, 10, 2},
+    {16012, 16022, 10, 3},
+    {16025, 16038, 13, 3},
+    {16041, 16051, 10, 2},
+    {16053, 16065, 12, 3},
+    {16068, 16090, 22, 3},
+    {16093, 463, 2, 1},
+    {16095, 16107, 12, 2},
+    {16109, 16122, 13, 2},
+    {16124, 16138, 14, 2},
+    {16140, 1450, 23, 2},
+    {16163, 16175, 12, 2},
+    {16177, 14133, 14, 3},
+    {16191, 16207, 16, 3},
+    {16210, 16223, 13, 2},
+    {16225, 16228, 3, 2},
+    {16230, 958, 22, 2},
+    {16252, 16262, 10, 2},
+    {16264, 16286, 22, 3},
+    {16289, 16299, 10, 3},
+    {16302, 30, 2, 1},
+    {16304, 16315, 11, 2},
+    {16317, 16327, 10, 2},
+    {16329, 1932, 6, 2},
+    {16335, 16346, 11, 3},
+    {16349, 16362, 13, 3},
+    {16365, 16376, 11, 2},
+    {16378, 16391, 13, 2},
+    {16393, 16404, 11, 3},
+    {16407, 16422, 15, 3},
+    {16425, 16441, 16, 2},
+    {16443, 16461, 18, 2},
+    {16463, 13360, 12, 2},
+    {16475, 16487, 12, 3},
+    {16490, 16510, 20, 3},
+    {16513, 16521, 8, 2},
+    {16523, 16538, 15, 3},
+    {16541, 16562, 21, 2},
+    {16564, 16578, 14, 2},
+    {16580, 13757, 10, 2},
+    {16590, 16596, 6, 3},
+    {16599, 16607, 8, 3},
+    {16610, 16629, 19, 3},
+    {16632, 16639, 7, 3},
+    {16642, 16653, 11, 2},
+    {16655, 16672, 17, 2},
+    {16674, 16677, 3, 2},
+    {16679, 16690, 11, 3},
+    {16693, 14740, 12, 2},
+    {16705, 16716, 11, 3},
+    {16719, 16731, 12, 3},
+    {16734, 16747, 13, 3},
+    {16750, 16757, 7, 3},
+    {16760, 16771, 11, 3},
+    {16774, 16782, 8, 2},
+    {16784, 16795, 11, 3},
+    {16798, 16812, 14, 2},
+    {16814, 16825, 11, 1},
+    {16826, 16833, 7, 3},
+    {16836, 16850, 14, 3},
+    {16853, 16864, 11, 3},
+    {16867, 16871, 4, 2},
+    {16873, 16879, 6, 2},
+    {16881, 16892, 11, 3},
+    {16895, 16905, 10, 2},
+    {16907, 16917, 10, 3},
+    {16920, 16931, 11, 2},
+    {16933, 16943, 10, 2},
+    {16945, 16957, 12, 2},
+    {16959, 16970, 11, 3},
+    {16973, 16987, 14, 3},
+    {16990, 17002, 12, 3},
+    {17005, 17015, 10, 2},
+    {17017, 17035, 18, 3},
+    {17038, 17050, 12, 3},
+    {17053, 17069, 16, 3},
+    {17072, 17082, 10, 2},
+    {17084, 17094, 10, 2},
+    {17096, 7409, 2, 1},
+    {17098, 17108, 10, 2},
+    {17110, 17117, 7, 2},
+    {17119, 8612, 12, 2},
+    {17131, 17146, 15, 3},
+    {17149, 17178, 29, 3},
+    {17181, 5782, 10, 2},
+    {17191, 17208, 17, 2},
+    {17210, 17239, 29, 3},
+    {17242, 17246, 4, 2},
+    {17248, 17263, 15, 2},
+    {17265, 1859, 7, 2},
+    {17272, 17282, 10, 3},
+    {17285, 17301, 16, 3},
+    {17304, 57, 2, 1},
+    {17306, 17321, 15, 3},
+    {17324, 17336, 12, 3},
+    {17339, 17366, 27, 3},
+    {17369, 17377, 8, 2},
+    {17379, 17392, 13, 2},
+    {17394, 17409, 15, 3},
+    {17412, 17423, 11, 2},
+    {17425, 17435, 10, 3},
+    {17438, 17448, 10, 2},
+    {17450, 17464, 14, 3},
+    {17467, 17481, 14, 3},
+    {17484, 17494, 10, 2},
+    {17496, 17530, 34, 3},
+    {17533, 17546, 13, 3},
+    {17549, 17559, 10, 2},
+    {17561, 44, 2, 1},
+    {17563, 1859, 13, 2},
+    {17576, 17582, 6, 3},
+    {17585, 17594, 9, 2},
+    {17596, 15632, 10, 2},
+    {17606, 17621, 15, 3},
+    {17624, 17635, 11, 3},
+    {17638, 17649, 11, 3},
+    {17652, 17672, 20, 3},
+    {17675, 17684, 9, 3},
+    {17687, 17697, 10, 2},
+    {17699, 17709, 10, 3},
+    {17712, 17731, 19, 3},
+    {17734, 17740, 6, 3},
+    {17743, 17766, 23, 3},
+    {17769, 17782, 13, 3},
+    {17785, 17804, 19, 3},
+    {17807, 17817, 10, 1},
+    {17818, 17830, 12, 3},
+    {17833, 17847, 14, 2},
+    {17849, 7317, 13, 2},
+    {17862, 17874, 12, 3},
+    {17877, 17892, 15, 2},
+    {17894, 16905, 5, 2},
+    {17899, 17917, 18, 3},
+    {17920, 17927, 7, 3},
+    {17930, 17937, 7, 3},
+    {17940, 17952, 12, 2},
+    {17954, 17969, 15, 2},
+    {17971, 17991, 20, 3},
+    {17994, 18003, 9, 3},
+    {18006, 18009, 3, 2},
+    {18011, 18019, 8, 3},
+    {18022, 18036, 14, 2},
+    {18038, 18052, 14, 3},
+    {18055, 18076, 21, 3},
+    {18079, 18088, 9, 3},
+    {18091, 18113, 22, 2},
+    {18115, 18125, 10, 3},
+    {18128, 18137, 9, 3},
+    {18140, 18148, 8, 2},
+    {18150, 7972, 16, 3},
+    {18166, 18177, 11, 1},
+    {18178, 18201, 23, 3},
+    {18204, 18215, 11, 2},
+    {18217, 18228, 11, 3},
+    {18231, 18249, 18, 3},
+    {18252, 18267, 15, 2},
+    {18269, 18286, 17, 3},
+    {18289, 18300, 11, 3},
+    {18303, 18318, 15, 3},
+    {18321, 18342, 21, 3},
+    {18345, 18358, 13, 3},
+    {18361, 18379, 18, 3},
+    {18382, 18394, 12, 3},
+    {18397, 18407, 10, 2},
+    {18409, 18434, 25, 3},
+    {18437, 18444, 7, 2},
+    {18446, 18454, 8, 3},
+    {18457, 18468, 11, 3},
+    {18471, 18482, 11, 3},
+    {18485, 2447, 10, 2},
+    {18495, 18504, 9, 3},
+    {18507, 18527, 20, 3},
+    {18530, 18548, 18, 3},
+    {18551, 18565, 14, 2},
+    {18567, 18584, 17, 2},
+    {18586, 15900, 5, 2},
+    {18591, 18599, 8, 3},
+    {18602, 5918, 15, 2},
+    {18617, 18635, 18, 3},
+    {18638, 18659, 21, 2},
+    {18661, 6828, 10, 2},
+    {18671, 18688, 17, 2},
+    {18690, 18709, 19, 3},
+    {18712, 18722, 10, 2},
+    {18724, 18729, 5, 2},
+    {18731, 18757, 26, 3},
+    {18760, 18766, 6, 2},
+    {18768, 18776, 8, 3},
+    {18779, 18789, 10, 2},
+    {18791, 18808, 17, 3},
+    {18811, 18822, 11, 2},
+    {18824, 18835, 11, 3},
+    {18838, 18848, 10, 3},
+    {18851, 18875, 24, 3},
+    {18878, 18885, 7, 2},
+    {18887, 18901, 14, 3},
+    {18904, 18910, 6, 2},
+    {18912, 18928, 16, 3},
+    {18931, 18946, 15, 3},
+    {18949, 18959, 10, 2},
+    {18961, 18972, 11, 2},
+    {18974, 18986, 12, 3},
+    {18989, 18996, 7, 2},
+    {18998, 19010, 12, 3},
+    {19013, 19020, 7, 3},
+    {19023, 19031, 8, 2},
+    {19033, 19043, 10, 3},
+    {19046, 16051, 11, 2},
+    {19057, 14607, 10, 2},
+    {19067, 19088, 21, 3},
+    {19091, 12351, 17, 2},
+    {19108, 19113, 5, 2},
+    {19115, 19128, 13, 2},
+    {19130, 19137, 7, 2},
+    {19139, 19158, 19, 3},
+    {19161, 19171, 10, 2},
+    {19173, 19193, 20, 3},
+    {19196, 222, 11, 2},
+    {19207, 9437, 11, 2},
+    {19218, 19225, 7, 3},
+    {19228, 19239, 11, 2},
+    {19241, 19251, 10, 3},
+    {19254, 19265, 11, 3},
+    {19268, 19280, 12, 2},
+    {19282, 19293, 11, 2},
+    {19295, 19306, 11, 3},
+    {19309, 19320, 11, 3},
+    {19323, 15455, 13, 2},
+    {19336, 19345, 9, 3},
+    {19348, 19364, 16, 3},
+    {19367, 19374, 7, 2},
+    {19376, 19392, 16, 2},
+    {19394, 19410, 16, 3},
+    {19413, 19424, 11, 1},
+    {19425, 19437, 12, 3},
+    {19440, 5251, 10, 2},
+    {19450, 19468, 18, 3},
+    {19471, 19482, 11, 3},
+    {19485, 19498, 13, 3},
+    {19501, 19517, 16, 3},
+    {19520, 19531, 11, 3},
+    {19534, 19555, 21, 3},
+    {19558, 19589, 31, 3},
+    {19592, 19602, 10, 3},
+    {19605, 19613, 8, 2},
+    {19615, 6515, 2, 1},
+    {19617, 19631, 14, 3},
+    {19634, 19651, 17, 3},
+    {19654, 19664, 10, 3},
+    {19667, 19678, 11, 3},
+    {19681, 19692, 11, 3},
+    {19695, 19702, 7, 3},
+    {19705, 19720, 15, 3},
+    {19723, 19739, 16, 3},
+    {19742, 19754, 12, 2},
+    {19756, 19765, 9, 3},
+    {19768, 2891, 13, 3},
+    {19781, 19793, 12, 3},
+    {19796, 19800, 4, 3},
+    {19803, 19816, 13, 3},
+    {19819, 19834, 15, 3},
+    {19837, 19849, 12, 3},
+    {19852, 274, 10, 2},
+    {19862, 14740, 18, 2},
+    {19880, 19892, 12, 1},
+    {19893, 19905, 12, 3},
+    {19908, 19923, 15, 3},
+    {19926, 19946, 20, 2},
+    {19948, 19954, 6, 3},
+    {19957, 19964, 7, 2},
+    {19966, 19973, 7, 3},
+    {19976, 19983, 7, 3},
+    {19986, 19994, 8, 3},
+    {19997, 259, 2, 1},
+    {19999, 20021, 22, 2},
+    {20023, 20035, 12, 3},
+    {20038, 20045, 7, 2},
+    {20047, 20057, 10, 2},
+    {20059, 20068, 9, 3},
+    {20071, 20081, 10, 3},
+    {20084, 20093, 9, 3},
+    {20096, 20109, 13, 2},
+    {20111, 20121, 10, 2},
+    {20123, 20135, 12, 2},
+    {20137, 20158, 21, 3},
+    {20161, 20168, 7, 2},
+    {20170, 20196, 26, 3},
+    {20199, 20211, 12, 3},
+    {20214, 20226, 12, 3},
+    {20229, 20239, 10, 2},
+    {20241, 20260, 19, 2},
+    {20262, 20282, 20, 3},
+    {20285, 13598, 8, 3},
+    {20293, 20326, 33, 3},
+    {20329, 20349, 20, 2},
+    {20351, 20364, 13, 3},
+    {20367, 20383, 16, 2},
+    {20385, 20395, 10, 2},
+    {20397, 20415, 18, 2},
+    {20417, 20426, 9, 3},
+    {20429, 20439, 10, 3},
+    {20442, 20459, 17, 3},
+    {20462, 20471, 9, 2},
+    {20473, 20484, 11, 3},
+    {20487, 20492, 5, 2},
+    {20494, 20498, 4, 2},
+    {20500, 20520, 20, 2},
+    {20522, 20532, 10, 2},
+    {20534, 20542, 8, 3},
+    {20545, 20551, 6, 2},
+    {20553, 20554, 2, 1},
+    {20555, 20574, 19, 3},
+    {20577, 20598, 21, 3},
+    {20601, 20611, 10, 3},
+    {20614, 20626, 12, 3},
+    {20629, 20655, 26, 3},
+    {20658, 9579, 8, 2},
+    {20666, 20674, 8, 2},
+    {20676, 20688, 12, 2},
+    {20690, 20701, 11, 3},
+    {20704, 20724, 20, 3},
+    {20727, 3003, 10, 2},
+    {20737, 20752, 15, 2},
+    {20754, 20771, 17, 3},
+    {20774, 20783, 9, 3},
+    {20786, 20799, 13, 3},
+    {20802, 10649, 10, 2},
+    {20812, 20824, 12, 3},
+    {20827, 20830, 3, 2},
+    {20832, 20846, 14, 3},
+    {20849, 20871, 22, 2},
+    {20873, 1859, 22, 2},
+    {20895, 20906, 11, 3},
+    {20909, 20915, 6, 3},
+    {20918, 20929, 11, 2},
+    {20931, 20947, 16, 3},
+    {20950, 20960, 10, 3},
+    {20963, 20971, 8, 2},
+    {20973, 20981, 8, 3},
+    {20984, 20998, 14, 3},
+    {21001, 21011, 10, 2},
+    {21013, 21034, 21, 3},
+    {21037, 1859, 9, 2},
+    {21046, 21057, 11, 3},
+    {21060, 21077, 17, 2},
+    {21079, 21089, 10, 3},
+    {21092, 8455, 10, 2},
+    {21102, 21112, 10, 2},
+    {21114, 21126, 12, 2},
+    {21128, 21144, 16, 3},
+    {21147, 21157, 10, 3},
+    {21160, 7797, 6, 2},
+    {21166, 21178, 12, 3},
+    {21181, 21207, 26, 3},
+    {21210, 21221, 11, 3},
+    {21224, 21239, 15, 3},
+    {21242, 21258, 16, 3},
+    {21261, 958, 14, 2},
+    {21275, 21284, 9, 3},
+    {21287, 21296, 9, 3},
+    {21299, 21310, 11, 3},
+    {21313, 21320, 7, 3},
+    {21323, 21332, 9, 3},
+    {21335, 21347, 12, 2},
+    {21349, 21364, 15, 2},
+    {21366, 21379, 13, 3},
+    {21382, 17015, 4, 2},
+    {21386, 21400, 14, 3},
+    {21403, 21413, 10, 3},
+    {21416, 21430, 14, 3},
+    {21433, 220, 2, 1},
+    {21435, 21453, 18, 3},
+    {21456, 21469, 13, 3},
+    {21472, 21480, 8, 3},
+    {21483, 21500, 17, 2},
+    {21502, 21517, 15, 2},
+    {21519, 21528, 9, 3},
+    {21531, 21541, 10, 2},
+    {21543, 21555, 12, 3},
+    {21558, 21572, 14, 3},
+    {21575, 21589, 14, 2},
+    {21591, 21606, 15, 3},
+    {21609, 21618, 9, 3},
+    {21621, 14505, 18, 2},
+    {21639, 21650, 11, 3},
+    {21653, 21668, 15, 3},
+    {21671, 21678, 7, 2},
+    {21680, 21697, 17, 3},
+    {21700, 21707, 7, 2},
+    {21709, 21716, 7, 2},
+    {21718, 21541, 12, 2},
+    {21730, 21744, 14, 3},
+    {21747, 21757, 10, 3},
+    {21760, 21788, 28, 3},
+    {21791, 21798, 7, 2},
+    {21800, 810, 4, 1},
+    {21804, 13511, 10, 3},
+    {21814, 19171, 10, 2},
+    {21824, 21840, 16, 3},
+    {21843, 21863, 20, 2},
+    {21865, 21882, 17, 3},
+    {21885, 21896, 11, 3},
+    {21899, 21909, 10, 3},
+    {21912, 21923, 11, 3},
+    {21926, 21940, 14, 2},
+    {21942, 21948, 6, 2},
+    {21950, 21956, 6, 2},
+    {21958, 21972, 14, 2},
+    {21974, 21985, 11, 3},
+    {21988, 21998, 10, 3},
+    {22001, 22018, 17, 3},
+    {22021, 16607, 24, 3},
+    {22045, 22055, 10, 3},
+    {22058, 22078, 20, 3},
+    {22081, 22106, 25, 3},
+    {22109, 22126, 17, 3},
+    {22129, 22144, 15, 3},
+    {22147, 22163, 16, 3},
+    {22166, 22180, 14, 3},
+    {22183, 22194, 11, 3},
+    {22197, 7797, 12, 2},
+    {22209, 22222, 13, 2},
+    {22224, 22245, 21, 3},
+    {22248, 22257, 9, 3},
+    {22260, 22271, 11, 2},
+    {22273, 22283, 10, 2},
+    {22285, 22300, 15, 2},
+    {22302, 22314, 12, 2},
+    {22316, 226, 2, 1},
+    {22318, 22342, 24, 2},
+    {22344, 22358, 14, 3},
+    {22361, 22374, 13, 2},
+    {22376, 22397, 21, 3},
+    {22400, 22424, 24, 3},
+    {22427, 22444, 17, 3},
+    {22447, 22469, 22, 3},
+    {22472, 22484, 12, 2},
+    {22486, 22493, 7, 2},
+    {22495, 22508, 13, 2},
+    {22510, 22528, 18, 2},
+    {22530, 22549, 19, 3},
+    {22552, 10102, 10, 3},
+    {22562, 22569, 7, 2},
+    {22571, 22579, 8, 3},
+    {22582, 22591, 9, 2},
+    {22593, 22605, 12, 2},
+    {22607, 22617, 10, 2},
+    {22619, 22635, 16, 2},
+    {22637, 22644, 7, 3},
+    {22647, 22657, 10, 2},
+    {22659, 22675, 16, 3},
+    {22678, 22686, 8, 3},
+    {22689, 6028, 8, 3},
+    {22697, 22706, 9, 3},
+    {22709, 22723, 14, 3},
+    {22726, 22732, 6, 2},
+    {22734, 22744, 10, 3},
+    {22747, 22756, 9, 2},
+    {22758, 22769, 11, 2},
+    {22771, 22787, 16, 3},
+    {22790, 1932, 10, 2},
+    {22800, 22814, 14, 3},
+    {22817, 22827, 10, 1},
+    {22828, 22839, 11, 3},
+    {22842, 22861, 19, 3},
+    {22864, 3966, 13, 2},
+    {22877, 22886, 9, 3},
+    {22889, 22903, 14, 2},
+    {22905, 22916, 11, 3},
+    {22919, 22929, 10, 1},
+    {22930, 22941, 11, 3},
+    {22944, 5112, 10, 2},
+    {22954, 22962, 8, 2},
+    {22964, 22971, 7, 2},
+    {22973, 22981, 8, 3},
+    {22984, 22996, 12, 2},
+    {22998, 23012, 14, 3},
+    {23015, 23027, 12, 3},
+    {23030, 23049, 19, 3},
+    {23052, 23078, 26, 3},
+    {23081, 23091, 10, 3},
+    {23094, 14740, 8, 2},
+    {23102, 23115, 13, 3},
+    {23118, 23130, 12, 3},
+    {23133, 23146, 13, 3},
+    {23149, 23160, 11, 3},
+    {23163, 23179, 16, 2},
+    {23181, 23199, 18, 3},
+    {23202, 23210, 8, 3},
+    {23213, 23221, 8, 3},
+    {23224, 23233, 9, 3},
+    {23236, 23249, 13, 2},
+    {23251, 23266, 15, 2},
+    {23268, 265, 2, 1},
+    {23270, 23278, 8, 1},
+    {23279, 9834, 10, 2},
+    {23289, 2135, 9, 2},
+    {23298, 23316, 18, 2},
+    {23318, 23328, 10, 3},
+    {23331, 23337, 6, 2},
+    {23339, 23353, 14, 2},
+    {23355, 23362, 7, 2},
+    {23364, 23384, 20, 3},
+    {23387, 23399, 12, 3},
+    {23402, 23414, 12, 3},
+    {23417, 23427, 10, 3},
+    {23430, 23441, 11, 3},
+    {23444, 3258, 10, 2},
+    {23454, 23465, 11, 3},
+    {23468, 23480, 12, 3},
+    {23483, 23498, 15, 3},
+    {23501, 23512, 11, 2},
+    {23514, 23522, 8, 2},
+    {23524, 23533, 9, 3},
+    {23536, 23546, 10, 2},
+    {23548, 23559, 11, 1},
+    {23560, 23563, 3, 2},
+    {23565, 23590, 25, 3},
+    {23593, 11817, 11, 2},
+    {23604, 23612, 8, 3},
+    {23615, 13, 2, 1},
+    {23617, 23627, 10, 3},
+    {23630, 23638, 8, 3},
+    {23641, 23655, 14, 3},
+    {23658, 23666, 8, 3},
+    {23669, 1859, 24, 2},
+    {23693, 23701, 8, 3},
+    {23704, 23714, 10, 2},
+    {23716, 23747, 31, 3},
+    {23750, 13360, 10, 2},
+    {23760, 23770, 10, 2},
+    {23772, 23783, 11, 3},
+    {23786, 23793, 7, 3},
+    {23796, 23806, 10, 2},
+    {23808, 23820, 12, 3},
+    {23823, 23834, 11, 2},
+    {23836, 23847, 11, 3},
+    {23850, 23856, 6, 2},
+    {23858, 22374, 10, 2},
+    {23868, 23876, 8, 3},
+    {23879, 23895, 16, 3},
+    {23898, 14705, 2, 1},
+    {23900, 23916, 16, 3},
+    {23919, 23930, 11, 3},
+    {23933, 23940, 7, 2},
+    {23942, 23955, 13, 3},
+    {23958, 23978, 20, 3},
+    {23981, 23991, 10, 2},
+    {23993, 360, 17, 2},
+    {24010, 24020, 10, 3},
+    {24023, 24033, 10, 3},
+    {24036, 24053, 17, 3},
+    {24056, 24067, 11, 3},
+    {24070, 24079, 9, 3},
+    {24082, 24093, 11, 3},
+    {24096, 24103, 7, 3},
+    {24106, 24120, 14, 3},
+    {24123, 24144, 21, 3},
+    {24147, 13241, 11, 1},
+    {24158, 24167, 9, 2},
+    {24169, 24179, 10, 3},
+    {24182, 24185, 3, 2},
+    {24187, 24198, 11, 3},
+    {24201, 24218, 17, 3},
+    {24221, 24249, 28, 3},
+    {24252, 24277, 25, 3},
+    {24280, 24288, 8, 3},
+    {24291, 24296, 5, 2},
+    {24298, 24308, 10, 2},
+    {24310, 24321, 11, 3},
+    {24324, 24338, 14, 3},
+    {24341, 24356, 15, 3},
+    {24359, 24380, 21, 2},
+    {24382, 24397, 15, 2},
+    {24399, 24406, 7, 3},
+    {24409, 24420, 11, 3},
+    {24423, 24427, 4, 2},
+    {24429, 24452, 23, 3},
+    {24455, 24467, 12, 3},
+    {24470, 24487, 17, 3},
+    {24490, 24497, 7, 2},
+    {24499, 24504, 5, 2},
+    {24506, 21541, 16, 2},
+    {24522, 24534, 12, 2},
+    {24536, 24546, 10, 3},
+    {24549, 24564, 15, 3},
+    {24567, 24587, 20, 3},
+    {24590, 24601, 11, 3},
+    {24604, 24619, 15, 2},
+    {24621, 24632, 11, 3},
+    {24635, 24651, 16, 3},
+    {24654, 24672, 18, 3},
+    {24675, 0, 8, 0},
+    {24683, 24696, 13, 3},
+    {24699, 24709, 10, 3},
+    {24712, 24722, 10, 2},
+    {24724, 24731, 7, 3},
+    {24734, 3908, 7, 1},
+    {24741, 24755, 14, 3},
+    {24758, 24775, 17, 3},
+    {24778, 24795, 17, 3},
+    {24798, 24809, 11, 3},
+    {24812, 24819, 7, 2},
+    {24821, 1859, 17, 2},
+    {24838, 24852, 14, 3},
+    {24855, 24870, 15, 3},
+    {24873, 24884, 11, 3},
+    {24887, 24892, 5, 1},
+    {24893, 17448, 11, 2},
+    {24904, 24917, 13, 2},
+    {24919, 305, 6, 1},
+    {24925, 37, 2, 1},
+    {24927, 124, 2, 1},
+    {24929, 218, 5, 1},
+    {24934, 24944, 10, 2},
+    {24946, 24957, 11, 2},
+    {24959, 958, 18, 2},
+    {24977, 24990, 13, 2},
+    {24992, 25004, 12, 3},
+    {25007, 25018, 11, 2},
+    {25020, 25031, 11, 3},
+    {25034, 25045, 11, 3},
+    {25048, 25060, 12, 3},
+    {25063, 25080, 17, 3},
+    {25083, 25094, 11, 3},
+    {25097, 25107, 10, 3},
+    {25110, 25120, 10, 3},
+    {25123, 25127, 4, 2},
+    {25129, 25143, 14, 3},
+    {25146, 25165, 19, 3},
+    {25168, 25197, 29, 3},
+    {25200, 25207, 7, 3},
+    {25210, 25222, 12, 2},
+    {25224, 25231, 7, 2},
+    {25233, 25243, 10, 3},
+    {25246, 25255, 9, 3},
+    {25258, 25269, 11, 3},
+    {25272, 25284, 12, 3},
+    {25287, 25308, 21, 2},
+    {25310, 25328, 18, 3},
+    {25331, 1859, 9, 2},
+    {25340, 25352, 12, 3},
+    {25355, 25366, 11, 3},
+    {25369, 25376, 7, 3},
+    {25379, 25390, 11, 2},
+    {25392, 25400, 8, 3},
+    {25403, 25418, 15, 3},
+    {25421, 25431, 10, 2},
+    {25433, 25445, 12, 3},
+    {25448, 25457, 9, 2},
+    {25459, 25472, 13, 2},
+    {25474, 25486, 12, 3},
+    {25489, 25499, 10, 3},
+    {25502, 25512, 10, 3},
+    {25515, 11418, 6, 2},
+    {25521, 25530, 9, 3},
+    {25533, 25539, 6, 2},
+    {25541, 25568, 27, 3},
+    {25571, 20783, 6, 3},
+    {25577, 25590, 13, 3},
+    {25593, 25603, 10, 3},
+    {25606, 25623, 17, 3},
+    {25626, 25639, 13, 2},
+    {25641, 25657, 16, 2},
+    {25659, 25673, 14, 3},
+    {25676, 25691, 15, 2},
+    {25693, 25718, 25, 2},
+    {25720, 25729, 9, 3},
+    {25732, 25745, 13, 2},
+    {25747, 25759, 12, 3},
+    {25762, 25784, 22, 2},
+    {25786, 25797, 11, 3},
+    {25800, 25827, 27, 3},
+    {25830, 3, 2, 1},
+    {25832, 25840, 8, 3},
+    {25843, 25855, 12, 2},
+    {25857, 25873, 16, 2},
+    {25875, 25896, 21, 2},
+    {25898, 25930, 32, 3},
+    {25933, 25944, 11, 3},
+    {25947, 25960, 13, 2},
+    {25962, 25973, 11, 3},
+    {25976, 25991, 15, 3},
+    {25994, 26006, 12, 2},
+    {26008, 26018, 10, 3},
+    {26021, 4959, 16, 2},
+    {26037, 26067, 30, 2},
+    {26069, 26087, 18, 3},
+    {26090, 26101, 11, 3},
+    {26104, 12848, 18, 3},
+    {26122, 26133, 11, 3},
+    {26136, 26147, 11, 2},
+    {26149, 26165, 16, 3},
+    {26168, 26184, 16, 3},
+    {26187, 26198, 11, 3},
+    {26201, 5251, 16, 2},
+    {26217, 26230, 13, 2},
+    {26232, 26249, 17, 3},
+    {26252, 1736, 15, 2},
+    {26267, 26277, 10, 3},
+    {26280, 26301, 21, 3},
+    {26304, 26322, 18, 2},
+    {26324, 26335, 11, 3},
+    {26338, 26351, 13, 3},
+    {26354, 26388, 34, 3},
+    {26391, 26402, 11, 3},
+    {26405, 26412, 7, 3},
+    {26415, 26428, 13, 2},
+    {26430, 8795, 10, 2},
+    {26440, 26462, 22, 3},
+    {26465, 9325, 12, 2},
+    {26477, 26489, 12, 2},
+    {26491, 26505, 14, 2},
+    {26507, 12324, 25, 3},
+    {26532, 26541, 9, 3},
+    {26544, 21157, 17, 3},
+    {26561, 26565, 4, 2},
+    {26567, 26590, 23, 3},
+    {26593, 26605, 12, 3},
+    {26608, 26627, 19, 3},
+    {26630, 26641, 11, 3},
+    {26644, 7972, 9, 3},
+    {26653, 26674, 21, 3},
+    {26677, 26691, 14, 2},
+    {26693, 26711, 18, 3},
+    {26714, 26718, 4, 2},
+    {26720, 26738, 18, 2},
+    {26740, 18659, 10, 2},
+    {26750, 26759, 9, 3},
+    {26762, 26772, 10, 3},
+    {26775, 26795, 20, 2},
+    {26797, 26807, 10, 2},
+    {26809, 26822, 13, 3},
+    {26825, 26843, 18, 3},
+    {26846, 26857, 11, 3},
+    {26860, 26881, 21, 3},
+    {26884, 26899, 15, 3},
+    {26902, 26912, 10, 3},
+    {26915, 26924, 9, 3},
+    {26927, 4042, 11, 2},
+    {26938, 26946, 8, 3},
+    {26949, 26959, 10, 3},
+    {26962, 26981, 19, 3},
+    {26984, 26995, 11, 3},
+    {26998, 27010, 12, 3},
+    {27013, 27014, 2, 1},
+    {27015, 27029, 14, 3},
+    {27032, 27048, 16, 3},
+    {27051, 27062, 11, 3},
+    {27065, 27074, 9, 3},
+    {27077, 14183, 12, 3},
+    {27089, 27106, 17, 2},
+    {27108, 27121, 13, 3},
+    {27124, 27136, 12, 2},
+    {27138, 27162, 24, 3},
+    {27165, 27175, 10, 2},
+    {27177, 27193, 16, 3},
+    {27196, 27206, 10, 3},
+    {27209, 27221, 12, 3},
+    {27224, 27235, 11, 3},
+    {27238, 27249, 11, 3},
+    {27252, 27261, 9, 3},
+    {27264, 1572, 10, 2},
+    {27274, 27296, 22, 3},
+    {27299, 27313, 14, 3},
+    {27316, 27326, 10, 3},
+    {27329, 27336, 7, 3},
+    {27339, 27349, 10, 3},
+    {27352, 27365, 13, 3},
+    {27368, 15455, 13, 2},
+    {27381, 27392, 11, 2},
+    {27394, 27412, 18, 3},
+    {27415, 27423, 8, 3},
+    {27426, 27437, 11, 3},
+    {27440, 27451, 11, 3},
+    {27454, 260, 11, 2},
+    {27465, 27475, 10, 2},
+    {27477, 27501, 24, 3},
+    {27504, 27515, 11, 3},
+    {27518, 27521, 3, 2},
+    {27523, 16943, 10, 2},
+    {27533, 27540, 7, 3},
+    {27543, 27554, 11, 2},
+    {27556, 22508, 12, 2},
+    {27568, 27579, 11, 2},
+    {27581, 27607, 26, 3},
+    {27610, 27611, 2, 1},
+    {27612, 27632, 20, 2},
+    {27634, 27650, 16, 3},
+    {27653, 27668, 15, 2},
+    {27670, 27683, 13, 2},
+    {27685, 27693, 8, 2},
+    {27695, 27707, 12, 2},
+    {27709, 27720, 11, 3},
+    {27723, 27739, 16, 3},
+    {27742, 27753, 11, 3},
+    {27756, 27767, 11, 1},
+    {27768, 27776, 8, 3},
+    {27779, 27789, 10, 3},
+    {27792, 27810, 18, 3},
+    {27813, 27823, 10, 2},
+    {27825, 27845, 20, 3},
+    {27848, 27859, 11, 3},
+    {27862, 27881, 19, 3},
+    {27884, 27896, 12, 3},
+    {27899, 27918, 19, 3},
+    {27921, 27928, 7, 2},
+    {27930, 27944, 14, 3},
+    {27947, 27955, 8, 3},
+    {27958, 26843, 12, 3},
+    {27970, 27980, 10, 3},
+    {27983, 27989, 6, 2},
+    {27991, 28020, 29, 3},
+    {28023, 28032, 9, 3},
+    {28035, 28044, 9, 3},
+    {28047, 28055, 8, 3},
+    {28058, 28077, 19, 2},
+    {28079, 28091, 12, 3},
+    {28094, 28105, 11, 3},
+    {28108, 28119, 11, 3},
+    {28122, 28137, 15, 3},
+    {28140, 17282, 6, 3},
+    {28146, 28152, 6, 3},
+    {28155, 28162, 7, 3},
+    {28165, 28180, 15, 2},
+    {28182, 28193, 11, 2},
+    {28195, 28212, 17, 3},
+    {28215, 28231, 16, 2},
+    {28233, 28238, 5, 2},
+    {28240, 28247, 7, 2},
+    {28249, 18148, 10, 2},
+    {28259, 28278, 19, 2},
+    {28280, 28291, 11, 3},
+    {28294, 28326, 32, 3},
+    {28329, 28337, 8, 3},
+    {28340, 28360, 20, 3},
+    {28363, 28373, 10, 2},
+    {28375, 28393, 18, 3},
+    {28396, 28401, 5, 2},
+    {28403, 28414, 11, 2},
+    {28416, 28430, 14, 3},
+    {28433, 28448, 15, 3},
+    {28451, 28461, 10, 1},
+    {28462, 28483, 21, 3},
+    {28486, 28505, 19, 3},
+    {28508, 28519, 11, 3},
+    {28522, 28531, 9, 3},
+    {28534, 28545, 11, 3},
+    {28548, 28558, 10, 2},
+    {28560, 15853, 10, 2},
+    {28570, 28582, 12, 3},
+    {28585, 24167, 15, 2},
+    {28600, 28611, 11, 3},
+    {28614, 28622, 8, 3},
+    {28625, 28636, 11, 3},
+    {28639, 28651, 12, 3},
+    {28654, 28665, 11, 3},
+    {28668, 28688, 20, 2},
+    {28690, 17423, 5, 2},
+    {28695, 28699, 4, 2},
+    {28701, 22591, 13, 2},
+    {28714, 10421, 10, 2},
+    {28724, 28731, 7, 2},
+    {28733, 28744, 11, 1},
+    {28745, 28756, 11, 2},
+    {28758, 28775, 17, 2},
+    {28777, 28788, 11, 3},
+    {28791, 1261, 2, 1},
+    {28793, 7254, 13, 2},
+    {28806, 28823, 17, 3},
+    {28826, 28847, 21, 3},
+    {28850, 320, 31, 2},
+    {28881, 28891, 10, 3},
+    {28894, 28904, 10, 2},
+    {28906, 28916, 10, 3},
+    {28919, 28935, 16, 3},
+    {28938, 28954, 16, 2},
+    {28956, 28967, 11, 3},
+    {28970, 28980, 10, 3},
+    {28983, 16943, 4, 2},
+    {28987, 28995, 8, 3},
+    {28998, 29009, 11, 3},
+    {29012, 29029, 17, 2},
+    {29031, 29043, 12, 3},
+    {29046, 29061, 15, 3},
+    {29064, 29071, 7, 3},
+    {29074, 29084, 10, 2},
+    {29086, 29093, 7, 3},
+    {29096, 29103, 7, 2},
+    {29105, 29117, 12, 2},
+    {29119, 29127, 8, 3},
+    {29130, 21011, 12, 2},
+    {29142, 29152, 10, 3},
+    {29155, 29161, 6, 2},
+    {29163, 29171, 8, 2},
+    {29173, 29186, 13, 3},
+    {29189, 29213, 24, 3},
+    {29216, 29237, 21, 3},
+    {29240, 29249, 9, 2},
+    {29251, 29261, 10, 3},
+    {29264, 29271, 7, 3},
+    {29274, 29285, 11, 3},
+    {29288, 18959, 12, 2},
+    {29300, 29084, 15, 2},
+    {29315, 29328, 13, 3},
+    {29331, 29334, 3, 2},
+    {29336, 29349, 13, 3},
+    {29352, 29358, 6, 2},
+    {29360, 29372, 12, 2},
+    {29374, 29394, 20, 3},
+    {29397, 29406, 9, 3},
+    {29409, 29415, 6, 2},
+    {29417, 29430, 13, 3},
+    {29433, 29446, 13, 2},
+    {29448, 29460, 12, 2},
+    {29462, 29478, 16, 2},
+    {29480, 3336, 4, 2},
+    {29484, 29493, 9, 2},
+    {29495, 29505, 10, 3},
+    {29508, 29523, 15, 2},
+    {29525, 29533, 8, 2},
+    {29535, 29545, 10, 2},
+    {29547, 7797, 8, 2},
+    {29555, 29561, 6, 2},
+    {29563, 29574, 11, 3},
+    {29577, 8748, 8, 1},
+    {29585, 2403, 2, 1},
+    {29587, 29602, 15, 2},
+    {29604, 26807, 11, 2},
+    {29615, 29627, 12, 3},
+    {29630, 4866, 10, 3},
+    {29640, 29647, 7, 3},
+    {29650, 29663, 13, 3},
+    {29666, 29673, 7, 3},
+    {29676, 29687, 11, 2},
+    {29689, 29705, 16, 3},
+    {29708, 13019, 10, 2},
+    {29718, 29729, 11, 2},
+    {29731, 29741, 10, 2},
+    {29743, 29754, 11, 3},
+    {29757, 29769, 12, 2},
+    {29771, 29793, 22, 3},
+    {29796, 29806, 10, 3},
+    {29809, 29819, 10, 3},
+    {29822, 29829, 7, 2},
+    {29831, 29841, 10, 2},
+    {29843, 29853, 10, 2},
+    {29855, 29872, 17, 2},
+    {29874, 29885, 11, 3},
+    {29888, 29898, 10, 3},
+    {29901, 2708, 10, 2},
+    {29911, 29918, 7, 3},
+    {29921, 29938, 17, 3},
+    {29941, 29950, 9, 3},
+    {29953, 0, 10, 0},
+    {29963, 29974, 11, 1},
+    {29975, 29995, 20, 3},
+    {29998, 30009, 11, 2},
+    {30011, 30018, 7, 2},
+    {30020, 30023, 3, 2},
+    {30025, 30035, 10, 3},
+    {30038, 30048, 10, 3},
+    {30051, 30059, 8, 2},
+    {30061, 30069, 8, 3},
+    {30072, 30086, 14, 3},
+    {30089, 30103, 14, 3},
+    {30106, 30117, 11, 1},
+    {30118, 30126, 8, 3},
+    {30129, 30149, 20, 3},
+    {30152, 30172, 20, 3},
+    {30175, 30195, 20, 3},
+    {30198, 30209, 11, 3},
+    {30212, 30229, 17, 3},
+    {30232, 30256, 24, 2},
+    {30258, 30269, 11, 3},
+    {30272, 30279, 7, 2},
+    {30281, 4959, 10, 2},
+    {30291, 30299, 8, 3},
+    {30302, 30312, 10, 2},
+    {30314, 30327, 13, 3},
+    {30330, 30349, 19, 3},
+    {30352, 30378, 26, 3},
+    {30381, 30399, 18, 3},
+    {30402, 30411, 9, 3},
+    {30414, 30433, 19, 3},
+    {30436, 30453, 17, 3},
+    {30456, 30468, 12, 2},
+    {30470, 12215, 13, 2},
+    {30483, 30493, 10, 3},
+    {30496, 30519, 23, 3},
+    {30522, 4348, 11, 2},
+    {30533, 30545, 12, 2},
+    {30547, 30559, 12, 2},
+    {30561, 30566, 5, 2},
+    {30568, 30582, 14, 3},
+    {30585, 30595, 10, 2},
+    {30597, 30607, 10, 3},
+    {30610, 30630, 20, 2},
+    {30632, 30640, 8, 2},
+    {30642, 30658, 16, 3},
+    {30661, 30672, 11, 3},
+    {30675, 30694, 19, 3},
+    {30697, 30709, 12, 3},
+    {30712, 30731, 19, 3},
+    {30734, 30751, 17, 3},
+    {30754, 30761, 7, 2},
+    {30763, 12830, 13, 2},
+    {30776, 30787, 11, 3},
+    {30790, 30814, 24, 2},
+    {30816, 30833, 17, 3},
+    {30836, 30853, 17, 3},
+    {30856, 30867, 11, 3},
+    {30870, 30889, 19, 3},
+    {30892, 30917, 25, 3},
+    {30920, 30926, 6, 3},
+    {30929, 30930, 2, 1},
+    {30931, 30943, 12, 2},
+    {30945, 30952, 7, 3},
+    {30955, 30966, 11, 3},
+    {30969, 30980, 11, 1},
+    {30981, 30993, 12, 3},
+    {30996, 31008, 12, 3},
+    {31011, 31018, 7, 3},
+    {31021, 31041, 20, 3},
+    {31044, 31061, 17, 3},
+    {31064, 31077, 13, 3},
+    {31080, 31088, 8, 3},
+    {31091, 31098, 7, 2},
+    {31100, 31114, 14, 3},
+    {31117, 31122, 5, 2},
+    {31124, 31139, 15, 2},
+    {31141, 31155, 14, 3},
+    {31158, 15455, 21, 2},
+    {31179, 31192, 13, 2},
+    {31194, 31200, 6, 3},
+    {31203, 31218, 15, 3},
+    {31221, 31237, 16, 3},
+    {31240, 31250, 10, 3},
+    {31253, 31264, 11, 3},
+    {31267, 31277, 10, 2},
+    {31279, 31291, 12, 3},
+    {31294, 31305, 11, 2},
+    {31307, 31328, 21, 3},
+    {31331, 31341, 10, 2},
+    {31343, 31359, 16, 3},
+    {31362, 5057, 12, 3},
+    {31374, 31385, 11, 3},
+    {31388, 1151, 25, 2},
+    {31413, 22617, 4, 2},
+    {31417, 28904, 12, 2},
+    {31429, 31446, 17, 3},
+    {31449, 31460, 11, 3},
+    {31463, 31473, 10, 2},
+    {31475, 31483, 8, 3},
+    {31486, 11, 2, 1},
+    {31488, 793, 2, 1},
+    {31490, 31508, 18, 3},
+    {31511, 31524, 13, 2},
+    {31526, 31542, 16, 3},
+    {31545, 31564, 19, 3},
+    {31567, 31575, 8, 2},
+    {31577, 31588, 11, 3},
+    {31591, 31594, 3, 2},
+    {31596, 31607, 11, 3},
+    {31610, 31622, 12, 3},
+    {31625, 31643, 18, 3},
+    {31646, 31653, 7, 2},
+    {31655, 31671, 16, 3},
+    {31674, 31686, 12, 2},
+    {31688, 31703, 15, 3},
+    {31706, 31722, 16, 3},
+    {31725, 31737, 12, 3},
+    {31740, 4295, 11, 2},
+    {31751, 31761, 10, 2},
+    {31763, 31775, 12, 2},
+    {31777, 813, 12, 3},
+    {31789, 31803, 14, 2},
+    {31805, 31812, 7, 3},
+    {31815, 15455, 11, 2},
+    {31826, 31836, 10, 3},
+    {31839, 31850, 11, 3},
+    {31853, 31869, 16, 3},
+    {31872, 31888, 16, 3},
+    {31891, 2135, 13, 2},
+    {31904, 31912, 8, 3},
+    {31915, 31934, 19, 3},
+    {31937, 31943, 6, 2},
+    {31945, 31953, 8, 2},
+    {31955, 31974, 19, 3},
+    {31977, 31989, 12, 3},
+    {31992, 32004, 12, 3},
+    {32007, 32018, 11, 3},
+    {32021, 32034, 13, 3},
+    {32037, 32044, 7, 3},
+    {32047, 32069, 22, 3},
+    {32072, 32083, 11, 3},
+    {32086, 32093, 7, 3},
+    {32096, 32106, 10, 2},
+    {32108, 32115, 7, 2},
+    {32117, 32138, 21, 2},
+    {32140, 32155, 15, 3},
+    {32158, 32175, 17, 3},
+    {32178, 32189, 11, 3},
+    {32192, 32210, 18, 2},
+    {32212, 32224, 12, 2},
+    {32226, 32236, 10, 2},
+    {32238, 20554, 7, 1},
+    {32245, 32254, 9, 3},
+    {32257, 32268, 11, 3},
+    {32271, 32282, 11, 3},
+    {32285, 134, 2, 1},
+    {32287, 32294, 7, 3},
+    {32297, 32305, 8, 3},
+    {32308, 32319, 11, 3},
+    {32322, 32338, 16, 3},
+    {32341, 32350, 9, 3},
+    {32353, 8699, 6, 3},
+    {32359, 32374, 15, 3},
+    {32377, 32392, 15, 3},
+    {32395, 32412, 17, 3},
+    {32415, 32423, 8, 3},
+    {32426, 32439, 13, 3},
+    {32442, 7813, 15, 2},
+    {32457, 32470, 13, 3},
+    {32473, 32480, 7, 3},
+    {32483, 32495, 12, 2},
+    {32497, 32505, 8, 3},
+    {32508, 32517, 9, 3},
+    {32520, 32538, 18, 3},
+    {32541, 32547, 6, 2},
+    {32549, 32560, 11, 2},
+    {32562, 32575, 13, 3},
+    {32578, 32589, 11, 3},
+    {32592, 32607, 15, 3},
+    {32610, 3232, 2, 1},
+    {32612, 10464, 2, 1},
+    {32614, 32625, 11, 3},
+    {32628, 32642, 14, 3},
+    {32645, 32656, 11, 3},
+    {32659, 32676, 17, 3},
+    {32679, 19849, 18, 3},
+    {32697, 32712, 15, 3},
+    {32715, 32730, 15, 3},
+    {32733, 32743, 10, 3},
+    {32746, 32757, 11, 3},
+    {32760, 32787, 27, 3},
+    {32790, 32800, 10, 3},
+    {32803, 32814, 11, 1},
+    {32815, 1572, 3, 2},
+    {32818, 958, 14, 2},
+    {32832, 32841, 9, 3},
+    {32844, 32854, 10, 2},
+    {32856, 32870, 14, 2},
+    {32872, 32892, 20, 2},
+    {32894, 808, 5, 1},
+    {32899, 32909, 10, 3},
+    {32912, 32922, 10, 3},
+    {32925, 15645, 10, 2},
+    {32935, 21178, 18, 3},
+    {32953, 32961, 8, 2},
+    {32963, 32972, 9, 3},
+    {32975, 18267, 9, 2},
+    {32984, 32993, 9, 3},
+    {32996, 33014, 18, 3},
+    {33017, 33026, 9, 3},
+    {33029, 33037, 8, 2},
+    {33039, 33055, 16, 3},
+    {33058, 33068, 10, 3},
+    {33071, 33086, 15, 3},
+    {33089, 33109, 20, 3},
+    {33112, 33134, 22, 3},
+    {33137, 33147, 10, 1},
+    {33148, 1710, 10, 2},
+    {33158, 33169, 11, 3},
+    {33172, 33187, 15, 3},
+    {33190, 33204, 14, 3},
+    {33207, 33227, 20, 3},
+    {33230, 33241, 11, 3},
+    {33244, 33255, 11, 2},
+    {33257, 33268, 11, 3},
+    {33271, 33281, 10, 3},
+    {33284, 33291, 7, 2},
+    {33293, 33307, 14, 3},
+    {33310, 33317, 7, 3},
+    {33320, 33321, 2, 1},
+    {33322, 33330, 8, 3},
+    {33333, 33338, 5, 3},
+    {33341, 33356, 15, 3},
+    {33359, 22617, 10, 2},
+    {33369, 33378, 9, 2},
+    {33380, 33392, 12, 2},
+    {33394, 33416, 22, 2},
+    {33418, 33429, 11, 3},
+    {33432, 33447, 15, 3},
+    {33450, 33460, 10, 3},
+    {33463, 33479, 16, 2},
+    {33481, 33488, 7, 2},
+    {33490, 33493, 3, 2},
+    {33495, 33523, 28, 3},
+    {33526, 33536, 10, 3},
+    {33539, 33549, 10, 3},
+    {33552, 33565, 13, 3},
+    {33568, 33583, 15, 3},
+    {33586, 33602, 16, 2},
+    {33604, 14740, 16, 2},
+    {33620, 33629, 9, 3},
+    {33632, 7960, 10, 2},
+    {33642, 33650, 8, 3},
+    {33653, 33665, 12, 2},
+    {33667, 33679, 12, 2},
+    {33681, 33688, 7, 3},
+    {33691, 9620, 4, 1},
+    {33695, 33707, 12, 3},
+    {33710, 33728, 18, 3},
+    {33731, 5251, 6, 2},
+    {33737, 33750, 13, 3},
+    {33753, 33764, 11, 3},
+    {33767, 33776, 9, 3},
+    {33779, 33789, 10, 2},
+    {33791, 33803, 12, 3},
+    {33806, 14308, 10, 2},
+    {33816, 33831, 15, 3},
+    {33834, 33855, 21, 3},
+    {33858, 33874, 16, 3},
+    {33877, 33901, 24, 3},
+    {33904, 33918, 14, 2},
+    {33920, 33935, 15, 2},
+    {33937, 33943, 6, 2},
+    {33945, 33957, 12, 3},
+    {33960, 33979, 19, 3},
+    {33982, 33993, 11, 3},
+    {33996, 34005, 9, 2},
+    {34007, 34014, 7, 3},
+    {34017, 34028, 11, 3},
+    {34031, 34043, 12, 3},
+    {34046, 34061, 15, 3},
+    {34064, 34074, 10, 3},
+    {34077, 34082, 5, 2},
+    {34084, 34101, 17, 3},
+    {34104, 34114, 10, 3},
+    {34117, 1859, 9, 2},
+    {34126, 34136, 10, 3},
+    {34139, 34151, 12, 2},
+    {34153, 34170, 17, 3},
+    {34173, 30930, 11, 1},
+    {34184, 34196, 12, 3},
+    {34199, 34210, 11, 3},
+    {34213, 34224, 11, 3},
+    {34227, 34249, 22, 2},
+    {34251, 34262, 11, 3},
+    {34265, 34281, 16, 3},
+    {34284, 34295, 11, 3},
+    {34298, 34311, 13, 3},
+    {34314, 34327, 13, 3},
+    {34330, 34348, 18, 2},
+    {34350, 34370, 20, 3},
+    {34373, 34385, 12, 3},
+    {34388, 329, 2, 1},
+    {34390, 34397, 7, 3},
+    {34400, 20674, 7, 2},
+    {34407, 34415, 8, 3},
+    {34418, 34433, 15, 3},
+    {34436, 34445, 9, 2},
+    {34447, 34458, 11, 3},
+    {34461, 34481, 20, 3},
+    {34484, 34492, 8, 3},
+    {34495, 34502, 7, 3},
+    {34505, 34516, 11, 2},
+    {34518, 34533, 15, 3},
+    {34536, 34543, 7, 3},
+    {34546, 34556, 10, 2},
+    {34558, 14214, 10, 2},
+    {34568, 34588, 20, 2},
+    {34590, 7880, 16, 2},
+    {34606, 21956, 12, 2},
+    {34618, 34630, 12, 3},
+    {34633, 34648, 15, 3},
+    {34651, 34659, 8, 3},
+    {34662, 34684, 22, 3},
+    {34687, 34691, 4, 2},
+    {34693, 34703, 10, 3},
+    {34706, 34397, 10, 3},
+    {34716, 34735, 19, 3},
+    {34738, 34745, 7, 2},
+    {34747, 33602, 12, 2},
+    {34759, 34770, 11, 2},
+    {34772, 34783, 11, 2},
+    {34785, 34794, 9, 3},
+    {34797, 34804, 7, 3},
+    {34807, 34818, 11, 3},
+    {34821, 34834, 13, 3},
+    {34837, 34848, 11, 3},
+    {34851, 34858, 7, 3},
+    {34861, 34880, 19, 3},
+    {34883, 34906, 23, 2},
+    {34908, 34921, 13, 3},
+    {34924, 34935, 11, 2},
+    {34937, 34941, 4, 2},
+    {34943, 15, 2, 1},
+    {34945, 34948, 3, 3},
+    {34951, 34966, 15, 3},
+    {34969, 34982, 13, 2},
+    {34984, 35004, 20, 2},
+    {35006, 35032, 26, 3},
+    {35035, 35046, 11, 3},
+    {35049, 35073, 24, 3},
+    {35076, 35095, 19, 3},
+    {35098, 35110, 12, 3},
+    {35113, 35132, 19, 3},
+    {35135, 35145, 10, 2},
+    {35147, 35156, 9, 2},
+    {35158, 35169, 11, 3},
+    {35172, 35188, 16, 3},
+    {35191, 35203, 12, 2},
+    {35205, 35225, 20, 3},
+    {35228, 35239, 11, 3},
+    {35242, 35253, 11, 3},
+    {35256, 35264, 8, 2},
+    {35266, 35272, 6, 2},
+    {35274, 35298, 24, 2},
+    {35300, 35311, 11, 1},
+    {35312, 35328, 16, 3},
+    {35331, 35341, 10, 3},
+    {35344, 34433, 17, 3},
+    {35361, 35367, 6, 3},
+    {35370, 35382, 12, 3},
+    {35385, 35407, 22, 3},
+    {35410, 35425, 15, 2},
+    {35427, 35443, 16, 3},
+    {35446, 35461, 15, 3},
+    {35464, 35477, 13, 2},
+    {35479, 35487, 8, 3},
+    {35490, 35497, 7, 3},
+    {35500, 16731, 18, 3},
+    {35518, 35532, 14, 3},
+    {35535, 958, 12, 2},
+    {35547, 35559, 12, 3},
+    {35562, 35571, 9, 3},
+    {35574, 35584, 10, 2},
+    {35586, 35610, 24, 3},
+    {35613, 35632, 19, 3},
+    {35635, 35646, 11, 3},
+    {35649, 35669, 20, 3},
+    {35672, 35687, 15, 2},
+    {35689, 35696, 7, 3},
+    {35699, 35714, 15, 3},
+    {35717, 35726, 9, 3},
+    {35729, 35739, 10, 2},
+    {35741, 31341, 11, 2},
+    {35752, 35762, 10, 3},
+    {35765, 35788, 23, 3},
+    {35791, 35800, 9, 3},
+    {35803, 35815, 12, 2},
+    {35817, 35827, 10, 3},
+    {35830, 1932, 16, 2},
+    {35846, 35863, 17, 3},
+    {35866, 35877, 11, 3},
+    {35880, 35890, 10, 3},
+    {35893, 35909, 16, 3},
+    {35912, 35924, 12, 2},
+    {35926, 1859, 20, 2},
+    {35946, 35956, 10, 2},
+    {35958, 35969, 11, 3},
+    {35972, 35983, 11, 3},
+    {35986, 35996, 10, 2},
+    {35998, 36013, 15, 3},
+    {36016, 36039, 23, 3},
+    {36042, 36053, 11, 3},
+    {36056, 36068, 12, 2},
+    {36070, 14740, 10, 2},
+    {36080, 36097, 17, 3},
+    {36100, 203, 2, 1},
+    {36102, 36118, 16, 2},
+    {36120, 36137, 17, 3},
+    {36140, 36153, 13, 3},
+    {36156, 36171, 15, 3},
+    {36174, 36179, 5, 2},
+    {36181, 36193, 12, 2},
+    {36195, 36213, 18, 3},
+    {36216, 36227, 11, 3},
+    {36230, 36241, 11, 3},
+    {36244, 36255, 11, 3},
+    {36258, 36265, 7, 2},
+    {36267, 36283, 16, 3},
+    {36286, 36291, 5, 3},
+    {36294, 36310, 16, 3},
+    {36313, 36325, 12, 3},
+    {36328, 36339, 11, 3},
+    {36342, 36354, 12, 3},
+    {36357, 1450, 17, 2},
+    {36374, 36393, 19, 3},
+    {36396, 274, 6, 2},
+    {36402, 36417, 15, 3},
+    {36420, 36431, 11, 3},
+    {36434, 36447, 13, 2},
+    {36449, 36460, 11, 3},
+    {36463, 36486, 23, 2},
+    {36488, 18928, 10, 3},
+    {36498, 36512, 14, 3},
+    {36515, 36527, 12, 3},
+    {36530, 1859, 9, 2},
+    {36539, 1748, 18, 2},
+    {36557, 36568, 11, 2},
+    {36570, 36579, 9, 3},
+    {36582, 36590, 8, 3},
+    {36593, 35584, 18, 2},
+    {36611, 36631, 20, 3},
+    {36634, 36653, 19, 3},
+    {36656, 17494, 10, 2},
+    {36666, 36673, 7, 2},
+    {36675, 36686, 11, 3},
+    {36689, 36705, 16, 2},
+    {36707, 36728, 21, 3},
+    {36731, 14075, 10, 2},
+    {36741, 36752, 11, 3},
+    {36755, 36765, 10, 2},
+    {36767, 36781, 14, 2},
+    {36783, 24546, 16, 3},
+    {36799, 36810, 11, 3},
+    {36813, 36830, 17, 3},
+    {36833, 36853, 20, 3},
+    {36856, 4413, 7, 2},
+    {36863, 24722, 18, 2},
+    {36881, 14740, 8, 2},
+    {36889, 24957, 10, 2},
+    {36899, 36913, 14, 3},
+    {36916, 36930, 14, 3},
+    {36933, 36948, 15, 3},
+    {36951, 36963, 12, 2},
+    {36965, 36980, 15, 2},
+    {36982, 36995, 13, 2},
+    {36997, 1450, 21, 2},
+    {37018, 37029, 11, 3},
+    {37032, 37040, 8, 3},
+    {37043, 37066, 23, 2},
+    {37068, 37080, 12, 2},
+    {37082, 37098, 16, 3},
+    {37101, 11633, 13, 2},
+    {37114, 37125, 11, 3},
+    {37128, 37152, 24, 3},
+    {37155, 37172, 17, 3},
+    {37175, 37194, 19, 3},
+    {37197, 37204, 7, 3},
+    {37207, 37215, 8, 3},
+    {37218, 37229, 11, 3},
+    {37232, 37243, 11, 3},
+    {37246, 22686, 10, 3},
+    {37256, 37285, 29, 3},
+    {37288, 37301, 13, 3},
+    {37304, 37314, 10, 2},
+    {37316, 37329, 13, 3},
+    {37332, 37339, 7, 3},
+    {37342, 33789, 16, 2},
+    {37358, 37380, 22, 2},
+    {37382, 37393, 11, 3},
+    {37396, 2357, 8, 2},
+    {37404, 37419, 15, 2},
+    {37421, 37432, 11, 3},
+    {37435, 37442, 7, 2},
+    {37444, 37454, 10, 3},
+    {37457, 37466, 9, 3},
+    {37469, 37493, 24, 2},
+    {37495, 37510, 15, 2},
+    {37512, 37527, 15, 3},
+    {37530, 37540, 10, 2},
+    {37542, 37548, 6, 2},
+    {37550, 3831, 19, 2},
+    {37569, 37583, 14, 2},
+    {37585, 37595, 10, 3},
+    {37598, 37627, 29, 3},
+    {37630, 37651, 21, 3},
+    {37654, 37674, 20, 3},
+    {37677, 7018, 14, 3},
+    {37691, 37712, 21, 2},
+    {37714, 37721, 7, 2},
+    {37723, 37741, 18, 3},
+    {37744, 37756, 12, 3},
+    {37759, 25657, 10, 2},
+    {37769, 37780, 11, 2},
+    {37782, 37797, 15, 2},
+    {37799, 37806, 7, 2},
+    {37808, 37818, 10, 3},
+    {37821, 37832, 11, 3},
+    {37835, 37845, 10, 3},
+    {37848, 28414, 5, 2},
+    {37853, 37867, 14, 3},
+    {37870, 37893, 23, 3},
+    {37896, 37914, 18, 3},
+    {37917, 37927, 10, 3},
+    {37930, 37949, 19, 3},
+    {37952, 37966, 14, 3},
+    {37969, 37987, 18, 3},
+    {37990, 38008, 18, 3},
+    {38011, 38014, 3, 2},
+    {38016, 14923, 14, 3},
+    {38030, 38040, 10, 3},
+    {38043, 38054, 11, 3},
+    {38057, 38066, 9, 3},
+    {38069, 38086, 17, 3},
+    {38089, 18822, 15, 2},
+    {38104, 12385, 10, 2},
+    {38114, 38133, 19, 2},
+    {38135, 38148, 13, 3},
+    {38151, 38161, 10, 3},
+    {38164, 38175, 11, 3},
+    {38178, 10635, 10, 2},
+    {38188, 38198, 10, 2},
+    {38200, 38211, 11, 3},
+    {38214, 38225, 11, 3},
+    {38228, 38238, 10, 2},
+    {38240, 38251, 11, 3},
+    {38254, 38279, 25, 3},
+    {38282, 38289, 7, 2},
+    {38291, 38316, 25, 3},
+    {38319, 38333, 14, 3},
+    {38336, 38348, 12, 2},
+    {38350, 38373, 23, 2},
+    {38375, 38386, 11, 3},
+    {38389, 38400, 11, 3},
+    {38403, 38410, 7, 2},
+    {38412, 38423, 11, 3},
+    {38426, 38436, 10, 1},
+    {38437, 38450, 13, 3},
+    {38453, 7011, 5, 2},
+    {38458, 38473, 15, 3},
+    {38476, 38485, 9, 3},
+    {38488, 38505, 17, 2},
+    {38507, 38523, 16, 2},
+    {38525, 38536, 11, 3},
+    {38539, 38551, 12, 3},
+    {38554, 38569, 15, 3},
+    {38572, 38583, 11, 3},
+    {38586, 38599, 13, 3},
+    {38602, 5623, 19, 2},
+    {38621, 38633, 12, 3},
+    {38636, 10377, 9, 2},
+    {38645, 33147, 2, 1},
+    {38647, 38662, 15, 2},
+    {38664, 38673, 9, 3},
+    {38676, 38687, 11, 3},
+    {38690, 38698, 8, 3},
+    {38701, 2135, 7, 2},
+    {38708, 38721, 13, 3},
+    {38724, 38742, 18, 2},
+    {38744, 38755, 11, 3},
+    {38758, 34659, 4, 3},
+    {38762, 1859, 9, 2},
+    {38771, 38784, 13, 2},
+    {38786, 38794, 8, 3},
+    {38797, 34005, 10, 2},
+    {38807, 13426, 6, 2},
+    {38813, 38826, 13, 3},
+    {38829, 38844, 15, 3},
+    {38847, 28, 2, 1},
+    {38849, 38869, 20, 3},
+    {38872, 38899, 27, 3},
+    {38902, 38913, 11, 3},
+    {38916, 221, 2, 1},
+    {38918, 38931, 13, 3},
+    {38934, 38963, 29, 3},
+    {38966, 38978, 12, 3},
+    {38981, 38997, 16, 3},
+    {39000, 39011, 11, 3},
+    {39014, 39025, 11, 3},
+    {39028, 39039, 11, 3},
+    {39042, 10400, 2, 1},
+    {39044, 39050, 6, 3},
+    {39053, 39067, 14, 3},
+    {39070, 39078, 8, 3},
+    {39081, 39092, 11, 3},
+    {39095, 39102, 7, 2},
+    {39104, 39115, 11, 2},
+    {39117, 39131, 14, 2},
+    {39133, 39141, 8, 3},
+    {39144, 39157, 13, 3},
+    {39160, 39191, 31, 3},
+    {39194, 39204, 10, 3},
+    {39207, 39218, 11, 3},
+    {39221, 20121, 7, 2},
+    {39228, 39237, 9, 3},
+    {39240, 16010, 11, 2},
+    {39251, 6828, 4, 2},
+    {39255, 39270, 15, 3},
+    {39273, 26505, 10, 2},
+    {39283, 39302, 19, 3},
+    {39305, 17582, 15, 3},
+    {39320, 39327, 7, 3},
+    {39330, 39342, 12, 3},
+    {39345, 39358, 13, 3},
+    {39361, 39379, 18, 3},
+    {39382, 39410, 28, 3},
+    {39413, 39434, 21, 3},
+    {39437, 39448, 11, 3},
+    {39451, 39459, 8, 2},
+    {39461, 39479, 18, 3},
+    {39482, 39494, 12, 2},
+    {39496, 39508, 12, 2},
+    {39510, 39521, 11, 3},
+    {39524, 39545, 21, 2},
+    {39547, 39560, 13, 2},
+    {39562, 39568, 6, 2},
+    {39570, 39573, 3, 2},
+    {39575, 39587, 12, 3},
+    {39590, 39601, 11, 3},
+    {39604, 39611, 7, 3},
+    {39614, 39627, 13, 2},
+    {39629, 39642, 13, 3},
+    {39645, 13631, 10, 2},
+    {39655, 39667, 12, 3},
+    {39670, 39684, 14, 3},
+    {39687, 39697, 10, 2},
+    {39699, 39706, 7, 3},
+    {39709, 39718, 9, 2},
+    {39720, 39740, 20, 3},
+    {39743, 39764, 21, 3},
+    {39767, 39778, 11, 2},
+    {39780, 39790, 10, 2},
+    {39792, 39801, 9, 3},
+    {39804, 39812, 8, 2},
+    {39814, 22605, 10, 2},
+    {39824, 39839, 15, 2},
+    {39841, 39849, 8, 2},
+    {39851, 39871, 20, 3},
+    {39874, 39884, 10, 3},
+    {39887, 5999, 4, 2},
+    {39891, 39905, 14, 2},
+    {39907, 39918, 11, 3},
+    {39921, 39945, 24, 3},
+    {39948, 39955, 7, 3},
+    {39958, 39970, 12, 2},
+    {39972, 39984, 12, 3},
+    {39987, 40006, 19, 3},
+    {40009, 40022, 13, 2},
+    {40024, 40033, 9, 3},
+    {40036, 40049, 13, 2},
+    {40051, 40058, 7, 3},
+    {40061, 40064, 3, 2},
+    {40066, 40092, 26, 2},
+    {40094, 40101, 7, 3},
+    {40104, 40122, 18, 2},
+    {40124, 40136, 12, 2},
+    {40138, 40157, 19, 3},
+    {40160, 40170, 10, 3},
+    {40173, 11296, 24, 3},
+    {40197, 40205, 8, 2},
+    {40207, 10649, 6, 2},
+    {40213, 40228, 15, 3},
+    {40231, 40238, 7, 3},
+    {40241, 40251, 10, 2},
+    {40253, 40274, 21, 3},
+    {40277, 40286, 9, 2},
+    {40288, 40291, 3, 3},
+    {40294, 40313, 19, 3},
+    {40316, 40327, 11, 3},
+    {40330, 40352, 22, 3},
+    {40355, 40366, 11, 3},
+    {40369, 40384, 15, 3},
+    {40387, 40394, 7, 3},
+    {40397, 40407, 10, 3},
+    {40410, 40422, 12, 2},
+    {40424, 9787, 8, 3},
+    {40432, 40445, 13, 3},
+    {40448, 1450, 13, 2},
+    {40461, 40471, 10, 2},
+    {40473, 40483, 10, 2},
+    {40485, 40497, 12, 3},
+    {40500, 40515, 15, 3},
+    {40518, 40522, 4, 2},
+    {40524, 2182, 10, 2},
+    {40534, 27554, 5, 2},
+    {40539, 40550, 11, 3},
+    {40553, 40566, 13, 3},
+    {40569, 40583, 14, 3},
+    {40586, 40598, 12, 2},
+    {40600, 40609, 9, 3},
+    {40612, 40622, 10, 1},
+    {40623, 40642, 19, 3},
+    {40645, 40657, 12, 3},
+    {40660, 40686, 26, 2},
+    {40688, 40706, 18, 3},
+    {40709, 40721, 12, 3},
+    {40724, 40733, 9, 3},
+    {40736, 40747, 11, 3},
+    {40750, 40774, 24, 2},
+    {40776, 40786, 10, 2},
+    {40788, 40797, 9, 3},
+    {40800, 40815, 15, 3},
+    {40818, 3474, 9, 2},
+    {40827, 40842, 15, 3},
+    {40845, 27611, 11, 1},
+    {40856, 33789, 12, 2},
+    {40868, 40879, 11, 3},
+    {40882, 40901, 19, 2},
+    {40903, 38784, 9, 2},
+    {40912, 40922, 10, 1},
+    {40923, 40933, 10, 3},
+    {40936, 21998, 5, 3},
+    {40941, 10487, 12, 2},
+    {40953, 40965, 12, 3},
+    {40968, 40975, 7, 2},
+    {40977, 26505, 10, 2},
+    {40987, 41004, 17, 3},
+    {41007, 41020, 13, 2},
+    {41022, 17559, 10, 2},
+    {41032, 41063, 31, 2},
+    {41065, 25127, 10, 2},
+    {41075, 13638, 10, 2},
+    {41085, 41093, 8, 2},
+    {41095, 5251, 12, 2},
+    {41107, 41122, 15, 3},
+    {41125, 41135, 10, 1},
+    {41136, 41154, 18, 3},
+    {41157, 41180, 23, 2},
+    {41182, 41194, 12, 3},
+    {41197, 9997, 11, 2},
+    {41208, 14740, 19, 2},
+    {41227, 41231, 4, 3},
+    {41234, 41252, 18, 3},
+    {41255, 41264, 9, 2},
+    {41266, 41284, 18, 3},
+    {41287, 41309, 22, 3},
+    {41312, 41324, 12, 2},
+    {41326, 832, 10, 3},
+    {41336, 41346, 10, 2},
+    {41348, 41357, 9, 3},
+    {41360, 36460, 11, 3},
+    {41371, 41374, 3, 2},
+    {41376, 41397, 21, 3},
+    {41400, 25499, 19, 3},
+    {41419, 41430, 11, 3},
+    {41433, 41443, 10, 3},
+    {41446, 41457, 11, 3},
+    {41460, 41473, 13, 2},
+    {41475, 41490, 15, 2},
+    {41492, 41498, 6, 3},
+    {41501, 41512, 11, 3},
+    {41515, 41530, 15, 3},
+    {41533, 41554, 21, 3},
+    {41557, 41564, 7, 2},
+    {41566, 41575, 9, 3},
+    {41578, 41595, 17, 2},
+    {41597, 41613, 16, 3},
+    {41616, 41628, 12, 2},
+    {41630, 41638, 8, 3},
+    {41641, 41653, 12, 2},
+    {41655, 41665, 10, 2},
+    {41667, 41684, 17, 3},
+    {41687, 12186, 10, 2},
+    {41697, 41712, 15, 2},
+    {41714, 41726, 12, 3},
+    {41729, 41740, 11, 3},
+    {41743, 41750, 7, 3},
+    {41753, 809, 6, 1},
+    {41759, 41772, 13, 3},
+    {41775, 41792, 17, 3},
+    {41795, 41806, 11, 3},
+    {41809, 41828, 19, 3},
+    {41831, 41845, 14, 3},
+    {41848, 41858, 10, 2},
+    {41860, 41878, 18, 3},
+    {41881, 41889, 8, 3},
+    {41892, 41908, 16, 3},
+    {41911, 41920, 9, 3},
+    {41923, 41938, 15, 3},
+    {41941, 41952, 11, 3},
+    {41955, 41966, 11, 3},
+    {41969, 42001, 32, 3},
+    {42004, 42023, 19, 2},
+    {42025, 42051, 26, 3},
+    {42054, 42065, 11, 3},
+    {42068, 42075, 7, 3},
+    {42078, 42087, 9, 3},
+    {42090, 42099, 9, 3},
+    {42102, 42122, 20, 3},
+    {42125, 42135, 10, 3},
+    {42138, 42146, 8, 3},
+    {42149, 42159, 10, 3},
+    {42162, 42172, 10, 3},
+    {42175, 9749, 10, 2},
+    {42185, 42197, 12, 2},
+    {42199, 42207, 8, 3},
+    {42210, 42229, 19, 3},
+    {42232, 4055, 10, 2},
+    {42242, 34691, 10, 2},
+    {42252, 42263, 11, 3},
+    {42266, 1450, 13, 2},
+    {42279, 28558, 11, 2},
+    {42290, 42307, 17, 3},
+    {42310, 42331, 21, 2},
+    {42333, 42344, 11, 2},
+    {42346, 42371, 25, 2},
+    {42373, 42380, 7, 2},
+    {42382, 42399, 17, 3},
+    {42402, 42428, 26, 3},
+    {42431, 42438, 7, 2},
+    {42440, 42463, 23, 2},
+    {42465, 42475, 10, 3},
+    {42478, 42491, 13, 3},
+    {42494, 1859, 9, 2},
+    {42503, 14740, 8, 2},
+    {42511, 42523, 12, 2},
+    {42525, 4295, 10, 2},
+    {42535, 42555, 20, 3},
+    {42558, 42570, 12, 2},
+    {42572, 42578, 6, 2},
+    {42580, 42587, 7, 2},
+    {42589, 5, 2, 1},
+    {42591, 42602, 11, 1},
+    {42603, 42618, 15, 2},
+    {42620, 42631, 11, 3},
+    {42634, 42646, 12, 3},
+    {42649, 4, 2, 1},
+    {42651, 42666, 15, 3},
+    {42669, 42686, 17, 2},
+    {42688, 42702, 14, 2},
+    {42704, 42724, 20, 3},
+    {42727, 24308, 12, 2},
+    {42739, 1450, 13, 2},
+    {42752, 42760, 8, 3},
+    {42763, 42787, 24, 3},
+    {42790, 42808, 18, 2},
+    {42810, 42823, 13, 3},
+    {42826, 42847, 21, 3},
+    {42850, 23834, 10, 2},
+    {42860, 29729, 5, 2},
+    {42865, 42878, 13, 3},
+    {42881, 5251, 18, 2},
+    {42899, 42908, 9, 3},
+    {42911, 32236, 13, 2},
+    {42924, 320, 18, 2},
+    {42942, 42953, 11, 3},
+    {42956, 42964, 8, 3},
+    {42967, 42982, 15, 3},
+    {42985, 43002, 17, 3},
+    {43005, 43012, 7, 2},
+    {43014, 43026, 12, 3},
+    {43029, 30023, 9, 2},
+    {43038, 43059, 21, 3},
+    {43062, 43085, 23, 3},
+    {43088, 43098, 10, 2},
+    {43100, 43109, 9, 3},
+    {43112, 43121, 9, 2},
+    {43123, 43133, 10, 2},
+    {43135, 20135, 10, 2},
+    {43145, 13501, 25, 3},
+    {43170, 43181, 11, 2},
+    {43183, 43195, 12, 3},
+    {43198, 43207, 9, 3},
+    {43210, 43227, 17, 3},
+    {43230, 43246, 16, 3},
+    {43249, 24167, 10, 2},
+    {43259, 43272, 13, 2},
+    {43274, 11805, 12, 2},
+    {43286, 10162, 11, 2},
+    {43297, 43315, 18, 3},
+    {43318, 43334, 16, 2},
+    {43336, 31139, 5, 2},
+    {43341, 43350, 9, 3},
+    {43353, 43363, 10, 3},
+    {43366, 958, 25, 2},
+    {43391, 43406, 15, 2},
+    {43408, 9526, 10, 2},
+    {43418, 43422, 4, 2},
+    {43424, 21716, 11, 2},
+    {43435, 43475, 40, 3},
+    {43478, 43488, 10, 3},
+    {43491, 43507, 16, 3},
+    {43510, 43531, 21, 2},
+    {43533, 43545, 12, 3},
+    {43548, 43566, 18, 3},
+    {43569, 43585, 16, 3},
+    {43588, 43597, 9, 3},
+    {43600, 43609, 9, 2},
+    {43611, 43619, 8, 3},
+    {43622, 43647, 25, 3},
+    {43650, 43674, 24, 3},
+    {43677, 43688, 11, 3},
+    {43691, 43702, 11, 3},
+    {43705, 43718, 13, 2},
+    {43720, 43731, 11, 3},
+    {43734, 19410, 10, 3},
+    {43744, 43763, 19, 2},
+    {43765, 11920, 10, 2},
+    {43775, 43787, 12, 3},
+    {43790, 43800, 10, 2},
+    {43802, 43814, 12, 2},
+    {43816, 43826, 10, 3},
+    {43829, 43839, 10, 2},
+    {43841, 43851, 10, 3},
+    {43854, 43866, 12, 3},
+    {43869, 1032, 2, 1},
+    {43871, 1648, 12, 2},
+    {43883, 43893, 10, 2},
+    {43895, 4504, 13, 3},
+    {43908, 43914, 6, 3},
+    {43917, 43930, 13, 3},
+    {43933, 43943, 10, 3},
+    {43946, 43958, 12, 2},
+    {43960, 13558, 12, 2},
+    {43972, 43985, 13, 2},
+    {43987, 43994, 7, 2},
+    {43996, 44006, 10, 3},
+    {44009, 44018, 9, 3},
+    {44021, 44033, 12, 3},
+    {44036, 44045, 9, 2},
+    {44047, 44059, 12, 3},
+    {44062, 44070, 8, 3},
+    {44073, 2237, 11, 2},
+    {44084, 44091, 7, 2},
+    {44093, 44109, 16, 3},
+    {44112, 44128, 16, 3},
+    {44131, 44150, 19, 3},
+    {44153, 44157, 4, 2},
+    {44159, 44179, 20, 3},
+    {44182, 44193, 11, 3},
+    {44196, 44208, 12, 3},
+    {44211, 44218, 7, 2},
+    {44220, 44231, 11, 3},
+    {44234, 29741, 12, 2},
+    {44246, 44266, 20, 3},
+    {44269, 1361, 11, 2},
+    {44280, 44293, 13, 2},
+    {44295, 23546, 13, 2},
+    {44308, 44324, 16, 3},
+    {44327, 44338, 11, 3},
+    {44341, 44360, 19, 3},
+    {44363, 44371, 8, 3},
+    {44374, 8, 2, 1},
+    {44376, 44388, 12, 2},
+    {44390, 41665, 16, 2},
+    {44406, 44417, 11, 3},
+    {44420, 44433, 13, 3},
+    {44436, 44444, 8, 3},
+    {44447, 44454, 7, 2},
+    {44456, 44474, 18, 2},
+    {44476, 44489, 13, 3},
+    {44492, 44520, 28, 3},
+    {44523, 44529, 6, 1},
+    {44530, 44541, 11, 3},
+    {44544, 44559, 15, 3},
+    {44562, 44573, 11, 3},
+    {44576, 44591, 15, 2},
+    {44593, 44600, 7, 3},
+    {44603, 44609, 6, 2},
+    {44611, 44623, 12, 2},
+    {44625, 44642, 17, 3},
+    {44645, 9394, 19, 3},
+    {44664, 44675, 11, 3},
+    {44678, 44697, 19, 3},
+    {44700, 44716, 16, 2},
+    {44718, 0, 2, 1},
+    {44720, 44732, 12, 3},
+    {44735, 44745, 10, 3},
+    {44748, 44761, 13, 3},
+    {44764, 44775, 11, 3},
+    {44778, 13766, 2, 1},
+    {44780, 44795, 15, 3},
+    {44798, 44808, 10, 3},
+    {44811, 44827, 16, 3},
+    {44830, 44854, 24, 3},
+    {44857, 20239, 11, 2},
+    {44868, 22397, 15, 3},
+    {44883, 44894, 11, 3},
+    {44897, 44925, 28, 3},
+    {44928, 44942, 14, 3},
+    {44945, 44957, 12, 3},
+    {44960, 44970, 10, 2},
+    {44972, 44983, 11, 3},
+    {44986, 10750, 11, 2},
+    {44997, 45006, 9, 3},
+    {45009, 45025, 16, 3},
+    {45028, 45042, 14, 3},
+    {45045, 16327, 10, 2},
+    {45055, 45067, 12, 2},
+    {45069, 45076, 7, 3},
+    {45079, 45093, 14, 2},
+    {45095, 45110, 15, 2},
+    {45112, 45125, 13, 3},
+    {45128, 45147, 19, 3},
+    {45150, 45155, 5, 2},
+    {45157, 45168, 11, 3},
+    {45171, 45185, 14, 2},
+    {45187, 45195, 8, 2},
+    {45197, 45214, 17, 3},
+    {45217, 45238, 21, 3},
+    {45241, 45252, 11, 3},
+    {45255, 45269, 14, 2},
+    {45271, 45274, 3, 2},
+    {45276, 45287, 11, 3},
+    {45290, 45310, 20, 2},
+    {45312, 45328, 16, 3},
+    {45331, 45344, 13, 3},
+    {45347, 17108, 10, 2},
+    {45357, 45366, 9, 3},
+    {45369, 45376, 7, 2},
+    {45378, 12954, 8, 2},
+    {45386, 45405, 19, 2},
+    {45407, 45413, 6, 2},
+    {45415, 45435, 20, 2},
+    {45437, 45451, 14, 3},
+    {45454, 1945, 10, 2},
+    {45464, 45476, 12, 3},
+    {45479, 45490, 11, 3},
+    {45493, 45507, 14, 3},
+    {45510, 45523, 13, 3},
+    {45526, 45527, 2, 1},
+    {45528, 45548, 20, 3},
+    {45551, 38523, 10, 2},
+    {45561, 45576, 15, 3},
+    {45579, 45591, 12, 3},
+    {45594, 45609, 15, 3},
+    {45612, 45633, 21, 2},
+    {45635, 45646, 11, 3},
+    {45649, 45658, 9, 3},
+    {45661, 45672, 11, 3},
+    {45675, 45693, 18, 2},
+    {45695, 45710, 15, 3},
+    {45713, 45728, 15, 3},
+    {45731, 17146, 16, 3},
+    {45747, 45758, 11, 3},
+    {45761, 45768, 7, 3},
+    {45771, 45780, 9, 3},
+    {45783, 6, 2, 1},
+    {45785, 45800, 15, 3},
+    {45803, 45821, 18, 3},
+    {45824, 45842, 18, 3},
+    {45845, 45866, 21, 2},
+    {45868, 45877, 9, 3},
+    {45880, 45895, 15, 3},
+    {45898, 45907, 9, 3},
+    {45910, 45913, 3, 2},
+    {45915, 45927, 12, 3},
+    {45930, 45950, 20, 3},
+    {45953, 45964, 11, 1},
+    {45965, 45982, 17, 3},
+    {45985, 45994, 9, 2},
+    {45996, 31277, 10, 2},
+    {46006, 46021, 15, 3},
+    {46024, 46043, 19, 3},
+    {46046, 46056, 10, 2},
+    {46058, 46065, 7, 2},
+    {46067, 46077, 10, 3},
+    {46080, 14119, 10, 3},
+    {46090, 44970, 9, 2},
+    {46099, 46109, 10, 3},
+    {46112, 46125, 13, 2},
+    {46127, 46138, 11, 1},
+    {46139, 46158, 19, 3},
+    {46161, 46174, 13, 2},
+    {46176, 46194, 18, 2},
+    {46196, 46223, 27, 3},
+    {46226, 46232, 6, 2},
+    {46234, 46246, 12, 2},
+    {46248, 21500, 10, 2},
+    {46258, 46269, 11, 3},
+    {46272, 46281, 9, 3},
+    {46284, 3719, 10, 2},
+    {46294, 46302, 8, 3},
+    {46305, 46312, 7, 2},
+    {46314, 46329, 15, 3},
+    {46332, 46350, 18, 3},
+    {46353, 46363, 10, 2},
+    {46365, 46381, 16, 3},
+    {46384, 21379, 7, 3},
+    {46391, 46406, 15, 3},
+    {46409, 46363, 14, 2},
+    {46423, 46432, 9, 3},
+    {46435, 46443, 8, 2},
+    {46445, 46457, 12, 3},
+    {46460, 46477, 17, 2},
+    {46479, 46483, 4, 3},
+    {46486, 46492, 6, 2},
+    {46494, 46510, 16, 3},
+    {46513, 46531, 18, 2},
+    {46533, 46552, 19, 3},
+    {46555, 46570, 15, 2},
+    {46572, 34556, 16, 2},
+    {46588, 46599, 11, 3},
+    {46602, 46613, 11, 2},
+    {46615, 46621, 6, 2},
+    {46623, 11863, 9, 2},
+    {46632, 46642, 10, 3},
+    {46645, 5251, 8, 2},
+    {46653, 46661, 8, 3},
+    {46664, 46681, 17, 3},
+    {46684, 46696, 12, 3},
+    {46699, 46712, 13, 3},
+    {46715, 46726, 11, 2},
+    {46728, 46737, 9, 3},
+    {46740, 46754, 14, 3},
+    {46757, 46768, 11, 3},
+    {46771, 35996, 17, 2},
+    {46788, 46804, 16, 3},
+    {46807, 22055, 19, 3},
+    {46826, 46852, 26, 3},
+    {46855, 46864, 9, 3},
+    {46867, 46883, 16, 3},
+    {46886, 46900, 14, 3},
+    {46903, 46929, 26, 3},
+    {46932, 46949, 17, 2},
+    {46951, 46962, 11, 3},
+    {46965, 46976, 11, 3},
+    {46979, 21956, 10, 2},
+    {46989, 47009, 20, 3},
+    {47012, 18722, 11, 2},
+    {47023, 47033, 10, 2},
+    {47035, 47043, 8, 2},
+    {47045, 47057, 12, 2},
+    {47059, 47084, 25, 3},
+    {47087, 47095, 8, 3},
+    {47098, 47109, 11, 3},
+    {47112, 47122, 10, 2},
+    {47124, 47144, 20, 3},
+    {47147, 47156, 9, 3},
+    {47159, 47169, 10, 2},
+    {47171, 47180, 9, 3},
+    {47183, 47193, 10, 2},
+    {47195, 47216, 21, 3},
+    {47219, 47236, 17, 3},
+    {47239, 47253, 14, 3},
+    {47256, 47269, 13, 3},
+    {47272, 47281, 9, 3},
+    {47284, 47294, 10, 3},
+    {47297, 47303, 6, 3},
+    {47306, 47319, 13, 3},
+    {47322, 36, 2, 1},
+    {47324, 47331, 7, 3},
+    {47334, 47351, 17, 3},
+    {47354, 27048, 10, 3},
+    {47364, 47382, 18, 2},
+    {47384, 47396, 12, 3},
+    {47399, 47408, 9, 3},
+    {47411, 47423, 12, 2},
+    {47425, 14022, 14, 2},
+    {47439, 47448, 9, 3},
+    {47451, 47470, 19, 2},
+    {47472, 47483, 11, 3},
+    {47486, 47508, 22, 3},
+    {47511, 47527, 16, 3},
+    {47530, 47548, 18, 3},
+    {47551, 47561, 10, 3},
+    {47564, 47574, 10, 3},
+    {47577, 28373, 13, 2},
+    {47590, 47600, 10, 3},
+    {47603, 47613, 10, 2},
+    {47615, 47632, 17, 3},
+    {47635, 47647, 12, 3},
+    {47650, 47657, 7, 2},
+    {47659, 47680, 21, 2},
+    {47682, 47703, 21, 3},
+    {47706, 47721, 15, 3},
+    {47724, 47735, 11, 3},
+    {47738, 47753, 15, 3},
+    {47756, 47762, 6, 2},
+    {47764, 12954, 9, 2},
+    {47773, 47784, 11, 3},
+    {47787, 47799, 12, 3},
+    {47802, 47813, 11, 3},
+    {47816, 47827, 11, 2},
+    {47829, 47839, 10, 3},
+    {47842, 47852, 10, 3},
+    {47855, 47865, 10, 2},
+    {47867, 47879, 12, 2},
+    {47881, 47891, 10, 3},
+    {47894, 47910, 16, 2},
+    {47912, 47920, 8, 2},
+    {47922, 47933, 11, 3},
+    {47936, 47944, 8, 2},
+    {47946, 47963, 17, 2},
+    {47965, 47977, 12, 2},
+    {47979, 47991, 12, 3},
+    {47994, 48005, 11, 2},
+    {48007, 48018, 11, 2},
+    {48020, 25127, 10, 2},
+    {48030, 48040, 10, 3},
+    {48043, 48058, 15, 2},
+    {48060, 9125, 10, 3},
+    {48070, 48089, 19, 3},
+    {48092, 48102, 10, 3},
+    {48105, 12954, 10, 2},
+    {48115, 48125, 10, 1},
+    {48126, 48137, 11, 3},
+    {48140, 7797, 16, 2},
+    {48156, 48165, 9, 3},
+    {48168, 48188, 20, 3},
+    {48191, 48216, 25, 3},
+    {48219, 9356, 10, 2},
+    {48229, 48239, 10, 2},
+    {48241, 48258, 17, 3},
+    {48261, 48281, 20, 3},
+    {48284, 48292, 8, 2},
+    {48294, 48305, 11, 3},
+    {48308, 48317, 9, 3},
+    {48320, 48337, 17, 3},
+    {48340, 48350, 10, 3},
+    {48353, 48367, 14, 2},
+    {48369, 48381, 12, 3},
+    {48384, 48398, 14, 3},
+    {48401, 48412, 11, 3},
+    {48415, 48422, 7, 3},
+    {48425, 48435, 10, 1},
+    {48436, 48444, 8, 3},
+    {48447, 48455, 8, 2},
+    {48457, 48462, 5, 2},
+    {48464, 48471, 7, 3},
+    {48474, 13019, 15, 2},
+    {48489, 48499, 10, 2},
+    {48501, 48518, 17, 3},
+    {48521, 48534, 13, 3},
+    {48537, 48550, 13, 3},
+    {48553, 11772, 16, 3},
+    {48569, 38473, 21, 3},
+    {48590, 48610, 20, 2},
+    {48612, 48621, 9, 3},
+    {48624, 39905, 7, 2},
+    {48631, 48642, 11, 3},
+    {48645, 34783, 10, 2},
+    {48655, 48670, 15, 3},
+    {48673, 48682, 9, 3},
+    {48685, 12954, 19, 2},
+    {48704, 48723, 19, 2},
+    {48725, 48731, 6, 2},
+    {48733, 2504, 2, 1},
+    {48735, 48752, 17, 2},
+    {48754, 9749, 10, 2},
+    {48764, 48778, 14, 3},
+    {48781, 20415, 10, 2},
+    {48791, 1914, 2, 1},
+    {48793, 48808, 15, 2},
+    {48810, 5124, 2, 1},
+    {48812, 17015, 10, 2},
+    {48822, 2357, 16, 2},
+    {48838, 48843, 5, 2},
+    {48845, 48856, 11, 3},
+    {48859, 48880, 21, 3},
+    {48883, 48239, 10, 2},
+    {48893, 25390, 10, 2},
+    {48903, 48910, 7, 3},
+    {48913, 48931, 18, 3},
+    {48934, 48937, 3, 2},
+    {48939, 38161, 16, 3},
+    {48955, 48970, 15, 2},
+    {48972, 48983, 11, 1},
+    {48984, 49005, 21, 3},
+    {49008, 33565, 14, 3},
+    {49022, 49033, 11, 3},
+    {49036, 49053, 17, 3},
+    {49056, 9620, 12, 1},
+    {49068, 49075, 7, 2},
+    {49077, 49087, 10, 3},
+    {49090, 49118, 28, 3},
+    {49121, 49136, 15, 3},
+    {49139, 7063, 16, 3},
+    {49155, 23249, 10, 2},
+    {49165, 49178, 13, 3},
+    {49181, 49188, 7, 3},
+    {49191, 14936, 11, 2},
+    {49202, 49208, 6, 2},
+    {49210, 49227, 17, 3},
+    {49230, 49244, 14, 3},
+    {49247, 49253, 6, 2},
+    {49255, 49262, 7, 2},
+    {49264, 8291, 2, 1},
+    {49266, 49293, 27, 3},
+    {49296, 49306, 10, 3},
+    {49309, 38473, 18, 3},
+    {49327, 49334, 7, 2},
+    {49336, 217, 4, 1},
+    {49340, 35739, 10, 2},
+    {49350, 49360, 10, 3},
+    {49363, 49370, 7, 2},
+    {49372, 49384, 12, 3},
+    {49387, 49396, 9, 3},
+    {49399, 15455, 23, 2},
+    {49422, 49431, 9, 3},
+    {49434, 49448, 14, 2},
+    {49450, 49466, 16, 3},
+    {49469, 49480, 11, 3},
+    {49483, 49490, 7, 2},
+    {49492, 49514, 22, 3},
+    {49517, 49528, 11, 3},
+    {49531, 49552, 21, 3},
+    {49555, 49575, 20, 3},
+    {49578, 27014, 9, 1},
+    {49587, 17697, 15, 2},
+    {49602, 49612, 10, 3},
+    {49615, 18729, 11, 2},
+    {49626, 48018, 10, 2},
+    {49636, 19239, 10, 2},
+    {49646, 49656, 10, 3},
+    {49659, 11349, 14, 3},
+    {49673, 49684, 11, 3},
+    {49687, 49699, 12, 3},
+    {49702, 49713, 11, 3},
+    {49716, 49733, 17, 3},
+    {49736, 49747, 11, 3},
+    {49750, 49772, 22, 3},
+    {49775, 38473, 10, 3},
+    {49785, 18822, 10, 2},
+    {49795, 49801, 6, 3},
+    {49804, 13638, 11, 2},
+    {49815, 49830, 15, 2},
+    {49832, 49854, 22, 2},
+    {49856, 49874, 18, 2},
+    {49876, 49890, 14, 2},
+    {49892, 49903, 11, 3},
+    {49906, 49918, 12, 1},
+    {49919, 49933, 14, 3},
+    {49936, 49944, 8, 2},
+    {49946, 1202, 2, 1},
+    {49948, 49971, 23, 3},
+    {49974, 49978, 4, 2},
+    {49980, 49990, 10, 3},
+    {49993, 24892, 2, 1},
+    {49995, 49998, 3, 2},
+    {50000, 50022, 22, 2},
+    {50024, 50034, 10, 3},
+    {50037, 50059, 22, 3},
+    {50062, 50069, 7, 3},
+    {50072, 50086, 14, 3},
+    {50089, 50108, 19, 3},
+    {50111, 50128, 17, 3},
+    {50131, 26230, 9, 2},
+    {50140, 50150, 10, 3},
+    {50153, 50164, 11, 3},
+    {50167, 50181, 14, 2},
+    {50183, 50194, 11, 3},
+    {50197, 50204, 7, 3},
+    {50207, 50224, 17, 3},
+    {50227, 50247, 20, 3},
+    {50250, 50262, 12, 3},
+    {50265, 50285, 20, 3},
+    {50288, 50294, 6, 2},
+    {50296, 12595, 10, 2},
+    {50306, 1184, 11, 2},
+    {50317, 50343, 26, 3},
+    {50346, 50355, 9, 3},
+    {50358, 50367, 9, 3},
+    {50370, 50387, 17, 3},
+    {50390, 50407, 17, 3},
+    {50410, 50426, 16, 3},
+    {50429, 50442, 13, 3},
+    {50445, 50452, 7, 2},
+    {50454, 50465, 11, 3},
+    {50468, 41858, 11, 2},
+    {50479, 34516, 10, 2},
+    {50489, 50500, 11, 3},
+    {50503, 16010, 15, 2},
+    {50518, 15159, 11, 2},
+    {50529, 16905, 11, 2},
+    {50540, 18358, 11, 3},
+    {50551, 50567, 16, 3},
+    {50570, 50583, 13, 3},
+    {50586, 50594, 8, 3},
+    {50597, 50608, 11, 3},
+    {50611, 2357, 12, 2},
+    {50623, 50637, 14, 2},
+    {50639, 50661, 22, 3},
+    {50664, 50681, 17, 2},
+    {50683, 28238, 11, 2},
+    {50694, 50705, 11, 3},
+    {50708, 5999, 10, 2},
+    {50718, 23991, 11, 2},
+    {50729, 50755, 26, 2},
+    {50757, 50771, 14, 2},
+    {50773, 50783, 10, 2},
+    {50785, 3831, 23, 2},
+    {50808, 50824, 16, 3},
+    {50827, 50836, 9, 2},
+    {50838, 50845, 7, 3},
+    {50848, 50874, 26, 3},
+    {50877, 50896, 19, 3},
+    {50899, 50905, 6, 2},
+    {50907, 50913, 6, 3},
+    {50916, 50933, 17, 3},
+    {50936, 50946, 10, 2},
+    {50948, 50958, 10, 3},
+    {50961, 50987, 26, 3},
+    {50990, 51015, 25, 2},
+    {51017, 51029, 12, 3},
+    {51032, 51052, 20, 3},
+    {51055, 6702, 8, 1},
+    {51063, 51077, 14, 2},
+    {51079, 51089, 10, 3},
+    {51092, 51101, 9, 3},
+    {51104, 51115, 11, 3},
+    {51118, 51131, 13, 3},
+    {51134, 51159, 25, 3},
+    {51162, 51169, 7, 3},
+    {51172, 51184, 12, 3},
+    {51187, 50946, 11, 2},
+    {51198, 51216, 18, 3},
+    {51219, 51225, 6, 2},
+    {51227, 48435, 2, 1},
+    {51229, 51240, 11, 3},
+    {51243, 51264, 21, 2},
+    {51266, 51279, 13, 3},
+    {51282, 51302, 20, 2},
+    {51304, 258, 6, 1},
+    {51310, 51320, 10, 2},
+    {51322, 51344, 22, 2},
+    {51346, 10102, 10, 3},
+    {51356, 51366, 10, 3},
+    {51369, 1450, 11, 2},
+    {51380, 2713, 2, 1},
+    {51382, 4068, 10, 2},
+    {51392, 51412, 20, 3},
+    {51415, 51441, 26, 3},
+    {51444, 51465, 21, 3},
+    {51468, 51475, 7, 2},
+    {51477, 51486, 9, 3},
+    {51489, 51510, 21, 3},
+    {51513, 51533, 20, 3},
+    {51536, 51558, 22, 3},
+    {51561, 30023, 10, 2},
+    {51571, 51583, 12, 3},
+    {51586, 51594, 8, 3},
+    {51597, 46138, 2, 1},
+    {51599, 51607, 8, 2},
+    {51609, 51632, 23, 3},
+    {51635, 51644, 9, 3},
+    {51647, 51657, 10, 3},
+    {51660, 51671, 11, 3},
+    {51674, 51680, 6, 2},
+    {51682, 2592, 2, 1},
+    {51684, 22657, 11, 2},
+    {51695, 29545, 11, 2},
+    {51706, 51716, 10, 3},
+    {51719, 51726, 7, 2},
+    {51728, 51745, 17, 3},
+    {51748, 51757, 9, 3},
+    {51760, 51772, 12, 3},
+    {51775, 12954, 12, 2},
+    {51787, 51798, 11, 3},
+    {51801, 12982, 10, 2},
+    {51811, 51831, 20, 3},
+    {51834, 51845, 11, 3},
+    {51848, 51884, 36, 3},
+    {51887, 51903, 16, 3},
+    {51906, 51912, 6, 2},
+    {51914, 51923, 9, 3},
+    {51926, 51937, 11, 3},
+    {51940, 51962, 22, 2},
+    {51964, 51974, 10, 3},
+    {51977, 5862, 12, 2},
+    {51989, 51998, 9, 2},
+    {52000, 52010, 10, 3},
+    {52013, 52029, 16, 3},
+    {52032, 52044, 12, 2},
+    {52046, 52057, 11, 3},
+    {52060, 52069, 9, 3},
+    {52072, 2135, 19, 2},
+    {52091, 52110, 19, 3},
+    {52113, 1553, 2, 1},
+    {52115, 2357, 19, 2},
+    {52134, 12055, 21, 2},
+    {52155, 52162, 7, 3},
+    {52165, 52172, 7, 3},
+    {52175, 7738, 19, 3},
+    {52194, 49830, 10, 2},
+    {52204, 45269, 10, 2},
+    {52214, 52235, 21, 3},
+    {52238, 45800, 9, 3},
+    {52247, 52256, 9, 3},
+    {52259, 52272, 13, 2},
+    {52274, 52291, 17, 3},
+    {52294, 1932, 8, 2},
+    {52302, 52319, 17, 3},
+    {52322, 35156, 13, 2},
+    {52335, 52342, 7, 3},
+    {52345, 52355, 10, 2},
+    {52357, 52364, 7, 3},
+    {52367, 52383, 16, 3},
+    {52386, 44529, 2, 1},
+    {52388, 52403, 15, 3},
+    {52406, 52416, 10, 3},
+    {52419, 18148, 14, 2},
+    {52433, 52444, 11, 3},
+    {52447, 21379, 14, 3},
+    {52461, 52476, 15, 3},
+    {52479, 52490, 11, 3},
+    {52493, 52503, 10, 2},
+    {52505, 52511, 6, 2},
+    {52513, 52523, 10, 3},
+    {52526, 22723, 8, 3},
+    {52534, 52560, 26, 2},
+    {52562, 52579, 17, 3},
+    {52582, 52608, 26, 3},
+    {52611, 17697, 12, 2},
+    {52623, 13426, 12, 2},
+    {52635, 52643, 8, 3},
+    {52646, 52664, 18, 3},
+    {52667, 52678, 11, 3},
+    {52681, 52705, 24, 3},
+    {52708, 52718, 10, 3},
+    {52721, 52732, 11, 3},
+    {52735, 52743, 8, 3},
+    {52746, 45927, 12, 3},
+    {52758, 52762, 4, 2},
+    {52764, 52775, 11, 2},
+    {52777, 52797, 20, 3},
+    {52800, 52814, 14, 3},
+    {52817, 52828, 11, 3},
+    {52831, 52850, 19, 3},
+    {52853, 52862, 9, 3},
+    {52865, 52873, 8, 3},
+    {52876, 52898, 22, 3},
+    {52901, 52919, 18, 3},
+    {52922, 52936, 14, 3},
+    {52939, 52950, 11, 3},
+    {52953, 52965, 12, 3},
+    {52968, 52979, 11, 3},
+    {52982, 52997, 15, 3},
+    {53000, 53008, 8, 3},
+    {53011, 53027, 16, 3},
+    {53030, 53044, 14, 3},
+    {53047, 53059, 12, 3},
+    {53062, 23770, 12, 2},
+    {53074, 53088, 14, 3},
+    {53091, 53100, 9, 2},
+    {53102, 53115, 13, 3},
+    {53118, 53137, 19, 3},
+    {53140, 53151, 11, 3},
+    {53154, 53165, 11, 3},
+    {53168, 53181, 13, 3},
+    {53184, 53195, 11, 3},
+    {53198, 53209, 11, 3},
+    {53212, 53228, 16, 2},
+    {53230, 53239, 9, 3},
+    {53242, 53252, 10, 1},
+    {53253, 53263, 10, 3},
+    {53266, 53272, 6, 2},
+    {53274, 53289, 15, 3},
+    {53292, 53299, 7, 3},
+    {53302, 53314, 12, 3},
+    {53317, 41346, 10, 2},
+    {53327, 53338, 11, 2},
+    {53340, 53360, 20, 2},
+    {53362, 53371, 9, 3},
+    {53374, 53390, 16, 2},
+    {53392, 53403, 11, 3},
+    {53406, 21379, 10, 3},
+    {53416, 53432, 16, 3},
+    {53435, 53443, 8, 2},
+    {53445, 53453, 8, 2},
+    {53455, 53487, 32, 3},
+    {53490, 53501, 11, 3},
+    {53504, 53529, 25, 3},
+    {53532, 53545, 13, 3},
+    {53548, 53555, 7, 2},
+    {53557, 53571, 14, 3},
+    {53574, 53585, 11, 3},
+    {53588, 53599, 11, 3},
+    {53602, 53612, 10, 3},
+    {53615, 22271, 5, 2},
+    {53620, 53629, 9, 3},
+    {53632, 32412, 7, 3},
+    {53639, 53647, 8, 2},
+    {53649, 53660, 11, 3},
+    {53663, 53674, 11, 3},
+    {53677, 31473, 10, 2},
+    {53687, 53695, 8, 3},
+    {53698, 10780, 6, 3},
+    {53704, 53714, 10, 3},
+    {53717, 53740, 23, 2},
+    {53742, 53752, 10, 2},
+    {53754, 53763, 9, 3},
+    {53766, 53777, 11, 3},
+    {53780, 53788, 8, 2},
+    {53790, 53801, 11, 2},
+    {53803, 53814, 11, 3},
+    {53817, 53831, 14, 3},
+    {53834, 53841, 7, 3},
+    {53844, 53864, 20, 3},
+    {53867, 53883, 16, 3},
+    {53886, 53896, 10, 3},
+    {53899, 7797, 8, 2},
+    {53907, 53918, 11, 3},
+    {53921, 53941, 20, 3},
+    {53944, 53951, 7, 3},
+    {53954, 53964, 10, 3},
+    {53967, 53977, 10, 3},
+    {53980, 53995, 15, 3},
+    {53998, 54015, 17, 3},
+    {54018, 54027, 9, 3},
+    {54030, 54042, 12, 2},
+    {54044, 54060, 16, 2},
+    {54062, 3336, 10, 2},
+    {54072, 54088, 16, 3},
+    {54091, 54105, 14, 2},
+    {54107, 54117, 10, 2},
+    {54119, 54134, 15, 2},
+    {54136, 54156, 20, 3},
+    {54159, 54181, 22, 3},
+    {54184, 54193, 9, 2},
+    {54195, 54209, 14, 3},
+    {54212, 54222, 10, 3},
+    {54225, 54235, 10, 2},
+    {54237, 54246, 9, 3},
+    {54249, 54259, 10, 3},
+    {54262, 54271, 9, 3},
+    {54274, 54285, 11, 3},
+    {54288, 7306, 12, 2},
+    {54300, 54307, 7, 3},
+    {54310, 54319, 9, 3},
+    {54322, 54339, 17, 3},
+    {54342, 25639, 10, 2},
+    {54352, 54363, 11, 3},
+    {54366, 54378, 12, 3},
+    {54381, 54390, 9, 3},
+    {54393, 54401, 8, 3},
+    {54404, 54414, 10, 3},
+    {54417, 54428, 11, 2},
+    {54430, 54440, 10, 3},
+    {54443, 54455, 12, 3},
+    {54458, 54474, 16, 3},
+    {54477, 54487, 10, 3},
+    {54490, 54510, 20, 2},
+    {54512, 54529, 17, 3},
+    {54532, 54544, 12, 2},
+    {54546, 54553, 7, 2},
+    {54555, 7797, 19, 2},
+    {54574, 54585, 11, 3},
+    {54588, 54620, 32, 3},
+    {54623, 54651, 28, 3},
+    {54654, 54660, 6, 2},
+    {54662, 54679, 17, 3},
+    {54682, 54690, 8, 3},
+    {54693, 54705, 12, 3},
+    {54708, 54716, 8, 2},
+    {54718, 54736, 18, 3},
+    {54739, 54753, 14, 3},
+    {54756, 54767, 11, 3},
+    {54770, 15455, 17, 2},
+    {54787, 8442, 12, 2},
+    {54799, 54810, 11, 1},
+    {54811, 54822, 11, 2},
+    {54824, 54844, 20, 3},
+    {54847, 54879, 32, 3},
+    {54882, 54906, 24, 3},
+    {54909, 54920, 11, 2},
+    {54922, 54933, 11, 3},
+    {54936, 54943, 7, 3},
+    {54946, 18789, 10, 2},
+    {54956, 54976, 20, 3},
+    {54979, 54990, 11, 3},
+    {54993, 55004, 11, 3},
+    {55007, 55014, 7, 2},
+    {55016, 55037, 21, 2},
+    {55039, 55046, 7, 3},
+    {55049, 55069, 20, 2},
+    {55071, 55078, 7, 3},
+    {55081, 15455, 13, 2},
+    {55094, 55101, 7, 3},
+    {55104, 55111, 7, 3},
+    {55114, 55125, 11, 3},
+    {55128, 55143, 15, 3},
+    {55146, 55166, 20, 3},
+    {55169, 55187, 18, 2},
+    {55189, 55203, 14, 3},
+    {55206, 43839, 10, 2},
+    {55216, 55227, 11, 1},
+    {55228, 9742, 12, 3},
+    {55240, 55247, 7, 2},
+    {55249, 55266, 17, 2},
+    {55268, 55286, 18, 3},
+    {55289, 55297, 8, 3},
+    {55300, 4866, 11, 3},
+    {55311, 55334, 23, 2},
+    {55336, 55346, 10, 3},
+    {55349, 55364, 15, 3},
+    {55367, 55377, 10, 2},
+    {55379, 55394, 15, 3},
+    {55397, 55413, 16, 3},
+    {55416, 55427, 11, 3},
+    {55430, 55441, 11, 3},
+    {55444, 55447, 3, 2},
+    {55449, 55465, 16, 3},
+    {55468, 55484, 16, 3},
+    {55487, 55498, 11, 2},
+    {55500, 55508, 8, 2},
+    {55510, 55519, 9, 3},
+    {55522, 4427, 10, 2},
+    {55532, 1827, 10, 2},
+    {55542, 55563, 21, 3},
+    {55566, 55578, 12, 3},
+    {55581, 55590, 9, 3},
+    {55593, 55615, 22, 3},
+    {55618, 55624, 6, 2},
+    {55626, 24795, 23, 3},
+    {55649, 55661, 12, 3},
+    {55664, 55684, 20, 3},
+    {55687, 55698, 11, 3},
+    {55701, 1424, 5, 2},
+    {55706, 15502, 10, 2},
+    {55716, 20395, 20, 2},
+    {55736, 221, 5, 1},
+    {55741, 55760, 19, 3},
+    {55763, 55777, 14, 3},
+    {55780, 43718, 10, 2},
+    {55790, 55801, 11, 2},
+    {55803, 55824, 21, 3},
+    {55827, 55838, 11, 3},
+    {55841, 8859, 10, 2},
+    {55851, 55866, 15, 2},
+    {55868, 55884, 16, 2},
+    {55886, 55890, 4, 2},
+    {55892, 55915, 23, 2},
+    {55917, 55926, 9, 3},
+    {55929, 55941, 12, 2},
+    {55943, 55966, 23, 2},
+    {55968, 55978, 10, 3},
+    {55981, 55991, 10, 3},
+    {55994, 56003, 9, 3},
+    {56006, 56018, 12, 3},
+    {56021, 56028, 7, 3},
+    {56031, 56047, 16, 2},
+    {56049, 56057, 8, 3},
+    {56060, 56071, 11, 3},
+    {56074, 56094, 20, 3},
+    {56097, 56119, 22, 3},
+    {56122, 56133, 11, 3},
+    {56136, 56143, 7, 3},
+    {56146, 56156, 10, 3},
+    {56159, 56174, 15, 3},
+    {56177, 29841, 16, 2},
+    {56193, 17263, 10, 2},
+    {56203, 56221, 18, 2},
+    {56223, 56240, 17, 2},
+    {56242, 56251, 9, 3},
+    {56254, 56266, 12, 2},
+    {56268, 56278, 10, 3},
+    {56281, 56291, 10, 2},
+    {56293, 24944, 17, 2},
+    {56310, 56323, 13, 3},
+    {56326, 56337, 11, 2},
+    {56339, 56354, 15, 3},
+    {56357, 3238, 5, 3},
+    {56362, 56372, 10, 3},
+    {56375, 56394, 19, 2},
+    {56396, 56410, 14, 3},
+    {56413, 217, 2, 1},
+    {56415, 53752, 15, 2},
+    {56430, 38373, 19, 2},
+    {56449, 56460, 11, 3},
+    {56463, 56474, 11, 3},
+    {56477, 56488, 11, 3},
+    {56491, 56503, 12, 2},
+    {56505, 56524, 19, 3},
+    {56527, 46726, 10, 2},
+    {56537, 56554, 17, 3},
+    {56557, 45527, 6, 1},
+    {56563, 56573, 10, 2},
+    {56575, 22827, 2, 1},
+    {56577, 56596, 19, 3},
+    {56599, 56626, 27, 3},
+    {56629, 56638, 9, 3},
+    {56641, 56652, 11, 3},
+    {56655, 56670, 15, 3},
+    {56673, 56682, 9, 3},
+    {56685, 56695, 10, 3},
+    {56698, 53299, 10, 3},
+    {56708, 56714, 6, 2},
+    {56716, 56732, 16, 3},
+    {56735, 56748, 13, 3},
+    {56751, 56768, 17, 3},
+    {56771, 56784, 13, 2},
+    {56786, 56798, 12, 3},
+    {56801, 56818, 17, 3},
+    {56821, 56828, 7, 2},
+    {56830, 55377, 11, 2},
+    {56841, 56857, 16, 3},
+    {56860, 1859, 18, 2},
+    {56878, 56895, 17, 3},
+    {56898, 56908, 10, 3},
+    {56911, 56918, 7, 3},
+    {56921, 56935, 14, 3},
+    {56938, 56958, 20, 2},
+    {56960, 1450, 10, 2},
+    {56970, 56980, 10, 3},
+    {56983, 56993, 10, 3},
+    {56996, 57021, 25, 3},
+    {57024, 57035, 11, 3},
+    {57038, 57063, 25, 3},
+    {57066, 258, 2, 1},
+    {57068, 34691, 10, 2},
+    {57078, 57087, 9, 3},
+    {57090, 57103, 13, 3},
+    {57106, 28373, 7, 2},
+    {57113, 57133, 20, 3},
+    {57136, 33338, 5, 3},
+    {57141, 28582, 18, 3},
+    {57159, 57175, 16, 2},
+    {57177, 57186, 9, 3},
+    {57189, 57202, 13, 3},
+    {57205, 57216, 11, 3},
+    {57219, 57232, 13, 3},
+    {57235, 57247, 12, 3},
+    {57250, 54117, 12, 2},
+    {57262, 57266, 4, 2},
+    {57268, 57275, 7, 2},
+    {57277, 57288, 11, 3},
+    {57291, 57302, 11, 3},
+    {57305, 57318, 13, 3},
+    {57321, 57341, 20, 3},
+    {57344, 57354, 10, 2},
+    {57356, 17263, 12, 2},
+    {57368, 57380, 12, 2},
+    {57382, 57392, 10, 3},
+    {57395, 57407, 12, 2},
+    {57409, 25308, 10, 2},
+    {57419, 57431, 12, 3},
+    {57434, 57437, 3, 2},
+    {57439, 57446, 7, 3},
+    {57449, 57462, 13, 3},
+    {57465, 57471, 6, 2},
+    {57473, 30299, 26, 3},
+    {57499, 57508, 9, 3},
+    {57511, 31328, 15, 3},
+    {57526, 57537, 11, 3},
+    {57540, 57550, 10, 2},
+    {57552, 57576, 24, 3},
+    {57579, 57590, 11, 3},
+    {57593, 57606, 13, 3},
+    {57609, 1123, 10, 2},
+    {57619, 57634, 15, 2},
+    {57636, 57650, 14, 3},
+    {57653, 15455, 10, 2},
+    {57663, 57673, 10, 3},
+    {57676, 22769, 10, 2},
+    {57686, 813, 18, 3},
+    {57704, 57713, 9, 3},
+    {57716, 43893, 10, 2},
+    {57726, 40786, 16, 2},
+    {57742, 12954, 6, 2},
+    {57748, 1932, 8, 2},
+    {57756, 55941, 10, 2},
+    {57766, 57772, 6, 2},
+    {57774, 57789, 15, 3},
+    {57792, 23, 2, 1},
+    {57794, 52503, 12, 2},
+    {57806, 57818, 12, 3},
+    {57821, 57833, 12, 3},
+    {57836, 57847, 11, 3},
+    {57850, 57866, 16, 3},
+    {57869, 57884, 15, 3},
+    {57887, 57903, 16, 3},
+    {57906, 57916, 10, 3},
+    {57919, 57929, 10, 3},
+    {57932, 57956, 24, 2},
+    {57958, 16262, 12, 2},
+    {57970, 57986, 16, 2},
+    {57988, 57998, 10, 2},
+    {58000, 58035, 35, 3},
+    {58038, 58051, 13, 3},
+    {58054, 58073, 19, 3},
+    {58076, 51320, 14, 2},
+    {58090, 58101, 11, 3},
+    {58104, 58117, 13, 2},
+    {58119, 58136, 17, 3},
+    {58139, 58151, 12, 3},
+    {58154, 58155, 2, 1},
+    {58156, 58159, 3, 2},
+    {58161, 58169, 8, 3},
+    {58172, 58187, 15, 2},
+    {58189, 58200, 11, 3},
+    {58203, 38400, 17, 3},
+    {58220, 58231, 11, 2},
+    {58233, 58256, 23, 3},
+    {58259, 3831, 14, 2},
+    {58273, 58283, 10, 2},
+    {58285, 58305, 20, 3},
+    {58308, 58326, 18, 3},
+    {58329, 58337, 8, 2},
+    {58339, 2, 2, 1},
+    {58341, 58351, 10, 2},
+    {58353, 12885, 10, 2},
+    {58363, 58385, 22, 3},
+    {58388, 58407, 19, 3},
+    {58410, 58434, 24, 2},
+    {58436, 12954, 16, 2},
+    {58452, 2966, 15, 3},
+    {58467, 58477, 10, 3},
+    {58480, 58495, 15, 3},
+    {58498, 58513, 15, 2},
+    {58515, 58533, 18, 3},
+    {58536, 58546, 10, 2},
+    {58548, 58556, 8, 3},
+    {58559, 58570, 11, 2},
+    {58572, 33321, 3, 1},
+    {58575, 985, 2, 1},
+    {58577, 58595, 18, 3},
+    {58598, 58611, 13, 3},
+    {58614, 58624, 10, 3},
+    {58627, 9368, 13, 2},
+    {58640, 58649, 9, 2},
+    {58651, 36354, 7, 3},
+    {58658, 57550, 10, 2},
+    {58668, 58681, 13, 2},
+    {58683, 58693, 10, 3},
+    {58696, 58702, 6, 2},
+    {58704, 55838, 15, 3},
+    {58719, 58736, 17, 3},
+    {58739, 1698, 10, 2},
+    {58749, 58762, 13, 2},
+    {58764, 38238, 11, 2},
+    {58775, 58781, 6, 2},
+    {58783, 58786, 3, 3},
+    {58789, 58799, 10, 3},
+    {58802, 12511, 10, 2},
+    {58812, 58825, 13, 3},
+    {58828, 58834, 6, 2},
+    {58836, 58856, 20, 3},
+    {58859, 73, 2, 1},
+    {58861, 58872, 11, 3},
+    {58875, 58896, 21, 3},
+    {58899, 58908, 9, 3},
+    {58911, 58922, 11, 3},
+    {58925, 58940, 15, 3},
+    {58943, 58953, 10, 2},
+    {58955, 58969, 14, 3},
+    {58972, 2357, 8, 2},
+    {58980, 58991, 11, 3},
+    {58994, 59005, 11, 3},
+    {59008, 59019, 11, 3},
+    {59022, 59031, 9, 3},
+    {59034, 59048, 14, 3},
+    {59051, 59070, 19, 2},
+    {59072, 59088, 16, 3},
+    {59091, 59100, 9, 2},
+    {59102, 59117, 15, 3},
+    {59120, 59134, 14, 3},
+    {59137, 35739, 14, 2},
+    {59151, 59157, 6, 2},
+    {59159, 58155, 10, 1},
+    {59169, 59182, 13, 3},
+    {59185, 59212, 27, 3},
+    {59215, 23278, 2, 1},
+    {59217, 59224, 7, 3},
+    {59227, 59237, 10, 3},
+    {59240, 59249, 9, 3},
+    {59252, 59271, 19, 3},
+    {59274, 59292, 18, 3},
+    {59295, 42523, 10, 2},
+    {59305, 59316, 11, 3},
+    {59319, 59332, 13, 3},
+    {59335, 3908, 2, 1},
+    {59337, 59354, 17, 3},
+    {59357, 59368, 11, 3},
+    {59371, 1498, 2, 1},
+    {59373, 59384, 11, 3},
+    {59387, 59398, 11, 3},
+    {59401, 59423, 22, 3},
+    {59426, 59436, 10, 3},
+    {59439, 59456, 17, 3},
+    {59459, 30559, 10, 2},
+    {59469, 59480, 11, 3},
+    {59483, 59490, 7, 3},
+    {59493, 59506, 13, 3},
+    {59509, 59522, 13, 2},
+    {59524, 1, 2, 1},
+    {59526, 59536, 10, 2},
+    {59538, 59541, 3, 2},
+    {59543, 59557, 14, 3},
+    {59560, 59577, 17, 2},
+    {59579, 59607, 28, 2},
+    {59609, 59614, 5, 2},
+    {59616, 59627, 11, 2},
+    {59629, 47122, 17, 2},
+    {59646, 59653, 7, 2},
+    {59655, 59663, 8, 2},
+    {59665, 59678, 13, 2},
+    {59680, 59691, 11, 3},
+    {59694, 59715, 21, 3},
+    {59718, 11832, 10, 2},
+    {59728, 32106, 12, 2},
+    {59740, 59752, 12, 3},
+    {59755, 808, 2, 1},
+    {59757, 59767, 10, 3},
+    {59770, 47613, 10, 2},
+    {59780, 59790, 10, 3},
+    {59793, 59807, 14, 3},
+    {59810, 59814, 4, 2},
+    {59816, 22971, 15, 2},
+    {59831, 59837, 6, 2},
+    {59839, 59850, 11, 3},
+    {59853, 59864, 11, 3},
+    {59867, 59876, 9, 3},
+    {59879, 59902, 23, 3},
+    {59905, 49918, 2, 1},
+    {59907, 2856, 2, 1},
+    {59909, 59921, 12, 2},
+    {59923, 5251, 8, 2},
+    {59931, 36339, 12, 3},
+    {59943, 59955, 12, 2},
+    {59957, 59967, 10, 3},
+    {59970, 59989, 19, 3},
+    {59992, 53612, 16, 3},
+    {60008, 60019, 11, 3},
+    {60022, 30709, 11, 3},
+    {60033, 60058, 25, 3},
+    {60061, 60071, 10, 2},
+    {60073, 60084, 11, 3},
+    {60087, 60097, 10, 3},
+    {60100, 60121, 21, 3},
+    {60124, 60133, 9, 3},
+    {60136, 60155, 19, 3},
+    {60158, 60173, 15, 3},
+    {60176, 3834, 2, 1},
+    {60178, 60192, 14, 3},
+    {60195, 60212, 17, 3},
+    {60215, 60228, 13, 3},
+    {60231, 60251, 20, 3},
+    {60254, 1258, 15, 2},
+    {60269, 60275, 6, 2},
+    {60277, 60297, 20, 3},
+    {60300, 60323, 23, 3},
+    {60326, 60338, 12, 3},
+    {60341, 60348, 7, 2},
+    {60350, 34906, 24, 2},
+    {60374, 60381, 7, 2},
+    {60383, 10102, 16, 3},
+    {60399, 30312, 10, 2},
+    {60409, 60418, 9, 3},
+    {60421, 60438, 17, 3},
+    {60441, 60453, 12, 3},
+    {60456, 60466, 10, 3},
+    {60469, 60479, 10, 3},
+    {60482, 60491, 9, 3},
+    {60494, 60519, 25, 3},
+    {60522, 60533, 11, 2},
+    {60535, 8082, 10, 2},
+    {60545, 60556, 11, 3},
+    {60559, 60579, 20, 3},
+    {60582, 60599, 17, 3},
+    {60602, 58953, 14, 2},
+    {60616, 60627, 11, 1},
+    {60628, 45913, 4, 2},
+    {60632, 60639, 7, 2},
+    {60641, 60648, 7, 3},
+    {60651, 60662, 11, 3},
+    {60665, 3429, 10, 2},
+    {60675, 60691, 16, 3},
+    {60694, 60717, 23, 3},
+    {60720, 60731, 11, 3},
+    {60734, 60746, 12, 3},
+    {60749, 60756, 7, 2},
+    {60758, 60766, 8, 3},
+    {60769, 60794, 25, 2},
+    {60796, 60812, 16, 3},
+    {60815, 60827, 12, 3},
+    {60830, 18267, 10, 2},
+    {60840, 29872, 10, 2},
+    {60850, 60856, 6, 3},
+    {60859, 48005, 10, 2},
+    {60869, 60880, 11, 3},
+    {60883, 60893, 10, 3},
+    {60896, 60903, 7, 2},
+    {60905, 60922, 17, 3},
+    {60925, 1424, 10, 2},
+    {60935, 57462, 13, 3},
+    {60948, 60956, 8, 3},
+    {60959, 60977, 18, 3},
+    {60980, 60996, 16, 3},
+    {60999, 61010, 11, 3},
+    {61013, 61024, 11, 3},
+    {61027, 61038, 11, 3},
+    {61041, 61065, 24, 2},
+    {61067, 61074, 7, 3},
+    {61077, 61094, 17, 3},
+    {61097, 39801, 15, 3},
+    {61112, 61118, 6, 3},
+    {61121, 61130, 9, 2},
+    {61132, 61157, 25, 2},
+    {61159, 61167, 8, 2},
+    {61169, 17082, 13, 2},
+    {61182, 59614, 11, 2},
+    {61193, 61206, 13, 3},
+    {61209, 22283, 13, 2},
+    {61222, 61232, 10, 3},
+    {61235, 61271, 36, 3},
+    {61274, 61282, 8, 3},
+    {61285, 4812, 2, 1},
+    {61287, 61298, 11, 3},
+    {61301, 61312, 11, 2},
+    {61314, 61327, 13, 3},
+    {61330, 61345, 15, 2},
+    {61347, 61356, 9, 3},
+    {61359, 61366, 7, 3},
+    {61369, 34556, 12, 2},
+    {61381, 61389, 8, 3},
+    {61392, 61402, 10, 2},
+    {61404, 61428, 24, 3},
+    {61431, 10821, 16, 2},
+    {61447, 61456, 9, 3},
+    {61459, 61468, 9, 3},
+    {61471, 61478, 7, 2},
+    {61480, 61493, 13, 3},
+    {61496, 61504, 8, 3},
+    {61507, 61516, 9, 3},
+    {61519, 38238, 5, 2},
+    {61524, 31686, 10, 2},
+    {61534, 61549, 15, 2},
+    {61551, 27823, 12, 2},
+    {61563, 61575, 12, 3},
+    {61578, 61598, 20, 3},
+    {61601, 61618, 17, 3},
+    {61621, 61637, 16, 3},
+    {61640, 61649, 9, 3},
+    {61652, 61662, 10, 3},
+    {61665, 61681, 16, 3},
+    {61684, 61695, 11, 3},
+    {61698, 61713, 15, 3},
+    {61716, 61731, 15, 3},
+    {61734, 24564, 13, 3},
+    {61747, 61753, 6, 2},
+    {61755, 61769, 14, 3},
+    {61772, 52775, 10, 2},
+    {61782, 61785, 3, 2},
+    {61787, 2135, 9, 2},
+    {61796, 61817, 21, 2},
+    {61819, 61828, 9, 3},
+    {61831, 61851, 20, 3},
+    {61854, 61866, 12, 2},
+    {61868, 61878, 10, 3},
+    {61881, 61892, 11, 3},
+    {61895, 61910, 15, 3},
+    {61913, 57986, 10, 2},
+    {61923, 61930, 7, 3},
+    {61933, 44600, 17, 3},
+    {61950, 33204, 10, 3},
+    {61960, 61973, 13, 2},
+    {61975, 61982, 7, 3},
+    {61985, 10868, 14, 2},
+    {61999, 62010, 11, 3},
+    {62013, 62025, 12, 3},
+    {62028, 35956, 15, 2},
+    {62043, 62064, 21, 2},
+    {62066, 62081, 15, 3},
+    {62084, 62101, 17, 3},
+    {62104, 62115, 11, 2},
+    {62117, 62126, 9, 3},
+    {62129, 62142, 13, 3},
+    {62145, 58546, 10, 2},
+    {62155, 62166, 11, 3},
+    {62169, 56337, 10, 2},
+    {62179, 62199, 20, 2},
+    {62201, 62220, 19, 2},
+    {62222, 28162, 12, 3},
+    {62234, 62253, 19, 3},
+    {62256, 62267, 11, 3},
+    {62270, 62273, 3, 2},
+    {62275, 62290, 15, 3},
+    {62293, 62313, 20, 3},
+    {62316, 62324, 8, 3},
+    {62327, 62336, 9, 3},
+    {62339, 7235, 9, 2},
+    {62348, 62368, 20, 3},
+    {62371, 62381, 10, 3},
+    {62384, 62388, 4, 2},
+    {62390, 58351, 13, 2},
+    {62403, 62419, 16, 3},
+    {62422, 62432, 10, 3},
+    {62435, 2459, 14, 2},
+    {62449, 62469, 20, 2},
+    {62471, 62483, 12, 3},
+    {62486, 23337, 5, 2},
+    {62491, 62501, 10, 3},
+    {62504, 62516, 12, 2},
+    {62518, 62526, 8, 2},
+    {62528, 53545, 7, 3},
+    {62535, 62553, 18, 3},
+    {62556, 62568, 12, 3},
+    {62571, 62588, 17, 3},
+    {62591, 47193, 11, 2},
+    {62602, 3494, 9, 2},
+    {62611, 62623, 12, 3},
+    {62626, 62633, 7, 2},
+    {62635, 62644, 9, 2}
+};
@@ -0,0 +1,251 @@
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+#include <math.h>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define LAYOUT_KERNELS_X86
+#endif
+
+#include "layout_kernels.h"
+
+using namespace std;
+
+namespace
+{
+    using dists_kernel_t = void (*)(const coordinates_t&, const boxes_coordinates_t&, size_t, size_t, float*);
+    using mask_kernel_t = void (*)(const coordinates_t&, const boxes_coordinates_t&, size_t, size_t, float, uint32_t*);
+
+    coordinates_t get_box(const boxes_coordinates_t &boxes, size_t i)
+    {
+        return coordinates_t(boxes.x0[i], boxes.y0[i], boxes.x1[i], boxes.y1[i]);
+    }
+
+    void get_dists_scalar(const coordinates_t &obj,
+                          const boxes_coordinates_t &boxes,
+                          size_t first,
+                          size_t n,
+                          float *result)
+    {
+        for (size_t i = 0; i < n; ++i) result[i] = get_dist(obj, get_box(boxes, first + i));
+    }
+
+    //sets bits of boxes first + begin..first + n - 1
+    void set_neighbour_bits(const coordinates_t &obj,
+                            const boxes_coordinates_t &boxes,
+                            size_t first,
+                            size_t begin,
+                            size_t n,
+                            float margin_ratio,
+                            uint32_t *mask)
+    {
+        for (size_t i = begin; i < n; ++i)
+        {
+            if (!is_neighbour_lines(get_box(boxes, first + i), obj, margin_ratio)) continue;
+            mask[i / 32] |= uint32_t(1) << (i % 32);
+        }
+    }
+
+#ifndef LAYOUT_KERNELS_X86
+    void get_neighbour_lines_mask_scalar(const coordinates_t &obj,
+                                         const boxes_coordinates_t &boxes,
+                                         size_t first,
+                                         size_t n,
+                                         float margin_ratio,
+                                         uint32_t *mask)
+    {
+        set_neighbour_bits(obj, boxes, first, 0, n, margin_ratio, mask);
+    }
+#endif
+
+#ifdef LAYOUT_KERNELS_X86
+    //min and max take the second argument if comparison fails, so arguments go in order which gives std::min and
+    //std::max results. Products and sums are not fused, every operation is rounded like in scalar code
+    void get_dists_sse2(const coordinates_t &obj,
+                        const boxes_coordinates_t &boxes,
+                        size_t first,
+                        size_t n,
+                        float *result)
+    {
+        const float area = (obj.x1 - obj.x0) * (obj.y1 - obj.y0);
+        const __m128 x0 = _mm_set1_ps(obj.x0), y0 = _mm_set1_ps(obj.y0);
+        const __m128 x1 = _mm_set1_ps(obj.x1), y1 = _mm_set1_ps(obj.y1), obj_area = _mm_set1_ps(area);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128 box_x0 = _mm_loadu_ps(&boxes.x0[first + i]), box_y0 = _mm_loadu_ps(&boxes.y0[first + i]);
+            const __m128 box_x1 = _mm_loadu_ps(&boxes.x1[first + i]), box_y1 = _mm_loadu_ps(&boxes.y1[first + i]);
+            const __m128 w = _mm_sub_ps(_mm_max_ps(box_x1, x1), _mm_min_ps(box_x0, x0));
+            const __m128 h = _mm_sub_ps(_mm_max_ps(box_y1, y1), _mm_min_ps(box_y0, y0));
+            const __m128 box_area = _mm_mul_ps(_mm_sub_ps(box_x1, box_x0), _mm_sub_ps(box_y1, box_y0));
+            _mm_storeu_ps(result + i, _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(w, h), obj_area), box_area));
+        }
+        get_dists_scalar(obj, boxes, first + i, n - i, result + i);
+    }
+
+    void get_neighbour_lines_mask_sse2(const coordinates_t &obj,
+                                       const boxes_coordinates_t &boxes,
+                                       size_t first,
+                                       size_t n,
+                                       float margin_ratio,
+                                       uint32_t *mask)
+    {
+        const __m128 sign = _mm_set1_ps(-0.0f), ratio = _mm_set1_ps(margin_ratio);
+        const __m128 x0 = _mm_set1_ps(obj.x0), y0 = _mm_set1_ps(obj.y0);
+        const __m128 x1 = _mm_set1_ps(obj.x1), y1 = _mm_set1_ps(obj.y1), h = _mm_set1_ps(obj.y1 - obj.y0);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128 box_x0 = _mm_loadu_ps(&boxes.x0[first + i]), box_y0 = _mm_loadu_ps(&boxes.y0[first + i]);
+            const __m128 box_x1 = _mm_loadu_ps(&boxes.x1[first + i]), box_y1 = _mm_loadu_ps(&boxes.y1[first + i]);
+            const __m128 box_h = _mm_sub_ps(box_y1, box_y0);
+            const __m128 d = _mm_mul_ps(ratio, _mm_max_ps(h, box_h));
+            __m128 result = _mm_cmplt_ps(_mm_andnot_ps(sign, _mm_sub_ps(box_h, h)), d);
+            result = _mm_and_ps(result, _mm_cmpgt_ps(x1, box_x0));
+            result = _mm_and_ps(result, _mm_cmplt_ps(x0, box_x1));
+            result = _mm_and_ps(result, _mm_cmplt_ps(y0, _mm_add_ps(box_y1, d)));
+            result = _mm_and_ps(result, _mm_cmpgt_ps(y1, _mm_sub_ps(box_y0, d)));
+            result = _mm_and_ps(result, _mm_or_ps(_mm_cmplt_ps(_mm_andnot_ps(sign, _mm_sub_ps(box_x0, x0)), d),
+                                                  _mm_cmplt_ps(_mm_andnot_ps(sign, _mm_sub_ps(box_x1, x1)), d)));
+            mask[i / 32] |= uint32_t(_mm_movemask_ps(result)) << (i % 32);
+        }
+        set_neighbour_bits(obj, boxes, first, i, n, margin_ratio, mask);
+    }
+
+    __attribute__((target("avx2")))
+    void get_dists_avx2(const coordinates_t &obj,
+                        const boxes_coordinates_t &boxes,
+                        size_t first,
+                        size_t n,
+                        float *result)
+    {
+        const float area = (obj.x1 - obj.x0) * (obj.y1 - obj.y0);
+        const __m256 x0 = _mm256_set1_ps(obj.x0), y0 = _mm256_set1_ps(obj.y0);
+        const __m256 x1 = _mm256_set1_ps(obj.x1), y1 = _mm256_set1_ps(obj.y1), obj_area = _mm256_set1_ps(area);
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            const __m256 box_x0 = _mm256_loadu_ps(&boxes.x0[first + i]), box_y0 = _mm256_loadu_ps(&boxes.y0[first + i]);
+            const __m256 box_x1 = _mm256_loadu_ps(&boxes.x1[first + i]), box_y1 = _mm256_loadu_ps(&boxes.y1[first + i]);
+            const __m256 w = _mm256_sub_ps(_mm256_max_ps(box_x1, x1), _mm256_min_ps(box_x0, x0));
+            const __m256 h = _mm256_sub_ps(_mm256_max_ps(box_y1, y1), _mm256_min_ps(box_y0, y0));
+            const __m256 box_area = _mm256_mul_ps(_mm256_sub_ps(box_x1, box_x0), _mm256_sub_ps(box_y1, box_y0));
+            _mm256_storeu_ps(result + i, _mm256_sub_ps(_mm256_sub_ps(_mm256_mul_ps(w, h), obj_area), box_area));
+        }
+        get_dists_sse2(obj, boxes, first + i, n - i, result + i);
+    }
+
+    __attribute__((target("avx2")))
+    void get_neighbour_lines_mask_avx2(const coordinates_t &obj,
+                                       const boxes_coordinates_t &boxes,
+                                       size_t first,
+                                       size_t n,
+                                       float margin_ratio,
+                                       uint32_t *mask)
+    {
+        const __m256 sign = _mm256_set1_ps(-0.0f), ratio = _mm256_set1_ps(margin_ratio);
+        const __m256 x0 = _mm256_set1_ps(obj.x0), y0 = _mm256_set1_ps(obj.y0);
+        const __m256 x1 = _mm256_set1_ps(obj.x1), y1 = _mm256_set1_ps(obj.y1), h = _mm256_set1_ps(obj.y1 - obj.y0);
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            const __m256 box_x0 = _mm256_loadu_ps(&boxes.x0[first + i]), box_y0 = _mm256_loadu_ps(&boxes.y0[first + i]);
+            const __m256 box_x1 = _mm256_loadu_ps(&boxes.x1[first + i]), box_y1 = _mm256_loadu_ps(&boxes.y1[first + i]);
+            const __m256 box_h = _mm256_sub_ps(box_y1, box_y0);
+            const __m256 d = _mm256_mul_ps(ratio, _mm256_max_ps(h, box_h));
+            const __m256 x0_shift = _mm256_andnot_ps(sign, _mm256_sub_ps(box_x0, x0));
+            const __m256 x1_shift = _mm256_andnot_ps(sign, _mm256_sub_ps(box_x1, x1));
+            __m256 result = _mm256_cmp_ps(_mm256_andnot_ps(sign, _mm256_sub_ps(box_h, h)), d, _CMP_LT_OQ);
+            result = _mm256_and_ps(result, _mm256_cmp_ps(x1, box_x0, _CMP_GT_OQ));
+            result = _mm256_and_ps(result, _mm256_cmp_ps(x0, box_x1, _CMP_LT_OQ));
+            result = _mm256_and_ps(result, _mm256_cmp_ps(y0, _mm256_add_ps(box_y1, d), _CMP_LT_OQ));
+            result = _mm256_and_ps(result, _mm256_cmp_ps(y1, _mm256_sub_ps(box_y0, d), _CMP_GT_OQ));
+            result = _mm256_and_ps(result, _mm256_or_ps(_mm256_cmp_ps(x0_shift, d, _CMP_LT_OQ),
+                                                        _mm256_cmp_ps(x1_shift, d, _CMP_LT_OQ)));
+            mask[i / 32] |= uint32_t(_mm256_movemask_ps(result)) << (i % 32);
+        }
+        set_neighbour_bits(obj, boxes, first, i, n, margin_ratio, mask);
+    }
+#endif
+
+    dists_kernel_t get_dists_kernel()
+    {
+#ifdef LAYOUT_KERNELS_X86
+        return __builtin_cpu_supports("avx2")? get_dists_avx2 : get_dists_sse2;
+#else
+        return get_dists_scalar;
+#endif
+    }
+
+    mask_kernel_t get_mask_kernel()
+    {
+#ifdef LAYOUT_KERNELS_X86
+        return __builtin_cpu_supports("avx2")? get_neighbour_lines_mask_avx2 : get_neighbour_lines_mask_sse2;
+#else
+        return get_neighbour_lines_mask_scalar;
+#endif
+    }
+}
+
+void boxes_coordinates_t::reserve(size_t size)
+{
+    x0.reserve(size);
+    y0.reserve(size);
+    x1.reserve(size);
+    y1.reserve(size);
+}
+
+void boxes_coordinates_t::push_back(const coordinates_t &obj)
+{
+    x0.push_back(obj.x0);
+    y0.push_back(obj.y0);
+    x1.push_back(obj.x1);
+    y1.push_back(obj.y1);
+}
+
+void boxes_coordinates_t::set(size_t i, const coordinates_t &obj)
+{
+    x0[i] = obj.x0;
+    y0[i] = obj.y0;
+    x1[i] = obj.x1;
+    y1[i] = obj.y1;
+}
+
+void boxes_coordinates_t::erase(size_t i)
+{
+    x0.erase(x0.begin() + i);
+    y0.erase(y0.begin() + i);
+    x1.erase(x1.begin() + i);
+    y1.erase(y1.begin() + i);
+}
+
+float get_dist(const coordinates_t &obj1, const coordinates_t &obj2)
+{
+    float x0 = min(obj1.x0, obj2.x0);
+    float y0 = min(obj1.y0, obj2.y0);
+    float x1 = max(obj1.x1, obj2.x1);
+    float y1 = max(obj1.y1, obj2.y1);
+    float area1 = (obj1.x1 - obj1.x0) * (obj1.y1 - obj1.y0);
+    float area2 = (obj2.x1 - obj2.x0) * (obj2.y1 - obj2.y0);
+    return (x1 - x0) * (y1 - y0) - area1 - area2;
+}
+
+void get_dists(const coordinates_t &obj, const boxes_coordinates_t &boxes, size_t first, size_t n, float *result)
+{
+    static const dists_kernel_t kernel = get_dists_kernel();
+    kernel(obj, boxes, first, n, result);
+}
+
+void get_neighbour_lines_mask(const coordinates_t &obj,
+                              const boxes_coordinates_t &boxes,
+                              size_t first,
+                              size_t n,
+                              float margin_ratio,
+                              uint32_t *mask)
+{
+    static const mask_kernel_t kernel = get_mask_kernel();
+    fill(mask, mask + (n + 31) / 32, 0);
+    kernel(obj, boxes, first, n, margin_ratio, mask);
+}
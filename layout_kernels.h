@@ -0,0 +1,62 @@
+#ifndef LAYOUT_KERNELS_H
+#define LAYOUT_KERNELS_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+#include "coordinates.h"
+
+//coordinates of boxes by components in separate arrays, so kernels check one box against many boxes at once
+struct boxes_coordinates_t
+{
+    void reserve(size_t size);
+    void push_back(const coordinates_t &obj);
+    void set(size_t i, const coordinates_t &obj);
+    void erase(size_t i);
+    size_t size() const
+    {
+        return x0.size();
+    }
+
+    std::vector<float> x0;
+    std::vector<float> y0;
+    std::vector<float> x1;
+    std::vector<float> y1;
+};
+
+//area of common bounding rectangle of two boxes minus areas of both boxes
+float get_dist(const coordinates_t &obj1, const coordinates_t &obj2);
+
+//lines are neighbours if heights differ less than margin, lines overlap horizontally, vertical gap and shift of
+//left or right edges are less than margin. Margin is margin_ratio of the higher line
+inline bool is_neighbour_lines(const coordinates_t &obj1, const coordinates_t &obj2, float margin_ratio)
+{
+    float height1 = obj1.y1 - obj1.y0, height2 = obj2.y1 - obj2.y0;
+    float d = margin_ratio * std::max(height1, height2);
+    if (std::fabs(height1 - height2) < d &&
+        obj2.x1 > obj1.x0 && obj2.x0 < obj1.x1 &&
+        obj2.y0 < obj1.y1 + d && obj2.y1 > obj1.y0 - d &&
+        (std::fabs(obj1.x0 - obj2.x0) < d ||
+         std::fabs(obj1.x1 - obj2.x1) < d))
+    {
+        return true;
+    }
+    return false;
+}
+
+//result[i] is get_dist(obj, box first + i) for n boxes. Kernels use AVX2 or SSE2 when cpu has them,
+//results are the same as of scalar functions
+void get_dists(const coordinates_t &obj, const boxes_coordinates_t &boxes, size_t first, size_t n, float *result);
+
+//bit i % 32 of mask[i / 32] is is_neighbour_lines(box first + i, obj, margin_ratio) for n boxes
+void get_neighbour_lines_mask(const coordinates_t &obj,
+                              const boxes_coordinates_t &boxes,
+                              size_t first,
+                              size_t n,
+                              float margin_ratio,
+                              uint32_t *mask);
+
+#endif //LAYOUT_KERNELS_H
@@ -0,0 +1,1067 @@
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <queue>
+#include <limits>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
+
+#include <math.h>
+
+#include "common.h"
+#include "coordinates.h"
+#include "utf.h"
+#include "page_layout.h"
+#include "layout_kernels.h"
+
+using namespace std;
+
+namespace
+{
+    //pair of boxes to group, obj1 is the box whose row holds the pair. c is 1 if pair was skipped because other box
+    //lies between them. order is the order of the row, pairs of earlier rows go first among equal distances
+    struct dist_t
+    {
+        dist_t(unsigned char c_arg,
+               float d_arg,
+               size_t obj1_arg,
+               size_t obj2_arg,
+               size_t order_arg) noexcept : d(d_arg), obj1(obj1_arg), obj2(obj2_arg), order(order_arg), c(c_arg)
+        {
+        }
+        float d;
+        size_t obj1;
+        size_t obj2;
+        size_t order;
+        unsigned char c;
+    };
+
+    enum : size_t { NONE = numeric_limits<size_t>::max() };
+    constexpr float LINE_OVERLAP = 0.5;
+    constexpr float CHAR_MARGIN = 2.0;
+    constexpr float WORD_MARGIN = 0.1;
+    constexpr float LINE_MARGIN = 0.5;
+    constexpr float BOXES_FLOW = 0.5;
+
+    bool operator>(const dist_t &obj1, const dist_t &obj2)
+    {
+        if (obj1.c != obj2.c) return obj1.c > obj2.c;
+        if (obj1.d != obj2.d) return obj1.d > obj2.d;
+        if (obj1.order != obj2.order) return obj1.order > obj2.order;
+        return obj1.obj2 > obj2.obj2;
+    }
+
+    //per-page storage of layout. Text of lines is written once to buffer, text of box is chain of pieces of buffer,
+    //so boxes are joined without copying of strings. Lines and boxes of all steps are parallel arrays,
+    //steps pass their indexes
+    struct arena_t
+    {
+        arena_t() : buffer(1, '\n')
+        {
+        }
+
+        size_t add_box(const coordinates_t &coordinates_arg, size_t string_len)
+        {
+            coordinates.push_back(coordinates_arg);
+            string_lens.push_back(string_len);
+            empty.push_back(0);
+            first_pieces.push_back(NONE);
+            last_pieces.push_back(NONE);
+            return coordinates.size() - 1;
+        }
+
+        void add_text(size_t box, size_t offset, size_t length)
+        {
+            offsets.push_back(offset);
+            lengths.push_back(length);
+            next_pieces.push_back(NONE);
+            const size_t piece = offsets.size() - 1;
+            if (first_pieces[box] == NONE) first_pieces[box] = piece;
+            else next_pieces[last_pieces[box]] = piece;
+            last_pieces[box] = piece;
+        }
+
+        void add_newline(size_t box)
+        {
+            add_text(box, NEWLINE, 1);
+        }
+
+        //moves text of box2 to the end of text of box1
+        void join_texts(size_t box1, size_t box2)
+        {
+            if (first_pieces[box2] == NONE) return;
+            if (first_pieces[box1] == NONE) first_pieces[box1] = first_pieces[box2];
+            else next_pieces[last_pieces[box1]] = first_pieces[box2];
+            last_pieces[box1] = last_pieces[box2];
+            first_pieces[box2] = last_pieces[box2] = NONE;
+        }
+
+        string get_text(size_t box) const
+        {
+            size_t length = 0;
+            for (size_t i = first_pieces[box]; i != NONE; i = next_pieces[i]) length += lengths[i];
+            string result;
+            result.reserve(length);
+            for (size_t i = first_pieces[box]; i != NONE; i = next_pieces[i])
+            {
+                result.append(buffer, offsets[i], lengths[i]);
+            }
+            return result;
+        }
+
+        enum { NEWLINE = 0 };
+        //'\n' at NEWLINE is shared by all boxes
+        string buffer;
+        vector<coordinates_t> coordinates;
+        vector<size_t> string_lens;
+        vector<unsigned char> empty;
+        vector<size_t> first_pieces;
+        vector<size_t> last_pieces;
+        //pieces of text: offset and length in buffer, the next piece of the same box
+        vector<size_t> offsets;
+        vector<size_t> lengths;
+        vector<size_t> next_pieces;
+    };
+
+    float height(const coordinates_t &obj)
+    {
+        return obj.y1 - obj.y0;
+    }
+
+    float width(const run_t &obj)
+    {
+        return (obj.coordinates.x1 - obj.coordinates.x0) / obj.string_len;
+    }
+
+    float width(const coordinates_t &obj)
+    {
+        return obj.x1 - obj.x0;
+    }
+
+    bool is_zero_string(const coordinates_t &coordinates)
+    {
+        return width(coordinates) <= 0 || height(coordinates) <= 0;
+    }
+
+    //boxes by cells of their lower left corners. Box lies inside of rectangle only if its corner lies inside,
+    //so only cells covered by rectangle are checked
+    class BoxesGrid
+    {
+    public:
+        explicit BoxesGrid(const vector<coordinates_t> &coordinates_arg) : coordinates(coordinates_arg),
+                                                                           x0(numeric_limits<float>::max()),
+                                                                           y0(numeric_limits<float>::max()),
+                                                                           cell_width(1),
+                                                                           cell_height(1),
+                                                                           size(max(sqrt(coordinates.size()), 1.0)),
+                                                                           cells(size * size),
+                                                                           box_cells(coordinates.size()),
+                                                                           positions(coordinates.size())
+        {
+            float x1 = numeric_limits<float>::lowest(), y1 = numeric_limits<float>::lowest();
+            for (const coordinates_t &coord : coordinates)
+            {
+                if (!isfinite(coord.x0) || !isfinite(coord.y0)) continue;
+                x0 = min(x0, coord.x0);
+                y0 = min(y0, coord.y0);
+                x1 = max(x1, coord.x0);
+                y1 = max(y1, coord.y0);
+            }
+            if (x1 > x0) cell_width = (x1 - x0) / size;
+            if (y1 > y0) cell_height = (y1 - y0) / size;
+            for (size_t i = 0; i < coordinates.size(); ++i) add(i);
+        }
+
+        void add(size_t box)
+        {
+            const size_t cell = get_index(coordinates[box].y0, y0, cell_height) * size +
+                                get_index(coordinates[box].x0, x0, cell_width);
+            box_cells[box] = cell;
+            positions[box] = cells[cell].size();
+            cells[cell].push_back(box);
+        }
+
+        void remove(size_t box)
+        {
+            vector<size_t> &cell = cells[box_cells[box]];
+            positions[cell.back()] = positions[box];
+            cell[positions[box]] = cell.back();
+            cell.pop_back();
+        }
+
+        //true if other box lies inside of bounding rectangle of obj1 and obj2
+        bool is_between(size_t obj1, size_t obj2) const
+        {
+            float x0 = min(coordinates[obj1].x0, coordinates[obj2].x0);
+            float y0 = min(coordinates[obj1].y0, coordinates[obj2].y0);
+            float x1 = max(coordinates[obj1].x1, coordinates[obj2].x1);
+            float y1 = max(coordinates[obj1].y1, coordinates[obj2].y1);
+            const size_t last_column = get_index(x1, this->x0, cell_width);
+            const size_t last_row = get_index(y1, this->y0, cell_height);
+            for (size_t row = get_index(y0, this->y0, cell_height); row <= last_row; ++row)
+            {
+                for (size_t column = get_index(x0, this->x0, cell_width); column <= last_column; ++column)
+                {
+                    for (size_t i : cells[row * size + column])
+                    {
+                        const coordinates_t &coord = coordinates[i];
+                        if (coord.x0 >= x0 && coord.y0 >= y0 && coord.x1 <= x1 && coord.y1 <= y1 &&
+                            !(coord == coordinates[obj1]) && !(coord == coordinates[obj2])) return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+    private:
+        //index is monotonic, so corners inside of range get indexes inside of range of its ends
+        size_t get_index(float val, float start, float cell) const
+        {
+            float index = (val - start) / cell;
+            if (!(index > 0)) return 0;
+            if (index >= size) return size - 1;
+            return index;
+        }
+
+        const vector<coordinates_t> &coordinates;
+        float x0;
+        float y0;
+        float cell_width;
+        float cell_height;
+        size_t size;
+        vector<vector<size_t>> cells;
+        vector<size_t> box_cells;
+        vector<size_t> positions;
+    };
+
+    bool is_voverlap(const coordinates_t &obj1, const coordinates_t &obj2)
+    {
+        return obj2.y0 <= obj1.y1 && obj1.y0 <= obj2.y1;
+    }
+
+    bool is_hoverlap(const coordinates_t &obj1, const coordinates_t &obj2)
+    {
+        return obj2.x0 <= obj1.x1 && obj1.x0 <= obj2.x1;
+    }
+
+    float voverlap(const coordinates_t &obj1, const coordinates_t &obj2)
+    {
+        return is_voverlap(obj1, obj2)? min(fabs(obj1.y0 - obj2.y1), fabs(obj1.y1 - obj2.y0)) : 0;
+    }
+
+    float hdistance(const coordinates_t &obj1, const coordinates_t &obj2)
+    {
+        return is_hoverlap(obj1, obj2)? 0 : min(fabs(obj1.x0 - obj2.x1), fabs(obj1.x1 - obj2.x0));
+    }
+
+    //runs of one chunk follow each other on the same line, so chunks are aligned when the last run
+    //of the first chunk is aligned with the first run of the second one
+    bool is_halign(const run_t &obj1, const run_t &obj2)
+    {
+        int y0_0 = static_cast<int>(obj1.coordinates.y0);
+        int y0_1 = static_cast<int>(obj1.coordinates.y1);
+        int y1_0 = static_cast<int>(obj2.coordinates.y0);
+        int y1_1 = static_cast<int>(obj2.coordinates.y1);
+        return (y0_0 == y1_0 && y0_1 == y1_1) || (is_voverlap(obj1.coordinates, obj2.coordinates) &&
+               (min(height(obj1.coordinates), height(obj2.coordinates)) * LINE_OVERLAP <
+                voverlap(obj1.coordinates, obj2.coordinates)) &&
+                (hdistance(obj1.coordinates, obj2.coordinates) < max(width(obj1), width(obj2)) * CHAR_MARGIN));
+
+    }
+
+    //some pdf strings have zero width or height. Every such box is joined with the following ones
+    //up to the next such box
+    void group_zero_lines(arena_t &arena, const vector<size_t> &lines)
+    {
+        auto is_zero = [&arena](size_t line) { return is_zero_string(arena.coordinates[line]); };
+        for (auto first_it = find_if(lines.begin(), lines.end(), is_zero); first_it != lines.end();)
+        {
+            auto last_it = find_if(first_it + 1, lines.end(), is_zero);
+            coordinates_t &coordinates = arena.coordinates[*first_it];
+            for (auto it = first_it + 1; it < last_it; ++it)
+            {
+                const coordinates_t &obj = arena.coordinates[*it];
+                arena.join_texts(*first_it, *it);
+                if (coordinates.x0 > obj.x0) coordinates.x0 = obj.x0;
+                if (coordinates.x1 < obj.x1) coordinates.x1 = obj.x1;
+                if (coordinates.y0 > obj.y0) coordinates.y0 = obj.y0;
+                if (coordinates.y1 < obj.y1) coordinates.y1 = obj.y1;
+                arena.string_lens[*first_it] += arena.string_lens[*it];
+                arena.empty[*it] = 1;
+            }
+            first_it = last_it;
+        }
+    }
+
+    void clear_empty_strings(const arena_t &arena, vector<size_t> &lines)
+    {
+        lines.erase(remove_if(lines.begin(),
+                              lines.end(),
+                              [&arena](size_t line) {
+                                  return arena.string_lens[line] == 0 || arena.empty[line];
+                              }),
+                    lines.end());
+    }
+
+    size_t merge_lines(arena_t &arena, vector<size_t> &&lines)
+    {
+        group_zero_lines(arena, lines);
+        clear_empty_strings(arena, lines);
+        sort(lines.begin(), lines.end(),
+             [&arena](size_t a, size_t b) -> bool
+             {
+                 const coordinates_t &coordinates_a = arena.coordinates[a], &coordinates_b = arena.coordinates[b];
+                 if (coordinates_a.y1 != coordinates_b.y1) return coordinates_a.y1 > coordinates_b.y1;
+                 return coordinates_a.x0 < coordinates_b.x0;
+             });
+        coordinates_t coordinates = arena.coordinates[lines[0]];
+        size_t string_len = arena.string_lens[lines[0]];
+        for (size_t i = 1; i < lines.size(); ++i)
+        {
+            const coordinates_t &obj = arena.coordinates[lines[i]];
+            if (obj.x0 < coordinates.x0) coordinates.x0 = obj.x0;
+            if (obj.x1 > coordinates.x1) coordinates.x1 = obj.x1;
+            if (obj.y0 < coordinates.y0) coordinates.y0 = obj.y0;
+            if (obj.y1 > coordinates.y1) coordinates.y1 = obj.y1;
+            string_len += arena.string_lens[lines[i]];
+        }
+        const size_t result = arena.add_box(coordinates, string_len);
+        for (size_t line : lines)
+        {
+            arena.join_texts(result, line);
+            arena.add_newline(result);
+        }
+        return result;
+    }
+
+    bool is_word_gap(const run_t &prev, const run_t &run)
+    {
+        return prev.coordinates.x1 < run.coordinates.x0 - max(height(run.coordinates), width(run)) * WORD_MARGIN;
+    }
+
+    //raw text breaks line when string starts left of the previous one or its baseline moves by more than half of height
+    bool is_raw_break(const run_t &prev, const run_t &run)
+    {
+        const coordinates_t &obj1 = prev.coordinates, &obj2 = run.coordinates;
+        return obj2.x0 < obj1.x0 || fabs(obj2.y0 - obj1.y0) > LINE_MARGIN * max(height(obj1), height(obj2));
+    }
+
+    //chunks first..last - 1 make one line. Words are separated by space if there is gap between them
+    size_t add_line(arena_t &arena, const text_chunk_t * const *first, const text_chunk_t * const *last)
+    {
+        coordinates_t coordinates = (*first)->coordinates;
+        size_t string_len = (*first)->string_len;
+        for (const text_chunk_t * const *it = first + 1; it < last; ++it)
+        {
+            const coordinates_t &obj = (*it)->coordinates;
+            if (obj.x0 < coordinates.x0) coordinates.x0 = obj.x0;
+            if (obj.x1 > coordinates.x1) coordinates.x1 = obj.x1;
+            if (obj.y0 < coordinates.y0) coordinates.y0 = obj.y0;
+            if (obj.y1 > coordinates.y1) coordinates.y1 = obj.y1;
+            string_len += (*it)->string_len;
+        }
+        /* sort of texts by x0 is REMOVED because of weird coordinates like
+        1.2016-012-Kleinberg-etal_MIT-Center_Hobbs.pdf
+        2.Power and the news media.pdf
+        next text has previous x coordinates
+        */
+        const size_t offset = arena.buffer.length();
+        for (const text_chunk_t * const *it = first; it < last; ++it)
+        {
+            if (it != first && is_word_gap((*(it - 1))->last_run, (*it)->first_run)) arena.buffer += ' ';
+            arena.buffer += (*it)->text;
+        }
+        const size_t result = arena.add_box(coordinates, string_len);
+        arena.add_text(result, offset, arena.buffer.length() - offset);
+        return result;
+    }
+
+    //chunks following each other on the same line are joined to lines
+    vector<size_t> make_text_lines(arena_t &arena, const vector<text_chunk_t> &chunks)
+    {
+        vector<const text_chunk_t*> symbols;
+        symbols.reserve(chunks.size());
+        size_t length = arena.buffer.length();
+        for (const text_chunk_t &chunk : chunks)
+        {
+            if (chunk.is_empty || chunk.string_len == 0) continue;
+            symbols.push_back(&chunk);
+            length += chunk.text.length() + 1;
+        }
+        arena.buffer.reserve(length);
+        vector<size_t> result;
+        for (size_t i = 0; i < symbols.size();)
+        {
+            size_t j = i + 1;
+            while (j < symbols.size() && is_halign(symbols[j - 1]->last_run, symbols[j]->first_run)) ++j;
+            result.push_back(add_line(arena, symbols.data() + i, symbols.data() + j));
+            i = j;
+        }
+        return result;
+    }
+
+    //lines in order of content stream
+    string render_lines(const arena_t &arena, const vector<size_t> &lines)
+    {
+        string result;
+        for (size_t line : lines)
+        {
+            result += arena.get_text(line);
+            result += '\n';
+        }
+        return result;
+    }
+
+    //strings in order of content stream. Line is broken when string starts left of the previous one or its baseline
+    //moves by more than half of height, words are separated like in lines
+    string render_raw(const vector<text_chunk_t> &chunks)
+    {
+        string result;
+        const text_chunk_t *prev = nullptr;
+        for (const text_chunk_t &chunk : chunks)
+        {
+            if (chunk.is_empty || chunk.string_len == 0) continue;
+            if (prev)
+            {
+                if (is_raw_break(prev->last_run, chunk.first_run)) result += '\n';
+                else if (is_word_gap(prev->last_run, chunk.first_run)) result += ' ';
+            }
+            result += chunk.text;
+            prev = &chunk;
+        }
+        if (prev) result += '\n';
+        return result;
+    }
+
+    //lines sorted by y0. Heights of neighbour lines differ less than twice and vertical margin is less than height,
+    //so neighbours of line are in band of its 4 heights around it. Lines with non-positive or not finite height
+    //are never neighbours and are not indexed. Lines are taken by boxes one by one
+    class LinesIndex
+    {
+    public:
+        LinesIndex(const arena_t &arena_arg, const vector<size_t> &lines_arg) : arena(arena_arg),
+                                                                                lines(lines_arg),
+                                                                                taken(lines.size(), 0)
+        {
+            for (size_t i = 0; i < lines.size(); ++i)
+            {
+                const coordinates_t &coord = arena.coordinates[lines[i]];
+                if (isfinite(coord.y0) && isfinite(coord.y1) && coord.y1 > coord.y0) sorted.push_back(i);
+            }
+            sort(sorted.begin(), sorted.end(), [this](size_t i1, size_t i2)
+            {
+                const float y1 = arena.coordinates[lines[i1]].y0, y2 = arena.coordinates[lines[i2]].y0;
+                if (y1 != y2) return y1 < y2;
+                return i1 < i2;
+            });
+            ys.reserve(sorted.size());
+            sorted_coordinates.reserve(sorted.size());
+            for (size_t i : sorted)
+            {
+                ys.push_back(arena.coordinates[lines[i]].y0);
+                sorted_coordinates.push_back(arena.coordinates[lines[i]]);
+            }
+        }
+
+        bool is_taken(size_t i) const
+        {
+            return taken[i];
+        }
+
+        void take(size_t i)
+        {
+            taken[i] = 1;
+        }
+
+        //takes neighbours of line which are not taken yet and appends them in order of lines
+        void take_neighbours(const coordinates_t &line, vector<size_t> &result)
+        {
+            const float h = height(line);
+            if (!(h > 0) || !isfinite(h)) return;
+            const double start = static_cast<double>(line.y0) - 4.0 * h;
+            const double end = static_cast<double>(line.y1) + 4.0 * h;
+            const size_t size = result.size();
+            const size_t first = lower_bound(ys.begin(), ys.end(), start) - ys.begin();
+            size_t last = first;
+            while (last < ys.size() && ys[last] <= end) ++last;
+            //short bands are checked one by one, long ones by kernel
+            if (last - first < SHORT_BAND)
+            {
+                for (size_t i = first; i < last; ++i)
+                {
+                    const size_t j = sorted[i];
+                    if (taken[j] || !is_neighbour_lines(arena.coordinates[lines[j]], line, LINE_MARGIN)) continue;
+                    result.push_back(j);
+                }
+            }
+            else
+            {
+                mask.resize((last - first + 31) / 32);
+                get_neighbour_lines_mask(line, sorted_coordinates, first, last - first, LINE_MARGIN, mask.data());
+                for (size_t i = 0; i < mask.size(); ++i)
+                {
+                    for (uint32_t bits = mask[i]; bits != 0; bits &= bits - 1)
+                    {
+                        const size_t j = sorted[first + i * 32 + __builtin_ctz(bits)];
+                        if (!taken[j]) result.push_back(j);
+                    }
+                }
+            }
+            sort(result.begin() + size, result.end());
+            for (auto it = result.begin() + size; it != result.end(); ++it)
+            {
+                take(*it);
+                *it = lines[*it];
+            }
+        }
+
+    private:
+        enum : size_t { SHORT_BAND = 16 };
+
+        const arena_t &arena;
+        const vector<size_t> &lines;
+        vector<unsigned char> taken;
+        vector<size_t> sorted;
+        vector<double> ys;
+        boxes_coordinates_t sorted_coordinates;
+        vector<uint32_t> mask;
+    };
+
+    //lines of box of line start: its neighbours, their neighbours and so on
+    vector<size_t> get_neighbour_lines(const arena_t &arena,
+                                       LinesIndex &index,
+                                       const vector<size_t> &lines,
+                                       size_t start)
+    {
+        vector<size_t> result{lines[start]};
+        index.take(start);
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            index.take_neighbours(arena.coordinates[result[i]], result);
+        }
+        return result;
+    }
+
+    //splits part of lines by empty cells of coarse occupancy grid along x or along y. Lines of different parts are
+    //never neighbours: empty column means no horizontal overlap, empty rows are higher than vertical margin of lines.
+    //Parts keep order of lines
+    bool cut_tiles(const arena_t &arena,
+                   const vector<size_t> &lines,
+                   const vector<size_t> &part,
+                   bool columns,
+                   vector<vector<size_t>> &parts)
+    {
+        enum : size_t { TILE_GRID = 256 };
+        auto get_range = [&](size_t i)
+        {
+            const coordinates_t &coord = arena.coordinates[lines[i]];
+            return columns? make_pair(min(coord.x0, coord.x1), max(coord.x0, coord.x1)) : make_pair(coord.y0, coord.y1);
+        };
+        float start = numeric_limits<float>::max(), end = numeric_limits<float>::lowest(), max_height = 0;
+        for (size_t i : part)
+        {
+            const pair<float, float> range = get_range(i);
+            start = min(start, range.first);
+            end = max(end, range.second);
+            max_height = max(max_height, height(arena.coordinates[lines[i]]));
+        }
+        const float cell_size = (end - start) / TILE_GRID;
+        if (!(cell_size > 0) || !isfinite(cell_size)) return false;
+        auto get_cell = [&](float val) { return min(static_cast<size_t>((val - start) / cell_size), TILE_GRID - 1); };
+        vector<int> cover(TILE_GRID + 1, 0);
+        for (size_t i : part)
+        {
+            const pair<float, float> range = get_range(i);
+            ++cover[get_cell(range.first)];
+            --cover[get_cell(range.second) + 1];
+        }
+        //rows are twice as high as needed because of rounding of cells
+        const size_t min_gap = columns? 1 : max(static_cast<size_t>(ceil(2 * LINE_MARGIN * max_height / cell_size)),
+                                                size_t(1));
+        vector<size_t> part_of_cell(TILE_GRID);
+        size_t parts_num = 0, gap = 0;
+        int depth = 0;
+        for (size_t i = 0; i < TILE_GRID; ++i)
+        {
+            depth += cover[i];
+            if (depth == 0)
+            {
+                ++gap;
+                continue;
+            }
+            if (parts_num == 0 || gap >= min_gap) ++parts_num;
+            gap = 0;
+            part_of_cell[i] = parts_num - 1;
+        }
+        if (parts_num < 2) return false;
+        const size_t first = parts.size();
+        parts.resize(first + parts_num);
+        for (size_t i : part) parts[first + part_of_cell[get_cell(get_range(i).first)]].push_back(i);
+        return true;
+    }
+
+    //positions of lines split to tiles by whitespace gutters, so lines of box are always in the same tile.
+    //Lines which are never neighbours go to the last tile, if some lines can't be put to grid page is one tile
+    vector<vector<size_t>> make_tiles(const arena_t &arena, const vector<size_t> &lines)
+    {
+        enum : size_t { MIN_TILED_LINES = 512 };
+        vector<vector<size_t>> result;
+        vector<size_t> single;
+        vector<vector<size_t>> stack(1);
+        for (size_t i = 0; i < lines.size(); ++i)
+        {
+            const coordinates_t &coord = arena.coordinates[lines[i]];
+            if (!isfinite(coord.y0) || !isfinite(coord.y1) || coord.y1 <= coord.y0)
+            {
+                single.push_back(i);
+                continue;
+            }
+            if (!isfinite(coord.x0) || !isfinite(coord.x1))
+            {
+                stack.clear();
+                break;
+            }
+            stack[0].push_back(i);
+        }
+        if (stack.empty() || lines.size() < MIN_TILED_LINES)
+        {
+            result.emplace_back(lines.size());
+            for (size_t i = 0; i < lines.size(); ++i) result[0][i] = i;
+            return result;
+        }
+        while (!stack.empty())
+        {
+            vector<size_t> part = std::move(stack.back());
+            stack.pop_back();
+            if (part.size() < MIN_TILED_LINES ||
+                (!cut_tiles(arena, lines, part, true, stack) && !cut_tiles(arena, lines, part, false, stack)))
+            {
+                result.push_back(std::move(part));
+            }
+        }
+        result.push_back(std::move(single));
+        return result;
+    }
+
+    //lines of boxes of tile by their first lines. Lines of box are its first line, its neighbours, their neighbours
+    //and so on
+    vector<pair<size_t, vector<size_t>>> get_boxes_lines(const arena_t &arena,
+                                                         const vector<size_t> &lines,
+                                                         const vector<size_t> &tile)
+    {
+        vector<size_t> tile_lines;
+        tile_lines.reserve(tile.size());
+        for (size_t i : tile) tile_lines.push_back(lines[i]);
+        LinesIndex index(arena, tile_lines);
+        vector<pair<size_t, vector<size_t>>> result;
+        for (size_t i = 0; i < tile_lines.size(); ++i)
+        {
+            if (index.is_taken(i)) continue;
+            result.emplace_back(tile[i], get_neighbour_lines(arena, index, tile_lines, i));
+        }
+        return result;
+    }
+
+    //calls f(0)..f(n - 1) on up to threads threads. The first exception is rethrown
+    void run_parallel(size_t n, unsigned int threads, const function<void(size_t)> &f)
+    {
+        threads = min<size_t>(threads, n);
+        if (threads <= 1)
+        {
+            for (size_t i = 0; i < n; ++i) f(i);
+            return;
+        }
+        atomic<size_t> next(0);
+        exception_ptr error;
+        mutex error_mutex;
+        auto work = [&]()
+        {
+            try
+            {
+                for (size_t i = next++; i < n; i = next++) f(i);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> lock(error_mutex);
+                if (!error) error = current_exception();
+                next = n;
+            }
+        };
+        vector<thread> workers;
+        workers.reserve(threads - 1);
+        for (unsigned int i = 1; i < threads; ++i) workers.emplace_back(work);
+        work();
+        for (thread &worker : workers) worker.join();
+        if (error) rethrow_exception(error);
+    }
+
+    //tiles are laid out independently and their boxes go in order of the first lines of boxes, which is the order
+    //of layout of page as a whole, so text doesn't depend on tiles and threads
+    vector<size_t> make_text_boxes(arena_t &arena, const vector<size_t> &lines, unsigned int threads)
+    {
+        const vector<vector<size_t>> tiles = make_tiles(arena, lines);
+        vector<vector<pair<size_t, vector<size_t>>>> tiles_boxes(tiles.size());
+        run_parallel(tiles.size(), threads, [&](size_t i)
+        {
+            tiles_boxes[i] = get_boxes_lines(arena, lines, tiles[i]);
+        });
+        vector<pair<size_t, vector<size_t>>> boxes_lines;
+        if (tiles_boxes.size() == 1)
+        {
+            boxes_lines = std::move(tiles_boxes[0]);
+        }
+        else
+        {
+            for (vector<pair<size_t, vector<size_t>>> &tile_boxes : tiles_boxes)
+            {
+                boxes_lines.insert(boxes_lines.end(), std::make_move_iterator(tile_boxes.begin()),
+                                   std::make_move_iterator(tile_boxes.end()));
+            }
+            sort(boxes_lines.begin(), boxes_lines.end(),
+                 [](const pair<size_t, vector<size_t>> &p1, const pair<size_t, vector<size_t>> &p2)
+                 {
+                     return p1.first < p2.first;
+                 });
+        }
+        vector<size_t> text_boxes;
+        text_boxes.reserve(boxes_lines.size());
+        for (pair<size_t, vector<size_t>> &p : boxes_lines)
+        {
+            text_boxes.push_back(merge_lines(arena, std::move(p.second)));
+        }
+        group_zero_lines(arena, text_boxes);
+        clear_empty_strings(arena, text_boxes);
+        return text_boxes;
+    }
+
+    vector<coordinates_t> get_coordinates(const arena_t &arena, const vector<size_t> &boxes)
+    {
+        vector<coordinates_t> result;
+        result.reserve(boxes.size());
+        for (size_t box : boxes) result.push_back(arena.coordinates[box]);
+        return result;
+    }
+
+    //boxes are grouped by pairs, the closest pair goes first. Box gets row of pairs when it is created:
+    //initial boxes with the following ones, groups with all boxes. Every row keeps a few of its closest pairs,
+    //heap holds the closest of them. Pairs of grouped boxes are skipped, row is looked through again
+    //when all its kept pairs are gone. Boxes are numbered by their order in boxes, group takes number of one of its
+    //boxes and keeps chain of its initial boxes
+    class PlaneMaker
+    {
+    public:
+        PlaneMaker(arena_t &arena_arg, const vector<size_t> &boxes_arg) : arena(arena_arg),
+                                                                          boxes(boxes_arg),
+                                                                          coordinates(get_coordinates(arena, boxes)),
+                                                                          initial_coordinates(coordinates),
+                                                                          grid(coordinates),
+                                                                          next_boxes(boxes.size(), NONE),
+                                                                          last_boxes(boxes.size()),
+                                                                          births(boxes.size(), 0),
+                                                                          skipped(boxes.size()),
+                                                                          rows(boxes.size()),
+                                                                          live(boxes.size()),
+                                                                          merges(0)
+        {
+            for (size_t i = 0; i < boxes.size(); ++i)
+            {
+                last_boxes[i] = i;
+                live[i] = i;
+                live_coordinates.push_back(coordinates[i]);
+            }
+            for (size_t i = 0; i < boxes.size(); ++i) push_row(i);
+        }
+
+        //returns box of arena holding the last group
+        size_t make()
+        {
+            while (!heap.empty())
+            {
+                const dist_t dist = heap.top();
+                heap.pop();
+                if (births[dist.obj1] == REMOVED || get_order(dist.obj1) != dist.order) continue;
+                rows[dist.obj1].pop_back();
+                if (!is_pair(dist.obj1, dist.obj2))
+                {
+                    push_row(dist.obj1);
+                    continue;
+                }
+                if (dist.c == 0 && grid.is_between(dist.obj1, dist.obj2))
+                {
+                    vector<size_t> &row_skipped = skipped[dist.obj1];
+                    row_skipped.insert(upper_bound(row_skipped.begin(), row_skipped.end(), dist.obj2), dist.obj2);
+                    push_row(dist.obj1);
+                    continue;
+                }
+                grid.remove(dist.obj1);
+                grid.remove(dist.obj2);
+                size_t group = create_group(dist.obj1, dist.obj2);
+                grid.add(group);
+                for (size_t obj : {dist.obj1, dist.obj2})
+                {
+                    births[obj] = REMOVED;
+                    rows[obj].clear();
+                    skipped[obj].clear();
+                }
+                live_coordinates.set(get_live_position(group), coordinates[group]);
+                const size_t removed = get_live_position((group == dist.obj1)? dist.obj2 : dist.obj1);
+                live.erase(live.begin() + removed);
+                live_coordinates.erase(removed);
+                births[group] = ++merges;
+                push_row(group);
+            }
+            for (size_t i = 0; i < boxes.size(); ++i)
+            {
+                if (births[i] != REMOVED) return boxes[i];
+            }
+            throw pdf_error(FUNC_STRING + "all objects are moved");
+        }
+
+    private:
+        enum : size_t { ROW_PAIRS = 16, REMOVED = numeric_limits<size_t>::max() };
+
+        size_t get_order(size_t box) const
+        {
+            return (births[box] == 0)? box : boxes.size() + births[box];
+        }
+
+        size_t get_live_position(size_t box) const
+        {
+            return lower_bound(live.begin(), live.end(), box) - live.begin();
+        }
+
+        //true if pair is in row of obj1
+        bool is_pair(size_t obj1, size_t obj2) const
+        {
+            if (obj2 == obj1 || births[obj2] == REMOVED) return false;
+            if (births[obj1] == 0) return births[obj2] == 0 && obj2 > obj1;
+            return births[obj2] < births[obj1];
+        }
+
+        //pushes the closest kept pair of row to heap. Kept pairs are sorted, the closest one is the last
+        void push_row(size_t box)
+        {
+            vector<dist_t> &row = rows[box];
+            while (!row.empty() && !is_pair(box, row.back().obj2)) row.pop_back();
+            if (row.empty()) fill_row(box);
+            if (!row.empty()) heap.push(row.back());
+        }
+
+        void fill_row(size_t box)
+        {
+            vector<dist_t> &row = rows[box];
+            const vector<size_t> &row_skipped = skipped[box];
+            const size_t order = get_order(box);
+            //live boxes are sorted, initial boxes pair only with the following ones
+            const size_t first = (births[box] == 0)? upper_bound(live.begin(), live.end(), box) - live.begin() : 0;
+            dists.resize(live.size() - first);
+            get_dists(coordinates[box], live_coordinates, first, dists.size(), dists.data());
+            for (size_t k = 0; k < dists.size(); ++k)
+            {
+                const size_t i = live[first + k];
+                if (!is_pair(box, i)) continue;
+                float d = dists[k];
+                //broken coordinates go last
+                if (isnan(d)) d = numeric_limits<float>::infinity();
+                if (row.size() == ROW_PAIRS && row.front().c == 0 && d > row.front().d) continue;
+                const bool is_skipped = !row_skipped.empty() &&
+                                        binary_search(row_skipped.begin(), row_skipped.end(), i);
+                const unsigned char c = is_skipped? 1 : 0;
+                const dist_t dist(c, d, box, i, order);
+                if (row.size() == ROW_PAIRS && !(row.front() > dist)) continue;
+                if (row.size() == ROW_PAIRS) row.erase(row.begin());
+                row.insert(upper_bound(row.begin(), row.end(), dist, greater<dist_t>()), dist);
+            }
+        }
+
+        //the upper box gets the other one, its bounds grow by initial boxes of the other one
+        size_t create_group(size_t obj1, size_t obj2)
+        {
+            float pos1 = (1 - BOXES_FLOW) * (coordinates[obj1].x0) -
+                         (1 + BOXES_FLOW) * (coordinates[obj1].y0 + coordinates[obj1].y1);
+            float pos2 = (1 - BOXES_FLOW) * (coordinates[obj2].x0) -
+                         (1 + BOXES_FLOW) * (coordinates[obj2].y0 + coordinates[obj2].y1);
+            size_t o1 = (pos1 <= pos2)? obj1 : obj2;
+            size_t o2 = (pos1 <= pos2)? obj2 : obj1;
+
+            coordinates_t &group = coordinates[o1];
+            for (size_t i = o2; i != NONE; i = next_boxes[i])
+            {
+                const coordinates_t &obj = initial_coordinates[i];
+                if (obj.x0 < group.x0) group.x0 = obj.x0;
+                if (obj.x1 > group.x1) group.x1 = obj.x1;
+                if (obj.y0 < group.y0) group.y0 = obj.y0;
+                if (obj.y1 > group.y1) group.y1 = obj.y1;
+            }
+            next_boxes[last_boxes[o1]] = o2;
+            last_boxes[o1] = last_boxes[o2];
+            arena.join_texts(boxes[o1], boxes[o2]);
+            return o1;
+        }
+
+        arena_t &arena;
+        const vector<size_t> &boxes;
+        vector<coordinates_t> coordinates;
+        vector<coordinates_t> initial_coordinates;
+        BoxesGrid grid;
+        //chains of initial boxes of groups
+        vector<size_t> next_boxes;
+        vector<size_t> last_boxes;
+        //number of merge which created box, 0 for initial boxes
+        vector<size_t> births;
+        //sorted boxes of row which are skipped once because other box lies between them
+        vector<vector<size_t>> skipped;
+        vector<vector<dist_t>> rows;
+        //sorted boxes which are not grouped yet and their coordinates
+        vector<size_t> live;
+        boxes_coordinates_t live_coordinates;
+        vector<float> dists;
+        size_t merges;
+        priority_queue<dist_t, vector<dist_t>, greater<dist_t>> heap;
+    };
+
+    //orders text boxes of page and joins their text, returns box holding it
+    using plane_engine_t = size_t (*)(arena_t &arena, const vector<size_t> &boxes);
+
+    size_t make_plane(arena_t &arena, const vector<size_t> &boxes)
+    {
+        return PlaneMaker(arena, boxes).make();
+    }
+
+    //splits boxes by the widest gaps between their projections to x axis (columns, left to right) or to y axis
+    //(blocks, top down), gaps of nearly the same width are cut together. Returns width of the widest gap,
+    //parts are appended in reading order
+    float cut_boxes(const arena_t &arena, vector<size_t> boxes, bool columns, vector<vector<size_t>> &parts)
+    {
+        constexpr float SAME_GAP = 0.99;
+        auto get_start = [&](size_t box) -> float
+        {
+            const coordinates_t &coord = arena.coordinates[box];
+            return columns? min(coord.x0, coord.x1) : -max(coord.y0, coord.y1);
+        };
+        auto get_end = [&](size_t box) -> float
+        {
+            const coordinates_t &coord = arena.coordinates[box];
+            return columns? max(coord.x0, coord.x1) : -min(coord.y0, coord.y1);
+        };
+        stable_sort(boxes.begin(), boxes.end(), [&](size_t box1, size_t box2)
+        {
+            return get_start(box1) < get_start(box2);
+        });
+        //gaps[i] is the gap before boxes[i]
+        vector<float> gaps(boxes.size(), 0);
+        float result = 0;
+        float end = get_end(boxes[0]);
+        for (size_t i = 1; i < boxes.size(); ++i)
+        {
+            const float start = get_start(boxes[i]);
+            if (start > end)
+            {
+                gaps[i] = start - end;
+                result = max(result, gaps[i]);
+            }
+            end = max(end, get_end(boxes[i]));
+        }
+        parts.emplace_back();
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            if (gaps[i] > 0 && gaps[i] >= result * SAME_GAP) parts.emplace_back();
+            parts.back().push_back(boxes[i]);
+        }
+        return result;
+    }
+
+    //recursive XY-cut: boxes are split by the widest whitespace gap, either across the page or between columns,
+    //until no gap is left. Boxes of such part go by their tops. Boxes with not finite coordinates go last
+    size_t make_xy_cut(arena_t &arena, const vector<size_t> &boxes)
+    {
+        vector<size_t> order;
+        order.reserve(boxes.size());
+        vector<size_t> broken;
+        vector<vector<size_t>> stack(1);
+        for (size_t box : boxes)
+        {
+            const coordinates_t &coord = arena.coordinates[box];
+            const bool is_finite = isfinite(coord.x0) && isfinite(coord.y0) && isfinite(coord.x1) && isfinite(coord.y1);
+            (is_finite? stack[0] : broken).push_back(box);
+        }
+        while (!stack.empty())
+        {
+            vector<size_t> part = std::move(stack.back());
+            stack.pop_back();
+            if (part.empty()) continue;
+            vector<vector<size_t>> columns, blocks;
+            const float column_gap = cut_boxes(arena, part, true, columns);
+            const float block_gap = cut_boxes(arena, part, false, blocks);
+            if (columns.size() == 1 && blocks.size() == 1)
+            {
+                stable_sort(part.begin(), part.end(), [&arena](size_t box1, size_t box2)
+                {
+                    const coordinates_t &coord1 = arena.coordinates[box1], &coord2 = arena.coordinates[box2];
+                    if (coord1.y1 != coord2.y1) return coord1.y1 > coord2.y1;
+                    return coord1.x0 < coord2.x0;
+                });
+                order.insert(order.end(), part.begin(), part.end());
+                continue;
+            }
+            vector<vector<size_t>> &parts = (blocks.size() > 1 && block_gap >= column_gap)? blocks : columns;
+            for (auto it = parts.rbegin(); it != parts.rend(); ++it) stack.push_back(std::move(*it));
+        }
+        order.insert(order.end(), broken.begin(), broken.end());
+        for (size_t i = 1; i < order.size(); ++i) arena.join_texts(order[0], order[i]);
+        return order[0];
+    }
+
+    plane_engine_t get_plane_engine(pdf_extractor_engine_t engine, size_t boxes_num)
+    {
+        switch (engine)
+        {
+        case PDF_EXTRACTOR_ENGINE_GROUPS:
+            return make_plane;
+        case PDF_EXTRACTOR_ENGINE_XY_CUT:
+            return make_xy_cut;
+        default:
+            return (boxes_num > PDF_EXTRACTOR_MAX_GROUPED_BOXES)? make_xy_cut : make_plane;
+        }
+    }
+}
+
+string render_text(const vector<text_chunk_t> &chunks, const pdf_extractor_options_t &options)
+{
+    if (options.layout == PDF_EXTRACTOR_LAYOUT_RAW) return render_raw(chunks);
+    arena_t arena;
+    if (options.layout == PDF_EXTRACTOR_LAYOUT_LINES) return render_lines(arena, make_text_lines(arena, chunks));
+    const vector<size_t> boxes = make_text_boxes(arena, make_text_lines(arena, chunks), options.threads);
+    if (boxes.empty()) return string();
+    return arena.get_text(get_plane_engine(options.engine, boxes.size())(arena, boxes));
+}
+
+void add_chunk(vector<text_chunk_t> &chunks, text_chunk_t &&chunk)
+{
+    if (chunk.is_empty || chunk.string_len == 0) return;
+    auto is_finite = [](const coordinates_t &obj)
+    {
+        return isfinite(obj.x0) && isfinite(obj.y0) && isfinite(obj.x1) && isfinite(obj.y1);
+    };
+    //runs are joined only if every tier would put them on one line with the same separator
+    if (chunks.empty() || !is_finite(chunks.back().coordinates) || !is_finite(chunk.coordinates) ||
+        !is_halign(chunks.back().last_run, chunk.first_run) || is_raw_break(chunks.back().last_run, chunk.first_run))
+    {
+        chunks.push_back(std::move(chunk));
+        return;
+    }
+    text_chunk_t &prev = chunks.back();
+    if (is_word_gap(prev.last_run, chunk.first_run)) prev.text += ' ';
+    prev.text += chunk.text;
+    const coordinates_t &obj = chunk.coordinates;
+    if (obj.x0 < prev.coordinates.x0) prev.coordinates.x0 = obj.x0;
+    if (obj.x1 > prev.coordinates.x1) prev.coordinates.x1 = obj.x1;
+    if (obj.y0 < prev.coordinates.y0) prev.coordinates.y0 = obj.y0;
+    if (obj.y1 > prev.coordinates.y1) prev.coordinates.y1 = obj.y1;
+    prev.string_len += chunk.string_len;
+    prev.last_run = chunk.last_run;
+}
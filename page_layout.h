@@ -0,0 +1,20 @@
+#ifndef PAGE_LAYOUT_H
+#define PAGE_LAYOUT_H
+
+#include <string>
+#include <vector>
+
+#include "coordinates.h"
+#include "pdf_extractor.h"
+
+//text of page laid out up to the tier of options. Chunks on the same line are joined to lines, neighbour lines
+//to text boxes and boxes are put in reading order by engine of options
+std::string render_text(const std::vector<text_chunk_t> &chunks, const pdf_extractor_options_t &options);
+
+//appends chunk of interpreted string to chunks of page. Chunk which is surely on the same line with the last one
+//is joined to it with space between words, so layout gets less chunks and renders the same text.
+//Empty chunks are dropped
+void add_chunk(std::vector<text_chunk_t> &chunks, text_chunk_t &&chunk);
+
+
+#endif //PAGE_LAYOUT_H
@@ -3,10 +3,11 @@
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
+#include <map>
+#include <memory>
 #include <boost/optional.hpp>
 #include <exception>
-
-#include <math.h>
+#include <limits>
 
 #include "common.h"
 #include "object_storage.h"
@@ -16,50 +17,34 @@
 #include "cmap.h"
 #include "pages_extractor.h"
 #include "coordinates.h"
-#include "font_file2.h"
-#include "font_file.h"
+#include "cmap_cache.h"
 #include "converter_engine.h"
+#include "page_layout.h"
+#include "utf.h"
+#include "struct_tree.h"
 
 using namespace std;
 using namespace boost;
 
 namespace
 {
-    struct dist_t
-    {
-        dist_t(unsigned char c_arg,
-               float d_arg,
-               size_t obj1_arg,
-               size_t obj2_arg) noexcept : d(d_arg), obj1(obj1_arg), obj2(obj2_arg), c(c_arg)
-        {
-        }
-        float d;
-        size_t obj1;
-        size_t obj2;
-        unsigned char c;
-    };
-
-    enum { MATRIX_ELEMENTS_NUM = 6, PDF_STRINGS_NUM = 5000 /*for optimization*/, MAX_BOXES = 300, MAX_XOBJECT_NESTED = 30 };
-    constexpr float LINE_OVERLAP = 0.5;
-    constexpr float CHAR_MARGIN = 2.0;
-    constexpr float WORD_MARGIN = 0.1;
-    constexpr float LINE_MARGIN = 0.5;
-    constexpr float BOXES_FLOW = 0.5;
-
-    bool operator<(const dist_t &obj1, const dist_t &obj2)
-    {
-        if (obj1.c != obj2.c) return obj1.c < obj2.c;
-        return obj1.d < obj2.d;
-    }
+    enum { MATRIX_ELEMENTS_NUM = 6, PDF_STRINGS_NUM = 5000 /*for optimization*/, MAX_XOBJECT_NESTED = 30, MAX_PAGES_DEPTH = 256 };
 
     using extract_handler_t = void (PagesExtractor::*)(PagesExtractor::extract_argument_t& argument, size_t &i);
-    using chunk_iterator_t = vector<text_chunk_t>::iterator;
     extract_handler_t get_extract_handler(const string &token)
     {
         //generated by gen_extract_handlers.pl
         static const extract_handler_t handlers[] =
             #include "extract_handlers.h"
             ;
+        //marked content operators are the only ones of 3 letters
+        if (token.length() == 3)
+        {
+            if (token == "BDC") return &PagesExtractor::do_BDC;
+            if (token == "BMC") return &PagesExtractor::do_BMC;
+            if (token == "EMC") return &PagesExtractor::do_EMC;
+            return nullptr;
+        }
         int hash;
         if (token.length() == 1) hash = token[0];
         else if (token.length() == 2) hash = token[0] * 'q' + token[1];
@@ -69,69 +54,10 @@ namespace
         return handlers[hash];
     }
 
-    float height(const coordinates_t &obj)
-    {
-        return obj.y1 - obj.y0;
-    }
-
-    float width(const text_chunk_t &obj)
-    {
-        return (obj.coordinates.x1 - obj.coordinates.x0) / obj.string_len;
-    }
-
-    float width(const text_t &obj)
-    {
-        return (obj.coordinates.x1 - obj.coordinates.x0) / utf8_length(obj.text);
-    }
-
-    float width(const coordinates_t &obj)
+    //chunks of innermost marked content with MCID or of page
+    vector<text_chunk_t>& get_chunks(PagesExtractor::extract_argument_t &arg)
     {
-        return obj.x1 - obj.x0;
-    }
-
-    bool is_zero_string(const text_chunk_t &line)
-    {
-        return width(line.coordinates) <= 0 || height(line.coordinates) <= 0;
-    }
-
-    bool is_between(const vector<text_chunk_t> &groups, size_t obj1, size_t obj2)
-    {
-        float x0 = min(groups[obj1].coordinates.x0, groups[obj2].coordinates.x0);
-        float y0 = min(groups[obj1].coordinates.y0, groups[obj2].coordinates.y0);
-        float x1 = max(groups[obj1].coordinates.x1, groups[obj2].coordinates.x1);
-        float y1 = max(groups[obj1].coordinates.y1, groups[obj2].coordinates.y1);
-        return find_if(groups.begin(), groups.end(), [x0, y0, x1, y1, obj1, obj2, &groups](const text_chunk_t &obj)
-                       {
-                           const coordinates_t &coord = obj.coordinates;
-                           if (coord.x0 >= x0 && coord.y0 >= y0 && coord.x1 <= x1 && coord.y1 <= y1 &&
-                               !obj.is_empty &&
-                               !(obj == groups[obj1]) && !(obj == groups[obj2])) return true;
-                           return false;
-                       }) != groups.end();
-    }
-
-    size_t create_group(vector<text_chunk_t> &groups, size_t obj1, size_t obj2)
-    {
-        float pos1 = (1 - BOXES_FLOW) * (groups[obj1].coordinates.x0) -
-                     (1 + BOXES_FLOW) * (groups[obj1].coordinates.y0 + groups[obj1].coordinates.y1);
-        float pos2 = (1 - BOXES_FLOW) * (groups[obj2].coordinates.x0) -
-                     (1 + BOXES_FLOW) * (groups[obj2].coordinates.y0 + groups[obj2].coordinates.y1);
-        size_t o1 = (pos1 <= pos2)? obj1 : obj2;
-        size_t o2 = (pos1 <= pos2)? obj2 : obj1;
-
-        for (const text_t &text : groups[o2].texts)
-        {
-            if (text.coordinates.x0 < groups[o1].coordinates.x0) groups[o1].coordinates.x0 = text.coordinates.x0;
-            if (text.coordinates.x1 > groups[o1].coordinates.x1) groups[o1].coordinates.x1 = text.coordinates.x1;
-            if (text.coordinates.y0 < groups[o1].coordinates.y0) groups[o1].coordinates.y0 = text.coordinates.y0;
-            if (text.coordinates.y1 > groups[o1].coordinates.y1) groups[o1].coordinates.y1 = text.coordinates.y1;
-        }
-
-        groups[o1].texts.insert(groups[o1].texts.end(),
-                                std::make_move_iterator(groups[o2].texts.begin()),
-                                std::make_move_iterator(groups[o2].texts.end()));
-        groups[o2].is_empty = true;
-        return o1;
+        return (arg.marked_chunks.empty() || !arg.marked_chunks.back())? arg.result[0] : *arg.marked_chunks.back();
     }
 
     string get_resource_name(const string &page, const string &object)
@@ -147,324 +73,24 @@ namespace
         return matrix_t{1, 0, 0, 1, -media_box.at(0), -media_box.at(1)};
     }
 
-    bool is_voverlap(const coordinates_t &obj1, const coordinates_t &obj2)
+    //bounding box of rectangle transformed by matrix
+    coordinates_t get_bounding_box(const matrix_t &m, float x0, float y0, float x1, float y1)
     {
-        return obj2.y0 <= obj1.y1 && obj1.y0 <= obj2.y1;
-    }
-
-    bool is_hoverlap(const coordinates_t &obj1, const coordinates_t &obj2)
-    {
-        return obj2.x0 <= obj1.x1 && obj1.x0 <= obj2.x1;
-    }
-
-    float voverlap(const coordinates_t &obj1, const coordinates_t &obj2)
-    {
-        return is_voverlap(obj1, obj2)? min(fabs(obj1.y0 - obj2.y1), fabs(obj1.y1 - obj2.y0)) : 0;
-    }
-
-    float hdistance(const coordinates_t &obj1, const coordinates_t &obj2)
-    {
-        return is_hoverlap(obj1, obj2)? 0 : min(fabs(obj1.x0 - obj2.x1), fabs(obj1.x1 - obj2.x0));
-    }
-
-    bool is_halign(const text_chunk_t &obj1, const text_chunk_t &obj2)
-    {
-        int y0_0 = static_cast<int>(obj1.coordinates.y0);
-        int y0_1 = static_cast<int>(obj1.coordinates.y1);
-        int y1_0 = static_cast<int>(obj2.coordinates.y0);
-        int y1_1 = static_cast<int>(obj2.coordinates.y1);
-        return (y0_0 == y1_0 && y0_1 == y1_1) || (is_voverlap(obj1.coordinates, obj2.coordinates) &&
-               (min(height(obj1.coordinates), height(obj2.coordinates)) * LINE_OVERLAP <
-                voverlap(obj1.coordinates, obj2.coordinates)) &&
-                (hdistance(obj1.coordinates, obj2.coordinates) < max(width(obj1), width(obj2)) * CHAR_MARGIN));
-
-    }
-
-    optional<pair<chunk_iterator_t, chunk_iterator_t>> get_zero_range(vector<text_chunk_t> &chunks,
-                                                                      chunk_iterator_t start_it)
-    {
-        chunk_iterator_t found_it = find_if(start_it, chunks.end(), [] (const text_chunk_t &chunk)
-                                            {
-                                                return is_zero_string(chunk);
-                                            });
-        if (found_it == chunks.end()) return boost::none;
-        for (chunk_iterator_t it = found_it + 1; it < chunks.end(); ++it)
-        {
-            if (is_zero_string(*it)) return make_pair(found_it, it);
-        }
-        return make_pair(found_it, chunks.end());
-    }
-
-    //some pdf strings have zero width or height. group those string together
-    void group_zero_lines(vector<text_chunk_t> &lines)
-    {
-#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
-        optional<pair<chunk_iterator_t, chunk_iterator_t>> r;
-#pragma GCC diagnostic warning "-Wmaybe-uninitialized"
-        chunk_iterator_t start_it = lines.begin();
-        while ((r = get_zero_range(lines, start_it)))
-        {
-            start_it = r->second;
-            if (r->second - r->first == 1) continue;
-            for (chunk_iterator_t it = r->first + 1; it < r->second; ++it)
-            {
-                r->first->texts[0].text += it->texts[0].text;
-                if (r->first->coordinates.x0 > it->coordinates.x0) r->first->coordinates.x0 = it->coordinates.x0;
-                if (r->first->coordinates.x1 < it->coordinates.x1) r->first->coordinates.x1 = it->coordinates.x1;
-                if (r->first->coordinates.y0 > it->coordinates.y0) r->first->coordinates.y0 = it->coordinates.y0;
-                if (r->first->coordinates.y1 < it->coordinates.y1) r->first->coordinates.y1 = it->coordinates.y1;
-                r->first->string_len += it->string_len;
-                it->is_empty = true;
-            }
-            r->first->texts[0].coordinates = r->first->coordinates;
-        }
-    }
-
-    void clear_empty_strings(vector<text_chunk_t> &chunks)
-    {
-        chunks.erase(remove_if(chunks.begin(),
-                               chunks.end(),
-                               [](const text_chunk_t& chunk) {
-                                   return chunk.string_len == 0 || chunk.is_empty;
-                               }),
-                     chunks.end());
-    }
-
-    text_chunk_t merge_lines(vector<text_chunk_t> &&lines)
-    {
-        if (lines.empty()) return text_chunk_t();
-        group_zero_lines(lines);
-        clear_empty_strings(lines);
-        sort(lines.begin(), lines.end(),
-             [](const text_chunk_t &a, const text_chunk_t &b) -> bool
-             {
-                 if (a.coordinates.y1 != b.coordinates.y1) return a.coordinates.y1 > b.coordinates.y1;
-                 return a.coordinates.x0 < b.coordinates.x0;
-             });
-        text_chunk_t result(lines[0].texts[0].text + '\n', std::move(lines[0].coordinates));
-        for (size_t i = 1; i < lines.size(); ++i)
+        const float xs[] = {x0, x1, x0, x1}, ys[] = {y0, y0, y1, y1};
+        coordinates_t result(m[0] * x0 + m[2] * y0 + m[4], m[1] * x0 + m[3] * y0 + m[5], 0, 0);
+        result.x1 = result.x0;
+        result.y1 = result.y0;
+        for (size_t i = 1; i < 4; ++i)
         {
-            result.texts[0].text += lines[i].texts[0].text + '\n';
-            if (lines[i].coordinates.x0 < result.coordinates.x0) result.coordinates.x0 = lines[i].coordinates.x0;
-            if (lines[i].coordinates.x1 > result.coordinates.x1) result.coordinates.x1 = lines[i].coordinates.x1;
-            if (lines[i].coordinates.y0 < result.coordinates.y0) result.coordinates.y0 = lines[i].coordinates.y0;
-            if (lines[i].coordinates.y1 > result.coordinates.y1) result.coordinates.y1 = lines[i].coordinates.y1;
-            result.string_len += lines[i].string_len;
+            const float x = m[0] * xs[i] + m[2] * ys[i] + m[4], y = m[1] * xs[i] + m[3] * ys[i] + m[5];
+            result.x0 = min(result.x0, x);
+            result.y0 = min(result.y0, y);
+            result.x1 = max(result.x1, x);
+            result.y1 = max(result.y1, y);
         }
-        result.texts[0].coordinates = result.coordinates;
-
         return result;
     }
 
-    void add2line(text_chunk_t &line, const text_chunk_t &obj)
-    {
-        line.string_len += obj.string_len;
-        for (const text_t &text : obj.texts) line.texts.push_back(std::move(text));
-        if (obj.coordinates.x0 < line.coordinates.x0) line.coordinates.x0 = obj.coordinates.x0;
-        if (obj.coordinates.x1 > line.coordinates.x1) line.coordinates.x1 = obj.coordinates.x1;
-        if (obj.coordinates.y0 < line.coordinates.y0) line.coordinates.y0 = obj.coordinates.y0;
-        if (obj.coordinates.y1 > line.coordinates.y1) line.coordinates.y1 = obj.coordinates.y1;
-    }
-
-    vector<text_chunk_t> traverse_symbols(const vector<text_chunk_t> &chunks)
-    {
-        if (chunks.empty()) vector<text_chunk_t>();
-        vector<text_chunk_t> result;
-        text_chunk_t line;
-        const text_chunk_t *obj0 = nullptr;
-        for (const text_chunk_t &obj1 : chunks)
-        {
-            if (obj0)
-            {
-                bool is_cmp = is_halign(*obj0, obj1);
-                if (is_cmp && !line.is_empty)
-                {
-                    add2line(line, obj1);
-                }
-                else if (!line.is_empty)
-                {
-                    result.push_back(line);
-                    line.is_empty = true;
-                }
-                else if (is_cmp)
-                {
-                    line = *obj0;
-                    line.is_empty = false;
-                    add2line(line, obj1);
-                }
-                else
-                {
-                    result.push_back(*obj0);
-                }
-            }
-            obj0 = &obj1;
-        }
-        if (line.is_empty && obj0) result.push_back(*obj0);
-        if (!line.is_empty) result.push_back(line);
-        return result;
-    }
-
-    bool is_neighbour_lines(const text_chunk_t &obj1, const text_chunk_t &obj2)
-    {
-        if (obj1.is_empty || obj2.is_empty) return false;
-        float height1 = height(obj1.coordinates), height2 = height(obj2.coordinates);
-        float d = LINE_MARGIN * max(height1, height2);
-        if (fabs(height1 - height2) < d &&
-            obj2.coordinates.x1 > obj1.coordinates.x0 && obj2.coordinates.x0 < obj1.coordinates.x1 &&
-            obj2.coordinates.y0 < obj1.coordinates.y1 + d && obj2.coordinates.y1 > obj1.coordinates.y0 - d &&
-            (fabs(obj1.coordinates.x0 - obj2.coordinates.x0) < d ||
-             fabs(obj1.coordinates.x1 - obj2.coordinates.x1) < d))
-        {
-            return true;
-        }
-        return false;
-    }
-
-    vector<text_chunk_t> get_neighbour_lines(vector<text_chunk_t> &&lines, text_chunk_t&& line_arg)
-    {
-        vector<text_chunk_t> result;
-        result.push_back(std::move(line_arg));
-        for (size_t i = 0; i < result.size(); ++i)
-        {
-            for (text_chunk_t &line : lines)
-            {
-                if (is_neighbour_lines(line, result[i])) result.push_back(std::move(line));
-            }
-        }
-        return result;
-    }
-
-    vector<text_chunk_t> make_text_boxes(vector<text_chunk_t> &&lines)
-    {
-        vector<text_chunk_t> text_boxes;
-        auto not_empty = [](const text_chunk_t &line) { return !line.is_empty; };
-        for (auto it = find_if(lines.begin(), lines.end(), not_empty);
-             it != lines.end();
-             it = find_if(it, lines.end(), not_empty))
-        {
-            text_chunk_t line = merge_lines(get_neighbour_lines(std::move(lines), *std::make_move_iterator(it)));
-            if (line.is_empty) continue;
-            text_boxes.push_back(std::move(line));
-        }
-        group_zero_lines(text_boxes);
-        clear_empty_strings(text_boxes);
-        return text_boxes;
-    }
-
-    void merge_chars(vector<text_chunk_t> &chars)
-    {
-        for (text_chunk_t &line : chars)
-        {
-            if (line.texts.empty()) continue;
-            vector<text_t> whole_line{text_t(line.coordinates)};
-            /* REMOVED because of weird coordinates like
-            1.2016-012-Kleinberg-etal_MIT-Center_Hobbs.pdf
-            2.Power and the news media.pdf
-            next text has previous x coordinates
-            */
-            // sort(line.texts.begin(), line.texts.end(),
-            //      [](const text_t &a, const text_t &b) -> bool
-            //      {
-            //          return a.coordinates.x0 < b.coordinates.x0;
-            //      });
-            for (size_t i = 0; i < line.texts.size(); ++i)
-            {
-                whole_line[0].text += line.texts[i].text;
-                if ((i != line.texts.size() - 1) &&
-                    line.texts[i].coordinates.x1 < line.texts[i + 1].coordinates.x0 -
-                    max(height(line.texts[i + 1].coordinates), width(line.texts[i + 1])) * WORD_MARGIN)
-                {
-                    whole_line[0].text += ' ';
-                }
-            }
-            line.texts = std::move(whole_line);
-        }
-    }
-
-    vector<text_chunk_t> make_text_lines(vector<text_chunk_t> &chunks)
-    {
-        clear_empty_strings(chunks);
-        vector<text_chunk_t> result = traverse_symbols(chunks);
-        merge_chars(result);
-        return result;
-    }
-
-    float get_dist(const text_chunk_t &obj1, const text_chunk_t &obj2)
-    {
-        float x0 = min(obj1.coordinates.x0, obj2.coordinates.x0);
-        float y0 = min(obj1.coordinates.y0, obj2.coordinates.y0);
-        float x1 = max(obj1.coordinates.x1, obj2.coordinates.x1);
-        float y1 = max(obj1.coordinates.y1, obj2.coordinates.y1);
-        return (x1 - x0) * (y1 - y0) -
-               width(obj1.coordinates) * height(obj1.coordinates) - width(obj2.coordinates) * height(obj2.coordinates);
-    }
-
-    text_chunk_t boxes_as_is(const vector<text_chunk_t> &boxes)
-    {
-        text_chunk_t result;
-        result.texts = vector<text_t>{text_t(coordinates_t(0, 0, 1, 1))};
-        for (const text_chunk_t &chunk : boxes)
-        {
-            result.is_empty = false;
-            result.texts[0].text += chunk.texts.at(0).text;
-        }
-        return result;
-    }
-
-    text_chunk_t make_plane(vector<text_chunk_t> &&boxes)
-    {
-        if (boxes.empty()) return text_chunk_t();
-        //prevent huge processing
-        if (boxes.size() > MAX_BOXES) return boxes_as_is(boxes);
-        vector<dist_t> dists;
-        dists.reserve(boxes.size() * (boxes.size() - 1));
-        for (size_t i = 0; i < boxes.size(); ++i)
-        {
-            for (size_t j = i + 1; j < boxes.size(); ++j) dists.emplace_back(0, get_dist(boxes[i], boxes[j]), i, j);
-        }
-        while (!dists.empty())
-        {
-            auto it = min_element(dists.begin(), dists.end());
-            if (it->c == 0 && is_between(boxes, it->obj1, it->obj2))
-            {
-                it->c = 1;
-                continue;
-            }
-            const dist_t dist = *it;
-            dists.erase(remove_if(dists.begin(), dists.end(), [&dist] (const dist_t &o) {
-                        if (o.obj1 == dist.obj1 || o.obj1 == dist.obj2 ||
-                            o.obj2 == dist.obj1 || o.obj2 == dist.obj2) return true;
-                        return false;
-                        }), dists.end());
-            size_t group = create_group(boxes, dist.obj1, dist.obj2);
-            for (size_t i = 0; i < boxes.size(); ++i)
-            {
-                if (i == group || boxes[i].is_empty) continue;
-                dists.emplace_back(0, get_dist(boxes[group], boxes[i]), group, i);
-            }
-        }
-
-        for (text_chunk_t &group : boxes)
-        {
-            if (!group.is_empty) return std::move(group);
-        }
-        throw pdf_error(FUNC_STRING + "all objects are moved");
-    }
-
-    string make_string(const text_chunk_t &group)
-    {
-        if (group.is_empty) return string();
-        string result;
-        for (const text_t &box : group.texts) result += box.text;
-        return result;
-    }
-
-    string render_text(vector<text_chunk_t> &chunks)
-    {
-//        for (const text_chunk_t &chunk : chunks) cout << '(' << chunk.coordinates.x0 << ',' << chunk.coordinates.y0 << ")(" << chunk.coordinates.x1 << ',' << chunk.coordinates.y1 << ')' << chunk.texts[0].text << endl;
-        return make_string(make_plane(make_text_boxes(make_text_lines(chunks))));
-    }
-
     string output_content(unordered_set<unsigned int> &visited_contents,
                           const string &buffer,
                           const ObjectStorage &storage,
@@ -539,6 +165,43 @@ namespace
         return parent_rotate;
     }
 
+    dict_t get_pages_root(const ObjectStorage &storage, unsigned int catalog_pages_id)
+    {
+        const pair<string, pdf_object_t> catalog_pair = storage.get_object(catalog_pages_id);
+        if (catalog_pair.second != DICTIONARY) throw pdf_error(FUNC_STRING + "catalog must be DICTIONARY");
+        dict_t data = get_dictionary_data(catalog_pair.first, 0);
+        auto it = data.find("/Type");
+        if (it == data.end() || it->second.first != "/Pages")
+        {
+            throw pdf_error("In root catalog type must be '/Type /Pages'");
+        }
+        return data;
+    }
+
+    //cuts text to max_bytes bytes and max_chars utf8 characters, 0 is no limit
+    void cut_text(string &text, size_t max_bytes, size_t max_chars)
+    {
+        size_t end = text.length();
+        if (max_bytes != 0 && end > max_bytes)
+        {
+            end = max_bytes;
+            while (end > 0 && (text[end] & 0xC0) == 0x80) --end;
+        }
+        if (max_chars != 0)
+        {
+            size_t chars = 0;
+            for (size_t i = 0; i < end; ++i)
+            {
+                if ((text[i] & 0xC0) != 0x80 && ++chars > max_chars)
+                {
+                    end = i;
+                    break;
+                }
+            }
+        }
+        text.resize(end);
+    }
+
     CharsetConverter get_charset_converter(const optional<pair<string, pdf_object_t>> &encoding)
     {
         if (!encoding) return CharsetConverter(string());
@@ -554,23 +217,140 @@ namespace
 PagesExtractor::PagesExtractor(unsigned int catalog_pages_id,
                                const ObjectStorage &storage_arg,
                                const dict_t &decrypt_data_arg,
-                               const string &doc_arg) :
-                               doc(doc_arg), storage(storage_arg), decrypt_data(decrypt_data_arg)
+                               const string &doc_arg,
+                               const pdf_extractor_options_t &options_arg,
+                               const dict_t &root_data_arg) :
+                               doc(doc_arg),
+                               storage(storage_arg),
+                               decrypt_data(decrypt_data_arg),
+                               options(options_arg),
+                               fonts_cache(storage_arg),
+                               pages_root(get_pages_root(storage_arg, catalog_pages_id)),
+                               is_pages_loaded(false),
+                               root_data(root_data_arg),
+                               output_bytes(0),
+                               output_chars(0)
+{
+}
+
+//reads all page tree
+void PagesExtractor::load_pages()
+{
+    if (is_pages_loaded) return;
+    is_pages_loaded = true;
+    unordered_set<unsigned int> checked_nodes;
+    get_pages_resources_int(checked_nodes,
+                            pages_root,
+                            get_fonts(pages_root, Fonts(fonts_cache, dict_t())),
+                            get_box(pages_root, boost::none),
+                            get_rotate(pages_root, 0));
+}
+
+//descends to page by /Count of nodes. Returns none if page tree doesn't match its counts
+optional<unsigned int> PagesExtractor::find_page(size_t page_num)
+{
+    dict_t node = pages_root;
+    Fonts node_fonts = get_fonts(node, Fonts(fonts_cache, dict_t()));
+    optional<mediabox_t> node_box = get_box(node, boost::none);
+    unsigned int node_rotate = get_rotate(node, 0);
+    for (size_t depth = 0; depth < MAX_PAGES_DEPTH; ++depth)
+    {
+        auto it = node.find("/Kids");
+        if (it == node.end() || it->second.second != ARRAY) return boost::none;
+        const vector<pair<unsigned int, unsigned int>> kids = get_set(it->second.first);
+        bool is_found = false;
+        for (size_t i = 0; i < kids.size() && !is_found; ++i)
+        {
+            const pair<string, pdf_object_t> kid = storage.get_object(kids[i].first);
+            if (kid.second != DICTIONARY) return boost::none;
+            dict_t kid_data = get_dictionary_data(kid.first, 0);
+            it = kid_data.find("/Type");
+            if (it == kid_data.end()) return boost::none;
+            if (it->second.first == "/Page")
+            {
+                if (page_num == 0)
+                {
+                    add_page(kids[i].first, std::move(kid_data), node_fonts, node_box, node_rotate);
+                    return kids[i].first;
+                }
+                --page_num;
+            }
+            else if (it->second.first == "/Pages")
+            {
+                const size_t count = get_dict_val(kid_data, "/Count", 0u);
+                if (page_num >= count)
+                {
+                    page_num -= count;
+                    continue;
+                }
+                node_fonts = get_fonts(kid_data, node_fonts);
+                node_box = get_box(kid_data, node_box);
+                node_rotate = get_rotate(kid_data, node_rotate);
+                node = std::move(kid_data);
+                is_found = true;
+            }
+        }
+        if (!is_found) return boost::none;
+    }
+    return boost::none;
+}
+
+optional<unsigned int> PagesExtractor::get_page_id(size_t page_num)
+{
+    if (!is_pages_loaded)
+    {
+        auto it = found_pages.find(page_num);
+        if (it != found_pages.end()) return it->second;
+        optional<unsigned int> page_id;
+        try
+        {
+            page_id = find_page(page_num);
+        }
+        catch (const std::exception &e)
+        {
+        }
+        if (page_id)
+        {
+            found_pages.emplace(page_num, *page_id);
+            return page_id;
+        }
+        //counts of page tree are broken, so pages are taken from all tree
+        load_pages();
+    }
+    if (page_num >= pages.size()) return boost::none;
+    return pages[page_num];
+}
+
+size_t PagesExtractor::get_page_count()
 {
-    const pair<string, pdf_object_t> catalog_pair = storage.get_object(catalog_pages_id);
-    if (catalog_pair.second != DICTIONARY) throw pdf_error(FUNC_STRING + "catalog must be DICTIONARY");
-    const dict_t data = get_dictionary_data(catalog_pair.first, 0);
-    auto it = data.find("/Type");
-    if (it == data.end() || it->second.first != "/Pages")
+    if (!is_pages_loaded)
     {
-        throw pdf_error("In root catalog type must be '/Type /Pages'");
+        try
+        {
+            const unsigned int count = get_dict_val(pages_root, "/Count", 0u);
+            if (count != 0) return count;
+        }
+        catch (const std::exception &e)
+        {
+        }
+        load_pages();
     }
-    unordered_set<unsigned int> checked_nodes;
-    get_pages_resources_int(checked_nodes,
-                            data,
-                            get_fonts(data, Fonts(storage, dict_t())),
-                            get_box(data, boost::none),
-                            get_rotate(data, 0));
+    return pages.size();
+}
+
+void PagesExtractor::add_page(unsigned int id,
+                              dict_t &&dict_data,
+                              const Fonts &parent_fonts,
+                              const optional<mediabox_t> &parent_media_box,
+                              unsigned int parent_rotate)
+{
+    const string id_str = to_string(id);
+    if (dicts.count(id_str)) return;
+    fonts.emplace(id_str, get_fonts(dict_data, parent_fonts));
+    media_boxes.emplace(id_str, get_box(dict_data, parent_media_box).value());
+    rotates.emplace(id_str, get_rotate(dict_data, parent_rotate));
+    XObjects_cache.emplace(id_str, dict_t());
+    dicts.emplace(id_str, std::move(dict_data));
 }
 
 void PagesExtractor::get_pages_resources_int(unordered_set<unsigned int> &checked_nodes,
@@ -596,13 +376,7 @@ void PagesExtractor::get_pages_resources_int(unordered_set<unsigned int> &checke
         if (dict_data.at("/Type").first == "/Page")
         {
             pages.push_back(id);
-            const string id_str = to_string(id);
-            fonts.emplace(id_str, get_fonts(dict_data, parent_fonts));
-            media_boxes.emplace(id_str, get_box(dict_data, parent_media_box).value());
-            rotates.emplace(id_str, get_rotate(dict_data, parent_rotate));
-            converter_engine_cache.emplace(id_str, unordered_map<string, ConverterEngine>());
-            XObjects_cache.emplace(id_str, dict_t());
-            dicts.emplace(id_str, std::move(dict_data));
+            add_page(id, std::move(dict_data), parent_fonts, parent_media_box, parent_rotate);
         }
         else
         {
@@ -620,6 +394,8 @@ bool PagesExtractor::get_XObject_data(const string &parent_id,
                                       const string &XObject_name,
                                       const string &resource_name)
 {
+    //data of form is read once, its stream is decoded on first use
+    if (dicts.count(resource_name)) return true;
     const dict_t &parent_dict = dicts.at(parent_id);
     dict_t &XObjects = XObjects_cache.at(parent_id);
     if (XObjects.empty())
@@ -638,8 +414,7 @@ bool PagesExtractor::get_XObject_data(const string &parent_id,
     if (dict.at("/Subtype").first != "/Form") return false;
     if (!dict.count("/BBox")) return false;
     fonts.emplace(resource_name, get_fonts(dict, fonts.at(parent_id)));
-    converter_engine_cache.emplace(resource_name, unordered_map<string, ConverterEngine>());
-    XObject_streams.emplace(resource_name, get_stream(doc, get_id_gen(XObject->second.first), storage, decrypt_data));
+    XObject_ids.emplace(resource_name, get_id_gen(XObject->second.first));
     auto it = dict.find("Matrix");
     if (it == dict.end())
     {
@@ -668,14 +443,69 @@ bool PagesExtractor::get_XObject_data(const string &parent_id,
     return true;
 }
 
-Fonts PagesExtractor::get_fonts(const dict_t &dictionary, const Fonts &parent_fonts) const
+void PagesExtractor::set_regions(size_t page_num, unsigned int page_id)
+{
+    regions.clear();
+    if (options.regions.empty()) return;
+    const string page_id_str = to_string(page_id);
+    //regions are transformed like text of page, so they are compared with coordinates of chunks
+    const matrix_t ctm = init_CTM(rotates.at(page_id_str), media_boxes.at(page_id_str));
+    for (const pdf_extractor_region_t &r : options.regions[min(page_num, options.regions.size() - 1)])
+    {
+        regions.push_back(get_bounding_box(ctm, r.x0, r.y0, r.x1, r.y1));
+    }
+}
+
+bool PagesExtractor::is_in_regions(const coordinates_t &box) const
+{
+    if (regions.empty()) return true;
+    for (const coordinates_t &r : regions)
+    {
+        if (box.x0 <= r.x1 && box.x1 >= r.x0 && box.y0 <= r.y1 && box.y1 >= r.y0) return true;
+    }
+    return false;
+}
+
+bool PagesExtractor::is_form_in_regions(const string &resource_name, const matrix_t &ctm) const
+{
+    if (regions.empty()) return true;
+    mediabox_t bbox;
+    try
+    {
+        bbox = parse_rectangle(dicts.at(resource_name).at("/BBox"));
+    }
+    catch (const std::exception &e)
+    {
+        //form with broken /BBox is decoded as usual
+        return true;
+    }
+    return is_in_regions(get_bounding_box(ctm, bbox[0], bbox[1], bbox[2], bbox[3]));
+}
+
+//chunks out of regions are dropped before layout
+void PagesExtractor::add_text_chunk(extract_argument_t &arg, text_chunk_t &&chunk)
+{
+    if (chunk.is_empty || !is_in_regions(chunk.coordinates)) return;
+    //rendered text of chunks isn't shorter than them, so page may stop when they reach limits
+    output_bytes += chunk.text.length();
+    output_chars += chunk.string_len;
+    add_chunk(get_chunks(arg), std::move(chunk));
+}
+
+bool PagesExtractor::is_output_full() const
+{
+    return (options.max_output_bytes != 0 && output_bytes >= options.max_output_bytes) ||
+           (options.max_chars != 0 && output_chars >= options.max_chars);
+}
+
+Fonts PagesExtractor::get_fonts(const dict_t &dictionary, const Fonts &parent_fonts)
 {
     auto it = dictionary.find("/Resources");
     if (it == dictionary.end()) return parent_fonts;
     const dict_t resources = get_dict_or_indirect_dict(it->second, storage);
     it = resources.find("/Font");
-    if (it == resources.end()) return Fonts(storage, dict_t());
-    return Fonts(storage, get_dict_or_indirect_dict(it->second, storage));
+    if (it == resources.end()) return Fonts(fonts_cache, dict_t());
+    return Fonts(fonts_cache, get_dict_or_indirect_dict(it->second, storage));
 }
 
 mediabox_t PagesExtractor::parse_rectangle(const pair<string, pdf_object_t> &rectangle) const
@@ -742,7 +572,8 @@ string PagesExtractor::get_stream_contents_no_exception(unsigned int page_id,
 
 string PagesExtractor::get_stream_contents(unsigned int page_id,
                                            const vector<pair<unsigned int, unsigned int>> &ids_gen,
-                                           unordered_set<unsigned int> &visited_ids)
+                                           unordered_set<unsigned int> &visited_ids,
+                                           const vector<unsigned int> *marked_order)
 {
     string text;
     string page_content;
@@ -757,27 +588,98 @@ string PagesExtractor::get_stream_contents(unsigned int page_id,
         }
         page_content += output_content(visited_ids, doc, storage, id_gen, decrypt_data);
     }
-    for (vector<text_chunk_t> &r : extract_text(page_content, page_id_str, boost::none, 0)) text += render_text(r);
+    map<unsigned int, vector<text_chunk_t>> marked;
+    vector<vector<text_chunk_t>> chunks = extract_text(page_content,
+                                                       page_id_str,
+                                                       boost::none,
+                                                       0,
+                                                       marked_order? &marked : nullptr);
+    if (marked_order) text += render_marked_text(marked, *marked_order);
+    for (vector<text_chunk_t> &r : chunks) text += render_text(r, options);
     return text;
 }
 
-string PagesExtractor::get_text()
+string PagesExtractor::render_marked_text(map<unsigned int, vector<text_chunk_t>> &marked,
+                                          const vector<unsigned int> &marked_order) const
 {
+    //marked content is a piece of text in reading order, so its lines aren't reordered
+    pdf_extractor_options_t marked_options = options;
+    if (marked_options.layout == PDF_EXTRACTOR_LAYOUT_FULL) marked_options.layout = PDF_EXTRACTOR_LAYOUT_LINES;
     string text;
-    for (unsigned int page_id : pages)
+    for (unsigned int mcid : marked_order)
+    {
+        auto it = marked.find(mcid);
+        if (it == marked.end()) continue;
+        text += render_text(it->second, marked_options);
+        marked.erase(it);
+    }
+    //marked content which is out of structure tree
+    for (const pair<const unsigned int, vector<text_chunk_t>> &p : marked)
     {
-        unordered_set<unsigned int> visited_contents;
-        const pair<string, pdf_object_t> page_pair = storage.get_object(page_id);
-        if (page_pair.second != DICTIONARY) throw pdf_error(FUNC_STRING + "page must be DICTIONARY");
-        const dict_t page_dict = get_dictionary_data(page_pair.first, 0);
-        text += get_stream_contents(page_id, get_id_gen_from_dictionary(page_dict, "/Contents"), visited_contents);
-        //do not use operator+ in one line because operator+ evaluation order is not specified
-        //DS CSS is not implemented, skip Annot streams with this
-        text += get_stream_contents_no_exception(page_id, get_id_gen_ap_n(page_dict, page_id), visited_contents);
+        text += render_text(p.second, marked_options);
     }
     return text;
 }
 
+string PagesExtractor::get_page_text(size_t page_num, unsigned int page_id)
+{
+    //empty list of regions skips the page
+    if (!options.regions.empty() && options.regions[min(page_num, options.regions.size() - 1)].empty()) return string();
+    set_regions(page_num, page_id);
+    unordered_set<unsigned int> visited_contents;
+    const pair<string, pdf_object_t> page_pair = storage.get_object(page_id);
+    if (page_pair.second != DICTIONARY) throw pdf_error(FUNC_STRING + "page must be DICTIONARY");
+    const dict_t page_dict = get_dictionary_data(page_pair.first, 0);
+    if (!structure_order)
+    {
+        structure_order = options.structure_order? get_structure_order(root_data, storage) :
+                                                   unordered_map<unsigned int, vector<unsigned int>>();
+    }
+    //page may be extracted again, so text state of previous extraction is dropped
+    fonts.at(to_string(page_id)).reset_text_state();
+    auto it = structure_order->find(page_id);
+    string text = get_stream_contents(page_id,
+                                      get_id_gen_from_dictionary(page_dict, "/Contents"),
+                                      visited_contents,
+                                      (it == structure_order->end())? nullptr : &it->second);
+    //do not use operator+ in one line because operator+ evaluation order is not specified
+    //DS CSS is not implemented, skip Annot streams with this
+    if (is_output_full()) return text;
+    text += get_stream_contents_no_exception(page_id, get_id_gen_ap_n(page_dict, page_id), visited_contents);
+    return text;
+}
+
+string PagesExtractor::get_text()
+{
+    //with output limit pages are found on demand, so pages after the limit aren't read.
+    //Pages are taken until there is no next one, /Count of broken page tree may be less than number of pages
+    if (options.max_output_bytes != 0 || options.max_chars != 0) return get_text(0, numeric_limits<size_t>::max());
+    load_pages();
+    return get_text(0, pages.size());
+}
+
+string PagesExtractor::get_text(size_t first, size_t last)
+{
+    string text;
+    size_t text_chars = 0;
+    output_bytes = 0;
+    output_chars = 0;
+    for (size_t page_num = first; page_num < last && !is_output_full(); ++page_num)
+    {
+        //page tree is loaded when page isn't found by /Count, so there are no pages after missing one
+        const optional<unsigned int> page_id = get_page_id(page_num);
+        if (!page_id) break;
+        const string page_text = get_page_text(page_num, *page_id);
+        text += page_text;
+        if (options.max_chars != 0) text_chars += utf8_length(page_text);
+        //chunks counted while page was extracted are replaced by its text
+        output_bytes = text.length();
+        output_chars = text_chars;
+    }
+    cut_text(text, options.max_output_bytes, options.max_chars);
+    return text;
+}
+
 optional<pair<string, pdf_object_t>> PagesExtractor::get_encoding(const dict_t &font_dict) const
 {
     auto it = font_dict.find("/Encoding");
@@ -811,26 +713,16 @@ ToUnicodeConverter PagesExtractor::get_to_unicode_converter(const dict_t &font_d
         auto it3 = desc_dict.find("/FontFile");
         if (it3 != desc_dict.end() && font_dict.count("/Encoding") == 0)
         {
-            const pair<unsigned int, unsigned int> id_gen = get_id_gen(it3->second.first);
-            if (!cmap_cache.count(id_gen.first)) cmap_cache.emplace(id_gen.first,
-                                                                    get_FontFile(doc, storage, id_gen, decrypt_data));
-            return ToUnicodeConverter(cmap_cache[id_gen.first]);
+            return ToUnicodeConverter(get_cmap(get_id_gen(it3->second.first), CmapCache::FONT_FILE));
         }
         it3 = desc_dict.find("/FontFile2");
         if (it3 == desc_dict.end()) return ToUnicodeConverter();
-        const pair<unsigned int, unsigned int> id_gen = get_id_gen(it3->second.first);
-        if (!cmap_cache.count(id_gen.first)) cmap_cache.emplace(id_gen.first,
-                                                                get_FontFile2(doc, storage, id_gen, decrypt_data));
-        return ToUnicodeConverter(cmap_cache[id_gen.first]);
+        return ToUnicodeConverter(get_cmap(get_id_gen(it3->second.first), CmapCache::FONT_FILE2));
     }
     switch (it->second.second)
     {
     case INDIRECT_OBJECT:
-    {
-        const pair<unsigned int, unsigned int> id_gen = get_id_gen(it->second.first);
-        if (!cmap_cache.count(id_gen.first)) cmap_cache.emplace(id_gen.first,  get_cmap(doc, storage, id_gen, decrypt_data));
-        return ToUnicodeConverter(cmap_cache[id_gen.first]);
-    }
+        return ToUnicodeConverter(get_cmap(get_id_gen(it->second.first), CmapCache::TO_UNICODE));
     case NAME_OBJECT:
         return ToUnicodeConverter();
     default:
@@ -838,16 +730,25 @@ ToUnicodeConverter PagesExtractor::get_to_unicode_converter(const dict_t &font_d
     }
 }
 
-ConverterEngine* PagesExtractor::get_font_encoding(const string &font, const string &resource_id)
+const cmap_t& PagesExtractor::get_cmap(const pair<unsigned int, unsigned int> &id_gen, CmapCache::cmap_type_t type)
+{
+    auto it = cmap_cache.find(id_gen.first);
+    if (it != cmap_cache.end()) return *it->second;
+    string stream = get_stream(doc, id_gen, storage, decrypt_data);
+    std::shared_ptr<const cmap_t> cmap = CmapCache::get_instance().get_cmap(type, std::move(stream));
+    return *cmap_cache.emplace(id_gen.first, std::move(cmap)).first->second;
+}
+
+ConverterEngine* PagesExtractor::get_font_encoding(const Fonts &resource_fonts)
 {
-    auto it = converter_engine_cache.at(resource_id).find(font);
-    if (it != converter_engine_cache[resource_id].end()) return &it->second;
-    const dict_t &font_dict = fonts.at(resource_id).get_current_font_dictionary();
+    const Fonts::font_data_t *font = &resource_fonts.get_current_font();
+    auto it = converter_engine_cache.find(font);
+    if (it != converter_engine_cache.end()) return &it->second;
+    const dict_t &font_dict = font->dictionary;
     optional<pair<string, pdf_object_t>> encoding = get_encoding(font_dict);
-    converter_engine_cache[resource_id].emplace(font, ConverterEngine(get_charset_converter(encoding),
-                                                                      get_diff_converter(encoding),
-                                                                      get_to_unicode_converter(font_dict)));
-    return &converter_engine_cache[resource_id][font];
+    return &converter_engine_cache.emplace(font, ConverterEngine(get_charset_converter(encoding),
+                                                                 get_diff_converter(encoding),
+                                                                 get_to_unicode_converter(font_dict))).first->second;
 }
 
 void PagesExtractor::do_BI(extract_argument_t &arg, size_t &i)
@@ -869,8 +770,9 @@ void PagesExtractor::do_Tf(extract_argument_t &arg, size_t &i)
 {
     arg.coordinates.set_Tf(arg.st);
     const string font = pop(arg.st).second;
-    fonts.at(arg.resource_id).set_current_font(font);
-    arg.encoding = get_font_encoding(font, arg.resource_id);
+    Fonts &resource_fonts = fonts.at(arg.resource_id);
+    resource_fonts.set_current_font(font);
+    arg.encoding = get_font_encoding(resource_fonts);
 }
 
 void PagesExtractor::do_Tj(extract_argument_t &arg, size_t &i)
@@ -880,7 +782,7 @@ void PagesExtractor::do_Tj(extract_argument_t &arg, size_t &i)
                                                   arg.coordinates,
                                                   0,
                                                   fonts.at(arg.resource_id));
-    if (!chunk.is_empty) arg.result[0].push_back(std::move(chunk));
+    add_text_chunk(arg, std::move(chunk));
 }
 
 void PagesExtractor::do_Tm(extract_argument_t &arg, size_t &i)
@@ -895,9 +797,7 @@ void PagesExtractor::do_TJ(extract_argument_t &arg, size_t &i)
     vector<text_chunk_t> tj_texts = arg.encoding->get_strings_from_array(pop(arg.st).second,
                                                                          arg.coordinates,
                                                                          fonts.at(arg.resource_id));
-    arg.result[0].insert(arg.result[0].end(),
-                         std::make_move_iterator(tj_texts.begin()),
-                         std::make_move_iterator(tj_texts.end()));
+    for (text_chunk_t &chunk : tj_texts) add_text_chunk(arg, std::move(chunk));
 }
 
 void PagesExtractor::do_TL(extract_argument_t &arg, size_t &i)
@@ -923,24 +823,30 @@ void PagesExtractor::do_Do(extract_argument_t &arg, size_t &i)
     const string XObject = pop(arg.st).second;
     const string resource_name = get_resource_name(arg.resource_id, XObject);
     if (!get_XObject_data(arg.resource_id, XObject, resource_name)) return;
+    const matrix_t ctm = XObject_matrices.at(resource_name) * arg.coordinates.get_CTM();
+    //form out of regions or after limits of text is not decoded
+    if (is_output_full() || !is_form_in_regions(resource_name, ctm)) return;
     auto it = XObject_streams.find(resource_name);
-    if (it != XObject_streams.end())
+    if (it == XObject_streams.end())
     {
-        ++arg.xobject_nested;
-        const matrix_t ctm = XObject_matrices.at(resource_name) * arg.coordinates.get_CTM();
-        for (vector<text_chunk_t> &r : extract_text(it->second, resource_name, ctm, arg.xobject_nested)) arg.result.push_back(std::move(r));
-        --arg.xobject_nested;
+        it = XObject_streams.emplace(resource_name,
+                                     get_stream(doc, XObject_ids.at(resource_name), storage, decrypt_data)).first;
     }
+    //text state is kept in fonts of resource between pages, so form starts with state of its parent every time
+    fonts.at(resource_name).set_text_state(fonts.at(arg.resource_id));
+    ++arg.xobject_nested;
+    for (vector<text_chunk_t> &r : extract_text(it->second, resource_name, ctm, arg.xobject_nested)) arg.result.push_back(std::move(r));
+    --arg.xobject_nested;
 }
 
 void PagesExtractor::do_quote(extract_argument_t &arg, size_t &i)
 {
     if (!arg.encoding || !arg.in) return;
     arg.coordinates.set_quote(arg.st);
-    arg.result[0].push_back(arg.encoding->get_string(decode_string(pop(arg.st).second),
-                                                     arg.coordinates,
-                                                     0,
-                                                     fonts.at(arg.resource_id)));
+    add_text_chunk(arg, arg.encoding->get_string(decode_string(pop(arg.st).second),
+                                                 arg.coordinates,
+                                                 0,
+                                                 fonts.at(arg.resource_id)));
 }
 
 void PagesExtractor::do_BT(extract_argument_t &arg, size_t &i)
@@ -976,7 +882,7 @@ void PagesExtractor::do_double_quote(extract_argument_t &arg, size_t &i)
     if (!arg.encoding || !arg.in) return;
     const string str = pop(arg.st).second;
     arg.coordinates.set_double_quote(arg.st);
-    arg.result[0].push_back(arg.encoding->get_string(str, arg.coordinates, 0, fonts.at(arg.resource_id)));
+    add_text_chunk(arg, arg.encoding->get_string(str, arg.coordinates, 0, fonts.at(arg.resource_id)));
 }
 
 void PagesExtractor::do_Ts(extract_argument_t &arg, size_t &i)
@@ -1007,10 +913,72 @@ void PagesExtractor::do_q(extract_argument_t &arg, size_t &i)
     arg.coordinates.do_q(arg.st);
 }
 
+optional<unsigned int> PagesExtractor::get_marked_id(const string &resource_id,
+                                                     const pair<pdf_object_t, string> &properties)
+{
+    dict_t dict;
+    if (properties.first == DICTIONARY)
+    {
+        dict = get_dictionary_data(properties.second, 0);
+    }
+    else
+    {
+        //named property list of resources
+        const dict_t &resource_dict = dicts.at(resource_id);
+        auto it = resource_dict.find("/Resources");
+        if (it == resource_dict.end()) return boost::none;
+        const dict_t resources = get_dict_or_indirect_dict(it->second, storage);
+        auto it2 = resources.find("/Properties");
+        if (it2 == resources.end()) return boost::none;
+        const dict_t property_lists = get_dict_or_indirect_dict(it2->second, storage);
+        auto it3 = property_lists.find(properties.second);
+        if (it3 == property_lists.end()) return boost::none;
+        dict = get_dict_or_indirect_dict(it3->second, storage);
+    }
+    auto it = dict.find("/MCID");
+    if (it == dict.end()) return boost::none;
+    return strict_stoul(it->second.first);
+}
+
+void PagesExtractor::do_BDC(extract_argument_t &arg, size_t &i)
+{
+    if (!arg.marked) return;
+    vector<text_chunk_t> *chunks = arg.marked_chunks.empty()? nullptr : arg.marked_chunks.back();
+    if (arg.st.size() >= 2)
+    {
+        const pair<pdf_object_t, string> properties = pop(arg.st);
+        pop(arg.st);
+        //text of broken property list goes with text out of marked content
+        try
+        {
+            const optional<unsigned int> mcid = get_marked_id(arg.resource_id, properties);
+            if (mcid) chunks = &(*arg.marked)[*mcid];
+        }
+        catch (const std::exception &e)
+        {
+        }
+    }
+    arg.marked_chunks.push_back(chunks);
+}
+
+void PagesExtractor::do_BMC(extract_argument_t &arg, size_t &i)
+{
+    if (!arg.marked) return;
+    if (!arg.st.empty()) pop(arg.st);
+    arg.marked_chunks.push_back(arg.marked_chunks.empty()? nullptr : arg.marked_chunks.back());
+}
+
+void PagesExtractor::do_EMC(extract_argument_t &arg, size_t &i)
+{
+    if (!arg.marked || arg.marked_chunks.empty()) return;
+    arg.marked_chunks.pop_back();
+}
+
 vector<vector<text_chunk_t>> PagesExtractor::extract_text(const string &page_content,
                                                           const string &resource_id,
                                                           const optional<matrix_t> CTM,
-                                                          int xobject_nested)
+                                                          int xobject_nested,
+                                                          map<unsigned int, vector<text_chunk_t>> *marked)
 {
     if (xobject_nested > MAX_XOBJECT_NESTED) return vector<vector<text_chunk_t>>();
     ConverterEngine *encoding = nullptr;
@@ -1020,12 +988,24 @@ vector<vector<text_chunk_t>> PagesExtractor::extract_text(const string &page_con
     bool in = false;
     vector<vector<text_chunk_t>> result(1);
     result[0].reserve(PDF_STRINGS_NUM);
-    extract_argument_t argument{result, encoding, st, coordinates, resource_id, in, page_content, xobject_nested};
+    vector<vector<text_chunk_t>*> marked_chunks;
+    extract_argument_t argument{result,
+                                encoding,
+                                st,
+                                coordinates,
+                                resource_id,
+                                in,
+                                page_content,
+                                xobject_nested,
+                                marked,
+                                marked_chunks};
     for (size_t i = skip_comments(page_content, 0, false);
-         i != string::npos && i < page_content.length();
+         i != string::npos && i < page_content.length() && !is_output_full();
          i = skip_comments(page_content, i, false))
     {
-        if (in && put2stack(st, page_content, i)) continue;
+        //property lists of marked content are out of text objects too
+        const bool is_properties = marked && page_content.compare(i, 2, "<<") == 0;
+        if ((in || is_properties) && put2stack(st, page_content, i)) continue;
         string token = get_token(page_content, i);
         extract_handler_t handler = get_extract_handler(token);
         if (handler) (this->*handler)(argument, i);
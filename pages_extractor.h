@@ -6,6 +6,8 @@
 #include <unordered_set>
 #include <unordered_map>
 #include <vector>
+#include <map>
+#include <memory>
 
 #include <boost/optional.hpp>
 
@@ -16,6 +18,8 @@
 #include "diff_converter.h"
 #include "to_unicode_converter.h"
 #include "converter_engine.h"
+#include "cmap_cache.h"
+#include "pdf_extractor.h"
 
 enum {RECTANGLE_ELEMENTS_NUM = 4};
 using mediabox_t = std::array<float, RECTANGLE_ELEMENTS_NUM>;
@@ -26,8 +30,14 @@ public:
     PagesExtractor(unsigned int catalog_pages_id,
                    const ObjectStorage &storage_arg,
                    const dict_t &decrypt_data_arg,
-                   const std::string &doc_arg);
+                   const std::string &doc_arg,
+                   const pdf_extractor_options_t &options_arg,
+                   const dict_t &root_data_arg);
     std::string get_text();
+    //text of pages [first, last) in order of page tree, page tree is read only on the way to them.
+    //Pages after the last one of document are skipped
+    std::string get_text(size_t first, size_t last);
+    size_t get_page_count();
     struct extract_argument_t
     {
         std::vector<std::vector<text_chunk_t>> &result;
@@ -38,6 +48,10 @@ public:
         bool &in;
         const std::string &content;
         int xobject_nested;
+        //chunks of marked content by MCID, nullptr if text is not ordered by structure tree
+        std::map<unsigned int, std::vector<text_chunk_t>> *marked;
+        //chunks of innermost marked content with MCID, nullptr for chunks out of it
+        std::vector<std::vector<text_chunk_t>*> &marked_chunks;
    };
 public:
     void do_Do(extract_argument_t &arg, size_t &i);
@@ -61,42 +75,83 @@ public:
     void do_cm(extract_argument_t &arg, size_t &i);
     void do_q(extract_argument_t &arg, size_t &i);
     void do_BI(extract_argument_t &arg, size_t &i);
+    void do_BDC(extract_argument_t &arg, size_t &i);
+    void do_BMC(extract_argument_t &arg, size_t &i);
+    void do_EMC(extract_argument_t &arg, size_t &i);
 private:
+    void load_pages();
+    boost::optional<unsigned int> find_page(size_t page_num);
+    boost::optional<unsigned int> get_page_id(size_t page_num);
+    std::string get_page_text(size_t page_num, unsigned int page_id);
+    void add_page(unsigned int id,
+                  dict_t &&dict_data,
+                  const Fonts &parent_fonts,
+                  const boost::optional<mediabox_t> &parent_media_box,
+                  unsigned int parent_rotate);
     std::vector<std::pair<unsigned int, unsigned int>> get_id_gen_ap_n(const dict_t &page_dict, unsigned int page_id);
-    std::string get_stream_contents(unsigned int page_id, const std::vector<std::pair<unsigned int, unsigned int>> &ids_gen, std::unordered_set<unsigned int> &visited_ids);
+    std::string get_stream_contents(unsigned int page_id, const std::vector<std::pair<unsigned int, unsigned int>> &ids_gen, std::unordered_set<unsigned int> &visited_ids, const std::vector<unsigned int> *marked_order = nullptr);
     std::string get_stream_contents_no_exception(unsigned int page_id, const std::vector<std::pair<unsigned int, unsigned int>> &ids_gen, std::unordered_set<unsigned int> &visited_ids);
     DiffConverter get_diff_converter(const boost::optional<std::pair<std::string, pdf_object_t>> &encoding) const;
     ToUnicodeConverter get_to_unicode_converter(const dict_t &font_dict);
+    const cmap_t& get_cmap(const std::pair<unsigned int, unsigned int> &id_gen, CmapCache::cmap_type_t type);
     boost::optional<mediabox_t> get_box(const dict_t &dictionary,
                                         const boost::optional<mediabox_t> &parent_media_box) const;
     mediabox_t parse_rectangle(const std::pair<std::string, pdf_object_t> &rectangle) const;
     std::vector<std::vector<text_chunk_t>> extract_text(const std::string &page_content,
                                                         const std::string &resource_id,
                                                         const boost::optional<matrix_t> CTM,
-                                                        int xobject_nested);
+                                                        int xobject_nested,
+                                                        std::map<unsigned int, std::vector<text_chunk_t>> *marked = nullptr);
+    std::string render_marked_text(std::map<unsigned int, std::vector<text_chunk_t>> &marked,
+                                   const std::vector<unsigned int> &marked_order) const;
+    boost::optional<unsigned int> get_marked_id(const std::string &resource_id,
+                                                const std::pair<pdf_object_t, std::string> &properties);
     void get_pages_resources_int(std::unordered_set<unsigned int> &checked_nodes,
                                  const dict_t &parent_dict,
                                  const Fonts &parent_fonts,
                                  const boost::optional<mediabox_t> &parent_media_box,
                                  unsigned int parent_rotate);
-    Fonts get_fonts(const dict_t &dictionary, const Fonts &parent_fonts) const;
-    ConverterEngine* get_font_encoding(const std::string &font, const std::string &resource_id);
+    Fonts get_fonts(const dict_t &dictionary, const Fonts &parent_fonts);
+    ConverterEngine* get_font_encoding(const Fonts &resource_fonts);
     boost::optional<std::pair<std::string, pdf_object_t>> get_encoding(const dict_t &font_dict) const;
     bool get_XObject_data(const std::string &page_id, const std::string &XObject_name, const std::string &resource_name);
+    void set_regions(size_t page_num, unsigned int page_id);
+    bool is_in_regions(const coordinates_t &box) const;
+    bool is_form_in_regions(const std::string &resource_name, const matrix_t &ctm) const;
+    void add_text_chunk(extract_argument_t &arg, text_chunk_t &&chunk);
+    bool is_output_full() const;
 private:
     const std::string &doc;
     const ObjectStorage &storage;
     const dict_t &decrypt_data;
+    const pdf_extractor_options_t options;
+    Fonts::Cache fonts_cache;
     std::unordered_map<std::string, Fonts> fonts;
+    //root of page tree, it is read on first request of pages
+    const dict_t pages_root;
+    bool is_pages_loaded;
     std::vector<unsigned int> pages;
+    //pages found by /Count of page tree nodes before all tree is read
+    std::unordered_map<size_t, unsigned int> found_pages;
     std::unordered_map<std::string, dict_t> dicts;
     std::unordered_map<std::string, mediabox_t> media_boxes;
     std::unordered_map<std::string, unsigned int> rotates;
-    std::unordered_map<std::string, std::unordered_map<std::string, ConverterEngine>> converter_engine_cache;
+    std::unordered_map<const Fonts::font_data_t*, ConverterEngine> converter_engine_cache;
     std::unordered_map<std::string, std::string> XObject_streams;
+    std::unordered_map<std::string, std::pair<unsigned int, unsigned int>> XObject_ids;
     std::unordered_map<std::string, matrix_t> XObject_matrices;
-    std::unordered_map<unsigned int, cmap_t> cmap_cache;
+    std::unordered_map<unsigned int, std::shared_ptr<const cmap_t>> cmap_cache;
     std::unordered_map<std::string, dict_t> XObjects_cache;
+    //document catalog
+    const dict_t root_data;
+    //MCIDs of pages in order of structure tree, empty if text is laid out by geometry.
+    //Structure tree is read when the first page is extracted
+    boost::optional<std::unordered_map<unsigned int, std::vector<unsigned int>>> structure_order;
+    //options.regions of current page in coordinates of text chunks, empty if all text of page is extracted
+    std::vector<coordinates_t> regions;
+    //size of text of previous pages and of chunks of current page, it is compared with limits of options
+    size_t output_bytes;
+    size_t output_chars;
 };
 
 #endif //PAGES_EXTRACTOR_H
@@ -4,6 +4,8 @@
 #include <utility>
 #include <vector>
 #include <unordered_set>
+#include <unordered_map>
+#include <memory>
 #include <openssl/provider.h>
 #include <boost/regex.hpp>
 
@@ -365,10 +367,7 @@ map<size_t, size_t> get_id2offsets(const string &buffer, const vector<pair<size_
     return id2offsets;
 }
 
-string get_text(const string &buffer,
-                size_t cross_ref_offset,
-                const ObjectStorage &storage,
-                const dict_t &decrypt_data)
+dict_t get_root_data(const string &buffer, size_t cross_ref_offset, const ObjectStorage &storage)
 {
     size_t trailer_offset = cross_ref_offset;
     if (is_prefix(buffer.data() + cross_ref_offset, "xref"))
@@ -382,11 +381,30 @@ string get_text(const string &buffer,
     const pair<string, pdf_object_t> real_root_pair = storage.get_object(get_id_gen(root_pair.first).first);
     if (real_root_pair.second != DICTIONARY) throw pdf_error(FUNC_STRING + "/Root indirect object must be a dictionary");
 
-    const dict_t root_data = get_dictionary_data(real_root_pair.first, 0);
+    return get_dictionary_data(real_root_pair.first, 0);
+}
+
+unsigned int get_pages_id(const dict_t &root_data)
+{
     const pair<string, pdf_object_t> pages_pair = root_data.at("/Pages");
     if (pages_pair.second != INDIRECT_OBJECT) throw pdf_error(FUNC_STRING + "/Pages value must be INDRECT_OBJECT");
+    return get_id_gen(pages_pair.first).first;
+}
 
-    return PagesExtractor(get_id_gen(pages_pair.first).first, storage, decrypt_data, buffer).get_text();
+string get_text(const string &buffer,
+                size_t cross_ref_offset,
+                const ObjectStorage &storage,
+                const dict_t &decrypt_data,
+                const pdf_extractor_options_t &options)
+{
+    const dict_t root_data = get_root_data(buffer, cross_ref_offset, storage);
+    const unsigned int pages_id = get_pages_id(root_data);
+    return PagesExtractor(pages_id,
+                          storage,
+                          decrypt_data,
+                          buffer,
+                          options,
+                          root_data).get_text();
 }
 
 pair<string, pair<string, pdf_object_t>> get_id(const string &buffer, size_t start, size_t end)
@@ -450,13 +468,77 @@ void pdf_extractor_deinit()
 
 string pdf2txt(const string &buffer)
 {
-    size_t cross_ref_offset = get_cross_ref_offset(buffer);
+    return pdf2txt(buffer, pdf_extractor_options_t());
+}
+
+string pdf2txt(const string &buffer, pdf_extractor_layout_t layout)
+{
+    pdf_extractor_options_t options;
+    options.layout = layout;
+    return pdf2txt(buffer, options);
+}
+
+//offsets of objects by id, encrypt_data is filled by /Encrypt of trailer
+map<size_t, size_t> get_objects_offsets(const string &buffer, size_t &cross_ref_offset, dict_t &encrypt_data)
+{
+    cross_ref_offset = get_cross_ref_offset(buffer);
     const pair<vector<pair<size_t, size_t>>, bool> trailer_offsets = get_trailer_offsets(buffer, cross_ref_offset);
     map<size_t, size_t> id2offsets = trailer_offsets.second? get_id2offsets_broken(buffer) : get_id2offsets(buffer, trailer_offsets.first);
-    const dict_t encrypt_data = get_encrypt_data(buffer,
-                                                 trailer_offsets.first.at(0).first,
-                                                 trailer_offsets.first.at(0).second,
-                                                 id2offsets);
+    encrypt_data = get_encrypt_data(buffer,
+                                    trailer_offsets.first.at(0).first,
+                                    trailer_offsets.first.at(0).second,
+                                    id2offsets);
+    return id2offsets;
+}
+
+string pdf2txt(const string &buffer, const pdf_extractor_options_t &options)
+{
+    size_t cross_ref_offset;
+    dict_t encrypt_data;
+    map<size_t, size_t> id2offsets = get_objects_offsets(buffer, cross_ref_offset, encrypt_data);
     ObjectStorage storage(buffer, std::move(id2offsets), encrypt_data);
-    return get_text(buffer, cross_ref_offset, storage, encrypt_data);
+    return get_text(buffer, cross_ref_offset, storage, encrypt_data, options);
+}
+
+//xref, objects and page index of document live while it is open
+struct PdfExtractorDocument::impl_t
+{
+    impl_t(string &&buffer_arg, const pdf_extractor_options_t &options) : buffer(std::move(buffer_arg))
+    {
+        size_t cross_ref_offset;
+        map<size_t, size_t> id2offsets = get_objects_offsets(buffer, cross_ref_offset, encrypt_data);
+        storage.reset(new ObjectStorage(buffer, std::move(id2offsets), encrypt_data));
+        const dict_t root_data = get_root_data(buffer, cross_ref_offset, *storage);
+        const unsigned int pages_id = get_pages_id(root_data);
+        extractor.reset(new PagesExtractor(pages_id,
+                                           *storage,
+                                           encrypt_data,
+                                           buffer,
+                                           options,
+                                           root_data));
+    }
+
+    const string buffer;
+    dict_t encrypt_data;
+    unique_ptr<ObjectStorage> storage;
+    unique_ptr<PagesExtractor> extractor;
+};
+
+PdfExtractorDocument::PdfExtractorDocument(string buffer, const pdf_extractor_options_t &options) :
+                                           impl(new impl_t(std::move(buffer), options))
+{
+}
+
+PdfExtractorDocument::~PdfExtractorDocument()
+{
+}
+
+size_t PdfExtractorDocument::page_count()
+{
+    return impl->extractor->get_page_count();
+}
+
+string PdfExtractorDocument::extract_pages(size_t first, size_t last)
+{
+    return impl->extractor->get_text(first, last);
 }
@@ -2,9 +2,108 @@
 #define PDF_EXTRACTOR_H
 
 #include <string>
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+struct pdf_extractor_cache_stats_t
+{
+    size_t hits;
+    size_t misses;
+    size_t entries;
+    size_t bytes;
+    size_t limit;
+    size_t file_hits;
+    size_t file_entries;
+};
+
+//how much of layout is done for text of pages, faster tiers go first
+enum pdf_extractor_layout_t
+{
+    //strings in order of content stream, line is broken when string leaves the line of previous one
+    PDF_EXTRACTOR_LAYOUT_RAW,
+    //strings are joined to lines, lines go in order of content stream
+    PDF_EXTRACTOR_LAYOUT_LINES,
+    //lines are joined to text boxes, boxes go in reading order
+    PDF_EXTRACTOR_LAYOUT_FULL
+};
+
+//how text boxes are put in reading order by PDF_EXTRACTOR_LAYOUT_FULL
+enum pdf_extractor_engine_t
+{
+    //GROUPS for pages of up to PDF_EXTRACTOR_MAX_GROUPED_BOXES boxes, XY_CUT for larger ones
+    PDF_EXTRACTOR_ENGINE_AUTO,
+    //boxes are grouped by pairs, the closest pair goes first. Time is quadratic in number of boxes
+    PDF_EXTRACTOR_ENGINE_GROUPS,
+    //boxes are split recursively by the widest whitespace gaps: blocks go top down, columns go left to right
+    PDF_EXTRACTOR_ENGINE_XY_CUT
+};
+
+enum { PDF_EXTRACTOR_MAX_GROUPED_BOXES = 1000 };
+
+//rectangle of page in default user space(units and origin of /MediaBox), (x0, y0) and (x1, y1) are opposite corners
+struct pdf_extractor_region_t
+{
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+};
+
+struct pdf_extractor_options_t
+{
+    pdf_extractor_layout_t layout = PDF_EXTRACTOR_LAYOUT_FULL;
+    pdf_extractor_engine_t engine = PDF_EXTRACTOR_ENGINE_AUTO;
+    //threads for layout of one page. Large pages are split to tiles by whitespace gutters and tiles are laid out
+    //in parallel, text doesn't depend on number of threads
+    unsigned int threads = 1;
+    //text of tagged documents goes in order of their structure tree, marked content is laid out by lines in order
+    //of content stream. Text out of structure tree goes after it with usual layout. Order of all pages is taken
+    //from structure tree at once, so the first extracted page reads the whole tree
+    bool structure_order = false;
+    //only strings crossing one of rectangles of page are extracted, strings are not clipped. regions[i] is for page i,
+    //the last element is for the rest of pages, so one element is for all pages. Empty list of page skips the page.
+    //No regions extracts all text
+    std::vector<std::vector<pdf_extractor_region_t>> regions;
+    //extraction stops when text reaches max_output_bytes bytes or max_chars characters and text is cut to them,
+    //0 is no limit. Pages, annotations and forms after the limit aren't decoded
+    size_t max_output_bytes = 0;
+    size_t max_chars = 0;
+};
+
+//parsed pdf document, text of pages is extracted on demand without parsing of document again.
+//Object isn't thread safe, different objects may be used in different threads
+class PdfExtractorDocument
+{
+public:
+    //buffer is kept by object. Options are used for all pages
+    explicit PdfExtractorDocument(std::string buffer,
+                                  const pdf_extractor_options_t &options = pdf_extractor_options_t());
+    ~PdfExtractorDocument();
+    PdfExtractorDocument(const PdfExtractorDocument&) = delete;
+    PdfExtractorDocument& operator=(const PdfExtractorDocument&) = delete;
+    //number of pages by /Count of page tree
+    size_t page_count();
+    //text of pages [first, last), pages are numbered from 0. Page tree is read only on the way to requested pages
+    std::string extract_pages(size_t first, size_t last);
+private:
+    struct impl_t;
+    std::unique_ptr<impl_t> impl;
+};
 
 std::string pdf2txt(const std::string &buffer);
+std::string pdf2txt(const std::string &buffer, pdf_extractor_layout_t layout);
+std::string pdf2txt(const std::string &buffer, const pdf_extractor_options_t &options);
 void pdf_extractor_init();
 void pdf_extractor_deinit();
+//process-wide cache of parsed font cmaps shared by documents and threads. It holds up to bytes, 0 disables it
+void pdf_extractor_set_cache_limit(size_t bytes);
+pdf_extractor_cache_stats_t pdf_extractor_get_cache_stats();
+//file of parsed cmaps shared by processes. Cmaps of mapped file are used in place when they are not in process cache.
+//Returns false if file doesn't exist or was written by other version of library
+bool pdf_extractor_load_cache_file(const std::string &path);
+//writes cmaps of process cache and of mapped file, the most recently used ones first, while file fits max_bytes.
+//File is replaced atomically, so it can be saved while other processes use it
+void pdf_extractor_save_cache_file(const std::string &path, size_t max_bytes);
 
 #endif //PDF_EXTRACTOR
@@ -1,14 +1,470 @@
-{{"/Courier",  {{'{', 600},{'!', 600},{'"', 600},{'#', 600},{'$', 600},{'%', 600},{'&', 600}, {'\'', 600},{'(', 600},{')', 600},{'*', 600},{'+', 600},{',', 600},{'-', 600},{'.', 600},{'/', 600},{'0', 600},{'1', 600},{'2', 600},{'3', 600},{'4', 600},{'5', 600},{'6', 600},{'7', 600},{'8', 600},{'9', 600},{':', 600},{';', 600},{'<', 600},{'=', 600},{'>', 600},{'?', 600},{'@', 600},{'A', 600},{'B', 600},{'C', 600},{'D', 600},{'E', 600},{'F', 600},{'G', 600},{'H', 600},{'I', 600},{'J', 600},{'K', 600},{'L', 600},{'M', 600},{'N', 600},{'O', 600},{'P', 600},{'Q', 600},{'R', 600},{'S', 600},{'T', 600},{'U', 600},{'V', 600},{'W', 600},{'X', 600},{'Y', 600},{'Z', 600},{'[', 600},{'\\', 600},{']', 600},{'^', 600},{'_', 600},{'`', 600},{'a', 600},{'b', 600},{'c', 600},{'d', 600},{'e', 600},{'f', 600},{'g', 600},{'h', 600},{'i', 600},{'j', 600},{'k', 600},{'l', 600},{'m', 600},{'n', 600},{'o', 600},{'p', 600},{'q', 600},{'r', 600},{'s', 600},{'t', 600},{'u', 600},{'v', 600},{'w', 600},{'x', 600},{'y', 600},{'z', 600},{'{', 600},{'|', 600},{'}', 600},{'~', 600},{0xa1, 600},{0xa2, 600},{0xa3, 600},{0xa4, 600},{0xa5, 600},{0xa6, 600},{0xa7, 600},{0xa8, 600},{0xa9, 600},{0xaa, 600},{0xab, 600},{0xac, 600},{0xae, 600},{0xaf, 600},{0xb0, 600},{0xb1, 600},{0xb2, 600},{0xb3, 600},{0xb4, 600},{0xb5, 600},{0xb6, 600},{0xb7, 600},{0xb8, 600},{0xb9, 600},{0xba, 600},{0xbb, 600},{0xbc, 600},{0xbd, 600},{0xbe, 600},{0xbf, 600},{0xc0, 600},{0xc1, 600},{0xc2, 600},{0xc3, 600},{0xc4, 600},{0xc5, 600},{0xc6, 600},{0xc7, 600},{0xc8, 600},{0xc9, 600},{0xca, 600},{0xcb, 600},{0xcc, 600},{0xcd, 600},{0xce, 600},{0xcf, 600},{0xd0, 600},{0xd1, 600},{0xd2, 600},{0xd3, 600},{0xd4, 600},{0xd5, 600},{0xd6, 600},{0xd7, 600},{0xd8, 600},{0xd9, 600},{0xda, 600},{0xdb, 600},{0xdc, 600},{0xdd, 600},{0xde, 600},{0xdf, 600},{0xe0, 600},{0xe1, 600},{0xe2, 600},{0xe3, 600},{0xe4, 600},{0xe5, 600},{0xe6, 600},{0xe7, 600},{0xe8, 600},{0xe9, 600},{0xea, 600},{0xeb, 600},{0xec, 600},{0xed, 600},{0xee, 600},{0xef, 600},{0xf0, 600},{0xf1, 600},{0xf2, 600},{0xf3, 600},{0xf4, 600},{0xf5, 600},{0xf6, 600},{0xf7, 600},{0xf8, 600},{0xf9, 600},{0xfa, 600},{0xfb, 600},{0xfc, 600},{0xfd, 600},{0xfe, 600},{0xff, 600}, {0x0100, 600}, {0x0101, 600},{0x0102, 600},{0x0103, 600},{0x0104, 600},{0x0105, 600},{0x0106, 600},{0x0107, 600},{0x010c, 600},{0x010d, 600},{0x010e, 600},{0x010f, 600},{0x0110, 600},{0x0111, 600},{0x0112, 600},{0x0113, 600},{0x0116, 600},{0x0117, 600},{0x0118, 600},{0x0119, 600},{0x011a, 600},{0x011b, 600},{0x011e, 600},{0x011f, 600},{0x0122, 600},{0x0123, 600},{0x012a, 600},{0x012b, 600},{0x012e, 600},{0x012f, 600},{0x0130, 600},{0x0131, 600},{0x0136, 600},{0x0137, 600},{0x0139, 600},{0x013a, 600},{0x013b, 600},{0x013c, 600},{0x013d, 600},{0x013e, 600},{0x0141, 600},{0x0142, 600},{0x0143, 600},{0x0144, 600},{0x0145, 600},{0x0146, 600},{0x0147, 600},{0x0148, 600},{0x014c, 600},{0x014d, 600},{0x0150, 600},{0x0151, 600},{0x0152, 600},{0x0153, 600},{0x0154, 600},{0x0155, 600},{0x0156, 600},{0x0157, 600},{0x0158, 600},{0x0159, 600},{0x015a, 600},{0x015b, 600},{0x015e, 600},{0x015f, 600},{0x0160, 600},{0x0161, 600},{0x0162, 600},{0x0163, 600},{0x0164, 600},{0x0165, 600},{0x016a, 600},{0x016b, 600},{0x016e, 600},{0x016f, 600},{0x0170, 600},{0x0171, 600},{0x0172, 600},{0x0173, 600},{0x0178, 600},{0x0179, 600},{0x017a, 600},{0x017b, 600},{0x017c, 600},{0x017d, 600},{0x017e, 600},{0x0192, 600},{0x0218, 600},{0x0219, 600},{0x02c6, 600},{0x02c7, 600},{0x02d8, 600},{0x02d9, 600},{0x02da, 600},{0x02db, 600},{0x02dc, 600},{0x02dd, 600},{0x2013, 600},{0x2014, 600},{0x2018, 600},{0x2019, 600},{0x201a, 600},{0x201c, 600},{0x201d, 600},{0x201e, 600},{0x2020, 600},{0x2021, 600},{0x2022, 600},{0x2026, 600},{0x2030, 600},{0x2039, 600},{0x203a, 600},{0x2044, 600},{0x2122, 600},{0x2202, 600},{0x2206, 600},{0x2211, 600},{0x2212, 600},{0x221a, 600},{0x2260, 600},{0x2264, 600},{0x2265, 600},{0x25ca, 600},{0xf6c3, 600},{0xfb01, 600},{0xfb02, 600}}},
-{"/Courier-Oblique" , {{' ', 600}, {'!', 600}, {'"', 600},{'#', 600},{'$', 600},{'%', 600},{'&', 600}, {'\'', 600},{'(', 600},{')', 600},{'*', 600},{'+', 600},{',', 600},{'-', 600},{'.', 600},{'/', 600},{'0', 600},{'1', 600},{'2', 600},{'3', 600},{'4', 600},{'5', 600},{'6', 600},{'7', 600},{'8', 600},{'9', 600},{':', 600},{';', 600},{'<', 600},{'=', 600},{'>', 600},{'?', 600},{'@', 600},{'A', 600},{'B', 600},{'C', 600},{'D', 600},{'E', 600},{'F', 600},{'G', 600},{'H', 600},{'I', 600},{'J', 600},{'K', 600},{'L', 600},{'M', 600},{'N', 600},{'O', 600},{'P', 600},{'Q', 600},{'R', 600},{'S', 600},{'T', 600},{'U', 600},{'V', 600},{'W', 600},{'X', 600},{'Y', 600},{'Z', 600},{'[', 600},{'\\', 600},{']', 600},{'^', 600},{'_', 600},{'`', 600},{'a', 600},{'b', 600},{'c', 600},{'d', 600},{'e', 600},{'f', 600},{'g', 600},{'h', 600},{'i', 600},{'j', 600},{'k', 600},{'l', 600},{'m', 600},{'n', 600},{'o', 600},{'p', 600},{'q', 600},{'r', 600},{'s', 600},{'t', 600},{'u', 600},{'v', 600},{'w', 600},{'x', 600},{'y', 600},{'z', 600},{'{', 600},{'|', 600},{'}', 600},{'~', 600},{0xa1, 600},{0xa2, 600},{0xa3, 600},{0xa4, 600},{0xa5, 600},{0xa6, 600},{0xa7, 600},{0xa8, 600},{0xa9, 600},{0xaa, 600},{0xab, 600},{0xac, 600},{0xae, 600},{0xaf, 600},{0xb0, 600},{0xb1, 600},{0xb2, 600},{0xb3, 600},{0xb4, 600},{0xb5, 600},{0xb6, 600},{0xb7, 600},{0xb8, 600},{0xb9, 600},{0xba, 600},{0xbb, 600},{0xbc, 600},{0xbd, 600},{0xbe, 600},{0xbf, 600},{0xc0, 600},{0xc1, 600},{0xc2, 600},{0xc3, 600},{0xc4, 600},{0xc5, 600},{0xc6, 600},{0xc7, 600},{0xc8, 600},{0xc9, 600},{0xca, 600},{0xcb, 600},{0xcc, 600},{0xcd, 600},{0xce, 600},{0xcf, 600},{0xd0, 600},{0xd1, 600},{0xd2, 600},{0xd3, 600},{0xd4, 600},{0xd5, 600},{0xd6, 600},{0xd7, 600},{0xd8, 600},{0xd9, 600},{0xda, 600},{0xdb, 600},{0xdc, 600},{0xdd, 600},{0xde, 600},{0xdf, 600},{0xe0, 600},{0xe1, 600},{0xe2, 600},{0xe3, 600},{0xe4, 600},{0xe5, 600},{0xe6, 600},{0xe7, 600},{0xe8, 600},{0xe9, 600},{0xea, 600},{0xeb, 600},{0xec, 600},{0xed, 600},{0xee, 600},{0xef, 600},{0xf0, 600},{0xf1, 600},{0xf2, 600},{0xf3, 600},{0xf4, 600},{0xf5, 600},{0xf6, 600},{0xf7, 600},{0xf8, 600},{0xf9, 600},{0xfa, 600},{0xfb, 600},{0xfc, 600},{0xfd, 600},{0xfe, 600},{0xff, 600},{0x0100, 600},{0x0101, 600},{0x0102, 600},{0x0103, 600},{0x0104, 600},{0x0105, 600},{0x0106, 600},{0x0107, 600},{0x010c, 600},{0x010d, 600},{0x010e, 600},{0x010f, 600},{0x0110, 600},{0x0111, 600},{0x0112, 600},{0x0113, 600},{0x0116, 600},{0x0117, 600},{0x0118, 600},{0x0119, 600},{0x011a, 600},{0x011b, 600},{0x011e, 600},{0x011f, 600},{0x0122, 600},{0x0123, 600},{0x012a, 600},{0x012b, 600},{0x012e, 600},{0x012f, 600},{0x0130, 600},{0x0131, 600},{0x0136, 600},{0x0137, 600},{0x0139, 600},{0x013a, 600},{0x013b, 600},{0x013c, 600},{0x013d, 600},{0x013e, 600},{0x0141, 600},{0x0142, 600},{0x0143, 600},{0x0144, 600},{0x0145, 600},{0x0146, 600},{0x0147, 600},{0x0148, 600},{0x014c, 600},{0x014d, 600},{0x0150, 600},{0x0151, 600},{0x0152, 600},{0x0153, 600},{0x0154, 600},{0x0155, 600},{0x0156, 600},{0x0157, 600},{0x0158, 600},{0x0159, 600},{0x015a, 600},{0x015b, 600},{0x015e, 600},{0x015f, 600},{0x0160, 600},{0x0161, 600},{0x0162, 600},{0x0163, 600},{0x0164, 600},{0x0165, 600},{0x016a, 600},{0x016b, 600},{0x016e, 600},{0x016f, 600},{0x0170, 600},{0x0171, 600},{0x0172, 600},{0x0173, 600},{0x0178, 600},{0x0179, 600},{0x017a, 600},{0x017b, 600},{0x017c, 600},{0x017d, 600},{0x017e, 600},{0x0192, 600},{0x0218, 600},{0x0219, 600},{0x02c6, 600},{0x02c7, 600},{0x02d8, 600},{0x02d9, 600},{0x02da, 600},{0x02db, 600},{0x02dc, 600},{0x02dd, 600},{0x2013, 600},{0x2014, 600},{0x2018, 600},{0x2019, 600},{0x201a, 600},{0x201c, 600},{0x201d, 600},{0x201e, 600},{0x2020, 600},{0x2021, 600},{0x2022, 600},{0x2026, 600},{0x2030, 600},{0x2039, 600},{0x203a, 600},{0x2044, 600},{0x2122, 600},{0x2202, 600},{0x2206, 600},{0x2211, 600},{0x2212, 600},{0x221a, 600},{0x2260, 600},{0x2264, 600},{0x2265, 600},{0x25ca, 600},{0xf6c3, 600},{0xfb01, 600},{0xfb02, 600}}},
-{"/Courier-Bold", {{' ', 600},{'!', 600},{'"', 600},{'#', 600},{'$', 600},{'%', 600},{'&', 600}, {'\'', 600},{'(', 600},{')', 600},{'*', 600},{'+', 600},{',', 600},{'-', 600},{'.', 600},{'/', 600},{'0', 600},{'1', 600},{'2', 600},{'3', 600},{'4', 600},{'5', 600},{'6', 600},{'7', 600},{'8', 600},{'9', 600},{':', 600},{';', 600},{'<', 600},{'=', 600},{'>', 600},{'?', 600},{'@', 600},{'A', 600},{'B', 600},{'C', 600},{'D', 600},{'E', 600},{'F', 600},{'G', 600},{'H', 600},{'I', 600},{'J', 600},{'K', 600},{'L', 600},{'M', 600},{'N', 600},{'O', 600},{'P', 600},{'Q', 600},{'R', 600},{'S', 600},{'T', 600},{'U', 600},{'V', 600},{'W', 600},{'X', 600},{'Y', 600},{'Z', 600},{'[', 600},{'\\', 600},{']', 600},{'^', 600},{'_', 600},{'`', 600},{'a', 600},{'b', 600},{'c', 600},{'d', 600},{'e', 600},{'f', 600},{'g', 600},{'h', 600},{'i', 600},{'j', 600},{'k', 600},{'l', 600},{'m', 600},{'n', 600},{'o', 600},{'p', 600},{'q', 600},{'r', 600},{'s', 600},{'t', 600},{'u', 600},{'v', 600},{'w', 600},{'x', 600},{'y', 600},{'z', 600},{'{', 600},{'|', 600},{'}', 600},{'~', 600},{0xa1, 600},{0xa2, 600},{0xa3, 600},{0xa4, 600},{0xa5, 600},{0xa6, 600},{0xa7, 600},{0xa8, 600},{0xa9, 600},{0xaa, 600},{0xab, 600},{0xac, 600},{0xae, 600},{0xaf, 600},{0xb0, 600},{0xb1, 600},{0xb2, 600},{0xb3, 600},{0xb4, 600},{0xb5, 600},{0xb6, 600},{0xb7, 600},{0xb8, 600},{0xb9, 600},{0xba, 600},{0xbb, 600},{0xbc, 600},{0xbd, 600},{0xbe, 600},{0xbf, 600},{0xc0, 600},{0xc1, 600},{0xc2, 600},{0xc3, 600},{0xc4, 600},{0xc5, 600},{0xc6, 600},{0xc7, 600},{0xc8, 600},{0xc9, 600},{0xca, 600},{0xcb, 600},{0xcc, 600},{0xcd, 600},{0xce, 600},{0xcf, 600},{0xd0, 600},{0xd1, 600},{0xd2, 600},{0xd3, 600},{0xd4, 600},{0xd5, 600},{0xd6, 600},{0xd7, 600},{0xd8, 600},{0xd9, 600},{0xda, 600},{0xdb, 600},{0xdc, 600},{0xdd, 600},{0xde, 600},{0xdf, 600},{0xe0, 600},{0xe1, 600},{0xe2, 600},{0xe3, 600},{0xe4, 600},{0xe5, 600},{0xe6, 600},{0xe7, 600},{0xe8, 600},{0xe9, 600},{0xea, 600},{0xeb, 600},{0xec, 600},{0xed, 600},{0xee, 600},{0xef, 600},{0xf0, 600},{0xf1, 600},{0xf2, 600},{0xf3, 600},{0xf4, 600},{0xf5, 600},{0xf6, 600},{0xf7, 600},{0xf8, 600},{0xf9, 600},{0xfa, 600},{0xfb, 600},{0xfc, 600},{0xfd, 600},{0xfe, 600},{0xff, 600}, {0x0100, 600}, {0x0101, 600}, {0x0102, 600}, {0x0103, 600}, {0x0104, 600}, {0x0105, 600}, {0x0106, 600}, {0x0107, 600}, {0x010c, 600}, {0x010d, 600}, {0x010e, 600}, {0x010f, 600}, {0x0110, 600}, {0x0111, 600}, {0x0112, 600}, {0x0113, 600}, {0x0116, 600}, {0x0117, 600}, {0x0118, 600}, {0x0119, 600}, {0x011a, 600}, {0x011b, 600}, {0x011e, 600}, {0x011f, 600}, {0x0122, 600}, {0x0123, 600}, {0x012a, 600}, {0x012b, 600}, {0x012e, 600}, {0x012f, 600}, {0x0130, 600}, {0x0131, 600}, {0x0136, 600}, {0x0137, 600}, {0x0139, 600}, {0x013a, 600}, {0x013b, 600}, {0x013c, 600}, {0x013d, 600}, {0x013e, 600}, {0x0141, 600}, {0x0142, 600}, {0x0143, 600}, {0x0144, 600}, {0x0145, 600}, {0x0146, 600}, {0x0147, 600}, {0x0148, 600}, {0x014c, 600}, {0x014d, 600}, {0x0150, 600}, {0x0151, 600}, {0x0152, 600}, {0x0153, 600}, {0x0154, 600}, {0x0155, 600}, {0x0156, 600}, {0x0157, 600}, {0x0158, 600}, {0x0159, 600}, {0x015a, 600}, {0x015b, 600}, {0x015e, 600}, {0x015f, 600}, {0x0160, 600}, {0x0161, 600}, {0x0162, 600}, {0x0163, 600}, {0x0164, 600}, {0x0165, 600}, {0x016a, 600}, {0x016b, 600}, {0x016e, 600}, {0x016f, 600}, {0x0170, 600}, {0x0171, 600}, {0x0172, 600}, {0x0173, 600}, {0x0178, 600}, {0x0179, 600}, {0x017a, 600}, {0x017b, 600}, {0x017c, 600}, {0x017d, 600}, {0x017e, 600}, {0x0192, 600}, {0x0218, 600}, {0x0219, 600}, {0x02c6, 600}, {0x02c7, 600}, {0x02d8, 600}, {0x02d9, 600}, {0x02da, 600}, {0x02db, 600}, {0x02dc, 600}, {0x02dd, 600}, {0x2013, 600}, {0x2014, 600}, {0x2018, 600}, {0x2019, 600}, {0x201a, 600}, {0x201c, 600}, {0x201d, 600}, {0x201e, 600}, {0x2020, 600}, {0x2021, 600}, {0x2022, 600}, {0x2026, 600}, {0x2030, 600}, {0x2039, 600}, {0x203a, 600}, {0x2044, 600}, {0x2122, 600}, {0x2202, 600}, {0x2206, 600}, {0x2211, 600}, {0x2212, 600}, {0x221a, 600}, {0x2260, 600}, {0x2264, 600}, {0x2265, 600}, {0x25ca, 600}, {0xf6c3, 600}, {0xfb01, 600}, {0xfb02, 600}}},
-{"/Courier-BoldOblique", {{' ', 600},{'!', 600},{'"', 600},{'#', 600},{'$', 600},{'%', 600},{'&', 600}, {'\'', 600},{'(', 600},{')', 600},{'*', 600},{'+', 600},{',', 600},{'-', 600},{'.', 600},{'/', 600},{'0', 600},{'1', 600},{'2', 600},{'3', 600},{'4', 600},{'5', 600},{'6', 600},{'7', 600},{'8', 600},{'9', 600},{':', 600},{';', 600},{'<', 600},{'=', 600},{'>', 600},{'?', 600},{'@', 600},{'A', 600},{'B', 600},{'C', 600},{'D', 600},{'E', 600},{'F', 600},{'G', 600},{'H', 600},{'I', 600},{'J', 600},{'K', 600},{'L', 600},{'M', 600},{'N', 600},{'O', 600},{'P', 600},{'Q', 600},{'R', 600},{'S', 600},{'T', 600},{'U', 600},{'V', 600},{'W', 600},{'X', 600},{'Y', 600},{'Z', 600},{'[', 600},{'\\', 600},{']', 600},{'^', 600},{'_', 600},{'`', 600},{'a', 600},{'b', 600},{'c', 600},{'d', 600},{'e', 600},{'f', 600},{'g', 600},{'h', 600},{'i', 600},{'j', 600},{'k', 600},{'l', 600},{'m', 600},{'n', 600},{'o', 600},{'p', 600},{'q', 600},{'r', 600},{'s', 600},{'t', 600},{'u', 600},{'v', 600},{'w', 600},{'x', 600},{'y', 600},{'z', 600},{'{', 600},{'|', 600},{'}', 600},{'~', 600},{0xa1, 600},{0xa2, 600},{0xa3, 600},{0xa4, 600},{0xa5, 600},{0xa6, 600},{0xa7, 600},{0xa8, 600},{0xa9, 600},{0xaa, 600},{0xab, 600},{0xac, 600},{0xae, 600},{0xaf, 600},{0xb0, 600},{0xb1, 600},{0xb2, 600},{0xb3, 600},{0xb4, 600},{0xb5, 600},{0xb6, 600},{0xb7, 600},{0xb8, 600},{0xb9, 600},{0xba, 600},{0xbb, 600},{0xbc, 600},{0xbd, 600},{0xbe, 600},{0xbf, 600},{0xc0, 600},{0xc1, 600},{0xc2, 600},{0xc3, 600},{0xc4, 600},{0xc5, 600},{0xc6, 600},{0xc7, 600},{0xc8, 600},{0xc9, 600},{0xca, 600},{0xcb, 600},{0xcc, 600},{0xcd, 600},{0xce, 600},{0xcf, 600},{0xd0, 600},{0xd1, 600},{0xd2, 600},{0xd3, 600},{0xd4, 600},{0xd5, 600},{0xd6, 600},{0xd7, 600},{0xd8, 600},{0xd9, 600},{0xda, 600},{0xdb, 600},{0xdc, 600},{0xdd, 600},{0xde, 600},{0xdf, 600},{0xe0, 600},{0xe1, 600},{0xe2, 600},{0xe3, 600},{0xe4, 600},{0xe5, 600},{0xe6, 600},{0xe7, 600},{0xe8, 600},{0xe9, 600},{0xea, 600},{0xeb, 600},{0xec, 600},{0xed, 600},{0xee, 600},{0xef, 600},{0xf0, 600},{0xf1, 600},{0xf2, 600},{0xf3, 600},{0xf4, 600},{0xf5, 600},{0xf6, 600},{0xf7, 600},{0xf8, 600},{0xf9, 600},{0xfa, 600},{0xfb, 600},{0xfc, 600},{0xfd, 600},{0xfe, 600},{0xff, 600},{0x0100, 600},{0x0101, 600},{0x0102, 600},{0x0103, 600},{0x0104, 600},{0x0105, 600},{0x0106, 600},{0x0107, 600},{0x010c, 600},{0x010d, 600},{0x010e, 600},{0x010f, 600},{0x0110, 600},{0x0111, 600},{0x0112, 600},{0x0113, 600},{0x0116, 600},{0x0117, 600},{0x0118, 600},{0x0119, 600},{0x011a, 600},{0x011b, 600},{0x011e, 600},{0x011f, 600},{0x0122, 600},{0x0123, 600},{0x012a, 600},{0x012b, 600},{0x012e, 600},{0x012f, 600},{0x0130, 600},{0x0131, 600},{0x0136, 600},{0x0137, 600},{0x0139, 600},{0x013a, 600},{0x013b, 600},{0x013c, 600},{0x013d, 600},{0x013e, 600},{0x0141, 600},{0x0142, 600},{0x0143, 600},{0x0144, 600},{0x0145, 600},{0x0146, 600},{0x0147, 600},{0x0148, 600},{0x014c, 600},{0x014d, 600},{0x0150, 600},{0x0151, 600},{0x0152, 600},{0x0153, 600},{0x0154, 600},{0x0155, 600},{0x0156, 600},{0x0157, 600},{0x0158, 600},{0x0159, 600},{0x015a, 600},{0x015b, 600},{0x015e, 600},{0x015f, 600},{0x0160, 600},{0x0161, 600},{0x0162, 600},{0x0163, 600},{0x0164, 600},{0x0165, 600},{0x016a, 600},{0x016b, 600},{0x016e, 600},{0x016f, 600},{0x0170, 600},{0x0171, 600},{0x0172, 600},{0x0173, 600},{0x0178, 600},{0x0179, 600},{0x017a, 600},{0x017b, 600},{0x017c, 600},{0x017d, 600},{0x017e, 600},{0x0192, 600},{0x0218, 600},{0x0219, 600},{0x02c6, 600},{0x02c7, 600},{0x02d8, 600},{0x02d9, 600},{0x02da, 600},{0x02db, 600},{0x02dc, 600},{0x02dd, 600},{0x2013, 600},{0x2014, 600},{0x2018, 600},{0x2019, 600},{0x201a, 600},{0x201c, 600},{0x201d, 600},{0x201e, 600},{0x2020, 600},{0x2021, 600},{0x2022, 600},{0x2026, 600},{0x2030, 600},{0x2039, 600},{0x203a, 600},{0x2044, 600},{0x2122, 600},{0x2202, 600},{0x2206, 600},{0x2211, 600},{0x2212, 600},{0x221a, 600},{0x2260, 600},{0x2264, 600},{0x2265, 600},{0x25ca, 600},{0xf6c3, 600},{0xfb01, 600},{0xfb02, 600}}},
- {"/Helvetica", {{' ', 278},{'!', 278},{'"', 355},{'#', 556},{'$', 556},{'%', 889},{'&', 667}, {'\'', 191},{'(', 333},{')', 333},{'*', 389},{'+', 584},{',', 278},{'-', 333},{'.', 278},{'/', 278},{'0', 556},{'1', 556},{'2', 556},{'3', 556},{'4', 556},{'5', 556},{'6', 556},{'7', 556},{'8', 556},{'9', 556},{':', 278},{';', 278},{'<', 584},{'=', 584},{'>', 584},{'?', 556},{'@', 1015},{'A', 667},{'B', 667},{'C', 722},{'D', 722},{'E', 667},{'F', 611},{'G', 778},{'H', 722},{'I', 278},{'J', 500},{'K', 667},{'L', 556},{'M', 833},{'N', 722},{'O', 778},{'P', 667},{'Q', 778},{'R', 722},{'S', 667},{'T', 611}, {'U', 722},{'V', 667},{'W', 944},{'X', 667},{'Y', 667},{'Z', 611},{'[', 278},{'\\', 278},{']', 278},{'^', 469},{'_', 556},{'`', 333},{'a', 556},{'b', 556},{'c', 500},{'d', 556},{'e', 556},{'f', 278},{'g', 556},{'h', 556},{'i', 222},{'j', 222},{'k', 500},{'l', 222},{'m', 833},{'n', 556},{'o', 556},{'p', 556},{'q', 556},{'r', 333},{'s', 500},{'t', 278},{'u', 556},{'v', 500},{'w', 722},{'x', 500},{'y', 500},{'z', 500},{'{', 334},{'|', 260},{'}', 334},{'~', 584},{0xa1, 333},{0xa2, 556},{0xa3, 556},{0xa4, 556},{0xa5, 556},{0xa6, 260},{0xa7, 556},{0xa8, 333},{0xa9, 737},{0xaa, 370},{0xab, 556},{0xac, 584},{0xae, 737},{0xaf, 333},{0xb0, 400},{0xb1, 584},{0xb2, 333},{0xb3, 333},{0xb4, 333},{0xb5, 556},{0xb6, 537},{0xb7, 278},{0xb8, 333},{0xb9, 333},{0xba, 365},{0xbb, 556},{0xbc, 834},{0xbd, 834},{0xbe, 834},{0xbf, 611},{0xc0, 667},{0xc1, 667},{0xc2, 667},{0xc3, 667},{0xc4, 667},{0xc5, 667},{0xc6, 1000},{0xc7, 722},{0xc8, 667},{0xc9, 667},{0xca, 667},{0xcb, 667},{0xcc, 278},{0xcd, 278},{0xce, 278},{0xcf, 278},{0xd0, 722},{0xd1, 722},{0xd2, 778},{0xd3, 778},{0xd4, 778},{0xd5, 778},{0xd6, 778},{0xd7, 584},{0xd8, 778},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 667},{0xde, 667},{0xdf, 611},{0xe0, 556},{0xe1, 556},{0xe2, 556},{0xe3, 556},{0xe4, 556},{0xe5, 556},{0xe6, 889},{0xe7, 500},{0xe8, 556},{0xe9, 556},{0xea, 556},{0xeb, 556},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 556},{0xf1, 556},{0xf2, 556},{0xf3, 556},{0xf4, 556},{0xf5, 556},{0xf6, 556},{0xf7, 584},{0xf8, 611},{0xf9, 556},{0xfa, 556},{0xfb, 556},{0xfc, 556},{0xfd, 500},{0xfe, 556},{0xff, 500},{0x0100, 667},{0x0101, 556},{0x0102, 667},{0x0103, 556},{0x0104, 667},{0x0105, 556},{0x0106, 722},{0x0107, 500},{0x010c, 722},{0x010d, 500},{0x010e, 722},{0x010f, 643},{0x0110, 722},{0x0111, 556},{0x0112, 667},{0x0113, 556},{0x0116, 667},{0x0117, 556},{0x0118, 667},{0x0119, 556},{0x011a, 667},{0x011b, 556},{0x011e, 778},{0x011f, 556},{0x0122, 778},{0x0123, 556},{0x012a, 278},{0x012b, 278},{0x012e, 278},{0x012f, 222},{0x0130, 278},{0x0131, 278},{0x0136, 667},{0x0137, 500},{0x0139, 556},{0x013a, 222},{0x013b, 556},{0x013c, 222},{0x013d, 556},{0x013e, 299},{0x0141, 556},{0x0142, 222},{0x0143, 722},{0x0144, 556},{0x0145, 722},{0x0146, 556},{0x0147, 722},{0x0148, 556},{0x014c, 778},{0x014d, 556},{0x0150, 778},{0x0151, 556},{0x0152, 1000},{0x0153, 944},{0x0154, 722},{0x0155, 333},{0x0156, 722},{0x0157, 333},{0x0158, 722},{0x0159, 333},{0x015a, 667},{0x015b, 500},{0x015e, 667},{0x015f, 500},{0x0160, 667},{0x0161, 500},{0x0162, 611},{0x0163, 278},{0x0164, 611},{0x0165, 317},{0x016a, 722},{0x016b, 556},{0x016e, 722},{0x016f, 556},{0x0170, 722},{0x0171, 556},{0x0172, 722},{0x0173, 556},{0x0178, 667},{0x0179, 611},{0x017a, 500},{0x017b, 611},{0x017c, 500},{0x017d, 611},{0x017e, 500},{0x0192, 556},{0x0218, 667},{0x0219, 500},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 556},{0x2014, 1000},{0x2018, 222},{0x2019, 222},{0x201a, 222},{0x201c, 333},{0x201d, 333},{0x201e, 333},{0x2020, 556},{0x2021, 556},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 1000},{0x2202, 476},{0x2206, 612},{0x2211, 600},{0x2212, 584},{0x221a, 453},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 471},{0xf6c3, 250},{0xfb01, 500},{0xfb02, 500}}},
-{"/Helvetica-Bold", {{' ', 278},{'!', 333},{'"', 474},{'#', 556},{'$', 556},{'%', 889},{'&', 722}, {'\'', 238},{'(', 333},{')', 333},{'*', 389},{'+', 584},{',', 278},{'-', 333},{'.', 278},{'/', 278},{'0', 556},{'1', 556},{'2', 556},{'3', 556},{'4', 556},{'5', 556},{'6', 556},{'7', 556},{'8', 556},{'9', 556},{':', 333},{';', 333},{'<', 584},{'=', 584},{'>', 584},{'?', 611},{'@', 975},{'A', 722},{'B', 722},{'C', 722},{'D', 722},{'E', 667},{'F', 611},{'G', 778},{'H', 722},{'I', 278},{'J', 556},{'K', 722},{'L', 611},{'M', 833},{'N', 722},{'O', 778},{'P', 667},{'Q', 778},{'R', 722},{'S', 667},{'T', 611},{'U', 722},{'V', 667},{'W', 944},{'X', 667},{'Y', 667},{'Z', 611},{'[', 333},{'\\', 278},{']', 333},{'^', 584},{'_', 556},{'`', 333},{'a', 556},{'b', 611},{'c', 556},{'d', 611},{'e', 556},{'f', 333},{'g', 611},{'h', 611},{'i', 278},{'j', 278},{'k', 556},{'l', 278},{'m', 889},{'n', 611},{'o', 611},{'p', 611},{'q', 611},{'r', 389},{'s', 556},{'t', 333},{'u', 611},{'v', 556},{'w', 778},{'x', 556},{'y', 556},{'z', 500},{'{', 389},{'|', 280},{'}', 389},{'~', 584},{0xa1, 333},{0xa2, 556},{0xa3, 556},{0xa4, 556},{0xa5, 556},{0xa6, 280},{0xa7, 556},{0xa8, 333},{0xa9, 737},{0xaa, 370},{0xab, 556},{0xac, 584},{0xae, 737},{0xaf, 333},{0xb0, 400},{0xb1, 584},{0xb2, 333},{0xb3, 333},{0xb4, 333},{0xb5, 611},{0xb6, 556},{0xb7, 278},{0xb8, 333},{0xb9, 333},{0xba, 365},{0xbb, 556},{0xbc, 834},{0xbd, 834},{0xbe, 834},{0xbf, 611},{0xc0, 722},{0xc1, 722},{0xc2, 722},{0xc3, 722},{0xc4, 722},{0xc5, 722},{0xc6, 1000},{0xc7, 722},{0xc8, 667},{0xc9, 667},{0xca, 667},{0xcb, 667},{0xcc, 278},{0xcd, 278},{0xce, 278},{0xcf, 278},{0xd0, 722},{0xd1, 722},{0xd2, 778},{0xd3, 778},{0xd4, 778},{0xd5, 778},{0xd6, 778},{0xd7, 584},{0xd8, 778},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 667},{0xde, 667},{0xdf, 611},{0xe0, 556},{0xe1, 556},{0xe2, 556},{0xe3, 556},{0xe4, 556},{0xe5, 556},{0xe6, 889},{0xe7, 556},{0xe8, 556},{0xe9, 556},{0xea, 556},{0xeb, 556},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 611},{0xf1, 611},{0xf2, 611},{0xf3, 611},{0xf4, 611},{0xf5, 611},{0xf6, 611},{0xf7, 584},{0xf8, 611},{0xf9, 611},{0xfa, 611},{0xfb, 611},{0xfc, 611},{0xfd, 556},{0xfe, 611},{0xff, 556},{0x0100, 722},{0x0101, 556},{0x0102, 722},{0x0103, 556},{0x0104, 722},{0x0105, 556},{0x0106, 722},{0x0107, 556},{0x010c, 722},{0x010d, 556},{0x010e, 722},{0x010f, 743},{0x0110, 722},{0x0111, 611},{0x0112, 667},{0x0113, 556},{0x0116, 667},{0x0117, 556},{0x0118, 667},{0x0119, 556},{0x011a, 667},{0x011b, 556},{0x011e, 778},{0x011f, 611},{0x0122, 778},{0x0123, 611},{0x012a, 278},{0x012b, 278},{0x012e, 278},{0x012f, 278},{0x0130, 278},{0x0131, 278},{0x0136, 722},{0x0137, 556},{0x0139, 611},{0x013a, 278},{0x013b, 611},{0x013c, 278},{0x013d, 611},{0x013e, 400},{0x0141, 611},{0x0142, 278},{0x0143, 722},{0x0144, 611},{0x0145, 722},{0x0146, 611},{0x0147, 722},{0x0148, 611},{0x014c, 778},{0x014d, 611},{0x0150, 778},{0x0151, 611},{0x0152, 1000},{0x0153, 944},{0x0154, 722},{0x0155, 389},{0x0156, 722},{0x0157, 389},{0x0158, 722},{0x0159, 389},{0x015a, 667},{0x015b, 556},{0x015e, 667},{0x015f, 556},{0x0160, 667},{0x0161, 556},{0x0162, 611},{0x0163, 333},{0x0164, 611},{0x0165, 389},{0x016a, 722},{0x016b, 611},{0x016e, 722},{0x016f, 611},{0x0170, 722},{0x0171, 611},{0x0172, 722},{0x0173, 611},{0x0178, 667},{0x0179, 611},{0x017a, 500},{0x017b, 611},{0x017c, 500},{0x017d, 611},{0x017e, 500},{0x0192, 556},{0x0218, 667},{0x0219, 556},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 556},{0x2014, 1000},{0x2018, 278},{0x2019, 278},{0x201a, 278},{0x201c, 500},{0x201d, 500},{0x201e, 500},{0x2020, 556},{0x2021, 556},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 1000},{0x2202, 494},{0x2206, 612},{0x2211, 600},{0x2212, 584},{0x221a, 549},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 494},{0xf6c3, 250},{0xfb01, 611},{0xfb02, 611}}},
-{"/Helvetica-BoldOblique", {{' ', 278},{'!', 333},{'"', 474},{'#', 556},{'$', 556},{'%', 889},{'&', 722}, {'\'', 238},{'(', 333},{')', 333},{'*', 389},{'+', 584},{',', 278},{'-', 333},{'.', 278},{'/', 278},{'0', 556},{'1', 556},{'2', 556},{'3', 556},{'4', 556},{'5', 556},{'6', 556},{'7', 556},{'8', 556},{'9', 556},{':', 333},{';', 333},{'<', 584},{'=', 584},{'>', 584},{'?', 611},{'@', 975},{'A', 722},{'B', 722},{'C', 722},{'D', 722},{'E', 667},{'F', 611},{'G', 778},{'H', 722},{'I', 278},{'J', 556},{'K', 722},{'L', 611},{'M', 833},{'N', 722},{'O', 778},{'P', 667},{'Q', 778},{'R', 722},{'S', 667},{'T', 611},{'U', 722},{'V', 667},{'W', 944},{'X', 667},{'Y', 667},{'Z', 611},{'[', 333},{'\\', 278},{']', 333},{'^', 584},{'_', 556},{'`', 333},{'a', 556},{'b', 611},{'c', 556},{'d', 611},{'e', 556},{'f', 333},{'g', 611},{'h', 611},{'i', 278},{'j', 278},{'k', 556},{'l', 278},{'m', 889},{'n', 611},{'o', 611},{'p', 611},{'q', 611},{'r', 389},{'s', 556},{'t', 333},{'u', 611},{'v', 556},{'w', 778},{'x', 556},{'y', 556},{'z', 500},{'{', 389},{'|', 280},{'}', 389},{'~', 584},{0xa1, 333},{0xa2, 556},{0xa3, 556},{0xa4, 556},{0xa5, 556},{0xa6, 280},{0xa7, 556},{0xa8, 333},{0xa9, 737},{0xaa, 370},{0xab, 556},{0xac, 584},{0xae, 737},{0xaf, 333},{0xb0, 400},{0xb1, 584},{0xb2, 333},{0xb3, 333},{0xb4, 333},{0xb5, 611},{0xb6, 556},{0xb7, 278},{0xb8, 333},{0xb9, 333},{0xba, 365},{0xbb, 556},{0xbc, 834},{0xbd, 834},{0xbe, 834},{0xbf, 611},{0xc0, 722},{0xc1, 722},{0xc2, 722},{0xc3, 722},{0xc4, 722},{0xc5, 722},{0xc6, 1000},{0xc7, 722},{0xc8, 667},{0xc9, 667},{0xca, 667},{0xcb, 667},{0xcc, 278},{0xcd, 278},{0xce, 278},{0xcf, 278},{0xd0, 722},{0xd1, 722},{0xd2, 778},{0xd3, 778},{0xd4, 778},{0xd5, 778},{0xd6, 778},{0xd7, 584},{0xd8, 778},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 667},{0xde, 667},{0xdf, 611},{0xe0, 556},{0xe1, 556},{0xe2, 556},{0xe3, 556},{0xe4, 556},{0xe5, 556},{0xe6, 889},{0xe7, 556},{0xe8, 556},{0xe9, 556},{0xea, 556},{0xeb, 556},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 611},{0xf1, 611},{0xf2, 611},{0xf3, 611},{0xf4, 611},{0xf5, 611},{0xf6, 611},{0xf7, 584},{0xf8, 611},{0xf9, 611},{0xfa, 611},{0xfb, 611},{0xfc, 611},{0xfd, 556},{0xfe, 611},{0xff, 556},{0x0100, 722},{0x0101, 556},{0x0102, 722},{0x0103, 556},{0x0104, 722},{0x0105, 556},{0x0106, 722},{0x0107, 556},{0x010c, 722},{0x010d, 556},{0x010e, 722},{0x010f, 743},{0x0110, 722},{0x0111, 611},{0x0112, 667},{0x0113, 556},{0x0116, 667},{0x0117, 556},{0x0118, 667},{0x0119, 556},{0x011a, 667},{0x011b, 556},{0x011e, 778},{0x011f, 611},{0x0122, 778},{0x0123, 611},{0x012a, 278},{0x012b, 278},{0x012e, 278},{0x012f, 278},{0x0130, 278},{0x0131, 278},{0x0136, 722},{0x0137, 556},{0x0139, 611},{0x013a, 278},{0x013b, 611},{0x013c, 278},{0x013d, 611},{0x013e, 400},{0x0141, 611},{0x0142, 278},{0x0143, 722},{0x0144, 611},{0x0145, 722},{0x0146, 611},{0x0147, 722},{0x0148, 611},{0x014c, 778},{0x014d, 611},{0x0150, 778},{0x0151, 611},{0x0152, 1000},{0x0153, 944},{0x0154, 722},{0x0155, 389},{0x0156, 722},{0x0157, 389},{0x0158, 722},{0x0159, 389},{0x015a, 667},{0x015b, 556},{0x015e, 667},{0x015f, 556},{0x0160, 667},{0x0161, 556},{0x0162, 611},{0x0163, 333},{0x0164, 611},{0x0165, 389},{0x016a, 722},{0x016b, 611},{0x016e, 722},{0x016f, 611},{0x0170, 722},{0x0171, 611},{0x0172, 722},{0x0173, 611},{0x0178, 667},{0x0179, 611},{0x017a, 500},{0x017b, 611},{0x017c, 500},{0x017d, 611},{0x017e, 500},{0x0192, 556},{0x0218, 667},{0x0219, 556},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 556},{0x2014, 1000},{0x2018, 278},{0x2019, 278},{0x201a, 278},{0x201c, 500},{0x201d, 500},{0x201e, 500},{0x2020, 556},{0x2021, 556},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 1000},{0x2202, 494},{0x2206, 612},{0x2211, 600},{0x2212, 584},{0x221a, 549},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 494},{0xf6c3, 250},{0xfb01, 611},{0xfb02, 611}}},
-{"/Helvetica-Oblique", {{' ', 278},{'!', 278},{'"', 355},{'#', 556},{'$', 556},{'%', 889},{'&', 667}, {'\'', 191},{'(', 333},{')', 333},{'*', 389},{'+', 584},{',', 278},{'-', 333},{'.', 278},{'/', 278},{'0', 556},{'1', 556},{'2', 556},{'3', 556},{'4', 556},{'5', 556},{'6', 556},{'7', 556},{'8', 556},{'9', 556},{':', 278},{';', 278},{'<', 584},{'=', 584},{'>', 584},{'?', 556},{'@', 1015},{'A', 667},{'B', 667},{'C', 722},{'D', 722},{'E', 667},{'F', 611},{'G', 778},{'H', 722},{'I', 278},{'J', 500},{'K', 667},{'L', 556},{'M', 833},{'N', 722},{'O', 778},{'P', 667},{'Q', 778},{'R', 722},{'S', 667},{'T', 611},{'U', 722},{'V', 667},{'W', 944},{'X', 667},{'Y', 667},{'Z', 611},{'[', 278},{'\\', 278},{']', 278},{'^', 469},{'_', 556},{'`', 333},{'a', 556},{'b', 556},{'c', 500},{'d', 556},{'e', 556},{'f', 278},{'g', 556},{'h', 556},{'i', 222},{'j', 222},{'k', 500},{'l', 222},{'m', 833},{'n', 556},{'o', 556},{'p', 556},{'q', 556},{'r', 333},{'s', 500},{'t', 278},{'u', 556},{'v', 500},{'w', 722},{'x', 500},{'y', 500},{'z', 500},{'{', 334},{'|', 260},{'}', 334},{'~', 584},{0xa1, 333},{0xa2, 556},{0xa3, 556},{0xa4, 556},{0xa5, 556},{0xa6, 260},{0xa7, 556},{0xa8, 333},{0xa9, 737},{0xaa, 370},{0xab, 556},{0xac, 584},{0xae, 737},{0xaf, 333},{0xb0, 400},{0xb1, 584},{0xb2, 333},{0xb3, 333},{0xb4, 333},{0xb5, 556},{0xb6, 537},{0xb7, 278},{0xb8, 333},{0xb9, 333},{0xba, 365},{0xbb, 556},{0xbc, 834},{0xbd, 834},{0xbe, 834},{0xbf, 611},{0xc0, 667},{0xc1, 667},{0xc2, 667},{0xc3, 667},{0xc4, 667},{0xc5, 667},{0xc6, 1000},{0xc7, 722},{0xc8, 667},{0xc9, 667},{0xca, 667},{0xcb, 667},{0xcc, 278},{0xcd, 278},{0xce, 278},{0xcf, 278},{0xd0, 722},{0xd1, 722},{0xd2, 778},{0xd3, 778},{0xd4, 778},{0xd5, 778},{0xd6, 778},{0xd7, 584},{0xd8, 778},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 667},{0xde, 667},{0xdf, 611},{0xe0, 556},{0xe1, 556},{0xe2, 556},{0xe3, 556},{0xe4, 556},{0xe5, 556},{0xe6, 889},{0xe7, 500},{0xe8, 556},{0xe9, 556},{0xea, 556},{0xeb, 556},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 556},{0xf1, 556},{0xf2, 556},{0xf3, 556},{0xf4, 556},{0xf5, 556},{0xf6, 556},{0xf7, 584},{0xf8, 611},{0xf9, 556},{0xfa, 556},{0xfb, 556},{0xfc, 556},{0xfd, 500},{0xfe, 556},{0xff, 500},{0x0100, 667},{0x0101, 556},{0x0102, 667},{0x0103, 556},{0x0104, 667},{0x0105, 556},{0x0106, 722},{0x0107, 500},{0x010c, 722},{0x010d, 500},{0x010e, 722},{0x010f, 643},{0x0110, 722},{0x0111, 556},{0x0112, 667},{0x0113, 556},{0x0116, 667},{0x0117, 556},{0x0118, 667},{0x0119, 556},{0x011a, 667},{0x011b, 556},{0x011e, 778},{0x011f, 556},{0x0122, 778},{0x0123, 556},{0x012a, 278},{0x012b, 278},{0x012e, 278},{0x012f, 222},{0x0130, 278},{0x0131, 278},{0x0136, 667},{0x0137, 500},{0x0139, 556},{0x013a, 222},{0x013b, 556},{0x013c, 222},{0x013d, 556},{0x013e, 299},{0x0141, 556},{0x0142, 222},{0x0143, 722},{0x0144, 556},{0x0145, 722},{0x0146, 556},{0x0147, 722},{0x0148, 556},{0x014c, 778},{0x014d, 556},{0x0150, 778},{0x0151, 556},{0x0152, 1000},{0x0153, 944},{0x0154, 722},{0x0155, 333},{0x0156, 722},{0x0157, 333},{0x0158, 722},{0x0159, 333},{0x015a, 667},{0x015b, 500},{0x015e, 667},{0x015f, 500},{0x0160, 667},{0x0161, 500},{0x0162, 611},{0x0163, 278},{0x0164, 611},{0x0165, 317},{0x016a, 722},{0x016b, 556},{0x016e, 722},{0x016f, 556},{0x0170, 722},{0x0171, 556},{0x0172, 722},{0x0173, 556},{0x0178, 667},{0x0179, 611},{0x017a, 500},{0x017b, 611},{0x017c, 500},{0x017d, 611},{0x017e, 500},{0x0192, 556},{0x0218, 667},{0x0219, 500},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 556},{0x2014, 1000},{0x2018, 222},{0x2019, 222},{0x201a, 222},{0x201c, 333},{0x201d, 333},{0x201e, 333},{0x2020, 556},{0x2021, 556},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 1000},{0x2202, 476},{0x2206, 612},{0x2211, 600},{0x2212, 584},{0x221a, 453},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 471},{0xf6c3, 250},{0xfb01, 500},{0xfb02, 500}}},
-{"/Symbol", {{' ', 250}, {'!', 333},{'#', 500},{'%', 833},{'&', 778},{'(', 333},{')', 333},{'+', 549},{',', 250},{'.', 250},{'/', 278},{'0', 500},{'1', 500},{'2', 500},{'3', 500},{'4', 500},{'5', 500},{'6', 500},{'7', 500},{'8', 500},{'9', 500},{':', 278},{';', 278},{'<', 549},{'=', 549},{'>', 549},{'?', 444},{'[', 333},{']', 333},{'_', 500},{'{', 480},{'|', 200},{'}', 480},{0xac, 713},{0xb0, 400},{0xb1, 549},{0xb5, 576},{0xd7, 549},{0xf7, 549},{0x0192, 500},{0x0391, 722},{0x0392, 667},{0x0393, 603},{0x0395, 611},{0x0396, 611},{0x0397, 722},{0x0398, 741},{0x0399, 333},{0x039a, 722},{0x039b, 686},{0x039c, 889},{0x039d, 722},{0x039e, 645},{0x039f, 722},{0x03a0, 768},{0x03a1, 556},{0x03a3, 592},{0x03a4, 611},{0x03a5, 690},{0x03a6, 763},{0x03a7, 722},{0x03a8, 795},{0x03b1, 631},{0x03b2, 549},{0x03b3, 411},{0x03b4, 494},{0x03b5, 439},{0x03b6, 494},{0x03b7, 603},{0x03b8, 521},{0x03b9, 329},{0x03ba, 549},{0x03bb, 549},{0x03bd, 521},{0x03be, 493},{0x03bf, 549},{0x03c0, 549},{0x03c1, 549},{0x03c2, 439},{0x03c3, 603},{0x03c4, 439},{0x03c5, 576},{0x03c6, 521},{0x03c7, 549},{0x03c8, 686},{0x03c9, 686},{0x03d1, 631},{0x03d2, 620},{0x03d5, 603},{0x03d6, 713},{0x2022, 460},{0x2026, 1000},{0x2032, 247},{0x2033, 411},{0x2044, 167},{0x20ac, 750},{0x2111, 686},{0x2118, 987},{0x211c, 795},{0x2126, 768},{0x2135, 823},{0x2190, 987},{0x2191, 603},{0x2192, 987},{0x2193, 603},{0x2194, 1042},{0x21b5, 658},{0x21d0, 987},{0x21d1, 603},{0x21d2, 987},{0x21d3, 603},{0x21d4, 1042},{0x2200, 713},{0x2202, 494},{0x2203, 549},{0x2205, 823},{0x2206, 612},{0x2207, 713},{0x2208, 713},{0x2209, 713},{0x220b, 439},{0x220f, 823},{0x2211, 713},{0x2212, 549},{0x2217, 500},{0x221a, 549},{0x221d, 713},{0x221e, 713},{0x2220, 768},{0x2227, 603},{0x2228, 603},{0x2229, 768},{0x222a, 768},{0x222b, 274},{0x2234, 863},{0x223c, 549},{0x2245, 549},{0x2248, 549},{0x2260, 549},{0x2261, 549},{0x2264, 549},{0x2265, 549},{0x2282, 713},{0x2283, 713},{0x2284, 713},{0x2286, 713},{0x2287, 713},{0x2295, 768},{0x2297, 768},{0x22a5, 658},{0x22c5, 250},{0x2320, 686},{0x2321, 686},{0x2329, 329},{0x232a, 329},{0x25ca, 494},{0x2660, 753},{0x2663, 753},{0x2665, 753},{0x2666, 753},{0xf6d9, 790},{0xf6da, 790},{0xf6db, 890},{0xf8e5, 500},{0xf8e6, 603},{0xf8e7, 1000},{0xf8e8, 790},{0xf8e9, 790},{0xf8ea, 786},{0xf8eb, 384},{0xf8ec, 384},{0xf8ed, 384},{0xf8ee, 384},{0xf8ef, 384},{0xf8f0, 384},{0xf8f1, 494},{0xf8f2, 494},{0xf8f3, 494},{0xf8f4, 494},{0xf8f5, 686},{0xf8f6, 384},{0xf8f7, 384},{0xf8f8, 384},{0xf8f9, 384},{0xf8fa, 384},{0xf8fb, 384},{0xf8fc, 494},{0xf8fd, 494},{0xf8fe, 494},{0xf8ff, 790}}},
-{"/Times-Bold", {{' ', 250},{'!', 333},{'"', 555},{'#', 500},{'$', 500},{'%', 1000},{'&', 833}, {'\'', 278},{'(', 333},{')', 333},{'*', 500},{'+', 570},{',', 250},{'-', 333},{'.', 250},{'/', 278},{'0', 500},{'1', 500},{'2', 500},{'3', 500},{'4', 500},{'5', 500},{'6', 500},{'7', 500},{'8', 500},{'9', 500},{':', 333},{';', 333},{'<', 570},{'=', 570},{'>', 570},{'?', 500},{'@', 930},{'A', 722},{'B', 667},{'C', 722},{'D', 722},{'E', 667},{'F', 611},{'G', 778},{'H', 778},{'I', 389},{'J', 500},{'K', 778},{'L', 667},{'M', 944},{'N', 722},{'O', 778},{'P', 611},{'Q', 778},{'R', 722},{'S', 556},{'T', 667},{'U', 722},{'V', 722},{'W', 1000},{'X', 722},{'Y', 722},{'Z', 667},{'[', 333},{'\\', 278},{']', 333},{'^', 581},{'_', 500},{'`', 333},{'a', 500},{'b', 556},{'c', 444},{'d', 556},{'e', 444},{'f', 333},{'g', 500},{'h', 556},{'i', 278},{'j', 333},{'k', 556},{'l', 278},{'m', 833},{'n', 556},{'o', 500},{'p', 556},{'q', 556},{'r', 444},{'s', 389},{'t', 333},{'u', 556},{'v', 500},{'w', 722},{'x', 500},{'y', 500},{'z', 444},{'{', 394},{'|', 220},{'}', 394},{'~', 520},{0xa1, 333},{0xa2, 500},{0xa3, 500},{0xa4, 500},{0xa5, 500},{0xa6, 220},{0xa7, 500},{0xa8, 333},{0xa9, 747},{0xaa, 300},{0xab, 500},{0xac, 570},{0xae, 747},{0xaf, 333},{0xb0, 400},{0xb1, 570},{0xb2, 300},{0xb3, 300},{0xb4, 333},{0xb5, 556},{0xb6, 540},{0xb7, 250},{0xb8, 333},{0xb9, 300},{0xba, 330},{0xbb, 500},{0xbc, 750},{0xbd, 750},{0xbe, 750},{0xbf, 500},{0xc0, 722},{0xc1, 722},{0xc2, 722},{0xc3, 722},{0xc4, 722},{0xc5, 722},{0xc6, 1000},{0xc7, 722},{0xc8, 667},{0xc9, 667},{0xca, 667},{0xcb, 667},{0xcc, 389},{0xcd, 389},{0xce, 389},{0xcf, 389},{0xd0, 722},{0xd1, 722},{0xd2, 778},{0xd3, 778},{0xd4, 778},{0xd5, 778},{0xd6, 778},{0xd7, 570},{0xd8, 778},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 722},{0xde, 611},{0xdf, 556},{0xe0, 500},{0xe1, 500},{0xe2, 500},{0xe3, 500},{0xe4, 500},{0xe5, 500},{0xe6, 722},{0xe7, 444},{0xe8, 444},{0xe9, 444},{0xea, 444},{0xeb, 444},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 500},{0xf1, 556},{0xf2, 500},{0xf3, 500},{0xf4, 500},{0xf5, 500},{0xf6, 500},{0xf7, 570},{0xf8, 500},{0xf9, 556},{0xfa, 556},{0xfb, 556},{0xfc, 556},{0xfd, 500},{0xfe, 556},{0xff, 500},{0x0100, 722},{0x0101, 500},{0x0102, 722},{0x0103, 500},{0x0104, 722},{0x0105, 500},{0x0106, 722},{0x0107, 444},{0x010c, 722},{0x010d, 444},{0x010e, 722},{0x010f, 672},{0x0110, 722},{0x0111, 556},{0x0112, 667},{0x0113, 444},{0x0116, 667},{0x0117, 444},{0x0118, 667},{0x0119, 444},{0x011a, 667},{0x011b, 444},{0x011e, 778},{0x011f, 500},{0x0122, 778},{0x0123, 500},{0x012a, 389},{0x012b, 278},{0x012e, 389},{0x012f, 278},{0x0130, 389},{0x0131, 278},{0x0136, 778},{0x0137, 556},{0x0139, 667},{0x013a, 278},{0x013b, 667},{0x013c, 278},{0x013d, 667},{0x013e, 394},{0x0141, 667},{0x0142, 278},{0x0143, 722},{0x0144, 556},{0x0145, 722},{0x0146, 556},{0x0147, 722},{0x0148, 556},{0x014c, 778},{0x014d, 500},{0x0150, 778},{0x0151, 500},{0x0152, 1000},{0x0153, 722},{0x0154, 722},{0x0155, 444},{0x0156, 722},{0x0157, 444},{0x0158, 722},{0x0159, 444},{0x015a, 556},{0x015b, 389},{0x015e, 556},{0x015f, 389},{0x0160, 556},{0x0161, 389},{0x0162, 667},{0x0163, 333},{0x0164, 667},{0x0165, 416},{0x016a, 722},{0x016b, 556},{0x016e, 722},{0x016f, 556},{0x0170, 722},{0x0171, 556},{0x0172, 722},{0x0173, 556},{0x0178, 722},{0x0179, 667},{0x017a, 444},{0x017b, 667},{0x017c, 444},{0x017d, 667},{0x017e, 444},{0x0192, 500},{0x0218, 556},{0x0219, 389},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 500},{0x2014, 1000},{0x2018, 333},{0x2019, 333},{0x201a, 333},{0x201c, 500},{0x201d, 500},{0x201e, 500},{0x2020, 500},{0x2021, 500},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 1000},{0x2202, 494},{0x2206, 612},{0x2211, 600},{0x2212, 570},{0x221a, 549},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 494},{0xf6c3, 250},{0xfb01, 556},{0xfb02, 556}}},
-{"/Times-BoldItalic", {{' ', 250},{'!', 389},{'"', 555},{'#', 500},{'$', 500},{'%', 833},{'&', 778}, {'\'', 278},{'(', 333},{')', 333},{'*', 500},{'+', 570},{',', 250},{'-', 333},{'.', 250},{'/', 278},{'0', 500},{'1', 500},{'2', 500},{'3', 500},{'4', 500},{'5', 500},{'6', 500},{'7', 500},{'8', 500},{'9', 500},{':', 333},{';', 333},{'<', 570},{'=', 570},{'>', 570},{'?', 500},{'@', 832},{'A', 667},{'B', 667},{'C', 667},{'D', 722},{'E', 667},{'F', 667},{'G', 722},{'H', 778},{'I', 389},{'J', 500},{'K', 667},{'L', 611},{'M', 889},{'N', 722},{'O', 722},{'P', 611},{'Q', 722},{'R', 667},{'S', 556},{'T', 611},{'U', 722},{'V', 667},{'W', 889},{'X', 667},{'Y', 611},{'Z', 611},{'[', 333},{'\\', 278},{']', 333},{'^', 570},{'_', 500},{'`', 333},{'a', 500},{'b', 500},{'c', 444},{'d', 500},{'e', 444},{'f', 333},{'g', 500},{'h', 556},{'i', 278},{'j', 278},{'k', 500},{'l', 278},{'m', 778},{'n', 556},{'o', 500},{'p', 500},{'q', 500},{'r', 389},{'s', 389},{'t', 278},{'u', 556},{'v', 444},{'w', 667},{'x', 500},{'y', 444},{'z', 389},{'{', 348},{'|', 220},{'}', 348},{'~', 570},{0xa1, 389},{0xa2, 500},{0xa3, 500},{0xa4, 500},{0xa5, 500},{0xa6, 220},{0xa7, 500},{0xa8, 333},{0xa9, 747},{0xaa, 266},{0xab, 500},{0xac, 606},{0xae, 747},{0xaf, 333},{0xb0, 400},{0xb1, 570},{0xb2, 300},{0xb3, 300},{0xb4, 333},{0xb5, 576},{0xb6, 500},{0xb7, 250},{0xb8, 333},{0xb9, 300},{0xba, 300},{0xbb, 500},{0xbc, 750},{0xbd, 750},{0xbe, 750},{0xbf, 500},{0xc0, 667},{0xc1, 667},{0xc2, 667},{0xc3, 667},{0xc4, 667},{0xc5, 667},{0xc6, 944},{0xc7, 667},{0xc8, 667},{0xc9, 667},{0xca, 667},{0xcb, 667},{0xcc, 389},{0xcd, 389},{0xce, 389},{0xcf, 389},{0xd0, 722},{0xd1, 722},{0xd2, 722},{0xd3, 722},{0xd4, 722},{0xd5, 722},{0xd6, 722},{0xd7, 570},{0xd8, 722},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 611},{0xde, 611},{0xdf, 500},{0xe0, 500},{0xe1, 500},{0xe2, 500},{0xe3, 500},{0xe4, 500},{0xe5, 500},{0xe6, 722},{0xe7, 444},{0xe8, 444},{0xe9, 444},{0xea, 444},{0xeb, 444},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 500},{0xf1, 556},{0xf2, 500},{0xf3, 500},{0xf4, 500},{0xf5, 500},{0xf6, 500},{0xf7, 570},{0xf8, 500},{0xf9, 556},{0xfa, 556},{0xfb, 556},{0xfc, 556},{0xfd, 444},{0xfe, 500},{0xff, 444},{0x0100, 667},{0x0101, 500},{0x0102, 667},{0x0103, 500},{0x0104, 667},{0x0105, 500},{0x0106, 667},{0x0107, 444},{0x010c, 667},{0x010d, 444},{0x010e, 722},{0x010f, 608},{0x0110, 722},{0x0111, 500},{0x0112, 667},{0x0113, 444},{0x0116, 667},{0x0117, 444},{0x0118, 667},{0x0119, 444},{0x011a, 667},{0x011b, 444},{0x011e, 722},{0x011f, 500},{0x0122, 722},{0x0123, 500},{0x012a, 389},{0x012b, 278},{0x012e, 389},{0x012f, 278},{0x0130, 389},{0x0131, 278},{0x0136, 667},{0x0137, 500},{0x0139, 611},{0x013a, 278},{0x013b, 611},{0x013c, 278},{0x013d, 611},{0x013e, 382},{0x0141, 611},{0x0142, 278},{0x0143, 722},{0x0144, 556},{0x0145, 722},{0x0146, 556},{0x0147, 722},{0x0148, 556},{0x014c, 722},{0x014d, 500},{0x0150, 722},{0x0151, 500},{0x0152, 944},{0x0153, 722},{0x0154, 667},{0x0155, 389},{0x0156, 667},{0x0157, 389},{0x0158, 667},{0x0159, 389},{0x015a, 556},{0x015b, 389},{0x015e, 556},{0x015f, 389},{0x0160, 556},{0x0161, 389},{0x0162, 611},{0x0163, 278},{0x0164, 611},{0x0165, 366},{0x016a, 722},{0x016b, 556},{0x016e, 722},{0x016f, 556},{0x0170, 722},{0x0171, 556},{0x0172, 722},{0x0173, 556},{0x0178, 611},{0x0179, 611},{0x017a, 389},{0x017b, 611},{0x017c, 389},{0x017d, 611},{0x017e, 389},{0x0192, 500},{0x0218, 556},{0x0219, 389},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 500},{0x2014, 1000},{0x2018, 333},{0x2019, 333},{0x201a, 333},{0x201c, 500},{0x201d, 500},{0x201e, 500},{0x2020, 500},{0x2021, 500},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 1000},{0x2202, 494},{0x2206, 612},{0x2211, 600},{0x2212, 606},{0x221a, 549},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 494},{0xf6c3, 250},{0xfb01, 556},{0xfb02, 556}}},
-{"/Times-Italic", {{' ', 250},{'!', 333},{'"', 420},{'#', 500},{'$', 500},{'%', 833},{'&', 778}, {'\'', 214},{'(', 333},{')', 333},{'*', 500},{'+', 675},{',', 250},{'-', 333},{'.', 250},{'/', 278},{'0', 500},{'1', 500},{'2', 500},{'3', 500},{'4', 500},{'5', 500},{'6', 500},{'7', 500},{'8', 500},{'9', 500},{':', 333},{';', 333},{'<', 675},{'=', 675},{'>', 675},{'?', 500},{'@', 920},{'A', 611},{'B', 611},{'C', 667},{'D', 722},{'E', 611},{'F', 611},{'G', 722},{'H', 722},{'I', 333},{'J', 444},{'K', 667},{'L', 556},{'M', 833},{'N', 667},{'O', 722},{'P', 611},{'Q', 722},{'R', 611},{'S', 500},{'T', 556},{'U', 722},{'V', 611},{'W', 833},{'X', 611},{'Y', 556},{'Z', 556},{'[', 389},{'\\', 278},{']', 389},{'^', 422},{'_', 500},{'`', 333},{'a', 500},{'b', 500},{'c', 444},{'d', 500},{'e', 444},{'f', 278},{'g', 500},{'h', 500},{'i', 278},{'j', 278},{'k', 444},{'l', 278},{'m', 722},{'n', 500},{'o', 500},{'p', 500},{'q', 500},{'r', 389},{'s', 389},{'t', 278},{'u', 500},{'v', 444},{'w', 667},{'x', 444},{'y', 444},{'z', 389},{'{', 400},{'|', 275},{'}', 400},{'~', 541},{0xa1, 389},{0xa2, 500},{0xa3, 500},{0xa4, 500},{0xa5, 500},{0xa6, 275},{0xa7, 500},{0xa8, 333},{0xa9, 760},{0xaa, 276},{0xab, 500},{0xac, 675},{0xae, 760},{0xaf, 333},{0xb0, 400},{0xb1, 675},{0xb2, 300},{0xb3, 300},{0xb4, 333},{0xb5, 500},{0xb6, 523},{0xb7, 250},{0xb8, 333},{0xb9, 300},{0xba, 310},{0xbb, 500},{0xbc, 750},{0xbd, 750},{0xbe, 750},{0xbf, 500},{0xc0, 611},{0xc1, 611},{0xc2, 611},{0xc3, 611},{0xc4, 611},{0xc5, 611},{0xc6, 889},{0xc7, 667},{0xc8, 611},{0xc9, 611},{0xca, 611},{0xcb, 611},{0xcc, 333},{0xcd, 333},{0xce, 333},{0xcf, 333},{0xd0, 722},{0xd1, 667},{0xd2, 722},{0xd3, 722},{0xd4, 722},{0xd5, 722},{0xd6, 722},{0xd7, 675},{0xd8, 722},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 556},{0xde, 611},{0xdf, 500},{0xe0, 500},{0xe1, 500},{0xe2, 500},{0xe3, 500},{0xe4, 500},{0xe5, 500},{0xe6, 667},{0xe7, 444},{0xe8, 444},{0xe9, 444},{0xea, 444},{0xeb, 444},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 500},{0xf1, 500},{0xf2, 500},{0xf3, 500},{0xf4, 500},{0xf5, 500},{0xf6, 500},{0xf7, 675},{0xf8, 500},{0xf9, 500},{0xfa, 500},{0xfb, 500},{0xfc, 500},{0xfd, 444},{0xfe, 500},{0xff, 444},{0x0100, 611},{0x0101, 500},{0x0102, 611},{0x0103, 500},{0x0104, 611},{0x0105, 500},{0x0106, 667},{0x0107, 444},{0x010c, 667},{0x010d, 444},{0x010e, 722},{0x010f, 544},{0x0110, 722},{0x0111, 500},{0x0112, 611},{0x0113, 444},{0x0116, 611},{0x0117, 444},{0x0118, 611},{0x0119, 444},{0x011a, 611},{0x011b, 444},{0x011e, 722},{0x011f, 500},{0x0122, 722},{0x0123, 500},{0x012a, 333},{0x012b, 278},{0x012e, 333},{0x012f, 278},{0x0130, 333},{0x0131, 278},{0x0136, 667},{0x0137, 444},{0x0139, 556},{0x013a, 278},{0x013b, 556},{0x013c, 278},{0x013d, 611},{0x013e, 300},{0x0141, 556},{0x0142, 278},{0x0143, 667},{0x0144, 500},{0x0145, 667},{0x0146, 500},{0x0147, 667},{0x0148, 500},{0x014c, 722},{0x014d, 500},{0x0150, 722},{0x0151, 500},{0x0152, 944},{0x0153, 667},{0x0154, 611},{0x0155, 389},{0x0156, 611},{0x0157, 389},{0x0158, 611},{0x0159, 389},{0x015a, 500},{0x015b, 389},{0x015e, 500},{0x015f, 389},{0x0160, 500},{0x0161, 389},{0x0162, 556},{0x0163, 278},{0x0164, 556},{0x0165, 300},{0x016a, 722},{0x016b, 500},{0x016e, 722},{0x016f, 500},{0x0170, 722},{0x0171, 500},{0x0172, 722},{0x0173, 500},{0x0178, 556},{0x0179, 556},{0x017a, 389},{0x017b, 556},{0x017c, 389},{0x017d, 556},{0x017e, 389},{0x0192, 500},{0x0218, 500},{0x0219, 389},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 500},{0x2014, 889},{0x2018, 333},{0x2019, 333},{0x201a, 333},{0x201c, 556},{0x201d, 556},{0x201e, 556},{0x2020, 500},{0x2021, 500},{0x2022, 350},{0x2026, 889},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 980},{0x2202, 476},{0x2206, 612},{0x2211, 600},{0x2212, 675},{0x221a, 453},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 471},{0xf6c3, 250},{0xfb01, 500},{0xfb02, 500}}},
-{"/Times-Roman", {{' ', 250},{'!', 333},{'"', 408},{'#', 500},{'$', 500},{'%', 833},{'&', 778}, {'\'', 180},{'(', 333},{')', 333},{'*', 500},{'+', 564},{',', 250},{'-', 333},{'.', 250},{'/', 278},{'0', 500},{'1', 500},{'2', 500},{'3', 500},{'4', 500},{'5', 500},{'6', 500},{'7', 500},{'8', 500},{'9', 500},{':', 278},{';', 278},{'<', 564},{'=', 564},{'>', 564},{'?', 444},{'@', 921},{'A', 722},{'B', 667},{'C', 667},{'D', 722},{'E', 611},{'F', 556},{'G', 722},{'H', 722},{'I', 333},{'J', 389},{'K', 722},{'L', 611},{'M', 889},{'N', 722},{'O', 722},{'P', 556},{'Q', 722},{'R', 667},{'S', 556},{'T', 611},{'U', 722},{'V', 722},{'W', 944},{'X', 722},{'Y', 722},{'Z', 611},{'[', 333},{'\\', 278},{']', 333},{'^', 469},{'_', 500},{'`', 333},{'a', 444},{'b', 500},{'c', 444},{'d', 500},{'e', 444},{'f', 333},{'g', 500},{'h', 500},{'i', 278},{'j', 278},{'k', 500},{'l', 278},{'m', 778},{'n', 500},{'o', 500},{'p', 500},{'q', 500},{'r', 333},{'s', 389},{'t', 278},{'u', 500},{'v', 500},{'w', 722},{'x', 500},{'y', 500},{'z', 444},{'{', 480},{'|', 200},{'}', 480},{'~', 541},{0xa1, 333},{0xa2, 500},{0xa3, 500},{0xa4, 500},{0xa5, 500},{0xa6, 200},{0xa7, 500},{0xa8, 333},{0xa9, 760},{0xaa, 276},{0xab, 500},{0xac, 564},{0xae, 760},{0xaf, 333},{0xb0, 400},{0xb1, 564},{0xb2, 300},{0xb3, 300},{0xb4, 333},{0xb5, 500},{0xb6, 453},{0xb7, 250},{0xb8, 333},{0xb9, 300},{0xba, 310},{0xbb, 500},{0xbc, 750},{0xbd, 750},{0xbe, 750},{0xbf, 444},{0xc0, 722},{0xc1, 722},{0xc2, 722},{0xc3, 722},{0xc4, 722},{0xc5, 722},{0xc6, 889},{0xc7, 667},{0xc8, 611},{0xc9, 611},{0xca, 611},{0xcb, 611},{0xcc, 333},{0xcd, 333},{0xce, 333},{0xcf, 333},{0xd0, 722},{0xd1, 722},{0xd2, 722},{0xd3, 722},{0xd4, 722},{0xd5, 722},{0xd6, 722},{0xd7, 564},{0xd8, 722},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 722},{0xde, 556},{0xdf, 500},{0xe0, 444},{0xe1, 444},{0xe2, 444},{0xe3, 444},{0xe4, 444},{0xe5, 444},{0xe6, 667},{0xe7, 444},{0xe8, 444},{0xe9, 444},{0xea, 444},{0xeb, 444},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 500},{0xf1, 500},{0xf2, 500},{0xf3, 500},{0xf4, 500},{0xf5, 500},{0xf6, 500},{0xf7, 564},{0xf8, 500},{0xf9, 500},{0xfa, 500},{0xfb, 500},{0xfc, 500},{0xfd, 500},{0xfe, 500},{0xff, 500},{0x0100, 722},{0x0101, 444},{0x0102, 722},{0x0103, 444},{0x0104, 722},{0x0105, 444},{0x0106, 667},{0x0107, 444},{0x010c, 667},{0x010d, 444},{0x010e, 722},{0x010f, 588},{0x0110, 722},{0x0111, 500},{0x0112, 611},{0x0113, 444},{0x0116, 611},{0x0117, 444},{0x0118, 611},{0x0119, 444},{0x011a, 611},{0x011b, 444},{0x011e, 722},{0x011f, 500},{0x0122, 722},{0x0123, 500},{0x012a, 333},{0x012b, 278},{0x012e, 333},{0x012f, 278},{0x0130, 333},{0x0131, 278},{0x0136, 722},{0x0137, 500},{0x0139, 611},{0x013a, 278},{0x013b, 611},{0x013c, 278},{0x013d, 611},{0x013e, 344},{0x0141, 611},{0x0142, 278},{0x0143, 722},{0x0144, 500},{0x0145, 722},{0x0146, 500},{0x0147, 722},{0x0148, 500},{0x014c, 722},{0x014d, 500},{0x0150, 722},{0x0151, 500},{0x0152, 889},{0x0153, 722},{0x0154, 667},{0x0155, 333},{0x0156, 667},{0x0157, 333},{0x0158, 667},{0x0159, 333},{0x015a, 556},{0x015b, 389},{0x015e, 556},{0x015f, 389},{0x0160, 556},{0x0161, 389},{0x0162, 611},{0x0163, 278},{0x0164, 611},{0x0165, 326},{0x016a, 722},{0x016b, 500},{0x016e, 722},{0x016f, 500},{0x0170, 722},{0x0171, 500},{0x0172, 722},{0x0173, 500},{0x0178, 722},{0x0179, 611},{0x017a, 444},{0x017b, 611},{0x017c, 444},{0x017d, 611},{0x017e, 444},{0x0192, 500},{0x0218, 556},{0x0219, 389},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 500},{0x2014, 1000},{0x2018, 333},{0x2019, 333},{0x201a, 333},{0x201c, 444},{0x201d, 444},{0x201e, 444},{0x2020, 500},{0x2021, 500},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 980},{0x2202, 476},{0x2206, 612},{0x2211, 600},{0x2212, 564},{0x221a, 453},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 471},{0xf6c3, 250},{0xfb01, 556},{0xfb02, 556}}},
-{"/ZapfDingbats", {{'\x01', 974},{'\x02', 961},{'\x03', 980},{'\x04', 719},{'\x05', 789},{'\x06', 494},{'\x07', 552},{'\x08', 537},{'\t', 577},{'\n', 692},{'\x0b', 960},{'\x0c', 939},{'\r', 549},{'\x0e', 855},{'\x0f', 911},{'\x10', 933},{'\x11', 945},{'\x12', 974},{'\x13', 755},{'\x14', 846},{'\x15', 762},{'\x16', 761},{'\x17', 571},{'\x18', 677},{'\x19', 763},{'\x1a', 760},{'\x1b', 759},{'\x1c', 754},{'\x1d', 786},{'\x1e', 788},{'\x1f', 788},{' ', 790},{'!', 793},{'"', 794},{'#', 816},{'$', 823},{'%', 789},{'&', 841}, {'\'', 823},{'(', 833},{')', 816},{'*', 831},{'+', 923},{',', 744},{'-', 723},{'.', 749},{'/', 790},{'0', 792},{'1', 695},{'2', 776},{'3', 768},{'4', 792},{'5', 759},{'6', 707},{'7', 708},{'8', 682},{'9', 701},{':', 826},{';', 815},{'<', 789},{'=', 789},{'>', 707},{'?', 687},{'@', 696},{'A', 689},{'B', 786},{'C', 787},{'D', 713},{'E', 791},{'F', 785},{'G', 791},{'H', 873},{'I', 761},{'J', 762},{'K', 759},{'L', 892},{'M', 892},{'N', 788},{'O', 784},{'Q', 438},{'R', 138},{'S', 277},{'T', 415},{'U', 509},{'V', 410},{'W', 234},{'X', 234},{'Y', 390},{'Z', 390},{'[', 276},{'\\', 276},{']', 317},{'^', 317},{'_', 334},{'`', 334},{'a', 392},{'b', 392},{'c', 668},{'d', 668},{'e', 732},{'f', 544},{'g', 544},{'h', 910},{'i', 911},{'j', 667},{'k', 760},{'l', 760},{'m', 626},{'n', 694},{'o', 595},{'p', 776},{'u', 690},{'v', 791},{'w', 790},{'x', 788},{'y', 788},{'z', 788},{'{', 788},{'|', 788},{'}', 788},{'~', 788},{0x7f, 788},{0x80, 788},{0x81, 788},{0x82, 788},{0x83, 788},{0x84, 788},{0x85, 788},{0x86, 788},{0x87, 788},{0x88, 788},{0x89, 788},{0x8a, 788},{0x8b, 788},{0x8c, 788},{0x8d, 788},{0x8e, 788},{0x8f, 788},{0x90, 788},{0x91, 788},{0x92, 788},{0x93, 788},{0x94, 788},{0x95, 788},{0x96, 788},{0x97, 788},{0x98, 788},{0x99, 788},{0x9a, 788},{0x9b, 788},{0x9c, 788},{0x9d, 788},{0x9e, 788},{0x9f, 788},{0xa0, 894},{0xa1, 838},{0xa2, 924},{0xa3, 1016},{0xa4, 458},{0xa5, 924},{0xa6, 918},{0xa7, 927},{0xa8, 928},{0xa9, 928},{0xaa, 834},{0xab, 873},{0xac, 828},{0xad, 924},{0xae, 917},{0xaf, 930},{0xb0, 931},{0xb1, 463},{0xb2, 883},{0xb3, 836},{0xb4, 867},{0xb5, 696},{0xb6, 874},{0xb7, 760},{0xb8, 946},{0xb9, 865},{0xba, 967},{0xbb, 831},{0xbc, 873},{0xbd, 927},{0xbe, 970},{0xbf, 918},{0xc0, 748},{0xc1, 836},{0xc2, 771},{0xc3, 888},{0xc4, 748},{0xc5, 771},{0xc6, 888},{0xc7, 867},{0xc8, 696},{0xc9, 874},{0xca, 974},{0xcb, 762},{0xcc, 759},{0xcd, 509},{0xce, 410}}}}
+//generated by tools/gen_standard_widths.cc
+constexpr std::pair<unsigned int, float> courier_widths[] = {
+    {123, 600}, {33, 600}, {34, 600}, {35, 600}, {36, 600}, {37, 600}, {38, 600}, {39, 600}, {40, 600}, {41, 600},
+    {42, 600}, {43, 600}, {44, 600}, {45, 600}, {46, 600}, {47, 600}, {48, 600}, {49, 600}, {50, 600}, {51, 600},
+    {52, 600}, {53, 600}, {54, 600}, {55, 600}, {56, 600}, {57, 600}, {58, 600}, {59, 600}, {60, 600}, {61, 600},
+    {62, 600}, {63, 600}, {64, 600}, {65, 600}, {66, 600}, {67, 600}, {68, 600}, {69, 600}, {70, 600}, {71, 600},
+    {72, 600}, {73, 600}, {74, 600}, {75, 600}, {76, 600}, {77, 600}, {78, 600}, {79, 600}, {80, 600}, {81, 600},
+    {82, 600}, {83, 600}, {84, 600}, {85, 600}, {86, 600}, {87, 600}, {88, 600}, {89, 600}, {90, 600}, {91, 600},
+    {92, 600}, {93, 600}, {94, 600}, {95, 600}, {96, 600}, {97, 600}, {98, 600}, {99, 600}, {100, 600}, {101, 600},
+    {102, 600}, {103, 600}, {104, 600}, {105, 600}, {106, 600}, {107, 600}, {108, 600}, {109, 600}, {110, 600}, {111, 600},
+    {112, 600}, {113, 600}, {114, 600}, {115, 600}, {116, 600}, {117, 600}, {118, 600}, {119, 600}, {120, 600}, {121, 600},
+    {122, 600}, {123, 600}, {124, 600}, {125, 600}, {126, 600}, {161, 600}, {162, 600}, {163, 600}, {164, 600}, {165, 600},
+    {166, 600}, {167, 600}, {168, 600}, {169, 600}, {170, 600}, {171, 600}, {172, 600}, {174, 600}, {175, 600}, {176, 600},
+    {177, 600}, {178, 600}, {179, 600}, {180, 600}, {181, 600}, {182, 600}, {183, 600}, {184, 600}, {185, 600}, {186, 600},
+    {187, 600}, {188, 600}, {189, 600}, {190, 600}, {191, 600}, {192, 600}, {193, 600}, {194, 600}, {195, 600}, {196, 600},
+    {197, 600}, {198, 600}, {199, 600}, {200, 600}, {201, 600}, {202, 600}, {203, 600}, {204, 600}, {205, 600}, {206, 600},
+    {207, 600}, {208, 600}, {209, 600}, {210, 600}, {211, 600}, {212, 600}, {213, 600}, {214, 600}, {215, 600}, {216, 600},
+    {217, 600}, {218, 600}, {219, 600}, {220, 600}, {221, 600}, {222, 600}, {223, 600}, {224, 600}, {225, 600}, {226, 600},
+    {227, 600}, {228, 600}, {229, 600}, {230, 600}, {231, 600}, {232, 600}, {233, 600}, {234, 600}, {235, 600}, {236, 600},
+    {237, 600}, {238, 600}, {239, 600}, {240, 600}, {241, 600}, {242, 600}, {243, 600}, {244, 600}, {245, 600}, {246, 600},
+    {247, 600}, {248, 600}, {249, 600}, {250, 600}, {251, 600}, {252, 600}, {253, 600}, {254, 600}, {255, 600}, {256, 600},
+    {257, 600}, {258, 600}, {259, 600}, {260, 600}, {261, 600}, {262, 600}, {263, 600}, {268, 600}, {269, 600}, {270, 600},
+    {271, 600}, {272, 600}, {273, 600}, {274, 600}, {275, 600}, {278, 600}, {279, 600}, {280, 600}, {281, 600}, {282, 600},
+    {283, 600}, {286, 600}, {287, 600}, {290, 600}, {291, 600}, {298, 600}, {299, 600}, {302, 600}, {303, 600}, {304, 600},
+    {305, 600}, {310, 600}, {311, 600}, {313, 600}, {314, 600}, {315, 600}, {316, 600}, {317, 600}, {318, 600}, {321, 600},
+    {322, 600}, {323, 600}, {324, 600}, {325, 600}, {326, 600}, {327, 600}, {328, 600}, {332, 600}, {333, 600}, {336, 600},
+    {337, 600}, {338, 600}, {339, 600}, {340, 600}, {341, 600}, {342, 600}, {343, 600}, {344, 600}, {345, 600}, {346, 600},
+    {347, 600}, {350, 600}, {351, 600}, {352, 600}, {353, 600}, {354, 600}, {355, 600}, {356, 600}, {357, 600}, {362, 600},
+    {363, 600}, {366, 600}, {367, 600}, {368, 600}, {369, 600}, {370, 600}, {371, 600}, {376, 600}, {377, 600}, {378, 600},
+    {379, 600}, {380, 600}, {381, 600}, {382, 600}, {402, 600}, {536, 600}, {537, 600}, {710, 600}, {711, 600}, {728, 600},
+    {729, 600}, {730, 600}, {731, 600}, {732, 600}, {733, 600}, {8211, 600}, {8212, 600}, {8216, 600}, {8217, 600}, {8218, 600},
+    {8220, 600}, {8221, 600}, {8222, 600}, {8224, 600}, {8225, 600}, {8226, 600}, {8230, 600}, {8240, 600}, {8249, 600}, {8250, 600},
+    {8260, 600}, {8482, 600}, {8706, 600}, {8710, 600}, {8721, 600}, {8722, 600}, {8730, 600}, {8800, 600}, {8804, 600}, {8805, 600},
+    {9674, 600}, {63171, 600}, {64257, 600}, {64258, 600}};
+
+constexpr std::pair<unsigned int, float> courier_bold_widths[] = {
+    {32, 600}, {33, 600}, {34, 600}, {35, 600}, {36, 600}, {37, 600}, {38, 600}, {39, 600}, {40, 600}, {41, 600},
+    {42, 600}, {43, 600}, {44, 600}, {45, 600}, {46, 600}, {47, 600}, {48, 600}, {49, 600}, {50, 600}, {51, 600},
+    {52, 600}, {53, 600}, {54, 600}, {55, 600}, {56, 600}, {57, 600}, {58, 600}, {59, 600}, {60, 600}, {61, 600},
+    {62, 600}, {63, 600}, {64, 600}, {65, 600}, {66, 600}, {67, 600}, {68, 600}, {69, 600}, {70, 600}, {71, 600},
+    {72, 600}, {73, 600}, {74, 600}, {75, 600}, {76, 600}, {77, 600}, {78, 600}, {79, 600}, {80, 600}, {81, 600},
+    {82, 600}, {83, 600}, {84, 600}, {85, 600}, {86, 600}, {87, 600}, {88, 600}, {89, 600}, {90, 600}, {91, 600},
+    {92, 600}, {93, 600}, {94, 600}, {95, 600}, {96, 600}, {97, 600}, {98, 600}, {99, 600}, {100, 600}, {101, 600},
+    {102, 600}, {103, 600}, {104, 600}, {105, 600}, {106, 600}, {107, 600}, {108, 600}, {109, 600}, {110, 600}, {111, 600},
+    {112, 600}, {113, 600}, {114, 600}, {115, 600}, {116, 600}, {117, 600}, {118, 600}, {119, 600}, {120, 600}, {121, 600},
+    {122, 600}, {123, 600}, {124, 600}, {125, 600}, {126, 600}, {161, 600}, {162, 600}, {163, 600}, {164, 600}, {165, 600},
+    {166, 600}, {167, 600}, {168, 600}, {169, 600}, {170, 600}, {171, 600}, {172, 600}, {174, 600}, {175, 600}, {176, 600},
+    {177, 600}, {178, 600}, {179, 600}, {180, 600}, {181, 600}, {182, 600}, {183, 600}, {184, 600}, {185, 600}, {186, 600},
+    {187, 600}, {188, 600}, {189, 600}, {190, 600}, {191, 600}, {192, 600}, {193, 600}, {194, 600}, {195, 600}, {196, 600},
+    {197, 600}, {198, 600}, {199, 600}, {200, 600}, {201, 600}, {202, 600}, {203, 600}, {204, 600}, {205, 600}, {206, 600},
+    {207, 600}, {208, 600}, {209, 600}, {210, 600}, {211, 600}, {212, 600}, {213, 600}, {214, 600}, {215, 600}, {216, 600},
+    {217, 600}, {218, 600}, {219, 600}, {220, 600}, {221, 600}, {222, 600}, {223, 600}, {224, 600}, {225, 600}, {226, 600},
+    {227, 600}, {228, 600}, {229, 600}, {230, 600}, {231, 600}, {232, 600}, {233, 600}, {234, 600}, {235, 600}, {236, 600},
+    {237, 600}, {238, 600}, {239, 600}, {240, 600}, {241, 600}, {242, 600}, {243, 600}, {244, 600}, {245, 600}, {246, 600},
+    {247, 600}, {248, 600}, {249, 600}, {250, 600}, {251, 600}, {252, 600}, {253, 600}, {254, 600}, {255, 600}, {256, 600},
+    {257, 600}, {258, 600}, {259, 600}, {260, 600}, {261, 600}, {262, 600}, {263, 600}, {268, 600}, {269, 600}, {270, 600},
+    {271, 600}, {272, 600}, {273, 600}, {274, 600}, {275, 600}, {278, 600}, {279, 600}, {280, 600}, {281, 600}, {282, 600},
+    {283, 600}, {286, 600}, {287, 600}, {290, 600}, {291, 600}, {298, 600}, {299, 600}, {302, 600}, {303, 600}, {304, 600},
+    {305, 600}, {310, 600}, {311, 600}, {313, 600}, {314, 600}, {315, 600}, {316, 600}, {317, 600}, {318, 600}, {321, 600},
+    {322, 600}, {323, 600}, {324, 600}, {325, 600}, {326, 600}, {327, 600}, {328, 600}, {332, 600}, {333, 600}, {336, 600},
+    {337, 600}, {338, 600}, {339, 600}, {340, 600}, {341, 600}, {342, 600}, {343, 600}, {344, 600}, {345, 600}, {346, 600},
+    {347, 600}, {350, 600}, {351, 600}, {352, 600}, {353, 600}, {354, 600}, {355, 600}, {356, 600}, {357, 600}, {362, 600},
+    {363, 600}, {366, 600}, {367, 600}, {368, 600}, {369, 600}, {370, 600}, {371, 600}, {376, 600}, {377, 600}, {378, 600},
+    {379, 600}, {380, 600}, {381, 600}, {382, 600}, {402, 600}, {536, 600}, {537, 600}, {710, 600}, {711, 600}, {728, 600},
+    {729, 600}, {730, 600}, {731, 600}, {732, 600}, {733, 600}, {8211, 600}, {8212, 600}, {8216, 600}, {8217, 600}, {8218, 600},
+    {8220, 600}, {8221, 600}, {8222, 600}, {8224, 600}, {8225, 600}, {8226, 600}, {8230, 600}, {8240, 600}, {8249, 600}, {8250, 600},
+    {8260, 600}, {8482, 600}, {8706, 600}, {8710, 600}, {8721, 600}, {8722, 600}, {8730, 600}, {8800, 600}, {8804, 600}, {8805, 600},
+    {9674, 600}, {63171, 600}, {64257, 600}, {64258, 600}};
+
+constexpr std::pair<unsigned int, float> courier_boldoblique_widths[] = {
+    {32, 600}, {33, 600}, {34, 600}, {35, 600}, {36, 600}, {37, 600}, {38, 600}, {39, 600}, {40, 600}, {41, 600},
+    {42, 600}, {43, 600}, {44, 600}, {45, 600}, {46, 600}, {47, 600}, {48, 600}, {49, 600}, {50, 600}, {51, 600},
+    {52, 600}, {53, 600}, {54, 600}, {55, 600}, {56, 600}, {57, 600}, {58, 600}, {59, 600}, {60, 600}, {61, 600},
+    {62, 600}, {63, 600}, {64, 600}, {65, 600}, {66, 600}, {67, 600}, {68, 600}, {69, 600}, {70, 600}, {71, 600},
+    {72, 600}, {73, 600}, {74, 600}, {75, 600}, {76, 600}, {77, 600}, {78, 600}, {79, 600}, {80, 600}, {81, 600},
+    {82, 600}, {83, 600}, {84, 600}, {85, 600}, {86, 600}, {87, 600}, {88, 600}, {89, 600}, {90, 600}, {91, 600},
+    {92, 600}, {93, 600}, {94, 600}, {95, 600}, {96, 600}, {97, 600}, {98, 600}, {99, 600}, {100, 600}, {101, 600},
+    {102, 600}, {103, 600}, {104, 600}, {105, 600}, {106, 600}, {107, 600}, {108, 600}, {109, 600}, {110, 600}, {111, 600},
+    {112, 600}, {113, 600}, {114, 600}, {115, 600}, {116, 600}, {117, 600}, {118, 600}, {119, 600}, {120, 600}, {121, 600},
+    {122, 600}, {123, 600}, {124, 600}, {125, 600}, {126, 600}, {161, 600}, {162, 600}, {163, 600}, {164, 600}, {165, 600},
+    {166, 600}, {167, 600}, {168, 600}, {169, 600}, {170, 600}, {171, 600}, {172, 600}, {174, 600}, {175, 600}, {176, 600},
+    {177, 600}, {178, 600}, {179, 600}, {180, 600}, {181, 600}, {182, 600}, {183, 600}, {184, 600}, {185, 600}, {186, 600},
+    {187, 600}, {188, 600}, {189, 600}, {190, 600}, {191, 600}, {192, 600}, {193, 600}, {194, 600}, {195, 600}, {196, 600},
+    {197, 600}, {198, 600}, {199, 600}, {200, 600}, {201, 600}, {202, 600}, {203, 600}, {204, 600}, {205, 600}, {206, 600},
+    {207, 600}, {208, 600}, {209, 600}, {210, 600}, {211, 600}, {212, 600}, {213, 600}, {214, 600}, {215, 600}, {216, 600},
+    {217, 600}, {218, 600}, {219, 600}, {220, 600}, {221, 600}, {222, 600}, {223, 600}, {224, 600}, {225, 600}, {226, 600},
+    {227, 600}, {228, 600}, {229, 600}, {230, 600}, {231, 600}, {232, 600}, {233, 600}, {234, 600}, {235, 600}, {236, 600},
+    {237, 600}, {238, 600}, {239, 600}, {240, 600}, {241, 600}, {242, 600}, {243, 600}, {244, 600}, {245, 600}, {246, 600},
+    {247, 600}, {248, 600}, {249, 600}, {250, 600}, {251, 600}, {252, 600}, {253, 600}, {254, 600}, {255, 600}, {256, 600},
+    {257, 600}, {258, 600}, {259, 600}, {260, 600}, {261, 600}, {262, 600}, {263, 600}, {268, 600}, {269, 600}, {270, 600},
+    {271, 600}, {272, 600}, {273, 600}, {274, 600}, {275, 600}, {278, 600}, {279, 600}, {280, 600}, {281, 600}, {282, 600},
+    {283, 600}, {286, 600}, {287, 600}, {290, 600}, {291, 600}, {298, 600}, {299, 600}, {302, 600}, {303, 600}, {304, 600},
+    {305, 600}, {310, 600}, {311, 600}, {313, 600}, {314, 600}, {315, 600}, {316, 600}, {317, 600}, {318, 600}, {321, 600},
+    {322, 600}, {323, 600}, {324, 600}, {325, 600}, {326, 600}, {327, 600}, {328, 600}, {332, 600}, {333, 600}, {336, 600},
+    {337, 600}, {338, 600}, {339, 600}, {340, 600}, {341, 600}, {342, 600}, {343, 600}, {344, 600}, {345, 600}, {346, 600},
+    {347, 600}, {350, 600}, {351, 600}, {352, 600}, {353, 600}, {354, 600}, {355, 600}, {356, 600}, {357, 600}, {362, 600},
+    {363, 600}, {366, 600}, {367, 600}, {368, 600}, {369, 600}, {370, 600}, {371, 600}, {376, 600}, {377, 600}, {378, 600},
+    {379, 600}, {380, 600}, {381, 600}, {382, 600}, {402, 600}, {536, 600}, {537, 600}, {710, 600}, {711, 600}, {728, 600},
+    {729, 600}, {730, 600}, {731, 600}, {732, 600}, {733, 600}, {8211, 600}, {8212, 600}, {8216, 600}, {8217, 600}, {8218, 600},
+    {8220, 600}, {8221, 600}, {8222, 600}, {8224, 600}, {8225, 600}, {8226, 600}, {8230, 600}, {8240, 600}, {8249, 600}, {8250, 600},
+    {8260, 600}, {8482, 600}, {8706, 600}, {8710, 600}, {8721, 600}, {8722, 600}, {8730, 600}, {8800, 600}, {8804, 600}, {8805, 600},
+    {9674, 600}, {63171, 600}, {64257, 600}, {64258, 600}};
+
+constexpr std::pair<unsigned int, float> courier_oblique_widths[] = {
+    {32, 600}, {33, 600}, {34, 600}, {35, 600}, {36, 600}, {37, 600}, {38, 600}, {39, 600}, {40, 600}, {41, 600},
+    {42, 600}, {43, 600}, {44, 600}, {45, 600}, {46, 600}, {47, 600}, {48, 600}, {49, 600}, {50, 600}, {51, 600},
+    {52, 600}, {53, 600}, {54, 600}, {55, 600}, {56, 600}, {57, 600}, {58, 600}, {59, 600}, {60, 600}, {61, 600},
+    {62, 600}, {63, 600}, {64, 600}, {65, 600}, {66, 600}, {67, 600}, {68, 600}, {69, 600}, {70, 600}, {71, 600},
+    {72, 600}, {73, 600}, {74, 600}, {75, 600}, {76, 600}, {77, 600}, {78, 600}, {79, 600}, {80, 600}, {81, 600},
+    {82, 600}, {83, 600}, {84, 600}, {85, 600}, {86, 600}, {87, 600}, {88, 600}, {89, 600}, {90, 600}, {91, 600},
+    {92, 600}, {93, 600}, {94, 600}, {95, 600}, {96, 600}, {97, 600}, {98, 600}, {99, 600}, {100, 600}, {101, 600},
+    {102, 600}, {103, 600}, {104, 600}, {105, 600}, {106, 600}, {107, 600}, {108, 600}, {109, 600}, {110, 600}, {111, 600},
+    {112, 600}, {113, 600}, {114, 600}, {115, 600}, {116, 600}, {117, 600}, {118, 600}, {119, 600}, {120, 600}, {121, 600},
+    {122, 600}, {123, 600}, {124, 600}, {125, 600}, {126, 600}, {161, 600}, {162, 600}, {163, 600}, {164, 600}, {165, 600},
+    {166, 600}, {167, 600}, {168, 600}, {169, 600}, {170, 600}, {171, 600}, {172, 600}, {174, 600}, {175, 600}, {176, 600},
+    {177, 600}, {178, 600}, {179, 600}, {180, 600}, {181, 600}, {182, 600}, {183, 600}, {184, 600}, {185, 600}, {186, 600},
+    {187, 600}, {188, 600}, {189, 600}, {190, 600}, {191, 600}, {192, 600}, {193, 600}, {194, 600}, {195, 600}, {196, 600},
+    {197, 600}, {198, 600}, {199, 600}, {200, 600}, {201, 600}, {202, 600}, {203, 600}, {204, 600}, {205, 600}, {206, 600},
+    {207, 600}, {208, 600}, {209, 600}, {210, 600}, {211, 600}, {212, 600}, {213, 600}, {214, 600}, {215, 600}, {216, 600},
+    {217, 600}, {218, 600}, {219, 600}, {220, 600}, {221, 600}, {222, 600}, {223, 600}, {224, 600}, {225, 600}, {226, 600},
+    {227, 600}, {228, 600}, {229, 600}, {230, 600}, {231, 600}, {232, 600}, {233, 600}, {234, 600}, {235, 600}, {236, 600},
+    {237, 600}, {238, 600}, {239, 600}, {240, 600}, {241, 600}, {242, 600}, {243, 600}, {244, 600}, {245, 600}, {246, 600},
+    {247, 600}, {248, 600}, {249, 600}, {250, 600}, {251, 600}, {252, 600}, {253, 600}, {254, 600}, {255, 600}, {256, 600},
+    {257, 600}, {258, 600}, {259, 600}, {260, 600}, {261, 600}, {262, 600}, {263, 600}, {268, 600}, {269, 600}, {270, 600},
+    {271, 600}, {272, 600}, {273, 600}, {274, 600}, {275, 600}, {278, 600}, {279, 600}, {280, 600}, {281, 600}, {282, 600},
+    {283, 600}, {286, 600}, {287, 600}, {290, 600}, {291, 600}, {298, 600}, {299, 600}, {302, 600}, {303, 600}, {304, 600},
+    {305, 600}, {310, 600}, {311, 600}, {313, 600}, {314, 600}, {315, 600}, {316, 600}, {317, 600}, {318, 600}, {321, 600},
+    {322, 600}, {323, 600}, {324, 600}, {325, 600}, {326, 600}, {327, 600}, {328, 600}, {332, 600}, {333, 600}, {336, 600},
+    {337, 600}, {338, 600}, {339, 600}, {340, 600}, {341, 600}, {342, 600}, {343, 600}, {344, 600}, {345, 600}, {346, 600},
+    {347, 600}, {350, 600}, {351, 600}, {352, 600}, {353, 600}, {354, 600}, {355, 600}, {356, 600}, {357, 600}, {362, 600},
+    {363, 600}, {366, 600}, {367, 600}, {368, 600}, {369, 600}, {370, 600}, {371, 600}, {376, 600}, {377, 600}, {378, 600},
+    {379, 600}, {380, 600}, {381, 600}, {382, 600}, {402, 600}, {536, 600}, {537, 600}, {710, 600}, {711, 600}, {728, 600},
+    {729, 600}, {730, 600}, {731, 600}, {732, 600}, {733, 600}, {8211, 600}, {8212, 600}, {8216, 600}, {8217, 600}, {8218, 600},
+    {8220, 600}, {8221, 600}, {8222, 600}, {8224, 600}, {8225, 600}, {8226, 600}, {8230, 600}, {8240, 600}, {8249, 600}, {8250, 600},
+    {8260, 600}, {8482, 600}, {8706, 600}, {8710, 600}, {8721, 600}, {8722, 600}, {8730, 600}, {8800, 600}, {8804, 600}, {8805, 600},
+    {9674, 600}, {63171, 600}, {64257, 600}, {64258, 600}};
+
+constexpr std::pair<unsigned int, float> helvetica_widths[] = {
+    {32, 278}, {33, 278}, {34, 355}, {35, 556}, {36, 556}, {37, 889}, {38, 667}, {39, 191}, {40, 333}, {41, 333},
+    {42, 389}, {43, 584}, {44, 278}, {45, 333}, {46, 278}, {47, 278}, {48, 556}, {49, 556}, {50, 556}, {51, 556},
+    {52, 556}, {53, 556}, {54, 556}, {55, 556}, {56, 556}, {57, 556}, {58, 278}, {59, 278}, {60, 584}, {61, 584},
+    {62, 584}, {63, 556}, {64, 1015}, {65, 667}, {66, 667}, {67, 722}, {68, 722}, {69, 667}, {70, 611}, {71, 778},
+    {72, 722}, {73, 278}, {74, 500}, {75, 667}, {76, 556}, {77, 833}, {78, 722}, {79, 778}, {80, 667}, {81, 778},
+    {82, 722}, {83, 667}, {84, 611}, {85, 722}, {86, 667}, {87, 944}, {88, 667}, {89, 667}, {90, 611}, {91, 278},
+    {92, 278}, {93, 278}, {94, 469}, {95, 556}, {96, 333}, {97, 556}, {98, 556}, {99, 500}, {100, 556}, {101, 556},
+    {102, 278}, {103, 556}, {104, 556}, {105, 222}, {106, 222}, {107, 500}, {108, 222}, {109, 833}, {110, 556}, {111, 556},
+    {112, 556}, {113, 556}, {114, 333}, {115, 500}, {116, 278}, {117, 556}, {118, 500}, {119, 722}, {120, 500}, {121, 500},
+    {122, 500}, {123, 334}, {124, 260}, {125, 334}, {126, 584}, {161, 333}, {162, 556}, {163, 556}, {164, 556}, {165, 556},
+    {166, 260}, {167, 556}, {168, 333}, {169, 737}, {170, 370}, {171, 556}, {172, 584}, {174, 737}, {175, 333}, {176, 400},
+    {177, 584}, {178, 333}, {179, 333}, {180, 333}, {181, 556}, {182, 537}, {183, 278}, {184, 333}, {185, 333}, {186, 365},
+    {187, 556}, {188, 834}, {189, 834}, {190, 834}, {191, 611}, {192, 667}, {193, 667}, {194, 667}, {195, 667}, {196, 667},
+    {197, 667}, {198, 1000}, {199, 722}, {200, 667}, {201, 667}, {202, 667}, {203, 667}, {204, 278}, {205, 278}, {206, 278},
+    {207, 278}, {208, 722}, {209, 722}, {210, 778}, {211, 778}, {212, 778}, {213, 778}, {214, 778}, {215, 584}, {216, 778},
+    {217, 722}, {218, 722}, {219, 722}, {220, 722}, {221, 667}, {222, 667}, {223, 611}, {224, 556}, {225, 556}, {226, 556},
+    {227, 556}, {228, 556}, {229, 556}, {230, 889}, {231, 500}, {232, 556}, {233, 556}, {234, 556}, {235, 556}, {236, 278},
+    {237, 278}, {238, 278}, {239, 278}, {240, 556}, {241, 556}, {242, 556}, {243, 556}, {244, 556}, {245, 556}, {246, 556},
+    {247, 584}, {248, 611}, {249, 556}, {250, 556}, {251, 556}, {252, 556}, {253, 500}, {254, 556}, {255, 500}, {256, 667},
+    {257, 556}, {258, 667}, {259, 556}, {260, 667}, {261, 556}, {262, 722}, {263, 500}, {268, 722}, {269, 500}, {270, 722},
+    {271, 643}, {272, 722}, {273, 556}, {274, 667}, {275, 556}, {278, 667}, {279, 556}, {280, 667}, {281, 556}, {282, 667},
+    {283, 556}, {286, 778}, {287, 556}, {290, 778}, {291, 556}, {298, 278}, {299, 278}, {302, 278}, {303, 222}, {304, 278},
+    {305, 278}, {310, 667}, {311, 500}, {313, 556}, {314, 222}, {315, 556}, {316, 222}, {317, 556}, {318, 299}, {321, 556},
+    {322, 222}, {323, 722}, {324, 556}, {325, 722}, {326, 556}, {327, 722}, {328, 556}, {332, 778}, {333, 556}, {336, 778},
+    {337, 556}, {338, 1000}, {339, 944}, {340, 722}, {341, 333}, {342, 722}, {343, 333}, {344, 722}, {345, 333}, {346, 667},
+    {347, 500}, {350, 667}, {351, 500}, {352, 667}, {353, 500}, {354, 611}, {355, 278}, {356, 611}, {357, 317}, {362, 722},
+    {363, 556}, {366, 722}, {367, 556}, {368, 722}, {369, 556}, {370, 722}, {371, 556}, {376, 667}, {377, 611}, {378, 500},
+    {379, 611}, {380, 500}, {381, 611}, {382, 500}, {402, 556}, {536, 667}, {537, 500}, {710, 333}, {711, 333}, {728, 333},
+    {729, 333}, {730, 333}, {731, 333}, {732, 333}, {733, 333}, {8211, 556}, {8212, 1000}, {8216, 222}, {8217, 222}, {8218, 222},
+    {8220, 333}, {8221, 333}, {8222, 333}, {8224, 556}, {8225, 556}, {8226, 350}, {8230, 1000}, {8240, 1000}, {8249, 333}, {8250, 333},
+    {8260, 167}, {8482, 1000}, {8706, 476}, {8710, 612}, {8721, 600}, {8722, 584}, {8730, 453}, {8800, 549}, {8804, 549}, {8805, 549},
+    {9674, 471}, {63171, 250}, {64257, 500}, {64258, 500}};
+
+constexpr std::pair<unsigned int, float> helvetica_bold_widths[] = {
+    {32, 278}, {33, 333}, {34, 474}, {35, 556}, {36, 556}, {37, 889}, {38, 722}, {39, 238}, {40, 333}, {41, 333},
+    {42, 389}, {43, 584}, {44, 278}, {45, 333}, {46, 278}, {47, 278}, {48, 556}, {49, 556}, {50, 556}, {51, 556},
+    {52, 556}, {53, 556}, {54, 556}, {55, 556}, {56, 556}, {57, 556}, {58, 333}, {59, 333}, {60, 584}, {61, 584},
+    {62, 584}, {63, 611}, {64, 975}, {65, 722}, {66, 722}, {67, 722}, {68, 722}, {69, 667}, {70, 611}, {71, 778},
+    {72, 722}, {73, 278}, {74, 556}, {75, 722}, {76, 611}, {77, 833}, {78, 722}, {79, 778}, {80, 667}, {81, 778},
+    {82, 722}, {83, 667}, {84, 611}, {85, 722}, {86, 667}, {87, 944}, {88, 667}, {89, 667}, {90, 611}, {91, 333},
+    {92, 278}, {93, 333}, {94, 584}, {95, 556}, {96, 333}, {97, 556}, {98, 611}, {99, 556}, {100, 611}, {101, 556},
+    {102, 333}, {103, 611}, {104, 611}, {105, 278}, {106, 278}, {107, 556}, {108, 278}, {109, 889}, {110, 611}, {111, 611},
+    {112, 611}, {113, 611}, {114, 389}, {115, 556}, {116, 333}, {117, 611}, {118, 556}, {119, 778}, {120, 556}, {121, 556},
+    {122, 500}, {123, 389}, {124, 280}, {125, 389}, {126, 584}, {161, 333}, {162, 556}, {163, 556}, {164, 556}, {165, 556},
+    {166, 280}, {167, 556}, {168, 333}, {169, 737}, {170, 370}, {171, 556}, {172, 584}, {174, 737}, {175, 333}, {176, 400},
+    {177, 584}, {178, 333}, {179, 333}, {180, 333}, {181, 611}, {182, 556}, {183, 278}, {184, 333}, {185, 333}, {186, 365},
+    {187, 556}, {188, 834}, {189, 834}, {190, 834}, {191, 611}, {192, 722}, {193, 722}, {194, 722}, {195, 722}, {196, 722},
+    {197, 722}, {198, 1000}, {199, 722}, {200, 667}, {201, 667}, {202, 667}, {203, 667}, {204, 278}, {205, 278}, {206, 278},
+    {207, 278}, {208, 722}, {209, 722}, {210, 778}, {211, 778}, {212, 778}, {213, 778}, {214, 778}, {215, 584}, {216, 778},
+    {217, 722}, {218, 722}, {219, 722}, {220, 722}, {221, 667}, {222, 667}, {223, 611}, {224, 556}, {225, 556}, {226, 556},
+    {227, 556}, {228, 556}, {229, 556}, {230, 889}, {231, 556}, {232, 556}, {233, 556}, {234, 556}, {235, 556}, {236, 278},
+    {237, 278}, {238, 278}, {239, 278}, {240, 611}, {241, 611}, {242, 611}, {243, 611}, {244, 611}, {245, 611}, {246, 611},
+    {247, 584}, {248, 611}, {249, 611}, {250, 611}, {251, 611}, {252, 611}, {253, 556}, {254, 611}, {255, 556}, {256, 722},
+    {257, 556}, {258, 722}, {259, 556}, {260, 722}, {261, 556}, {262, 722}, {263, 556}, {268, 722}, {269, 556}, {270, 722},
+    {271, 743}, {272, 722}, {273, 611}, {274, 667}, {275, 556}, {278, 667}, {279, 556}, {280, 667}, {281, 556}, {282, 667},
+    {283, 556}, {286, 778}, {287, 611}, {290, 778}, {291, 611}, {298, 278}, {299, 278}, {302, 278}, {303, 278}, {304, 278},
+    {305, 278}, {310, 722}, {311, 556}, {313, 611}, {314, 278}, {315, 611}, {316, 278}, {317, 611}, {318, 400}, {321, 611},
+    {322, 278}, {323, 722}, {324, 611}, {325, 722}, {326, 611}, {327, 722}, {328, 611}, {332, 778}, {333, 611}, {336, 778},
+    {337, 611}, {338, 1000}, {339, 944}, {340, 722}, {341, 389}, {342, 722}, {343, 389}, {344, 722}, {345, 389}, {346, 667},
+    {347, 556}, {350, 667}, {351, 556}, {352, 667}, {353, 556}, {354, 611}, {355, 333}, {356, 611}, {357, 389}, {362, 722},
+    {363, 611}, {366, 722}, {367, 611}, {368, 722}, {369, 611}, {370, 722}, {371, 611}, {376, 667}, {377, 611}, {378, 500},
+    {379, 611}, {380, 500}, {381, 611}, {382, 500}, {402, 556}, {536, 667}, {537, 556}, {710, 333}, {711, 333}, {728, 333},
+    {729, 333}, {730, 333}, {731, 333}, {732, 333}, {733, 333}, {8211, 556}, {8212, 1000}, {8216, 278}, {8217, 278}, {8218, 278},
+    {8220, 500}, {8221, 500}, {8222, 500}, {8224, 556}, {8225, 556}, {8226, 350}, {8230, 1000}, {8240, 1000}, {8249, 333}, {8250, 333},
+    {8260, 167}, {8482, 1000}, {8706, 494}, {8710, 612}, {8721, 600}, {8722, 584}, {8730, 549}, {8800, 549}, {8804, 549}, {8805, 549},
+    {9674, 494}, {63171, 250}, {64257, 611}, {64258, 611}};
+
+constexpr std::pair<unsigned int, float> helvetica_boldoblique_widths[] = {
+    {32, 278}, {33, 333}, {34, 474}, {35, 556}, {36, 556}, {37, 889}, {38, 722}, {39, 238}, {40, 333}, {41, 333},
+    {42, 389}, {43, 584}, {44, 278}, {45, 333}, {46, 278}, {47, 278}, {48, 556}, {49, 556}, {50, 556}, {51, 556},
+    {52, 556}, {53, 556}, {54, 556}, {55, 556}, {56, 556}, {57, 556}, {58, 333}, {59, 333}, {60, 584}, {61, 584},
+    {62, 584}, {63, 611}, {64, 975}, {65, 722}, {66, 722}, {67, 722}, {68, 722}, {69, 667}, {70, 611}, {71, 778},
+    {72, 722}, {73, 278}, {74, 556}, {75, 722}, {76, 611}, {77, 833}, {78, 722}, {79, 778}, {80, 667}, {81, 778},
+    {82, 722}, {83, 667}, {84, 611}, {85, 722}, {86, 667}, {87, 944}, {88, 667}, {89, 667}, {90, 611}, {91, 333},
+    {92, 278}, {93, 333}, {94, 584}, {95, 556}, {96, 333}, {97, 556}, {98, 611}, {99, 556}, {100, 611}, {101, 556},
+    {102, 333}, {103, 611}, {104, 611}, {105, 278}, {106, 278}, {107, 556}, {108, 278}, {109, 889}, {110, 611}, {111, 611},
+    {112, 611}, {113, 611}, {114, 389}, {115, 556}, {116, 333}, {117, 611}, {118, 556}, {119, 778}, {120, 556}, {121, 556},
+    {122, 500}, {123, 389}, {124, 280}, {125, 389}, {126, 584}, {161, 333}, {162, 556}, {163, 556}, {164, 556}, {165, 556},
+    {166, 280}, {167, 556}, {168, 333}, {169, 737}, {170, 370}, {171, 556}, {172, 584}, {174, 737}, {175, 333}, {176, 400},
+    {177, 584}, {178, 333}, {179, 333}, {180, 333}, {181, 611}, {182, 556}, {183, 278}, {184, 333}, {185, 333}, {186, 365},
+    {187, 556}, {188, 834}, {189, 834}, {190, 834}, {191, 611}, {192, 722}, {193, 722}, {194, 722}, {195, 722}, {196, 722},
+    {197, 722}, {198, 1000}, {199, 722}, {200, 667}, {201, 667}, {202, 667}, {203, 667}, {204, 278}, {205, 278}, {206, 278},
+    {207, 278}, {208, 722}, {209, 722}, {210, 778}, {211, 778}, {212, 778}, {213, 778}, {214, 778}, {215, 584}, {216, 778},
+    {217, 722}, {218, 722}, {219, 722}, {220, 722}, {221, 667}, {222, 667}, {223, 611}, {224, 556}, {225, 556}, {226, 556},
+    {227, 556}, {228, 556}, {229, 556}, {230, 889}, {231, 556}, {232, 556}, {233, 556}, {234, 556}, {235, 556}, {236, 278},
+    {237, 278}, {238, 278}, {239, 278}, {240, 611}, {241, 611}, {242, 611}, {243, 611}, {244, 611}, {245, 611}, {246, 611},
+    {247, 584}, {248, 611}, {249, 611}, {250, 611}, {251, 611}, {252, 611}, {253, 556}, {254, 611}, {255, 556}, {256, 722},
+    {257, 556}, {258, 722}, {259, 556}, {260, 722}, {261, 556}, {262, 722}, {263, 556}, {268, 722}, {269, 556}, {270, 722},
+    {271, 743}, {272, 722}, {273, 611}, {274, 667}, {275, 556}, {278, 667}, {279, 556}, {280, 667}, {281, 556}, {282, 667},
+    {283, 556}, {286, 778}, {287, 611}, {290, 778}, {291, 611}, {298, 278}, {299, 278}, {302, 278}, {303, 278}, {304, 278},
+    {305, 278}, {310, 722}, {311, 556}, {313, 611}, {314, 278}, {315, 611}, {316, 278}, {317, 611}, {318, 400}, {321, 611},
+    {322, 278}, {323, 722}, {324, 611}, {325, 722}, {326, 611}, {327, 722}, {328, 611}, {332, 778}, {333, 611}, {336, 778},
+    {337, 611}, {338, 1000}, {339, 944}, {340, 722}, {341, 389}, {342, 722}, {343, 389}, {344, 722}, {345, 389}, {346, 667},
+    {347, 556}, {350, 667}, {351, 556}, {352, 667}, {353, 556}, {354, 611}, {355, 333}, {356, 611}, {357, 389}, {362, 722},
+    {363, 611}, {366, 722}, {367, 611}, {368, 722}, {369, 611}, {370, 722}, {371, 611}, {376, 667}, {377, 611}, {378, 500},
+    {379, 611}, {380, 500}, {381, 611}, {382, 500}, {402, 556}, {536, 667}, {537, 556}, {710, 333}, {711, 333}, {728, 333},
+    {729, 333}, {730, 333}, {731, 333}, {732, 333}, {733, 333}, {8211, 556}, {8212, 1000}, {8216, 278}, {8217, 278}, {8218, 278},
+    {8220, 500}, {8221, 500}, {8222, 500}, {8224, 556}, {8225, 556}, {8226, 350}, {8230, 1000}, {8240, 1000}, {8249, 333}, {8250, 333},
+    {8260, 167}, {8482, 1000}, {8706, 494}, {8710, 612}, {8721, 600}, {8722, 584}, {8730, 549}, {8800, 549}, {8804, 549}, {8805, 549},
+    {9674, 494}, {63171, 250}, {64257, 611}, {64258, 611}};
+
+constexpr std::pair<unsigned int, float> helvetica_oblique_widths[] = {
+    {32, 278}, {33, 278}, {34, 355}, {35, 556}, {36, 556}, {37, 889}, {38, 667}, {39, 191}, {40, 333}, {41, 333},
+    {42, 389}, {43, 584}, {44, 278}, {45, 333}, {46, 278}, {47, 278}, {48, 556}, {49, 556}, {50, 556}, {51, 556},
+    {52, 556}, {53, 556}, {54, 556}, {55, 556}, {56, 556}, {57, 556}, {58, 278}, {59, 278}, {60, 584}, {61, 584},
+    {62, 584}, {63, 556}, {64, 1015}, {65, 667}, {66, 667}, {67, 722}, {68, 722}, {69, 667}, {70, 611}, {71, 778},
+    {72, 722}, {73, 278}, {74, 500}, {75, 667}, {76, 556}, {77, 833}, {78, 722}, {79, 778}, {80, 667}, {81, 778},
+    {82, 722}, {83, 667}, {84, 611}, {85, 722}, {86, 667}, {87, 944}, {88, 667}, {89, 667}, {90, 611}, {91, 278},
+    {92, 278}, {93, 278}, {94, 469}, {95, 556}, {96, 333}, {97, 556}, {98, 556}, {99, 500}, {100, 556}, {101, 556},
+    {102, 278}, {103, 556}, {104, 556}, {105, 222}, {106, 222}, {107, 500}, {108, 222}, {109, 833}, {110, 556}, {111, 556},
+    {112, 556}, {113, 556}, {114, 333}, {115, 500}, {116, 278}, {117, 556}, {118, 500}, {119, 722}, {120, 500}, {121, 500},
+    {122, 500}, {123, 334}, {124, 260}, {125, 334}, {126, 584}, {161, 333}, {162, 556}, {163, 556}, {164, 556}, {165, 556},
+    {166, 260}, {167, 556}, {168, 333}, {169, 737}, {170, 370}, {171, 556}, {172, 584}, {174, 737}, {175, 333}, {176, 400},
+    {177, 584}, {178, 333}, {179, 333}, {180, 333}, {181, 556}, {182, 537}, {183, 278}, {184, 333}, {185, 333}, {186, 365},
+    {187, 556}, {188, 834}, {189, 834}, {190, 834}, {191, 611}, {192, 667}, {193, 667}, {194, 667}, {195, 667}, {196, 667},
+    {197, 667}, {198, 1000}, {199, 722}, {200, 667}, {201, 667}, {202, 667}, {203, 667}, {204, 278}, {205, 278}, {206, 278},
+    {207, 278}, {208, 722}, {209, 722}, {210, 778}, {211, 778}, {212, 778}, {213, 778}, {214, 778}, {215, 584}, {216, 778},
+    {217, 722}, {218, 722}, {219, 722}, {220, 722}, {221, 667}, {222, 667}, {223, 611}, {224, 556}, {225, 556}, {226, 556},
+    {227, 556}, {228, 556}, {229, 556}, {230, 889}, {231, 500}, {232, 556}, {233, 556}, {234, 556}, {235, 556}, {236, 278},
+    {237, 278}, {238, 278}, {239, 278}, {240, 556}, {241, 556}, {242, 556}, {243, 556}, {244, 556}, {245, 556}, {246, 556},
+    {247, 584}, {248, 611}, {249, 556}, {250, 556}, {251, 556}, {252, 556}, {253, 500}, {254, 556}, {255, 500}, {256, 667},
+    {257, 556}, {258, 667}, {259, 556}, {260, 667}, {261, 556}, {262, 722}, {263, 500}, {268, 722}, {269, 500}, {270, 722},
+    {271, 643}, {272, 722}, {273, 556}, {274, 667}, {275, 556}, {278, 667}, {279, 556}, {280, 667}, {281, 556}, {282, 667},
+    {283, 556}, {286, 778}, {287, 556}, {290, 778}, {291, 556}, {298, 278}, {299, 278}, {302, 278}, {303, 222}, {304, 278},
+    {305, 278}, {310, 667}, {311, 500}, {313, 556}, {314, 222}, {315, 556}, {316, 222}, {317, 556}, {318, 299}, {321, 556},
+    {322, 222}, {323, 722}, {324, 556}, {325, 722}, {326, 556}, {327, 722}, {328, 556}, {332, 778}, {333, 556}, {336, 778},
+    {337, 556}, {338, 1000}, {339, 944}, {340, 722}, {341, 333}, {342, 722}, {343, 333}, {344, 722}, {345, 333}, {346, 667},
+    {347, 500}, {350, 667}, {351, 500}, {352, 667}, {353, 500}, {354, 611}, {355, 278}, {356, 611}, {357, 317}, {362, 722},
+    {363, 556}, {366, 722}, {367, 556}, {368, 722}, {369, 556}, {370, 722}, {371, 556}, {376, 667}, {377, 611}, {378, 500},
+    {379, 611}, {380, 500}, {381, 611}, {382, 500}, {402, 556}, {536, 667}, {537, 500}, {710, 333}, {711, 333}, {728, 333},
+    {729, 333}, {730, 333}, {731, 333}, {732, 333}, {733, 333}, {8211, 556}, {8212, 1000}, {8216, 222}, {8217, 222}, {8218, 222},
+    {8220, 333}, {8221, 333}, {8222, 333}, {8224, 556}, {8225, 556}, {8226, 350}, {8230, 1000}, {8240, 1000}, {8249, 333}, {8250, 333},
+    {8260, 167}, {8482, 1000}, {8706, 476}, {8710, 612}, {8721, 600}, {8722, 584}, {8730, 453}, {8800, 549}, {8804, 549}, {8805, 549},
+    {9674, 471}, {63171, 250}, {64257, 500}, {64258, 500}};
+
+constexpr std::pair<unsigned int, float> symbol_widths[] = {
+    {32, 250}, {33, 333}, {35, 500}, {37, 833}, {38, 778}, {40, 333}, {41, 333}, {43, 549}, {44, 250}, {46, 250},
+    {47, 278}, {48, 500}, {49, 500}, {50, 500}, {51, 500}, {52, 500}, {53, 500}, {54, 500}, {55, 500}, {56, 500},
+    {57, 500}, {58, 278}, {59, 278}, {60, 549}, {61, 549}, {62, 549}, {63, 444}, {91, 333}, {93, 333}, {95, 500},
+    {123, 480}, {124, 200}, {125, 480}, {172, 713}, {176, 400}, {177, 549}, {181, 576}, {215, 549}, {247, 549}, {402, 500},
+    {913, 722}, {914, 667}, {915, 603}, {917, 611}, {918, 611}, {919, 722}, {920, 741}, {921, 333}, {922, 722}, {923, 686},
+    {924, 889}, {925, 722}, {926, 645}, {927, 722}, {928, 768}, {929, 556}, {931, 592}, {932, 611}, {933, 690}, {934, 763},
+    {935, 722}, {936, 795}, {945, 631}, {946, 549}, {947, 411}, {948, 494}, {949, 439}, {950, 494}, {951, 603}, {952, 521},
+    {953, 329}, {954, 549}, {955, 549}, {957, 521}, {958, 493}, {959, 549}, {960, 549}, {961, 549}, {962, 439}, {963, 603},
+    {964, 439}, {965, 576}, {966, 521}, {967, 549}, {968, 686}, {969, 686}, {977, 631}, {978, 620}, {981, 603}, {982, 713},
+    {8226, 460}, {8230, 1000}, {8242, 247}, {8243, 411}, {8260, 167}, {8364, 750}, {8465, 686}, {8472, 987}, {8476, 795}, {8486, 768},
+    {8501, 823}, {8592, 987}, {8593, 603}, {8594, 987}, {8595, 603}, {8596, 1042}, {8629, 658}, {8656, 987}, {8657, 603}, {8658, 987},
+    {8659, 603}, {8660, 1042}, {8704, 713}, {8706, 494}, {8707, 549}, {8709, 823}, {8710, 612}, {8711, 713}, {8712, 713}, {8713, 713},
+    {8715, 439}, {8719, 823}, {8721, 713}, {8722, 549}, {8727, 500}, {8730, 549}, {8733, 713}, {8734, 713}, {8736, 768}, {8743, 603},
+    {8744, 603}, {8745, 768}, {8746, 768}, {8747, 274}, {8756, 863}, {8764, 549}, {8773, 549}, {8776, 549}, {8800, 549}, {8801, 549},
+    {8804, 549}, {8805, 549}, {8834, 713}, {8835, 713}, {8836, 713}, {8838, 713}, {8839, 713}, {8853, 768}, {8855, 768}, {8869, 658},
+    {8901, 250}, {8992, 686}, {8993, 686}, {9001, 329}, {9002, 329}, {9674, 494}, {9824, 753}, {9827, 753}, {9829, 753}, {9830, 753},
+    {63193, 790}, {63194, 790}, {63195, 890}, {63717, 500}, {63718, 603}, {63719, 1000}, {63720, 790}, {63721, 790}, {63722, 786}, {63723, 384},
+    {63724, 384}, {63725, 384}, {63726, 384}, {63727, 384}, {63728, 384}, {63729, 494}, {63730, 494}, {63731, 494}, {63732, 494}, {63733, 686},
+    {63734, 384}, {63735, 384}, {63736, 384}, {63737, 384}, {63738, 384}, {63739, 384}, {63740, 494}, {63741, 494}, {63742, 494}, {63743, 790}};
+
+constexpr std::pair<unsigned int, float> times_bold_widths[] = {
+    {32, 250}, {33, 333}, {34, 555}, {35, 500}, {36, 500}, {37, 1000}, {38, 833}, {39, 278}, {40, 333}, {41, 333},
+    {42, 500}, {43, 570}, {44, 250}, {45, 333}, {46, 250}, {47, 278}, {48, 500}, {49, 500}, {50, 500}, {51, 500},
+    {52, 500}, {53, 500}, {54, 500}, {55, 500}, {56, 500}, {57, 500}, {58, 333}, {59, 333}, {60, 570}, {61, 570},
+    {62, 570}, {63, 500}, {64, 930}, {65, 722}, {66, 667}, {67, 722}, {68, 722}, {69, 667}, {70, 611}, {71, 778},
+    {72, 778}, {73, 389}, {74, 500}, {75, 778}, {76, 667}, {77, 944}, {78, 722}, {79, 778}, {80, 611}, {81, 778},
+    {82, 722}, {83, 556}, {84, 667}, {85, 722}, {86, 722}, {87, 1000}, {88, 722}, {89, 722}, {90, 667}, {91, 333},
+    {92, 278}, {93, 333}, {94, 581}, {95, 500}, {96, 333}, {97, 500}, {98, 556}, {99, 444}, {100, 556}, {101, 444},
+    {102, 333}, {103, 500}, {104, 556}, {105, 278}, {106, 333}, {107, 556}, {108, 278}, {109, 833}, {110, 556}, {111, 500},
+    {112, 556}, {113, 556}, {114, 444}, {115, 389}, {116, 333}, {117, 556}, {118, 500}, {119, 722}, {120, 500}, {121, 500},
+    {122, 444}, {123, 394}, {124, 220}, {125, 394}, {126, 520}, {161, 333}, {162, 500}, {163, 500}, {164, 500}, {165, 500},
+    {166, 220}, {167, 500}, {168, 333}, {169, 747}, {170, 300}, {171, 500}, {172, 570}, {174, 747}, {175, 333}, {176, 400},
+    {177, 570}, {178, 300}, {179, 300}, {180, 333}, {181, 556}, {182, 540}, {183, 250}, {184, 333}, {185, 300}, {186, 330},
+    {187, 500}, {188, 750}, {189, 750}, {190, 750}, {191, 500}, {192, 722}, {193, 722}, {194, 722}, {195, 722}, {196, 722},
+    {197, 722}, {198, 1000}, {199, 722}, {200, 667}, {201, 667}, {202, 667}, {203, 667}, {204, 389}, {205, 389}, {206, 389},
+    {207, 389}, {208, 722}, {209, 722}, {210, 778}, {211, 778}, {212, 778}, {213, 778}, {214, 778}, {215, 570}, {216, 778},
+    {217, 722}, {218, 722}, {219, 722}, {220, 722}, {221, 722}, {222, 611}, {223, 556}, {224, 500}, {225, 500}, {226, 500},
+    {227, 500}, {228, 500}, {229, 500}, {230, 722}, {231, 444}, {232, 444}, {233, 444}, {234, 444}, {235, 444}, {236, 278},
+    {237, 278}, {238, 278}, {239, 278}, {240, 500}, {241, 556}, {242, 500}, {243, 500}, {244, 500}, {245, 500}, {246, 500},
+    {247, 570}, {248, 500}, {249, 556}, {250, 556}, {251, 556}, {252, 556}, {253, 500}, {254, 556}, {255, 500}, {256, 722},
+    {257, 500}, {258, 722}, {259, 500}, {260, 722}, {261, 500}, {262, 722}, {263, 444}, {268, 722}, {269, 444}, {270, 722},
+    {271, 672}, {272, 722}, {273, 556}, {274, 667}, {275, 444}, {278, 667}, {279, 444}, {280, 667}, {281, 444}, {282, 667},
+    {283, 444}, {286, 778}, {287, 500}, {290, 778}, {291, 500}, {298, 389}, {299, 278}, {302, 389}, {303, 278}, {304, 389},
+    {305, 278}, {310, 778}, {311, 556}, {313, 667}, {314, 278}, {315, 667}, {316, 278}, {317, 667}, {318, 394}, {321, 667},
+    {322, 278}, {323, 722}, {324, 556}, {325, 722}, {326, 556}, {327, 722}, {328, 556}, {332, 778}, {333, 500}, {336, 778},
+    {337, 500}, {338, 1000}, {339, 722}, {340, 722}, {341, 444}, {342, 722}, {343, 444}, {344, 722}, {345, 444}, {346, 556},
+    {347, 389}, {350, 556}, {351, 389}, {352, 556}, {353, 389}, {354, 667}, {355, 333}, {356, 667}, {357, 416}, {362, 722},
+    {363, 556}, {366, 722}, {367, 556}, {368, 722}, {369, 556}, {370, 722}, {371, 556}, {376, 722}, {377, 667}, {378, 444},
+    {379, 667}, {380, 444}, {381, 667}, {382, 444}, {402, 500}, {536, 556}, {537, 389}, {710, 333}, {711, 333}, {728, 333},
+    {729, 333}, {730, 333}, {731, 333}, {732, 333}, {733, 333}, {8211, 500}, {8212, 1000}, {8216, 333}, {8217, 333}, {8218, 333},
+    {8220, 500}, {8221, 500}, {8222, 500}, {8224, 500}, {8225, 500}, {8226, 350}, {8230, 1000}, {8240, 1000}, {8249, 333}, {8250, 333},
+    {8260, 167}, {8482, 1000}, {8706, 494}, {8710, 612}, {8721, 600}, {8722, 570}, {8730, 549}, {8800, 549}, {8804, 549}, {8805, 549},
+    {9674, 494}, {63171, 250}, {64257, 556}, {64258, 556}};
+
+constexpr std::pair<unsigned int, float> times_bolditalic_widths[] = {
+    {32, 250}, {33, 389}, {34, 555}, {35, 500}, {36, 500}, {37, 833}, {38, 778}, {39, 278}, {40, 333}, {41, 333},
+    {42, 500}, {43, 570}, {44, 250}, {45, 333}, {46, 250}, {47, 278}, {48, 500}, {49, 500}, {50, 500}, {51, 500},
+    {52, 500}, {53, 500}, {54, 500}, {55, 500}, {56, 500}, {57, 500}, {58, 333}, {59, 333}, {60, 570}, {61, 570},
+    {62, 570}, {63, 500}, {64, 832}, {65, 667}, {66, 667}, {67, 667}, {68, 722}, {69, 667}, {70, 667}, {71, 722},
+    {72, 778}, {73, 389}, {74, 500}, {75, 667}, {76, 611}, {77, 889}, {78, 722}, {79, 722}, {80, 611}, {81, 722},
+    {82, 667}, {83, 556}, {84, 611}, {85, 722}, {86, 667}, {87, 889}, {88, 667}, {89, 611}, {90, 611}, {91, 333},
+    {92, 278}, {93, 333}, {94, 570}, {95, 500}, {96, 333}, {97, 500}, {98, 500}, {99, 444}, {100, 500}, {101, 444},
+    {102, 333}, {103, 500}, {104, 556}, {105, 278}, {106, 278}, {107, 500}, {108, 278}, {109, 778}, {110, 556}, {111, 500},
+    {112, 500}, {113, 500}, {114, 389}, {115, 389}, {116, 278}, {117, 556}, {118, 444}, {119, 667}, {120, 500}, {121, 444},
+    {122, 389}, {123, 348}, {124, 220}, {125, 348}, {126, 570}, {161, 389}, {162, 500}, {163, 500}, {164, 500}, {165, 500},
+    {166, 220}, {167, 500}, {168, 333}, {169, 747}, {170, 266}, {171, 500}, {172, 606}, {174, 747}, {175, 333}, {176, 400},
+    {177, 570}, {178, 300}, {179, 300}, {180, 333}, {181, 576}, {182, 500}, {183, 250}, {184, 333}, {185, 300}, {186, 300},
+    {187, 500}, {188, 750}, {189, 750}, {190, 750}, {191, 500}, {192, 667}, {193, 667}, {194, 667}, {195, 667}, {196, 667},
+    {197, 667}, {198, 944}, {199, 667}, {200, 667}, {201, 667}, {202, 667}, {203, 667}, {204, 389}, {205, 389}, {206, 389},
+    {207, 389}, {208, 722}, {209, 722}, {210, 722}, {211, 722}, {212, 722}, {213, 722}, {214, 722}, {215, 570}, {216, 722},
+    {217, 722}, {218, 722}, {219, 722}, {220, 722}, {221, 611}, {222, 611}, {223, 500}, {224, 500}, {225, 500}, {226, 500},
+    {227, 500}, {228, 500}, {229, 500}, {230, 722}, {231, 444}, {232, 444}, {233, 444}, {234, 444}, {235, 444}, {236, 278},
+    {237, 278}, {238, 278}, {239, 278}, {240, 500}, {241, 556}, {242, 500}, {243, 500}, {244, 500}, {245, 500}, {246, 500},
+    {247, 570}, {248, 500}, {249, 556}, {250, 556}, {251, 556}, {252, 556}, {253, 444}, {254, 500}, {255, 444}, {256, 667},
+    {257, 500}, {258, 667}, {259, 500}, {260, 667}, {261, 500}, {262, 667}, {263, 444}, {268, 667}, {269, 444}, {270, 722},
+    {271, 608}, {272, 722}, {273, 500}, {274, 667}, {275, 444}, {278, 667}, {279, 444}, {280, 667}, {281, 444}, {282, 667},
+    {283, 444}, {286, 722}, {287, 500}, {290, 722}, {291, 500}, {298, 389}, {299, 278}, {302, 389}, {303, 278}, {304, 389},
+    {305, 278}, {310, 667}, {311, 500}, {313, 611}, {314, 278}, {315, 611}, {316, 278}, {317, 611}, {318, 382}, {321, 611},
+    {322, 278}, {323, 722}, {324, 556}, {325, 722}, {326, 556}, {327, 722}, {328, 556}, {332, 722}, {333, 500}, {336, 722},
+    {337, 500}, {338, 944}, {339, 722}, {340, 667}, {341, 389}, {342, 667}, {343, 389}, {344, 667}, {345, 389}, {346, 556},
+    {347, 389}, {350, 556}, {351, 389}, {352, 556}, {353, 389}, {354, 611}, {355, 278}, {356, 611}, {357, 366}, {362, 722},
+    {363, 556}, {366, 722}, {367, 556}, {368, 722}, {369, 556}, {370, 722}, {371, 556}, {376, 611}, {377, 611}, {378, 389},
+    {379, 611}, {380, 389}, {381, 611}, {382, 389}, {402, 500}, {536, 556}, {537, 389}, {710, 333}, {711, 333}, {728, 333},
+    {729, 333}, {730, 333}, {731, 333}, {732, 333}, {733, 333}, {8211, 500}, {8212, 1000}, {8216, 333}, {8217, 333}, {8218, 333},
+    {8220, 500}, {8221, 500}, {8222, 500}, {8224, 500}, {8225, 500}, {8226, 350}, {8230, 1000}, {8240, 1000}, {8249, 333}, {8250, 333},
+    {8260, 167}, {8482, 1000}, {8706, 494}, {8710, 612}, {8721, 600}, {8722, 606}, {8730, 549}, {8800, 549}, {8804, 549}, {8805, 549},
+    {9674, 494}, {63171, 250}, {64257, 556}, {64258, 556}};
+
+constexpr std::pair<unsigned int, float> times_italic_widths[] = {
+    {32, 250}, {33, 333}, {34, 420}, {35, 500}, {36, 500}, {37, 833}, {38, 778}, {39, 214}, {40, 333}, {41, 333},
+    {42, 500}, {43, 675}, {44, 250}, {45, 333}, {46, 250}, {47, 278}, {48, 500}, {49, 500}, {50, 500}, {51, 500},
+    {52, 500}, {53, 500}, {54, 500}, {55, 500}, {56, 500}, {57, 500}, {58, 333}, {59, 333}, {60, 675}, {61, 675},
+    {62, 675}, {63, 500}, {64, 920}, {65, 611}, {66, 611}, {67, 667}, {68, 722}, {69, 611}, {70, 611}, {71, 722},
+    {72, 722}, {73, 333}, {74, 444}, {75, 667}, {76, 556}, {77, 833}, {78, 667}, {79, 722}, {80, 611}, {81, 722},
+    {82, 611}, {83, 500}, {84, 556}, {85, 722}, {86, 611}, {87, 833}, {88, 611}, {89, 556}, {90, 556}, {91, 389},
+    {92, 278}, {93, 389}, {94, 422}, {95, 500}, {96, 333}, {97, 500}, {98, 500}, {99, 444}, {100, 500}, {101, 444},
+    {102, 278}, {103, 500}, {104, 500}, {105, 278}, {106, 278}, {107, 444}, {108, 278}, {109, 722}, {110, 500}, {111, 500},
+    {112, 500}, {113, 500}, {114, 389}, {115, 389}, {116, 278}, {117, 500}, {118, 444}, {119, 667}, {120, 444}, {121, 444},
+    {122, 389}, {123, 400}, {124, 275}, {125, 400}, {126, 541}, {161, 389}, {162, 500}, {163, 500}, {164, 500}, {165, 500},
+    {166, 275}, {167, 500}, {168, 333}, {169, 760}, {170, 276}, {171, 500}, {172, 675}, {174, 760}, {175, 333}, {176, 400},
+    {177, 675}, {178, 300}, {179, 300}, {180, 333}, {181, 500}, {182, 523}, {183, 250}, {184, 333}, {185, 300}, {186, 310},
+    {187, 500}, {188, 750}, {189, 750}, {190, 750}, {191, 500}, {192, 611}, {193, 611}, {194, 611}, {195, 611}, {196, 611},
+    {197, 611}, {198, 889}, {199, 667}, {200, 611}, {201, 611}, {202, 611}, {203, 611}, {204, 333}, {205, 333}, {206, 333},
+    {207, 333}, {208, 722}, {209, 667}, {210, 722}, {211, 722}, {212, 722}, {213, 722}, {214, 722}, {215, 675}, {216, 722},
+    {217, 722}, {218, 722}, {219, 722}, {220, 722}, {221, 556}, {222, 611}, {223, 500}, {224, 500}, {225, 500}, {226, 500},
+    {227, 500}, {228, 500}, {229, 500}, {230, 667}, {231, 444}, {232, 444}, {233, 444}, {234, 444}, {235, 444}, {236, 278},
+    {237, 278}, {238, 278}, {239, 278}, {240, 500}, {241, 500}, {242, 500}, {243, 500}, {244, 500}, {245, 500}, {246, 500},
+    {247, 675}, {248, 500}, {249, 500}, {250, 500}, {251, 500}, {252, 500}, {253, 444}, {254, 500}, {255, 444}, {256, 611},
+    {257, 500}, {258, 611}, {259, 500}, {260, 611}, {261, 500}, {262, 667}, {263, 444}, {268, 667}, {269, 444}, {270, 722},
+    {271, 544}, {272, 722}, {273, 500}, {274, 611}, {275, 444}, {278, 611}, {279, 444}, {280, 611}, {281, 444}, {282, 611},
+    {283, 444}, {286, 722}, {287, 500}, {290, 722}, {291, 500}, {298, 333}, {299, 278}, {302, 333}, {303, 278}, {304, 333},
+    {305, 278}, {310, 667}, {311, 444}, {313, 556}, {314, 278}, {315, 556}, {316, 278}, {317, 611}, {318, 300}, {321, 556},
+    {322, 278}, {323, 667}, {324, 500}, {325, 667}, {326, 500}, {327, 667}, {328, 500}, {332, 722}, {333, 500}, {336, 722},
+    {337, 500}, {338, 944}, {339, 667}, {340, 611}, {341, 389}, {342, 611}, {343, 389}, {344, 611}, {345, 389}, {346, 500},
+    {347, 389}, {350, 500}, {351, 389}, {352, 500}, {353, 389}, {354, 556}, {355, 278}, {356, 556}, {357, 300}, {362, 722},
+    {363, 500}, {366, 722}, {367, 500}, {368, 722}, {369, 500}, {370, 722}, {371, 500}, {376, 556}, {377, 556}, {378, 389},
+    {379, 556}, {380, 389}, {381, 556}, {382, 389}, {402, 500}, {536, 500}, {537, 389}, {710, 333}, {711, 333}, {728, 333},
+    {729, 333}, {730, 333}, {731, 333}, {732, 333}, {733, 333}, {8211, 500}, {8212, 889}, {8216, 333}, {8217, 333}, {8218, 333},
+    {8220, 556}, {8221, 556}, {8222, 556}, {8224, 500}, {8225, 500}, {8226, 350}, {8230, 889}, {8240, 1000}, {8249, 333}, {8250, 333},
+    {8260, 167}, {8482, 980}, {8706, 476}, {8710, 612}, {8721, 600}, {8722, 675}, {8730, 453}, {8800, 549}, {8804, 549}, {8805, 549},
+    {9674, 471}, {63171, 250}, {64257, 500}, {64258, 500}};
+
+constexpr std::pair<unsigned int, float> times_roman_widths[] = {
+    {32, 250}, {33, 333}, {34, 408}, {35, 500}, {36, 500}, {37, 833}, {38, 778}, {39, 180}, {40, 333}, {41, 333},
+    {42, 500}, {43, 564}, {44, 250}, {45, 333}, {46, 250}, {47, 278}, {48, 500}, {49, 500}, {50, 500}, {51, 500},
+    {52, 500}, {53, 500}, {54, 500}, {55, 500}, {56, 500}, {57, 500}, {58, 278}, {59, 278}, {60, 564}, {61, 564},
+    {62, 564}, {63, 444}, {64, 921}, {65, 722}, {66, 667}, {67, 667}, {68, 722}, {69, 611}, {70, 556}, {71, 722},
+    {72, 722}, {73, 333}, {74, 389}, {75, 722}, {76, 611}, {77, 889}, {78, 722}, {79, 722}, {80, 556}, {81, 722},
+    {82, 667}, {83, 556}, {84, 611}, {85, 722}, {86, 722}, {87, 944}, {88, 722}, {89, 722}, {90, 611}, {91, 333},
+    {92, 278}, {93, 333}, {94, 469}, {95, 500}, {96, 333}, {97, 444}, {98, 500}, {99, 444}, {100, 500}, {101, 444},
+    {102, 333}, {103, 500}, {104, 500}, {105, 278}, {106, 278}, {107, 500}, {108, 278}, {109, 778}, {110, 500}, {111, 500},
+    {112, 500}, {113, 500}, {114, 333}, {115, 389}, {116, 278}, {117, 500}, {118, 500}, {119, 722}, {120, 500}, {121, 500},
+    {122, 444}, {123, 480}, {124, 200}, {125, 480}, {126, 541}, {161, 333}, {162, 500}, {163, 500}, {164, 500}, {165, 500},
+    {166, 200}, {167, 500}, {168, 333}, {169, 760}, {170, 276}, {171, 500}, {172, 564}, {174, 760}, {175, 333}, {176, 400},
+    {177, 564}, {178, 300}, {179, 300}, {180, 333}, {181, 500}, {182, 453}, {183, 250}, {184, 333}, {185, 300}, {186, 310},
+    {187, 500}, {188, 750}, {189, 750}, {190, 750}, {191, 444}, {192, 722}, {193, 722}, {194, 722}, {195, 722}, {196, 722},
+    {197, 722}, {198, 889}, {199, 667}, {200, 611}, {201, 611}, {202, 611}, {203, 611}, {204, 333}, {205, 333}, {206, 333},
+    {207, 333}, {208, 722}, {209, 722}, {210, 722}, {211, 722}, {212, 722}, {213, 722}, {214, 722}, {215, 564}, {216, 722},
+    {217, 722}, {218, 722}, {219, 722}, {220, 722}, {221, 722}, {222, 556}, {223, 500}, {224, 444}, {225, 444}, {226, 444},
+    {227, 444}, {228, 444}, {229, 444}, {230, 667}, {231, 444}, {232, 444}, {233, 444}, {234, 444}, {235, 444}, {236, 278},
+    {237, 278}, {238, 278}, {239, 278}, {240, 500}, {241, 500}, {242, 500}, {243, 500}, {244, 500}, {245, 500}, {246, 500},
+    {247, 564}, {248, 500}, {249, 500}, {250, 500}, {251, 500}, {252, 500}, {253, 500}, {254, 500}, {255, 500}, {256, 722},
+    {257, 444}, {258, 722}, {259, 444}, {260, 722}, {261, 444}, {262, 667}, {263, 444}, {268, 667}, {269, 444}, {270, 722},
+    {271, 588}, {272, 722}, {273, 500}, {274, 611}, {275, 444}, {278, 611}, {279, 444}, {280, 611}, {281, 444}, {282, 611},
+    {283, 444}, {286, 722}, {287, 500}, {290, 722}, {291, 500}, {298, 333}, {299, 278}, {302, 333}, {303, 278}, {304, 333},
+    {305, 278}, {310, 722}, {311, 500}, {313, 611}, {314, 278}, {315, 611}, {316, 278}, {317, 611}, {318, 344}, {321, 611},
+    {322, 278}, {323, 722}, {324, 500}, {325, 722}, {326, 500}, {327, 722}, {328, 500}, {332, 722}, {333, 500}, {336, 722},
+    {337, 500}, {338, 889}, {339, 722}, {340, 667}, {341, 333}, {342, 667}, {343, 333}, {344, 667}, {345, 333}, {346, 556},
+    {347, 389}, {350, 556}, {351, 389}, {352, 556}, {353, 389}, {354, 611}, {355, 278}, {356, 611}, {357, 326}, {362, 722},
+    {363, 500}, {366, 722}, {367, 500}, {368, 722}, {369, 500}, {370, 722}, {371, 500}, {376, 722}, {377, 611}, {378, 444},
+    {379, 611}, {380, 444}, {381, 611}, {382, 444}, {402, 500}, {536, 556}, {537, 389}, {710, 333}, {711, 333}, {728, 333},
+    {729, 333}, {730, 333}, {731, 333}, {732, 333}, {733, 333}, {8211, 500}, {8212, 1000}, {8216, 333}, {8217, 333}, {8218, 333},
+    {8220, 444}, {8221, 444}, {8222, 444}, {8224, 500}, {8225, 500}, {8226, 350}, {8230, 1000}, {8240, 1000}, {8249, 333}, {8250, 333},
+    {8260, 167}, {8482, 980}, {8706, 476}, {8710, 612}, {8721, 600}, {8722, 564}, {8730, 453}, {8800, 549}, {8804, 549}, {8805, 549},
+    {9674, 471}, {63171, 250}, {64257, 556}, {64258, 556}};
+
+constexpr std::pair<unsigned int, float> zapfdingbats_widths[] = {
+    {1, 974}, {2, 961}, {3, 980}, {4, 719}, {5, 789}, {6, 494}, {7, 552}, {8, 537}, {9, 577}, {10, 692},
+    {11, 960}, {12, 939}, {13, 549}, {14, 855}, {15, 911}, {16, 933}, {17, 945}, {18, 974}, {19, 755}, {20, 846},
+    {21, 762}, {22, 761}, {23, 571}, {24, 677}, {25, 763}, {26, 760}, {27, 759}, {28, 754}, {29, 786}, {30, 788},
+    {31, 788}, {32, 790}, {33, 793}, {34, 794}, {35, 816}, {36, 823}, {37, 789}, {38, 841}, {39, 823}, {40, 833},
+    {41, 816}, {42, 831}, {43, 923}, {44, 744}, {45, 723}, {46, 749}, {47, 790}, {48, 792}, {49, 695}, {50, 776},
+    {51, 768}, {52, 792}, {53, 759}, {54, 707}, {55, 708}, {56, 682}, {57, 701}, {58, 826}, {59, 815}, {60, 789},
+    {61, 789}, {62, 707}, {63, 687}, {64, 696}, {65, 689}, {66, 786}, {67, 787}, {68, 713}, {69, 791}, {70, 785},
+    {71, 791}, {72, 873}, {73, 761}, {74, 762}, {75, 759}, {76, 892}, {77, 892}, {78, 788}, {79, 784}, {81, 438},
+    {82, 138}, {83, 277}, {84, 415}, {85, 509}, {86, 410}, {87, 234}, {88, 234}, {89, 390}, {90, 390}, {91, 276},
+    {92, 276}, {93, 317}, {94, 317}, {95, 334}, {96, 334}, {97, 392}, {98, 392}, {99, 668}, {100, 668}, {101, 732},
+    {102, 544}, {103, 544}, {104, 910}, {105, 911}, {106, 667}, {107, 760}, {108, 760}, {109, 626}, {110, 694}, {111, 595},
+    {112, 776}, {117, 690}, {118, 791}, {119, 790}, {120, 788}, {121, 788}, {122, 788}, {123, 788}, {124, 788}, {125, 788},
+    {126, 788}, {127, 788}, {128, 788}, {129, 788}, {130, 788}, {131, 788}, {132, 788}, {133, 788}, {134, 788}, {135, 788},
+    {136, 788}, {137, 788}, {138, 788}, {139, 788}, {140, 788}, {141, 788}, {142, 788}, {143, 788}, {144, 788}, {145, 788},
+    {146, 788}, {147, 788}, {148, 788}, {149, 788}, {150, 788}, {151, 788}, {152, 788}, {153, 788}, {154, 788}, {155, 788},
+    {156, 788}, {157, 788}, {158, 788}, {159, 788}, {160, 894}, {161, 838}, {162, 924}, {163, 1016}, {164, 458}, {165, 924},
+    {166, 918}, {167, 927}, {168, 928}, {169, 928}, {170, 834}, {171, 873}, {172, 828}, {173, 924}, {174, 917}, {175, 930},
+    {176, 931}, {177, 463}, {178, 883}, {179, 836}, {180, 867}, {181, 696}, {182, 874}, {183, 760}, {184, 946}, {185, 865},
+    {186, 967}, {187, 831}, {188, 873}, {189, 927}, {190, 970}, {191, 918}, {192, 748}, {193, 836}, {194, 771}, {195, 888},
+    {196, 748}, {197, 771}, {198, 888}, {199, 867}, {200, 696}, {201, 874}, {202, 974}, {203, 762}, {204, 759}, {205, 509},
+    {206, 410}};
+
+//sorted by font name
+constexpr standard_widths_t standard_widths[] = {
+    {"/Courier", courier_widths, 314},
+    {"/Courier-Bold", courier_bold_widths, 314},
+    {"/Courier-BoldOblique", courier_boldoblique_widths, 314},
+    {"/Courier-Oblique", courier_oblique_widths, 314},
+    {"/Helvetica", helvetica_widths, 314},
+    {"/Helvetica-Bold", helvetica_bold_widths, 314},
+    {"/Helvetica-BoldOblique", helvetica_boldoblique_widths, 314},
+    {"/Helvetica-Oblique", helvetica_oblique_widths, 314},
+    {"/Symbol", symbol_widths, 190},
+    {"/Times-Bold", times_bold_widths, 314},
+    {"/Times-BoldItalic", times_bolditalic_widths, 314},
+    {"/Times-Italic", times_italic_widths, 314},
+    {"/Times-Roman", times_roman_widths, 314},
+    {"/ZapfDingbats", zapfdingbats_widths, 201}
+};
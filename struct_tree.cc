@@ -0,0 +1,98 @@
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include <unordered_set>
+#include <exception>
+
+#include "common.h"
+#include "object_storage.h"
+#include "struct_tree.h"
+
+using namespace std;
+
+namespace
+{
+    //document is tagged if it has structure tree and /MarkInfo << /Marked true >>
+    bool is_tagged(const dict_t &root_data, const ObjectStorage &storage)
+    {
+        auto it = root_data.find("/MarkInfo");
+        if (it == root_data.end() || !root_data.count("/StructTreeRoot")) return false;
+        const dict_t mark_info = get_dict_or_indirect_dict(it->second, storage);
+        it = mark_info.find("/Marked");
+        return it != mark_info.end() && it->second.first == "true";
+    }
+
+    unsigned int get_page(const dict_t &dict, unsigned int parent_page)
+    {
+        auto it = dict.find("/Pg");
+        if (it == dict.end() || it->second.second != INDIRECT_OBJECT) return parent_page;
+        return get_id_gen(it->second.first).first;
+    }
+}
+
+unordered_map<unsigned int, vector<unsigned int>> get_structure_order(const dict_t &root_data,
+                                                                      const ObjectStorage &storage)
+{
+    unordered_map<unsigned int, vector<unsigned int>> result;
+    try
+    {
+        if (!is_tagged(root_data, storage)) return result;
+        //kids of structure elements with their pages, the next kid is on top. Elements are visited depth first,
+        //every object once
+        vector<pair<pair<string, pdf_object_t>, unsigned int>> st{make_pair(root_data.at("/StructTreeRoot"), 0)};
+        unordered_set<unsigned int> visited;
+        while (!st.empty())
+        {
+            const pair<string, pdf_object_t> kid = std::move(st.back().first);
+            const unsigned int page = st.back().second;
+            st.pop_back();
+            switch (kid.second)
+            {
+            case VALUE:
+                //marked content of page
+                if (page != 0) result[page].push_back(strict_stoul(kid.first));
+                break;
+            case INDIRECT_OBJECT:
+            {
+                const unsigned int id = get_id_gen(kid.first).first;
+                if (visited.count(id) || !storage.is_object_exists(id)) break;
+                visited.insert(id);
+                st.emplace_back(storage.get_object(id), page);
+                break;
+            }
+            case ARRAY:
+            {
+                const array_t kids = get_array_data(kid.first, 0);
+                for (auto it = kids.rbegin(); it != kids.rend(); ++it) st.emplace_back(*it, page);
+                break;
+            }
+            case DICTIONARY:
+            {
+                const dict_t dict = get_dictionary_data(kid.first, 0);
+                auto it = dict.find("/Type");
+                //annotations and other objects have no text of page content
+                if (it != dict.end() && it->second.first == "/OBJR") break;
+                if (it != dict.end() && it->second.first == "/MCR")
+                {
+                    //marked content of xobject streams is not ordered
+                    if (dict.count("/Stm")) break;
+                    it = dict.find("/MCID");
+                    if (it != dict.end()) st.emplace_back(it->second, get_page(dict, page));
+                    break;
+                }
+                it = dict.find("/K");
+                if (it != dict.end()) st.emplace_back(it->second, get_page(dict, page));
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        //text of document with broken structure tree is laid out by geometry
+        result.clear();
+    }
+    return result;
+}
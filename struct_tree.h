@@ -0,0 +1,15 @@
+#ifndef STRUCT_TREE_H
+#define STRUCT_TREE_H
+
+#include <vector>
+#include <unordered_map>
+
+#include "common.h"
+#include "object_storage.h"
+
+//14.7 Logical Structure. MCIDs of marked content of every page in order of structure tree, page id is the key.
+//Empty if document is not tagged
+std::unordered_map<unsigned int, std::vector<unsigned int>> get_structure_order(const dict_t &root_data,
+                                                                               const ObjectStorage &storage);
+
+#endif //STRUCT_TREE_H
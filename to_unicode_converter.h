@@ -2,9 +2,6 @@
 #define TO_UNICODE_CONVERTER
 
 #include <string>
-#include <utility>
-
-#include <boost/optional.hpp>
 
 #include "fonts.h"
 #include "cmap.h"
@@ -12,13 +9,13 @@
 class ToUnicodeConverter
 {
 public:
-    explicit ToUnicodeConverter(cmap_t &custom_encoding_arg);
+    explicit ToUnicodeConverter(const cmap_t &custom_encoding_arg);
     ToUnicodeConverter() noexcept;
     bool is_empty() const;
     bool is_vertical() const;
-    std::pair<std::string, float> custom_decode_symbol(const std::string &s, size_t &i, const Fonts &fonts) const;
+    const cmap_t& get_cmap() const;
 private:
-    boost::optional<cmap_t&> custom_encoding;
+    const cmap_t *custom_encoding;
     bool empty;
 };
 
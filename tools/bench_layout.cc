@@ -0,0 +1,98 @@
+//measures time of text extraction with every layout tier and engine to choose them for workload.
+//Build and run: g++ -O2 tools/bench_layout.cc -I. -L<build dir> -lpdf_extractor -o bench_layout &&
+//./bench_layout [-n repeats] [-t threads] file.pdf...
+//For every tier and engine prints total time of the best of repeats over all files and size of extracted text.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <exception>
+#include <algorithm>
+
+#include "pdf_extractor.h"
+
+using namespace std;
+
+namespace
+{
+    struct tier_t
+    {
+        pdf_extractor_layout_t layout;
+        pdf_extractor_engine_t engine;
+        const char *name;
+    };
+
+    const tier_t tiers[] = {{PDF_EXTRACTOR_LAYOUT_RAW, PDF_EXTRACTOR_ENGINE_AUTO, "raw"},
+                            {PDF_EXTRACTOR_LAYOUT_LINES, PDF_EXTRACTOR_ENGINE_AUTO, "lines"},
+                            {PDF_EXTRACTOR_LAYOUT_FULL, PDF_EXTRACTOR_ENGINE_AUTO, "full"},
+                            {PDF_EXTRACTOR_LAYOUT_FULL, PDF_EXTRACTOR_ENGINE_GROUPS, "full/groups"},
+                            {PDF_EXTRACTOR_LAYOUT_FULL, PDF_EXTRACTOR_ENGINE_XY_CUT, "full/xy-cut"}};
+
+    string read_file(const char *path)
+    {
+        ifstream in(path, ios::binary);
+        stringstream result;
+        result << in.rdbuf();
+        return result.str();
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int repeats = 3;
+    int threads = 1;
+    int first = 1;
+    for (; first + 1 < argc; first += 2)
+    {
+        if (strcmp(argv[first], "-n") == 0) repeats = max(atoi(argv[first + 1]), 1);
+        else if (strcmp(argv[first], "-t") == 0) threads = max(atoi(argv[first + 1]), 1);
+        else break;
+    }
+    if (first >= argc)
+    {
+        fprintf(stderr, "usage: %s [-n repeats] [-t threads] file.pdf...\n", argv[0]);
+        return 1;
+    }
+    vector<string> docs;
+    for (int i = first; i < argc; ++i) docs.push_back(read_file(argv[i]));
+
+    pdf_extractor_init();
+    for (const tier_t &tier : tiers)
+    {
+        pdf_extractor_options_t options;
+        options.layout = tier.layout;
+        options.engine = tier.engine;
+        options.threads = threads;
+        double total = 0;
+        size_t bytes = 0;
+        size_t errors = 0;
+        for (const string &doc : docs)
+        {
+            double best = 0;
+            for (int i = 0; i < repeats; ++i)
+            {
+                const auto start = chrono::steady_clock::now();
+                try
+                {
+                    const string text = pdf2txt(doc, options);
+                    if (i == 0) bytes += text.length();
+                }
+                catch (const exception &e)
+                {
+                    if (i == 0) ++errors;
+                }
+                const double elapsed = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                if (i == 0 || elapsed < best) best = elapsed;
+            }
+            total += best;
+        }
+        printf("%-12s %10.2f ms %12zu bytes %zu errors\n", tier.name, total, bytes, errors);
+    }
+    pdf_extractor_deinit();
+    return 0;
+}
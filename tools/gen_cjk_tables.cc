@@ -0,0 +1,160 @@
+//generates cjk_tables.h: decoding tries of multi-byte CJK charsets used by predefined CMaps (encoding2charset).
+//Tables are taken from iconv, which was used for these charsets at runtime before, so output stays the same.
+//Build and run: g++ -O2 tools/gen_cjk_tables.cc -o gen_cjk_tables && ./gen_cjk_tables > cjk_tables.h
+//
+//Every node covers bytes first..last of one code position. Entry is a BMP code point, NO_CODE for invalid byte,
+//CHILD + n if byte is a lead byte of longer code continued in node n, or SKIP + n if iconv consumes invalid code
+//before reporting it and n bytes are to be skipped. Surrogates never appear in these charsets, so CHILD and SKIP
+//ranges don't clash with code points.
+
+#include <iconv.h>
+#include <errno.h>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+
+using namespace std;
+
+namespace
+{
+    enum : uint16_t { NO_CODE = 0xFFFF, CHILD = 0xD800, MAX_CHILDREN = 0x400, SKIP = 0xDC00 };
+    enum { MAX_CODE_LENGTH = 3 };
+
+    struct node_t
+    {
+        unsigned int first;
+        unsigned int last;
+        size_t offset;
+    };
+
+    //charset name in encoding2charset -> iconv charset name
+    const pair<const char*, const char*> charsets[] = {{"GBK", "GBK"},
+                                                       {"EUC-CN", "EUC-CN"},
+                                                       {"Big5", "BIG5"},
+                                                       {"Big-5", "BIG5"},
+                                                       {"Shift-JIS", "SHIFT_JIS"},
+                                                       {"EUC-JP", "EUC-JP"},
+                                                       {"UHC", "UHC"},
+                                                       {"EUC-KR", "EUC-KR"}};
+
+    vector<node_t> nodes;
+    vector<uint16_t> codes;
+
+    enum result_t { VALID, INCOMPLETE, INVALID };
+
+    result_t convert(iconv_t cd, const string &s, uint32_t &code_point, size_t &consumed)
+    {
+        iconv(cd, nullptr, nullptr, nullptr, nullptr);
+        char *in = const_cast<char*>(s.data());
+        size_t in_left = s.length();
+        unsigned char out_buf[16];
+        char *out = reinterpret_cast<char*>(out_buf);
+        size_t out_left = sizeof(out_buf);
+        size_t result = iconv(cd, &in, &in_left, &out, &out_left);
+        consumed = s.length() - in_left;
+        if (result == static_cast<size_t>(-1))
+        {
+            return (errno == EINVAL)? INCOMPLETE : INVALID;
+        }
+        if (sizeof(out_buf) - out_left != sizeof(uint32_t)) return INVALID;
+        code_point = (out_buf[0] << 24) | (out_buf[1] << 16) | (out_buf[2] << 8) | out_buf[3];
+        if (code_point > 0xFFFF || (code_point >= CHILD && code_point <= 0xDFFF))
+        {
+            fprintf(stderr, "unsupported code point %X\n", code_point);
+            exit(1);
+        }
+        return VALID;
+    }
+
+    //returns node index or -1 if prefix has no valid continuation
+    int make_node(iconv_t cd, const string &prefix)
+    {
+        vector<uint16_t> entries(256, NO_CODE);
+        for (unsigned int b = 0; b < 256; ++b)
+        {
+            const string s = prefix + static_cast<char>(b);
+            uint32_t code_point;
+            size_t consumed;
+            switch (convert(cd, s, code_point, consumed))
+            {
+            case VALID:
+                entries[b] = code_point;
+                break;
+            case INCOMPLETE:
+            {
+                if (s.length() >= MAX_CODE_LENGTH) break;
+                int child = make_node(cd, s);
+                if (child < 0) break;
+                if (child >= MAX_CHILDREN)
+                {
+                    fprintf(stderr, "too many nodes\n");
+                    exit(1);
+                }
+                entries[b] = CHILD + child;
+                break;
+            }
+            case INVALID:
+                //invalid code is skipped by one byte after the consumed part
+                if (consumed > 0) entries[b] = SKIP + consumed + 1;
+                break;
+            }
+        }
+        unsigned int first = 0;
+        while (first < 256 && entries[first] == NO_CODE) ++first;
+        if (first == 256) return -1;
+        unsigned int last = 255;
+        while (entries[last] == NO_CODE) --last;
+        nodes.push_back(node_t{first, last, codes.size()});
+        codes.insert(codes.end(), entries.begin() + first, entries.begin() + last + 1);
+        return nodes.size() - 1;
+    }
+}
+
+int main()
+{
+    map<string, int> roots;
+    vector<pair<const char*, int>> names;
+    for (const pair<const char*, const char*> &charset : charsets)
+    {
+        auto it = roots.find(charset.second);
+        if (it == roots.end())
+        {
+            iconv_t cd = iconv_open("UTF-32BE", charset.second);
+            if (cd == reinterpret_cast<iconv_t>(-1))
+            {
+                fprintf(stderr, "can't open %s\n", charset.second);
+                return 1;
+            }
+            it = roots.emplace(charset.second, make_node(cd, string())).first;
+            iconv_close(cd);
+        }
+        names.emplace_back(charset.first, it->second);
+    }
+
+    printf("//generated by tools/gen_cjk_tables.cc\n");
+    printf("constexpr cjk_node_t cjk_nodes[] = {\n");
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        printf("    {0x%02X, 0x%02X, %zu}%s\n", nodes[i].first, nodes[i].last, nodes[i].offset, (i + 1 < nodes.size())? "," : "");
+    }
+    printf("};\n\n");
+    printf("constexpr uint16_t cjk_codes[] = {\n");
+    for (size_t i = 0; i < codes.size(); i += 12)
+    {
+        printf("   ");
+        for (size_t j = i; j < i + 12 && j < codes.size(); ++j) printf(" 0x%04X%s", codes[j], (j + 1 < codes.size())? "," : "");
+        printf("\n");
+    }
+    printf("};\n\n");
+    printf("constexpr std::pair<const char*, unsigned int> cjk_charsets[] = {\n");
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        printf("    {\"%s\", %d}%s\n", names[i].first, names[i].second, (i + 1 < names.size())? "," : "");
+    }
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,842 @@
+#!/usr/bin/perl
+#generates encoding_tables.h: standard simple font encodings (9.6.6, Annex D) as flat 256-entry tables
+#of {offset, length} into one blob of utf8 symbols
+
+use strict;
+
+my %tables;
+my @order;
+my $encoding;
+while (my $line = <DATA>)
+{
+    chomp $line;
+    next if ($line eq '');
+    if ($line !~ /\t/)
+    {
+        $encoding = $line;
+        push @order, $encoding;
+        $tables{$encoding} = {};
+        next;
+    }
+    my ($code, $symbol) = split(/\t/, $line, 2);
+    $tables{$encoding}{$code} = $symbol;
+}
+
+my $blob = '';
+my %offsets;
+my @rows;
+for my $encoding (@order)
+{
+    my @row;
+    for my $code (0..255)
+    {
+        if (!exists $tables{$encoding}{$code})
+        {
+            push @row, "{0, symbol_t::NO_SYMBOL}";
+            next;
+        }
+        my $symbol = $tables{$encoding}{$code};
+        if (!exists $offsets{$symbol})
+        {
+            $offsets{$symbol} = length($blob);
+            $blob .= $symbol;
+        }
+        push @row, "{$offsets{$symbol}, " . length($symbol) . "}";
+    }
+    push @rows, \@row;
+}
+die "blob is too large" if (length($blob) > 65535);
+
+print "//generated by gen_encoding_tables.pl\n";
+print "constexpr char standard_symbols[] =\n    \"";
+my $column = 0;
+for my $c (split(//, $blob))
+{
+    my $n = ord($c);
+    if ($n >= 0x20 && $n < 0x7F && $c ne '"' && $c ne '\\' && $c ne '?') { print $c; }
+    else { printf("\\%03o", $n); }
+    if (++$column % 32 == 0) { print "\"\n    \""; }
+}
+print "\";\n\n";
+print "constexpr std::array<encoding_table_t, STANDARD_ENCODINGS_NUM> standard_encodings = {{\n";
+for my $i (0..$#order)
+{
+    print "    //$order[$i]\n    {{";
+    for my $code (0..255)
+    {
+        print "\n      " if ($code % 8 == 0);
+        print $rows[$i][$code];
+        print ", " if ($code != 255);
+    }
+    print "}}";
+    print "," if ($i != $#order);
+    print "\n";
+}
+print "}};\n";
+
+__DATA__
+DEFAULT
+32	 
+33	!
+34	"
+35	#
+36	$
+37	%
+38	%
+39	’
+40	(
+41	)
+42	*
+43	+
+44	,
+45	-
+46	.
+47	/
+48	0
+49	1
+50	2
+51	3
+52	4
+53	5
+54	6
+55	7
+56	8
+57	9
+58	:
+59	;
+60	<
+61	=
+62	>
+63	?
+64	@
+65	A
+66	B
+67	C
+68	D
+69	E
+70	F
+71	G
+72	H
+73	I
+74	J
+75	K
+76	L
+77	M
+78	N
+79	O
+80	P
+81	Q
+82	R
+83	S
+84	T
+85	U
+86	V
+87	W
+88	X
+89	Y
+90	Z
+91	[
+92	\
+93	]
+94	^
+95	_
+96	‘
+97	a
+98	b
+99	c
+100	d
+101	e
+102	f
+103	g
+104	h
+105	i
+106	j
+107	k
+108	l
+109	m
+110	n
+111	o
+112	p
+113	q
+114	r
+115	s
+116	t
+117	u
+118	v
+119	w
+120	x
+121	y
+122	z
+123	{
+124	|
+125	}
+126	~
+161	¡
+162	¢
+163	£
+164	⁄
+165	¥
+166	ƒ
+167	§
+168	¤
+169	'
+170	“
+171	«
+172	‹
+173	›
+174	ﬁ
+175	ﬂ
+177	–
+178	†
+179	‡
+180	·
+182	¶
+183	•
+184	‚
+185	„
+186	”
+187	»
+188	…
+189	‰
+191	¿
+193	`
+194	´
+195	ˆ
+196	˜
+197	¯
+198	˘
+199	˙
+200	¨
+202	˚
+203	¸
+205	˝
+206	˛
+207	ˇ
+208	—
+225	Æ
+227	ª
+232	Ł
+233	Ø
+234	Œ
+235	º
+241	æ
+245	ı
+248	ł
+249	ø
+250	œ
+251	ß
+MAC_EXPERT
+32	 
+33	
+34	
+35	
+36	
+37	
+38	
+39	
+40	⁽
+41	⁾
+42	..
+43	.
+44	
+45	-
+46	.
+47	⁄
+48	0
+49	1
+50	2
+51	3
+52	4
+53	5
+54	6
+55	7
+56	8
+57	9
+58	:
+59	;
+61	
+63	
+68	
+71	¼
+72	½
+73	¾
+74	⅛
+75	⅜
+76	⅝
+77	⅞
+78	⅓
+79	⅔
+86	ff
+87	fi
+88	fl
+89	ffi
+90	ffl
+91	₍
+93	₎
+94	
+95	
+96	
+97	A
+98	B
+99	C
+100	D
+101	E
+102	F
+103	G
+104	H
+105	I
+106	J
+107	K
+108	L
+109	M
+110	N
+111	O
+112	P
+113	Q
+114	R
+115	S
+116	T
+117	U
+118	V
+119	W
+120	X
+121	Y
+122	Z
+123	₡
+124	
+125	
+126	
+129	
+130	
+135	
+136	
+137	
+138	
+139	
+140	
+141	
+142	
+143	
+144	
+145	
+146	
+147	
+148	
+149	
+150	
+151	
+152	
+153	
+154	
+155	
+156	
+157	
+158	
+159	
+161	⁸
+162	₄
+163	₃
+164	₆
+165	₈
+166	⁷
+167	
+169	
+170	₃
+172	
+174	
+175	
+176	₅
+178	
+179	
+180	
+182	
+185	
+187	₉
+188	₀
+189	
+190	
+191	
+192	
+193	₁
+194	
+201	
+207	
+208	‒
+209	
+214	
+216	
+218	1
+219	2
+220	3
+221	4
+222	5
+223	6
+224	7
+225	8
+226	0
+228	
+229	
+230	
+233	
+234	
+235	
+241	
+242	
+243	
+244	
+245	
+246	ⁿ
+247	
+248	
+249	
+250	
+251	
+MAC_ROMAN
+32	 
+33	!
+34	"
+35	#
+36	$
+37	%
+38	&
+39	'
+40	(
+41	)
+42	*
+43	+
+44	
+45	-
+46	.
+47	/
+48	0
+49	1
+50	2
+51	3
+52	4
+53	5
+54	6
+55	7
+56	8
+57	9
+58	:
+59	;
+60	<
+61	=
+62	>
+63	?
+64	@
+65	A
+66	B
+67	C
+68	D
+69	E
+70	F
+71	G
+72	H
+73	I
+74	J
+75	K
+76	L
+77	M
+78	N
+79	O
+80	P
+81	Q
+82	R
+83	S
+84	T
+85	U
+86	V
+87	W
+88	X
+89	Y
+90	Z
+91	[
+92	\
+93	]
+94	^
+95	_
+96	`
+97	a
+98	b
+99	c
+100	d
+101	e
+102	f
+103	g
+104	h
+105	i
+106	j
+107	k
+108	l
+109	m
+110	n
+111	o
+112	p
+113	q
+114	r
+115	s
+116	t
+117	u
+118	v
+119	w
+120	x
+121	y
+122	z
+123	{
+124	|
+125	}
+126	~
+128	Ä
+129	Å
+130	Ç
+131	É
+132	Ñ
+133	Ö
+134	Ü
+135	á
+136	à
+137	â
+138	ä
+139	ã
+140	å
+141	ç
+142	é
+143	è
+144	ê
+145	ë
+146	í
+147	ì
+148	î
+149	ï
+150	ñ
+151	ó
+152	ò
+153	ô
+154	ö
+155	õ
+156	ú
+157	ù
+158	û
+159	ü
+160	†
+161	°
+162	¢
+163	£
+164	§
+165	•
+166	¶
+167	ß
+168	®
+169	©
+170	™
+171	´
+172	¨
+173	≠
+174	Æ
+175	Ø
+176	∞
+177	±
+178	≤
+179	≥
+180	¥
+181	µ
+182	∂
+183	∑
+184	∏
+185	π
+186	∫
+187	ª
+188	º
+189	Ω
+190	æ
+191	ø
+192	¿
+193	¡
+194	¬
+195	√
+196	ƒ
+197	≈
+198	∆
+199	«
+200	»
+201	…
+202	 
+203	À
+204	Ã
+205	Õ
+206	Œ
+207	œ
+208	–
+209	—
+210	“
+211	”
+212	‘
+213	’
+214	÷
+215	◊
+216	ÿ
+217	Ÿ
+218	⁄
+219	€¹
+220	‹
+221	›
+222	ﬁ
+223	ﬂ
+224	‡
+225	·
+226	‚
+227	„
+228	‰
+229	Â
+230	Ê
+231	Á
+232	Ë
+233	È
+234	Í
+235	Î
+236	Ï
+237	Ì
+238	Ó
+239	Ô
+240	
+241	Ò
+242	Ú
+243	Û
+244	Ù
+245	ı
+246	ˆ
+247	˜
+248	¯
+249	˘
+250	˙
+251	˚
+252	¸
+253	˝
+254	˛
+255	ˇ
+WIN
+32	 
+33	!
+34	@
+35	#
+36	$
+37	%
+38	&
+39	'
+40	(
+41	)
+42	*
+43	+
+44	
+45	-
+46	.
+47	/
+48	0
+49	1
+50	2
+51	3
+52	4
+53	5
+54	6
+55	7
+56	8
+57	9
+58	:
+59	;
+60	<
+61	=
+62	>
+63	?
+64	@
+65	A
+66	B
+67	C
+68	D
+69	E
+70	F
+71	G
+72	H
+73	I
+74	J
+75	K
+76	L
+77	M
+78	N
+79	O
+80	P
+81	Q
+82	R
+83	S
+84	T
+85	U
+86	V
+87	W
+88	X
+89	Y
+90	Z
+91	[
+92	\
+93	]
+94	^
+95	_
+96	`
+97	a
+98	b
+99	c
+100	d
+101	e
+102	f
+103	g
+104	h
+105	i
+106	j
+107	k
+108	l
+109	m
+110	n
+111	o
+112	p
+113	q
+114	r
+115	s
+116	t
+117	u
+118	v
+119	w
+120	x
+121	y
+122	z
+123	{
+124	|
+125	}
+126	~
+127	•
+128	€
+129	•
+130	‚
+131	ƒ
+132	„
+133	…
+134	†
+135	‡
+136	ˆ
+137	‰
+138	Š
+139	‹
+140	Œ
+141	•
+142	Ž
+143	•
+144	•
+145	‘
+146	’
+147	“
+148	”
+149	•
+150	–
+151	—
+152	˜
+153	™
+154	š
+155	›
+156	œ
+157	•
+158	ž
+159	Ÿ
+160	 
+161	¡
+162	¢
+163	£
+164	¤
+165	¥
+166	¦
+167	§
+168	¨
+169	©
+170	ª
+171	«
+172	¬
+173	-
+174	®
+175	¯
+176	°
+177	±
+178	²
+179	³
+180	´
+181	µ
+182	¶
+183	·
+184	¸
+185	¹
+186	º
+187	»
+188	¼
+189	½
+190	¾
+191	¿
+192	À
+193	Á
+194	Â
+195	Ã
+196	Ä
+197	Å
+198	Æ
+199	Ç
+200	È
+201	É
+202	Ê
+203	Ë
+204	Ì
+205	Í
+206	Î
+207	Ï
+208	Ð
+209	Ñ
+210	Ò
+211	Ó
+212	Ô
+213	Õ
+214	Ö
+215	×
+216	Ø
+217	Ù
+218	Ú
+219	Û
+220	Ü
+221	Ý
+222	Þ
+223	ß
+224	à
+225	á
+226	â
+227	ã
+228	ä
+229	å
+230	æ
+231	ç
+232	è
+233	é
+234	ê
+235	ë
+236	ì
+237	í
+238	î
+239	ï
+240	ð
+241	ñ
+242	ò
+243	ó
+244	ô
+245	õ
+246	ö
+247	÷
+248	ø
+249	ù
+250	ú
+251	û
+252	ü
+253	ý
+254	þ
+255	ÿ
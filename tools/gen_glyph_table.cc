@@ -0,0 +1,132 @@
+//generates glyph_table.h: minimal perfect hash of glyph names (symbol_table.h) to utf8 symbols.
+//Names are split into buckets by glyph_name_hash with seed 0. For every bucket, largest first, a seed is chosen
+//which places all its names into free slots of GLYPHS_NUM slots (hash and displace).
+//Build and run: g++ -O2 tools/gen_glyph_table.cc -o gen_glyph_table && ./gen_glyph_table > glyph_table.h
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <set>
+#include <utility>
+#include <algorithm>
+
+#include "../glyph_names.h"
+
+using namespace std;
+
+namespace
+{
+    //first name wins like in unordered_map initialized from the list
+    const vector<pair<string, string>> symbol_table = {
+        #include "symbol_table.h"
+    };
+
+    enum : uint32_t { MAX_SEED = 0xFFFF };
+
+    void print_blob(const string &blob)
+    {
+        printf("constexpr char glyph_blob[] =\n    \"");
+        for (size_t i = 0; i < blob.length(); ++i)
+        {
+            unsigned char c = blob[i];
+            if (c >= 0x20 && c < 0x7F && c != '"' && c != '\\' && c != '?') putchar(c);
+            else printf("\\%03o", c);
+            if ((i + 1) % 32 == 0) printf("\"\n    \"");
+        }
+        printf("\";\n\n");
+    }
+}
+
+int main()
+{
+    vector<pair<string, string>> glyphs;
+    set<string> names;
+    for (const pair<string, string> &p : symbol_table)
+    {
+        if (names.insert(p.first).second) glyphs.push_back(p);
+    }
+    const uint32_t glyphs_num = glyphs.size();
+    const uint32_t buckets_num = (glyphs_num + 3) / 4;
+
+    vector<vector<uint32_t>> buckets(buckets_num);
+    for (uint32_t i = 0; i < glyphs_num; ++i)
+    {
+        const string &name = glyphs[i].first;
+        buckets[glyph_name_hash(name.data(), name.length(), 0) % buckets_num].push_back(i);
+    }
+    vector<uint32_t> order(buckets_num);
+    for (uint32_t i = 0; i < buckets_num; ++i) order[i] = i;
+    stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return buckets[a].size() > buckets[b].size(); });
+
+    vector<uint32_t> seeds(buckets_num, 0);
+    vector<int64_t> slots(glyphs_num, -1);
+    for (uint32_t b : order)
+    {
+        if (buckets[b].empty()) break;
+        uint32_t seed = 1;
+        for (; seed <= MAX_SEED; ++seed)
+        {
+            vector<uint32_t> taken;
+            for (uint32_t i : buckets[b])
+            {
+                const string &name = glyphs[i].first;
+                uint32_t slot = glyph_name_hash(name.data(), name.length(), seed) % glyphs_num;
+                if (slots[slot] >= 0 || find(taken.begin(), taken.end(), slot) != taken.end()) break;
+                taken.push_back(slot);
+            }
+            if (taken.size() != buckets[b].size()) continue;
+            for (size_t j = 0; j < taken.size(); ++j) slots[taken[j]] = buckets[b][j];
+            break;
+        }
+        if (seed > MAX_SEED)
+        {
+            fprintf(stderr, "can't place bucket %u\n", b);
+            return 1;
+        }
+        seeds[b] = seed;
+    }
+
+    string blob;
+    vector<pair<uint32_t, uint32_t>> offsets(glyphs_num);
+    for (uint32_t i = 0; i < glyphs_num; ++i)
+    {
+        const pair<string, string> &glyph = glyphs[slots[i]];
+        if (glyph.first.length() > 255 || glyph.second.length() > 255)
+        {
+            fprintf(stderr, "too long glyph %s\n", glyph.first.c_str());
+            return 1;
+        }
+        offsets[i].first = blob.length();
+        blob += glyph.first;
+        //symbol may be shared with earlier bytes of the blob
+        size_t pos = blob.find(glyph.second);
+        if (pos == string::npos)
+        {
+            pos = blob.length();
+            blob += glyph.second;
+        }
+        offsets[i].second = pos;
+    }
+
+    printf("//generated by tools/gen_glyph_table.cc\n");
+    printf("enum : uint32_t { GLYPHS_NUM = %u, GLYPH_BUCKETS = %u };\n\n", glyphs_num, buckets_num);
+    print_blob(blob);
+    printf("constexpr uint16_t glyph_seeds[GLYPH_BUCKETS] = {\n");
+    for (uint32_t i = 0; i < buckets_num; i += 12)
+    {
+        printf("   ");
+        for (uint32_t j = i; j < i + 12 && j < buckets_num; ++j) printf(" %u%s", seeds[j], (j + 1 < buckets_num)? "," : "");
+        printf("\n");
+    }
+    printf("};\n\n");
+    printf("constexpr glyph_t glyphs[GLYPHS_NUM] = {\n");
+    for (uint32_t i = 0; i < glyphs_num; ++i)
+    {
+        const pair<string, string> &glyph = glyphs[slots[i]];
+        printf("    {%u, %u, %zu, %zu}%s\n", offsets[i].first, offsets[i].second, glyph.first.length(),
+               glyph.second.length(), (i + 1 < glyphs_num)? "," : "");
+    }
+    printf("};\n");
+    return 0;
+}
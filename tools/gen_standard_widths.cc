@@ -0,0 +1,55 @@
+//generates standard_widths.h: glyph widths of standard 14 fonts as constexpr arrays and the table of fonts
+//sorted by name. Widths keep the order of tools/standard_widths.h, which get_width searches in.
+//Build and run: g++ -O2 tools/gen_standard_widths.cc -o gen_standard_widths && ./gen_standard_widths > standard_widths.h
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+using namespace std;
+
+namespace
+{
+    const vector<pair<string, vector<pair<unsigned int, float>>>> standard_widths =
+        #include "standard_widths.h"
+        ;
+
+    //"/Times-Roman" -> "times_roman_widths"
+    string get_array_name(const string &font)
+    {
+        string result;
+        for (char c : font.substr(1)) result.push_back((c == '-')? '_' : tolower(c));
+        return result + "_widths";
+    }
+}
+
+int main()
+{
+    vector<pair<string, vector<pair<unsigned int, float>>>> fonts = standard_widths;
+    sort(fonts.begin(), fonts.end(), [](const pair<string, vector<pair<unsigned int, float>>> &a,
+                                        const pair<string, vector<pair<unsigned int, float>>> &b)
+                                     { return a.first < b.first; });
+    printf("//generated by tools/gen_standard_widths.cc\n");
+    for (const pair<string, vector<pair<unsigned int, float>>> &font : fonts)
+    {
+        printf("constexpr std::pair<unsigned int, float> %s[] = {", get_array_name(font.first).c_str());
+        for (size_t i = 0; i < font.second.size(); ++i)
+        {
+            if (i % 10 == 0) printf("\n   ");
+            printf(" {%u, %.9g}%s", font.second[i].first, font.second[i].second, (i + 1 < font.second.size())? "," : "");
+        }
+        printf("};\n\n");
+    }
+    printf("//sorted by font name\n");
+    printf("constexpr standard_widths_t standard_widths[] = {\n");
+    for (size_t i = 0; i < fonts.size(); ++i)
+    {
+        const string name = get_array_name(fonts[i].first);
+        printf("    {\"%s\", %s, %zu}%s\n", fonts[i].first.c_str(), name.c_str(), fonts[i].second.size(),
+               (i + 1 < fonts.size())? "," : "");
+    }
+    printf("};\n");
+    return 0;
+}
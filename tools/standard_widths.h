@@ -0,0 +1,14 @@
+{{"/Courier",  {{'{', 600},{'!', 600},{'"', 600},{'#', 600},{'$', 600},{'%', 600},{'&', 600}, {'\'', 600},{'(', 600},{')', 600},{'*', 600},{'+', 600},{',', 600},{'-', 600},{'.', 600},{'/', 600},{'0', 600},{'1', 600},{'2', 600},{'3', 600},{'4', 600},{'5', 600},{'6', 600},{'7', 600},{'8', 600},{'9', 600},{':', 600},{';', 600},{'<', 600},{'=', 600},{'>', 600},{'?', 600},{'@', 600},{'A', 600},{'B', 600},{'C', 600},{'D', 600},{'E', 600},{'F', 600},{'G', 600},{'H', 600},{'I', 600},{'J', 600},{'K', 600},{'L', 600},{'M', 600},{'N', 600},{'O', 600},{'P', 600},{'Q', 600},{'R', 600},{'S', 600},{'T', 600},{'U', 600},{'V', 600},{'W', 600},{'X', 600},{'Y', 600},{'Z', 600},{'[', 600},{'\\', 600},{']', 600},{'^', 600},{'_', 600},{'`', 600},{'a', 600},{'b', 600},{'c', 600},{'d', 600},{'e', 600},{'f', 600},{'g', 600},{'h', 600},{'i', 600},{'j', 600},{'k', 600},{'l', 600},{'m', 600},{'n', 600},{'o', 600},{'p', 600},{'q', 600},{'r', 600},{'s', 600},{'t', 600},{'u', 600},{'v', 600},{'w', 600},{'x', 600},{'y', 600},{'z', 600},{'{', 600},{'|', 600},{'}', 600},{'~', 600},{0xa1, 600},{0xa2, 600},{0xa3, 600},{0xa4, 600},{0xa5, 600},{0xa6, 600},{0xa7, 600},{0xa8, 600},{0xa9, 600},{0xaa, 600},{0xab, 600},{0xac, 600},{0xae, 600},{0xaf, 600},{0xb0, 600},{0xb1, 600},{0xb2, 600},{0xb3, 600},{0xb4, 600},{0xb5, 600},{0xb6, 600},{0xb7, 600},{0xb8, 600},{0xb9, 600},{0xba, 600},{0xbb, 600},{0xbc, 600},{0xbd, 600},{0xbe, 600},{0xbf, 600},{0xc0, 600},{0xc1, 600},{0xc2, 600},{0xc3, 600},{0xc4, 600},{0xc5, 600},{0xc6, 600},{0xc7, 600},{0xc8, 600},{0xc9, 600},{0xca, 600},{0xcb, 600},{0xcc, 600},{0xcd, 600},{0xce, 600},{0xcf, 600},{0xd0, 600},{0xd1, 600},{0xd2, 600},{0xd3, 600},{0xd4, 600},{0xd5, 600},{0xd6, 600},{0xd7, 600},{0xd8, 600},{0xd9, 600},{0xda, 600},{0xdb, 600},{0xdc, 600},{0xdd, 600},{0xde, 600},{0xdf, 600},{0xe0, 600},{0xe1, 600},{0xe2, 600},{0xe3, 600},{0xe4, 600},{0xe5, 600},{0xe6, 600},{0xe7, 600},{0xe8, 600},{0xe9, 600},{0xea, 600},{0xeb, 600},{0xec, 600},{0xed, 600},{0xee, 600},{0xef, 600},{0xf0, 600},{0xf1, 600},{0xf2, 600},{0xf3, 600},{0xf4, 600},{0xf5, 600},{0xf6, 600},{0xf7, 600},{0xf8, 600},{0xf9, 600},{0xfa, 600},{0xfb, 600},{0xfc, 600},{0xfd, 600},{0xfe, 600},{0xff, 600}, {0x0100, 600}, {0x0101, 600},{0x0102, 600},{0x0103, 600},{0x0104, 600},{0x0105, 600},{0x0106, 600},{0x0107, 600},{0x010c, 600},{0x010d, 600},{0x010e, 600},{0x010f, 600},{0x0110, 600},{0x0111, 600},{0x0112, 600},{0x0113, 600},{0x0116, 600},{0x0117, 600},{0x0118, 600},{0x0119, 600},{0x011a, 600},{0x011b, 600},{0x011e, 600},{0x011f, 600},{0x0122, 600},{0x0123, 600},{0x012a, 600},{0x012b, 600},{0x012e, 600},{0x012f, 600},{0x0130, 600},{0x0131, 600},{0x0136, 600},{0x0137, 600},{0x0139, 600},{0x013a, 600},{0x013b, 600},{0x013c, 600},{0x013d, 600},{0x013e, 600},{0x0141, 600},{0x0142, 600},{0x0143, 600},{0x0144, 600},{0x0145, 600},{0x0146, 600},{0x0147, 600},{0x0148, 600},{0x014c, 600},{0x014d, 600},{0x0150, 600},{0x0151, 600},{0x0152, 600},{0x0153, 600},{0x0154, 600},{0x0155, 600},{0x0156, 600},{0x0157, 600},{0x0158, 600},{0x0159, 600},{0x015a, 600},{0x015b, 600},{0x015e, 600},{0x015f, 600},{0x0160, 600},{0x0161, 600},{0x0162, 600},{0x0163, 600},{0x0164, 600},{0x0165, 600},{0x016a, 600},{0x016b, 600},{0x016e, 600},{0x016f, 600},{0x0170, 600},{0x0171, 600},{0x0172, 600},{0x0173, 600},{0x0178, 600},{0x0179, 600},{0x017a, 600},{0x017b, 600},{0x017c, 600},{0x017d, 600},{0x017e, 600},{0x0192, 600},{0x0218, 600},{0x0219, 600},{0x02c6, 600},{0x02c7, 600},{0x02d8, 600},{0x02d9, 600},{0x02da, 600},{0x02db, 600},{0x02dc, 600},{0x02dd, 600},{0x2013, 600},{0x2014, 600},{0x2018, 600},{0x2019, 600},{0x201a, 600},{0x201c, 600},{0x201d, 600},{0x201e, 600},{0x2020, 600},{0x2021, 600},{0x2022, 600},{0x2026, 600},{0x2030, 600},{0x2039, 600},{0x203a, 600},{0x2044, 600},{0x2122, 600},{0x2202, 600},{0x2206, 600},{0x2211, 600},{0x2212, 600},{0x221a, 600},{0x2260, 600},{0x2264, 600},{0x2265, 600},{0x25ca, 600},{0xf6c3, 600},{0xfb01, 600},{0xfb02, 600}}},
+{"/Courier-Oblique" , {{' ', 600}, {'!', 600}, {'"', 600},{'#', 600},{'$', 600},{'%', 600},{'&', 600}, {'\'', 600},{'(', 600},{')', 600},{'*', 600},{'+', 600},{',', 600},{'-', 600},{'.', 600},{'/', 600},{'0', 600},{'1', 600},{'2', 600},{'3', 600},{'4', 600},{'5', 600},{'6', 600},{'7', 600},{'8', 600},{'9', 600},{':', 600},{';', 600},{'<', 600},{'=', 600},{'>', 600},{'?', 600},{'@', 600},{'A', 600},{'B', 600},{'C', 600},{'D', 600},{'E', 600},{'F', 600},{'G', 600},{'H', 600},{'I', 600},{'J', 600},{'K', 600},{'L', 600},{'M', 600},{'N', 600},{'O', 600},{'P', 600},{'Q', 600},{'R', 600},{'S', 600},{'T', 600},{'U', 600},{'V', 600},{'W', 600},{'X', 600},{'Y', 600},{'Z', 600},{'[', 600},{'\\', 600},{']', 600},{'^', 600},{'_', 600},{'`', 600},{'a', 600},{'b', 600},{'c', 600},{'d', 600},{'e', 600},{'f', 600},{'g', 600},{'h', 600},{'i', 600},{'j', 600},{'k', 600},{'l', 600},{'m', 600},{'n', 600},{'o', 600},{'p', 600},{'q', 600},{'r', 600},{'s', 600},{'t', 600},{'u', 600},{'v', 600},{'w', 600},{'x', 600},{'y', 600},{'z', 600},{'{', 600},{'|', 600},{'}', 600},{'~', 600},{0xa1, 600},{0xa2, 600},{0xa3, 600},{0xa4, 600},{0xa5, 600},{0xa6, 600},{0xa7, 600},{0xa8, 600},{0xa9, 600},{0xaa, 600},{0xab, 600},{0xac, 600},{0xae, 600},{0xaf, 600},{0xb0, 600},{0xb1, 600},{0xb2, 600},{0xb3, 600},{0xb4, 600},{0xb5, 600},{0xb6, 600},{0xb7, 600},{0xb8, 600},{0xb9, 600},{0xba, 600},{0xbb, 600},{0xbc, 600},{0xbd, 600},{0xbe, 600},{0xbf, 600},{0xc0, 600},{0xc1, 600},{0xc2, 600},{0xc3, 600},{0xc4, 600},{0xc5, 600},{0xc6, 600},{0xc7, 600},{0xc8, 600},{0xc9, 600},{0xca, 600},{0xcb, 600},{0xcc, 600},{0xcd, 600},{0xce, 600},{0xcf, 600},{0xd0, 600},{0xd1, 600},{0xd2, 600},{0xd3, 600},{0xd4, 600},{0xd5, 600},{0xd6, 600},{0xd7, 600},{0xd8, 600},{0xd9, 600},{0xda, 600},{0xdb, 600},{0xdc, 600},{0xdd, 600},{0xde, 600},{0xdf, 600},{0xe0, 600},{0xe1, 600},{0xe2, 600},{0xe3, 600},{0xe4, 600},{0xe5, 600},{0xe6, 600},{0xe7, 600},{0xe8, 600},{0xe9, 600},{0xea, 600},{0xeb, 600},{0xec, 600},{0xed, 600},{0xee, 600},{0xef, 600},{0xf0, 600},{0xf1, 600},{0xf2, 600},{0xf3, 600},{0xf4, 600},{0xf5, 600},{0xf6, 600},{0xf7, 600},{0xf8, 600},{0xf9, 600},{0xfa, 600},{0xfb, 600},{0xfc, 600},{0xfd, 600},{0xfe, 600},{0xff, 600},{0x0100, 600},{0x0101, 600},{0x0102, 600},{0x0103, 600},{0x0104, 600},{0x0105, 600},{0x0106, 600},{0x0107, 600},{0x010c, 600},{0x010d, 600},{0x010e, 600},{0x010f, 600},{0x0110, 600},{0x0111, 600},{0x0112, 600},{0x0113, 600},{0x0116, 600},{0x0117, 600},{0x0118, 600},{0x0119, 600},{0x011a, 600},{0x011b, 600},{0x011e, 600},{0x011f, 600},{0x0122, 600},{0x0123, 600},{0x012a, 600},{0x012b, 600},{0x012e, 600},{0x012f, 600},{0x0130, 600},{0x0131, 600},{0x0136, 600},{0x0137, 600},{0x0139, 600},{0x013a, 600},{0x013b, 600},{0x013c, 600},{0x013d, 600},{0x013e, 600},{0x0141, 600},{0x0142, 600},{0x0143, 600},{0x0144, 600},{0x0145, 600},{0x0146, 600},{0x0147, 600},{0x0148, 600},{0x014c, 600},{0x014d, 600},{0x0150, 600},{0x0151, 600},{0x0152, 600},{0x0153, 600},{0x0154, 600},{0x0155, 600},{0x0156, 600},{0x0157, 600},{0x0158, 600},{0x0159, 600},{0x015a, 600},{0x015b, 600},{0x015e, 600},{0x015f, 600},{0x0160, 600},{0x0161, 600},{0x0162, 600},{0x0163, 600},{0x0164, 600},{0x0165, 600},{0x016a, 600},{0x016b, 600},{0x016e, 600},{0x016f, 600},{0x0170, 600},{0x0171, 600},{0x0172, 600},{0x0173, 600},{0x0178, 600},{0x0179, 600},{0x017a, 600},{0x017b, 600},{0x017c, 600},{0x017d, 600},{0x017e, 600},{0x0192, 600},{0x0218, 600},{0x0219, 600},{0x02c6, 600},{0x02c7, 600},{0x02d8, 600},{0x02d9, 600},{0x02da, 600},{0x02db, 600},{0x02dc, 600},{0x02dd, 600},{0x2013, 600},{0x2014, 600},{0x2018, 600},{0x2019, 600},{0x201a, 600},{0x201c, 600},{0x201d, 600},{0x201e, 600},{0x2020, 600},{0x2021, 600},{0x2022, 600},{0x2026, 600},{0x2030, 600},{0x2039, 600},{0x203a, 600},{0x2044, 600},{0x2122, 600},{0x2202, 600},{0x2206, 600},{0x2211, 600},{0x2212, 600},{0x221a, 600},{0x2260, 600},{0x2264, 600},{0x2265, 600},{0x25ca, 600},{0xf6c3, 600},{0xfb01, 600},{0xfb02, 600}}},
+{"/Courier-Bold", {{' ', 600},{'!', 600},{'"', 600},{'#', 600},{'$', 600},{'%', 600},{'&', 600}, {'\'', 600},{'(', 600},{')', 600},{'*', 600},{'+', 600},{',', 600},{'-', 600},{'.', 600},{'/', 600},{'0', 600},{'1', 600},{'2', 600},{'3', 600},{'4', 600},{'5', 600},{'6', 600},{'7', 600},{'8', 600},{'9', 600},{':', 600},{';', 600},{'<', 600},{'=', 600},{'>', 600},{'?', 600},{'@', 600},{'A', 600},{'B', 600},{'C', 600},{'D', 600},{'E', 600},{'F', 600},{'G', 600},{'H', 600},{'I', 600},{'J', 600},{'K', 600},{'L', 600},{'M', 600},{'N', 600},{'O', 600},{'P', 600},{'Q', 600},{'R', 600},{'S', 600},{'T', 600},{'U', 600},{'V', 600},{'W', 600},{'X', 600},{'Y', 600},{'Z', 600},{'[', 600},{'\\', 600},{']', 600},{'^', 600},{'_', 600},{'`', 600},{'a', 600},{'b', 600},{'c', 600},{'d', 600},{'e', 600},{'f', 600},{'g', 600},{'h', 600},{'i', 600},{'j', 600},{'k', 600},{'l', 600},{'m', 600},{'n', 600},{'o', 600},{'p', 600},{'q', 600},{'r', 600},{'s', 600},{'t', 600},{'u', 600},{'v', 600},{'w', 600},{'x', 600},{'y', 600},{'z', 600},{'{', 600},{'|', 600},{'}', 600},{'~', 600},{0xa1, 600},{0xa2, 600},{0xa3, 600},{0xa4, 600},{0xa5, 600},{0xa6, 600},{0xa7, 600},{0xa8, 600},{0xa9, 600},{0xaa, 600},{0xab, 600},{0xac, 600},{0xae, 600},{0xaf, 600},{0xb0, 600},{0xb1, 600},{0xb2, 600},{0xb3, 600},{0xb4, 600},{0xb5, 600},{0xb6, 600},{0xb7, 600},{0xb8, 600},{0xb9, 600},{0xba, 600},{0xbb, 600},{0xbc, 600},{0xbd, 600},{0xbe, 600},{0xbf, 600},{0xc0, 600},{0xc1, 600},{0xc2, 600},{0xc3, 600},{0xc4, 600},{0xc5, 600},{0xc6, 600},{0xc7, 600},{0xc8, 600},{0xc9, 600},{0xca, 600},{0xcb, 600},{0xcc, 600},{0xcd, 600},{0xce, 600},{0xcf, 600},{0xd0, 600},{0xd1, 600},{0xd2, 600},{0xd3, 600},{0xd4, 600},{0xd5, 600},{0xd6, 600},{0xd7, 600},{0xd8, 600},{0xd9, 600},{0xda, 600},{0xdb, 600},{0xdc, 600},{0xdd, 600},{0xde, 600},{0xdf, 600},{0xe0, 600},{0xe1, 600},{0xe2, 600},{0xe3, 600},{0xe4, 600},{0xe5, 600},{0xe6, 600},{0xe7, 600},{0xe8, 600},{0xe9, 600},{0xea, 600},{0xeb, 600},{0xec, 600},{0xed, 600},{0xee, 600},{0xef, 600},{0xf0, 600},{0xf1, 600},{0xf2, 600},{0xf3, 600},{0xf4, 600},{0xf5, 600},{0xf6, 600},{0xf7, 600},{0xf8, 600},{0xf9, 600},{0xfa, 600},{0xfb, 600},{0xfc, 600},{0xfd, 600},{0xfe, 600},{0xff, 600}, {0x0100, 600}, {0x0101, 600}, {0x0102, 600}, {0x0103, 600}, {0x0104, 600}, {0x0105, 600}, {0x0106, 600}, {0x0107, 600}, {0x010c, 600}, {0x010d, 600}, {0x010e, 600}, {0x010f, 600}, {0x0110, 600}, {0x0111, 600}, {0x0112, 600}, {0x0113, 600}, {0x0116, 600}, {0x0117, 600}, {0x0118, 600}, {0x0119, 600}, {0x011a, 600}, {0x011b, 600}, {0x011e, 600}, {0x011f, 600}, {0x0122, 600}, {0x0123, 600}, {0x012a, 600}, {0x012b, 600}, {0x012e, 600}, {0x012f, 600}, {0x0130, 600}, {0x0131, 600}, {0x0136, 600}, {0x0137, 600}, {0x0139, 600}, {0x013a, 600}, {0x013b, 600}, {0x013c, 600}, {0x013d, 600}, {0x013e, 600}, {0x0141, 600}, {0x0142, 600}, {0x0143, 600}, {0x0144, 600}, {0x0145, 600}, {0x0146, 600}, {0x0147, 600}, {0x0148, 600}, {0x014c, 600}, {0x014d, 600}, {0x0150, 600}, {0x0151, 600}, {0x0152, 600}, {0x0153, 600}, {0x0154, 600}, {0x0155, 600}, {0x0156, 600}, {0x0157, 600}, {0x0158, 600}, {0x0159, 600}, {0x015a, 600}, {0x015b, 600}, {0x015e, 600}, {0x015f, 600}, {0x0160, 600}, {0x0161, 600}, {0x0162, 600}, {0x0163, 600}, {0x0164, 600}, {0x0165, 600}, {0x016a, 600}, {0x016b, 600}, {0x016e, 600}, {0x016f, 600}, {0x0170, 600}, {0x0171, 600}, {0x0172, 600}, {0x0173, 600}, {0x0178, 600}, {0x0179, 600}, {0x017a, 600}, {0x017b, 600}, {0x017c, 600}, {0x017d, 600}, {0x017e, 600}, {0x0192, 600}, {0x0218, 600}, {0x0219, 600}, {0x02c6, 600}, {0x02c7, 600}, {0x02d8, 600}, {0x02d9, 600}, {0x02da, 600}, {0x02db, 600}, {0x02dc, 600}, {0x02dd, 600}, {0x2013, 600}, {0x2014, 600}, {0x2018, 600}, {0x2019, 600}, {0x201a, 600}, {0x201c, 600}, {0x201d, 600}, {0x201e, 600}, {0x2020, 600}, {0x2021, 600}, {0x2022, 600}, {0x2026, 600}, {0x2030, 600}, {0x2039, 600}, {0x203a, 600}, {0x2044, 600}, {0x2122, 600}, {0x2202, 600}, {0x2206, 600}, {0x2211, 600}, {0x2212, 600}, {0x221a, 600}, {0x2260, 600}, {0x2264, 600}, {0x2265, 600}, {0x25ca, 600}, {0xf6c3, 600}, {0xfb01, 600}, {0xfb02, 600}}},
+{"/Courier-BoldOblique", {{' ', 600},{'!', 600},{'"', 600},{'#', 600},{'$', 600},{'%', 600},{'&', 600}, {'\'', 600},{'(', 600},{')', 600},{'*', 600},{'+', 600},{',', 600},{'-', 600},{'.', 600},{'/', 600},{'0', 600},{'1', 600},{'2', 600},{'3', 600},{'4', 600},{'5', 600},{'6', 600},{'7', 600},{'8', 600},{'9', 600},{':', 600},{';', 600},{'<', 600},{'=', 600},{'>', 600},{'?', 600},{'@', 600},{'A', 600},{'B', 600},{'C', 600},{'D', 600},{'E', 600},{'F', 600},{'G', 600},{'H', 600},{'I', 600},{'J', 600},{'K', 600},{'L', 600},{'M', 600},{'N', 600},{'O', 600},{'P', 600},{'Q', 600},{'R', 600},{'S', 600},{'T', 600},{'U', 600},{'V', 600},{'W', 600},{'X', 600},{'Y', 600},{'Z', 600},{'[', 600},{'\\', 600},{']', 600},{'^', 600},{'_', 600},{'`', 600},{'a', 600},{'b', 600},{'c', 600},{'d', 600},{'e', 600},{'f', 600},{'g', 600},{'h', 600},{'i', 600},{'j', 600},{'k', 600},{'l', 600},{'m', 600},{'n', 600},{'o', 600},{'p', 600},{'q', 600},{'r', 600},{'s', 600},{'t', 600},{'u', 600},{'v', 600},{'w', 600},{'x', 600},{'y', 600},{'z', 600},{'{', 600},{'|', 600},{'}', 600},{'~', 600},{0xa1, 600},{0xa2, 600},{0xa3, 600},{0xa4, 600},{0xa5, 600},{0xa6, 600},{0xa7, 600},{0xa8, 600},{0xa9, 600},{0xaa, 600},{0xab, 600},{0xac, 600},{0xae, 600},{0xaf, 600},{0xb0, 600},{0xb1, 600},{0xb2, 600},{0xb3, 600},{0xb4, 600},{0xb5, 600},{0xb6, 600},{0xb7, 600},{0xb8, 600},{0xb9, 600},{0xba, 600},{0xbb, 600},{0xbc, 600},{0xbd, 600},{0xbe, 600},{0xbf, 600},{0xc0, 600},{0xc1, 600},{0xc2, 600},{0xc3, 600},{0xc4, 600},{0xc5, 600},{0xc6, 600},{0xc7, 600},{0xc8, 600},{0xc9, 600},{0xca, 600},{0xcb, 600},{0xcc, 600},{0xcd, 600},{0xce, 600},{0xcf, 600},{0xd0, 600},{0xd1, 600},{0xd2, 600},{0xd3, 600},{0xd4, 600},{0xd5, 600},{0xd6, 600},{0xd7, 600},{0xd8, 600},{0xd9, 600},{0xda, 600},{0xdb, 600},{0xdc, 600},{0xdd, 600},{0xde, 600},{0xdf, 600},{0xe0, 600},{0xe1, 600},{0xe2, 600},{0xe3, 600},{0xe4, 600},{0xe5, 600},{0xe6, 600},{0xe7, 600},{0xe8, 600},{0xe9, 600},{0xea, 600},{0xeb, 600},{0xec, 600},{0xed, 600},{0xee, 600},{0xef, 600},{0xf0, 600},{0xf1, 600},{0xf2, 600},{0xf3, 600},{0xf4, 600},{0xf5, 600},{0xf6, 600},{0xf7, 600},{0xf8, 600},{0xf9, 600},{0xfa, 600},{0xfb, 600},{0xfc, 600},{0xfd, 600},{0xfe, 600},{0xff, 600},{0x0100, 600},{0x0101, 600},{0x0102, 600},{0x0103, 600},{0x0104, 600},{0x0105, 600},{0x0106, 600},{0x0107, 600},{0x010c, 600},{0x010d, 600},{0x010e, 600},{0x010f, 600},{0x0110, 600},{0x0111, 600},{0x0112, 600},{0x0113, 600},{0x0116, 600},{0x0117, 600},{0x0118, 600},{0x0119, 600},{0x011a, 600},{0x011b, 600},{0x011e, 600},{0x011f, 600},{0x0122, 600},{0x0123, 600},{0x012a, 600},{0x012b, 600},{0x012e, 600},{0x012f, 600},{0x0130, 600},{0x0131, 600},{0x0136, 600},{0x0137, 600},{0x0139, 600},{0x013a, 600},{0x013b, 600},{0x013c, 600},{0x013d, 600},{0x013e, 600},{0x0141, 600},{0x0142, 600},{0x0143, 600},{0x0144, 600},{0x0145, 600},{0x0146, 600},{0x0147, 600},{0x0148, 600},{0x014c, 600},{0x014d, 600},{0x0150, 600},{0x0151, 600},{0x0152, 600},{0x0153, 600},{0x0154, 600},{0x0155, 600},{0x0156, 600},{0x0157, 600},{0x0158, 600},{0x0159, 600},{0x015a, 600},{0x015b, 600},{0x015e, 600},{0x015f, 600},{0x0160, 600},{0x0161, 600},{0x0162, 600},{0x0163, 600},{0x0164, 600},{0x0165, 600},{0x016a, 600},{0x016b, 600},{0x016e, 600},{0x016f, 600},{0x0170, 600},{0x0171, 600},{0x0172, 600},{0x0173, 600},{0x0178, 600},{0x0179, 600},{0x017a, 600},{0x017b, 600},{0x017c, 600},{0x017d, 600},{0x017e, 600},{0x0192, 600},{0x0218, 600},{0x0219, 600},{0x02c6, 600},{0x02c7, 600},{0x02d8, 600},{0x02d9, 600},{0x02da, 600},{0x02db, 600},{0x02dc, 600},{0x02dd, 600},{0x2013, 600},{0x2014, 600},{0x2018, 600},{0x2019, 600},{0x201a, 600},{0x201c, 600},{0x201d, 600},{0x201e, 600},{0x2020, 600},{0x2021, 600},{0x2022, 600},{0x2026, 600},{0x2030, 600},{0x2039, 600},{0x203a, 600},{0x2044, 600},{0x2122, 600},{0x2202, 600},{0x2206, 600},{0x2211, 600},{0x2212, 600},{0x221a, 600},{0x2260, 600},{0x2264, 600},{0x2265, 600},{0x25ca, 600},{0xf6c3, 600},{0xfb01, 600},{0xfb02, 600}}},
+ {"/Helvetica", {{' ', 278},{'!', 278},{'"', 355},{'#', 556},{'$', 556},{'%', 889},{'&', 667}, {'\'', 191},{'(', 333},{')', 333},{'*', 389},{'+', 584},{',', 278},{'-', 333},{'.', 278},{'/', 278},{'0', 556},{'1', 556},{'2', 556},{'3', 556},{'4', 556},{'5', 556},{'6', 556},{'7', 556},{'8', 556},{'9', 556},{':', 278},{';', 278},{'<', 584},{'=', 584},{'>', 584},{'?', 556},{'@', 1015},{'A', 667},{'B', 667},{'C', 722},{'D', 722},{'E', 667},{'F', 611},{'G', 778},{'H', 722},{'I', 278},{'J', 500},{'K', 667},{'L', 556},{'M', 833},{'N', 722},{'O', 778},{'P', 667},{'Q', 778},{'R', 722},{'S', 667},{'T', 611}, {'U', 722},{'V', 667},{'W', 944},{'X', 667},{'Y', 667},{'Z', 611},{'[', 278},{'\\', 278},{']', 278},{'^', 469},{'_', 556},{'`', 333},{'a', 556},{'b', 556},{'c', 500},{'d', 556},{'e', 556},{'f', 278},{'g', 556},{'h', 556},{'i', 222},{'j', 222},{'k', 500},{'l', 222},{'m', 833},{'n', 556},{'o', 556},{'p', 556},{'q', 556},{'r', 333},{'s', 500},{'t', 278},{'u', 556},{'v', 500},{'w', 722},{'x', 500},{'y', 500},{'z', 500},{'{', 334},{'|', 260},{'}', 334},{'~', 584},{0xa1, 333},{0xa2, 556},{0xa3, 556},{0xa4, 556},{0xa5, 556},{0xa6, 260},{0xa7, 556},{0xa8, 333},{0xa9, 737},{0xaa, 370},{0xab, 556},{0xac, 584},{0xae, 737},{0xaf, 333},{0xb0, 400},{0xb1, 584},{0xb2, 333},{0xb3, 333},{0xb4, 333},{0xb5, 556},{0xb6, 537},{0xb7, 278},{0xb8, 333},{0xb9, 333},{0xba, 365},{0xbb, 556},{0xbc, 834},{0xbd, 834},{0xbe, 834},{0xbf, 611},{0xc0, 667},{0xc1, 667},{0xc2, 667},{0xc3, 667},{0xc4, 667},{0xc5, 667},{0xc6, 1000},{0xc7, 722},{0xc8, 667},{0xc9, 667},{0xca, 667},{0xcb, 667},{0xcc, 278},{0xcd, 278},{0xce, 278},{0xcf, 278},{0xd0, 722},{0xd1, 722},{0xd2, 778},{0xd3, 778},{0xd4, 778},{0xd5, 778},{0xd6, 778},{0xd7, 584},{0xd8, 778},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 667},{0xde, 667},{0xdf, 611},{0xe0, 556},{0xe1, 556},{0xe2, 556},{0xe3, 556},{0xe4, 556},{0xe5, 556},{0xe6, 889},{0xe7, 500},{0xe8, 556},{0xe9, 556},{0xea, 556},{0xeb, 556},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 556},{0xf1, 556},{0xf2, 556},{0xf3, 556},{0xf4, 556},{0xf5, 556},{0xf6, 556},{0xf7, 584},{0xf8, 611},{0xf9, 556},{0xfa, 556},{0xfb, 556},{0xfc, 556},{0xfd, 500},{0xfe, 556},{0xff, 500},{0x0100, 667},{0x0101, 556},{0x0102, 667},{0x0103, 556},{0x0104, 667},{0x0105, 556},{0x0106, 722},{0x0107, 500},{0x010c, 722},{0x010d, 500},{0x010e, 722},{0x010f, 643},{0x0110, 722},{0x0111, 556},{0x0112, 667},{0x0113, 556},{0x0116, 667},{0x0117, 556},{0x0118, 667},{0x0119, 556},{0x011a, 667},{0x011b, 556},{0x011e, 778},{0x011f, 556},{0x0122, 778},{0x0123, 556},{0x012a, 278},{0x012b, 278},{0x012e, 278},{0x012f, 222},{0x0130, 278},{0x0131, 278},{0x0136, 667},{0x0137, 500},{0x0139, 556},{0x013a, 222},{0x013b, 556},{0x013c, 222},{0x013d, 556},{0x013e, 299},{0x0141, 556},{0x0142, 222},{0x0143, 722},{0x0144, 556},{0x0145, 722},{0x0146, 556},{0x0147, 722},{0x0148, 556},{0x014c, 778},{0x014d, 556},{0x0150, 778},{0x0151, 556},{0x0152, 1000},{0x0153, 944},{0x0154, 722},{0x0155, 333},{0x0156, 722},{0x0157, 333},{0x0158, 722},{0x0159, 333},{0x015a, 667},{0x015b, 500},{0x015e, 667},{0x015f, 500},{0x0160, 667},{0x0161, 500},{0x0162, 611},{0x0163, 278},{0x0164, 611},{0x0165, 317},{0x016a, 722},{0x016b, 556},{0x016e, 722},{0x016f, 556},{0x0170, 722},{0x0171, 556},{0x0172, 722},{0x0173, 556},{0x0178, 667},{0x0179, 611},{0x017a, 500},{0x017b, 611},{0x017c, 500},{0x017d, 611},{0x017e, 500},{0x0192, 556},{0x0218, 667},{0x0219, 500},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 556},{0x2014, 1000},{0x2018, 222},{0x2019, 222},{0x201a, 222},{0x201c, 333},{0x201d, 333},{0x201e, 333},{0x2020, 556},{0x2021, 556},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 1000},{0x2202, 476},{0x2206, 612},{0x2211, 600},{0x2212, 584},{0x221a, 453},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 471},{0xf6c3, 250},{0xfb01, 500},{0xfb02, 500}}},
+{"/Helvetica-Bold", {{' ', 278},{'!', 333},{'"', 474},{'#', 556},{'$', 556},{'%', 889},{'&', 722}, {'\'', 238},{'(', 333},{')', 333},{'*', 389},{'+', 584},{',', 278},{'-', 333},{'.', 278},{'/', 278},{'0', 556},{'1', 556},{'2', 556},{'3', 556},{'4', 556},{'5', 556},{'6', 556},{'7', 556},{'8', 556},{'9', 556},{':', 333},{';', 333},{'<', 584},{'=', 584},{'>', 584},{'?', 611},{'@', 975},{'A', 722},{'B', 722},{'C', 722},{'D', 722},{'E', 667},{'F', 611},{'G', 778},{'H', 722},{'I', 278},{'J', 556},{'K', 722},{'L', 611},{'M', 833},{'N', 722},{'O', 778},{'P', 667},{'Q', 778},{'R', 722},{'S', 667},{'T', 611},{'U', 722},{'V', 667},{'W', 944},{'X', 667},{'Y', 667},{'Z', 611},{'[', 333},{'\\', 278},{']', 333},{'^', 584},{'_', 556},{'`', 333},{'a', 556},{'b', 611},{'c', 556},{'d', 611},{'e', 556},{'f', 333},{'g', 611},{'h', 611},{'i', 278},{'j', 278},{'k', 556},{'l', 278},{'m', 889},{'n', 611},{'o', 611},{'p', 611},{'q', 611},{'r', 389},{'s', 556},{'t', 333},{'u', 611},{'v', 556},{'w', 778},{'x', 556},{'y', 556},{'z', 500},{'{', 389},{'|', 280},{'}', 389},{'~', 584},{0xa1, 333},{0xa2, 556},{0xa3, 556},{0xa4, 556},{0xa5, 556},{0xa6, 280},{0xa7, 556},{0xa8, 333},{0xa9, 737},{0xaa, 370},{0xab, 556},{0xac, 584},{0xae, 737},{0xaf, 333},{0xb0, 400},{0xb1, 584},{0xb2, 333},{0xb3, 333},{0xb4, 333},{0xb5, 611},{0xb6, 556},{0xb7, 278},{0xb8, 333},{0xb9, 333},{0xba, 365},{0xbb, 556},{0xbc, 834},{0xbd, 834},{0xbe, 834},{0xbf, 611},{0xc0, 722},{0xc1, 722},{0xc2, 722},{0xc3, 722},{0xc4, 722},{0xc5, 722},{0xc6, 1000},{0xc7, 722},{0xc8, 667},{0xc9, 667},{0xca, 667},{0xcb, 667},{0xcc, 278},{0xcd, 278},{0xce, 278},{0xcf, 278},{0xd0, 722},{0xd1, 722},{0xd2, 778},{0xd3, 778},{0xd4, 778},{0xd5, 778},{0xd6, 778},{0xd7, 584},{0xd8, 778},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 667},{0xde, 667},{0xdf, 611},{0xe0, 556},{0xe1, 556},{0xe2, 556},{0xe3, 556},{0xe4, 556},{0xe5, 556},{0xe6, 889},{0xe7, 556},{0xe8, 556},{0xe9, 556},{0xea, 556},{0xeb, 556},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 611},{0xf1, 611},{0xf2, 611},{0xf3, 611},{0xf4, 611},{0xf5, 611},{0xf6, 611},{0xf7, 584},{0xf8, 611},{0xf9, 611},{0xfa, 611},{0xfb, 611},{0xfc, 611},{0xfd, 556},{0xfe, 611},{0xff, 556},{0x0100, 722},{0x0101, 556},{0x0102, 722},{0x0103, 556},{0x0104, 722},{0x0105, 556},{0x0106, 722},{0x0107, 556},{0x010c, 722},{0x010d, 556},{0x010e, 722},{0x010f, 743},{0x0110, 722},{0x0111, 611},{0x0112, 667},{0x0113, 556},{0x0116, 667},{0x0117, 556},{0x0118, 667},{0x0119, 556},{0x011a, 667},{0x011b, 556},{0x011e, 778},{0x011f, 611},{0x0122, 778},{0x0123, 611},{0x012a, 278},{0x012b, 278},{0x012e, 278},{0x012f, 278},{0x0130, 278},{0x0131, 278},{0x0136, 722},{0x0137, 556},{0x0139, 611},{0x013a, 278},{0x013b, 611},{0x013c, 278},{0x013d, 611},{0x013e, 400},{0x0141, 611},{0x0142, 278},{0x0143, 722},{0x0144, 611},{0x0145, 722},{0x0146, 611},{0x0147, 722},{0x0148, 611},{0x014c, 778},{0x014d, 611},{0x0150, 778},{0x0151, 611},{0x0152, 1000},{0x0153, 944},{0x0154, 722},{0x0155, 389},{0x0156, 722},{0x0157, 389},{0x0158, 722},{0x0159, 389},{0x015a, 667},{0x015b, 556},{0x015e, 667},{0x015f, 556},{0x0160, 667},{0x0161, 556},{0x0162, 611},{0x0163, 333},{0x0164, 611},{0x0165, 389},{0x016a, 722},{0x016b, 611},{0x016e, 722},{0x016f, 611},{0x0170, 722},{0x0171, 611},{0x0172, 722},{0x0173, 611},{0x0178, 667},{0x0179, 611},{0x017a, 500},{0x017b, 611},{0x017c, 500},{0x017d, 611},{0x017e, 500},{0x0192, 556},{0x0218, 667},{0x0219, 556},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 556},{0x2014, 1000},{0x2018, 278},{0x2019, 278},{0x201a, 278},{0x201c, 500},{0x201d, 500},{0x201e, 500},{0x2020, 556},{0x2021, 556},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 1000},{0x2202, 494},{0x2206, 612},{0x2211, 600},{0x2212, 584},{0x221a, 549},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 494},{0xf6c3, 250},{0xfb01, 611},{0xfb02, 611}}},
+{"/Helvetica-BoldOblique", {{' ', 278},{'!', 333},{'"', 474},{'#', 556},{'$', 556},{'%', 889},{'&', 722}, {'\'', 238},{'(', 333},{')', 333},{'*', 389},{'+', 584},{',', 278},{'-', 333},{'.', 278},{'/', 278},{'0', 556},{'1', 556},{'2', 556},{'3', 556},{'4', 556},{'5', 556},{'6', 556},{'7', 556},{'8', 556},{'9', 556},{':', 333},{';', 333},{'<', 584},{'=', 584},{'>', 584},{'?', 611},{'@', 975},{'A', 722},{'B', 722},{'C', 722},{'D', 722},{'E', 667},{'F', 611},{'G', 778},{'H', 722},{'I', 278},{'J', 556},{'K', 722},{'L', 611},{'M', 833},{'N', 722},{'O', 778},{'P', 667},{'Q', 778},{'R', 722},{'S', 667},{'T', 611},{'U', 722},{'V', 667},{'W', 944},{'X', 667},{'Y', 667},{'Z', 611},{'[', 333},{'\\', 278},{']', 333},{'^', 584},{'_', 556},{'`', 333},{'a', 556},{'b', 611},{'c', 556},{'d', 611},{'e', 556},{'f', 333},{'g', 611},{'h', 611},{'i', 278},{'j', 278},{'k', 556},{'l', 278},{'m', 889},{'n', 611},{'o', 611},{'p', 611},{'q', 611},{'r', 389},{'s', 556},{'t', 333},{'u', 611},{'v', 556},{'w', 778},{'x', 556},{'y', 556},{'z', 500},{'{', 389},{'|', 280},{'}', 389},{'~', 584},{0xa1, 333},{0xa2, 556},{0xa3, 556},{0xa4, 556},{0xa5, 556},{0xa6, 280},{0xa7, 556},{0xa8, 333},{0xa9, 737},{0xaa, 370},{0xab, 556},{0xac, 584},{0xae, 737},{0xaf, 333},{0xb0, 400},{0xb1, 584},{0xb2, 333},{0xb3, 333},{0xb4, 333},{0xb5, 611},{0xb6, 556},{0xb7, 278},{0xb8, 333},{0xb9, 333},{0xba, 365},{0xbb, 556},{0xbc, 834},{0xbd, 834},{0xbe, 834},{0xbf, 611},{0xc0, 722},{0xc1, 722},{0xc2, 722},{0xc3, 722},{0xc4, 722},{0xc5, 722},{0xc6, 1000},{0xc7, 722},{0xc8, 667},{0xc9, 667},{0xca, 667},{0xcb, 667},{0xcc, 278},{0xcd, 278},{0xce, 278},{0xcf, 278},{0xd0, 722},{0xd1, 722},{0xd2, 778},{0xd3, 778},{0xd4, 778},{0xd5, 778},{0xd6, 778},{0xd7, 584},{0xd8, 778},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 667},{0xde, 667},{0xdf, 611},{0xe0, 556},{0xe1, 556},{0xe2, 556},{0xe3, 556},{0xe4, 556},{0xe5, 556},{0xe6, 889},{0xe7, 556},{0xe8, 556},{0xe9, 556},{0xea, 556},{0xeb, 556},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 611},{0xf1, 611},{0xf2, 611},{0xf3, 611},{0xf4, 611},{0xf5, 611},{0xf6, 611},{0xf7, 584},{0xf8, 611},{0xf9, 611},{0xfa, 611},{0xfb, 611},{0xfc, 611},{0xfd, 556},{0xfe, 611},{0xff, 556},{0x0100, 722},{0x0101, 556},{0x0102, 722},{0x0103, 556},{0x0104, 722},{0x0105, 556},{0x0106, 722},{0x0107, 556},{0x010c, 722},{0x010d, 556},{0x010e, 722},{0x010f, 743},{0x0110, 722},{0x0111, 611},{0x0112, 667},{0x0113, 556},{0x0116, 667},{0x0117, 556},{0x0118, 667},{0x0119, 556},{0x011a, 667},{0x011b, 556},{0x011e, 778},{0x011f, 611},{0x0122, 778},{0x0123, 611},{0x012a, 278},{0x012b, 278},{0x012e, 278},{0x012f, 278},{0x0130, 278},{0x0131, 278},{0x0136, 722},{0x0137, 556},{0x0139, 611},{0x013a, 278},{0x013b, 611},{0x013c, 278},{0x013d, 611},{0x013e, 400},{0x0141, 611},{0x0142, 278},{0x0143, 722},{0x0144, 611},{0x0145, 722},{0x0146, 611},{0x0147, 722},{0x0148, 611},{0x014c, 778},{0x014d, 611},{0x0150, 778},{0x0151, 611},{0x0152, 1000},{0x0153, 944},{0x0154, 722},{0x0155, 389},{0x0156, 722},{0x0157, 389},{0x0158, 722},{0x0159, 389},{0x015a, 667},{0x015b, 556},{0x015e, 667},{0x015f, 556},{0x0160, 667},{0x0161, 556},{0x0162, 611},{0x0163, 333},{0x0164, 611},{0x0165, 389},{0x016a, 722},{0x016b, 611},{0x016e, 722},{0x016f, 611},{0x0170, 722},{0x0171, 611},{0x0172, 722},{0x0173, 611},{0x0178, 667},{0x0179, 611},{0x017a, 500},{0x017b, 611},{0x017c, 500},{0x017d, 611},{0x017e, 500},{0x0192, 556},{0x0218, 667},{0x0219, 556},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 556},{0x2014, 1000},{0x2018, 278},{0x2019, 278},{0x201a, 278},{0x201c, 500},{0x201d, 500},{0x201e, 500},{0x2020, 556},{0x2021, 556},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 1000},{0x2202, 494},{0x2206, 612},{0x2211, 600},{0x2212, 584},{0x221a, 549},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 494},{0xf6c3, 250},{0xfb01, 611},{0xfb02, 611}}},
+{"/Helvetica-Oblique", {{' ', 278},{'!', 278},{'"', 355},{'#', 556},{'$', 556},{'%', 889},{'&', 667}, {'\'', 191},{'(', 333},{')', 333},{'*', 389},{'+', 584},{',', 278},{'-', 333},{'.', 278},{'/', 278},{'0', 556},{'1', 556},{'2', 556},{'3', 556},{'4', 556},{'5', 556},{'6', 556},{'7', 556},{'8', 556},{'9', 556},{':', 278},{';', 278},{'<', 584},{'=', 584},{'>', 584},{'?', 556},{'@', 1015},{'A', 667},{'B', 667},{'C', 722},{'D', 722},{'E', 667},{'F', 611},{'G', 778},{'H', 722},{'I', 278},{'J', 500},{'K', 667},{'L', 556},{'M', 833},{'N', 722},{'O', 778},{'P', 667},{'Q', 778},{'R', 722},{'S', 667},{'T', 611},{'U', 722},{'V', 667},{'W', 944},{'X', 667},{'Y', 667},{'Z', 611},{'[', 278},{'\\', 278},{']', 278},{'^', 469},{'_', 556},{'`', 333},{'a', 556},{'b', 556},{'c', 500},{'d', 556},{'e', 556},{'f', 278},{'g', 556},{'h', 556},{'i', 222},{'j', 222},{'k', 500},{'l', 222},{'m', 833},{'n', 556},{'o', 556},{'p', 556},{'q', 556},{'r', 333},{'s', 500},{'t', 278},{'u', 556},{'v', 500},{'w', 722},{'x', 500},{'y', 500},{'z', 500},{'{', 334},{'|', 260},{'}', 334},{'~', 584},{0xa1, 333},{0xa2, 556},{0xa3, 556},{0xa4, 556},{0xa5, 556},{0xa6, 260},{0xa7, 556},{0xa8, 333},{0xa9, 737},{0xaa, 370},{0xab, 556},{0xac, 584},{0xae, 737},{0xaf, 333},{0xb0, 400},{0xb1, 584},{0xb2, 333},{0xb3, 333},{0xb4, 333},{0xb5, 556},{0xb6, 537},{0xb7, 278},{0xb8, 333},{0xb9, 333},{0xba, 365},{0xbb, 556},{0xbc, 834},{0xbd, 834},{0xbe, 834},{0xbf, 611},{0xc0, 667},{0xc1, 667},{0xc2, 667},{0xc3, 667},{0xc4, 667},{0xc5, 667},{0xc6, 1000},{0xc7, 722},{0xc8, 667},{0xc9, 667},{0xca, 667},{0xcb, 667},{0xcc, 278},{0xcd, 278},{0xce, 278},{0xcf, 278},{0xd0, 722},{0xd1, 722},{0xd2, 778},{0xd3, 778},{0xd4, 778},{0xd5, 778},{0xd6, 778},{0xd7, 584},{0xd8, 778},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 667},{0xde, 667},{0xdf, 611},{0xe0, 556},{0xe1, 556},{0xe2, 556},{0xe3, 556},{0xe4, 556},{0xe5, 556},{0xe6, 889},{0xe7, 500},{0xe8, 556},{0xe9, 556},{0xea, 556},{0xeb, 556},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 556},{0xf1, 556},{0xf2, 556},{0xf3, 556},{0xf4, 556},{0xf5, 556},{0xf6, 556},{0xf7, 584},{0xf8, 611},{0xf9, 556},{0xfa, 556},{0xfb, 556},{0xfc, 556},{0xfd, 500},{0xfe, 556},{0xff, 500},{0x0100, 667},{0x0101, 556},{0x0102, 667},{0x0103, 556},{0x0104, 667},{0x0105, 556},{0x0106, 722},{0x0107, 500},{0x010c, 722},{0x010d, 500},{0x010e, 722},{0x010f, 643},{0x0110, 722},{0x0111, 556},{0x0112, 667},{0x0113, 556},{0x0116, 667},{0x0117, 556},{0x0118, 667},{0x0119, 556},{0x011a, 667},{0x011b, 556},{0x011e, 778},{0x011f, 556},{0x0122, 778},{0x0123, 556},{0x012a, 278},{0x012b, 278},{0x012e, 278},{0x012f, 222},{0x0130, 278},{0x0131, 278},{0x0136, 667},{0x0137, 500},{0x0139, 556},{0x013a, 222},{0x013b, 556},{0x013c, 222},{0x013d, 556},{0x013e, 299},{0x0141, 556},{0x0142, 222},{0x0143, 722},{0x0144, 556},{0x0145, 722},{0x0146, 556},{0x0147, 722},{0x0148, 556},{0x014c, 778},{0x014d, 556},{0x0150, 778},{0x0151, 556},{0x0152, 1000},{0x0153, 944},{0x0154, 722},{0x0155, 333},{0x0156, 722},{0x0157, 333},{0x0158, 722},{0x0159, 333},{0x015a, 667},{0x015b, 500},{0x015e, 667},{0x015f, 500},{0x0160, 667},{0x0161, 500},{0x0162, 611},{0x0163, 278},{0x0164, 611},{0x0165, 317},{0x016a, 722},{0x016b, 556},{0x016e, 722},{0x016f, 556},{0x0170, 722},{0x0171, 556},{0x0172, 722},{0x0173, 556},{0x0178, 667},{0x0179, 611},{0x017a, 500},{0x017b, 611},{0x017c, 500},{0x017d, 611},{0x017e, 500},{0x0192, 556},{0x0218, 667},{0x0219, 500},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 556},{0x2014, 1000},{0x2018, 222},{0x2019, 222},{0x201a, 222},{0x201c, 333},{0x201d, 333},{0x201e, 333},{0x2020, 556},{0x2021, 556},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 1000},{0x2202, 476},{0x2206, 612},{0x2211, 600},{0x2212, 584},{0x221a, 453},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 471},{0xf6c3, 250},{0xfb01, 500},{0xfb02, 500}}},
+{"/Symbol", {{' ', 250}, {'!', 333},{'#', 500},{'%', 833},{'&', 778},{'(', 333},{')', 333},{'+', 549},{',', 250},{'.', 250},{'/', 278},{'0', 500},{'1', 500},{'2', 500},{'3', 500},{'4', 500},{'5', 500},{'6', 500},{'7', 500},{'8', 500},{'9', 500},{':', 278},{';', 278},{'<', 549},{'=', 549},{'>', 549},{'?', 444},{'[', 333},{']', 333},{'_', 500},{'{', 480},{'|', 200},{'}', 480},{0xac, 713},{0xb0, 400},{0xb1, 549},{0xb5, 576},{0xd7, 549},{0xf7, 549},{0x0192, 500},{0x0391, 722},{0x0392, 667},{0x0393, 603},{0x0395, 611},{0x0396, 611},{0x0397, 722},{0x0398, 741},{0x0399, 333},{0x039a, 722},{0x039b, 686},{0x039c, 889},{0x039d, 722},{0x039e, 645},{0x039f, 722},{0x03a0, 768},{0x03a1, 556},{0x03a3, 592},{0x03a4, 611},{0x03a5, 690},{0x03a6, 763},{0x03a7, 722},{0x03a8, 795},{0x03b1, 631},{0x03b2, 549},{0x03b3, 411},{0x03b4, 494},{0x03b5, 439},{0x03b6, 494},{0x03b7, 603},{0x03b8, 521},{0x03b9, 329},{0x03ba, 549},{0x03bb, 549},{0x03bd, 521},{0x03be, 493},{0x03bf, 549},{0x03c0, 549},{0x03c1, 549},{0x03c2, 439},{0x03c3, 603},{0x03c4, 439},{0x03c5, 576},{0x03c6, 521},{0x03c7, 549},{0x03c8, 686},{0x03c9, 686},{0x03d1, 631},{0x03d2, 620},{0x03d5, 603},{0x03d6, 713},{0x2022, 460},{0x2026, 1000},{0x2032, 247},{0x2033, 411},{0x2044, 167},{0x20ac, 750},{0x2111, 686},{0x2118, 987},{0x211c, 795},{0x2126, 768},{0x2135, 823},{0x2190, 987},{0x2191, 603},{0x2192, 987},{0x2193, 603},{0x2194, 1042},{0x21b5, 658},{0x21d0, 987},{0x21d1, 603},{0x21d2, 987},{0x21d3, 603},{0x21d4, 1042},{0x2200, 713},{0x2202, 494},{0x2203, 549},{0x2205, 823},{0x2206, 612},{0x2207, 713},{0x2208, 713},{0x2209, 713},{0x220b, 439},{0x220f, 823},{0x2211, 713},{0x2212, 549},{0x2217, 500},{0x221a, 549},{0x221d, 713},{0x221e, 713},{0x2220, 768},{0x2227, 603},{0x2228, 603},{0x2229, 768},{0x222a, 768},{0x222b, 274},{0x2234, 863},{0x223c, 549},{0x2245, 549},{0x2248, 549},{0x2260, 549},{0x2261, 549},{0x2264, 549},{0x2265, 549},{0x2282, 713},{0x2283, 713},{0x2284, 713},{0x2286, 713},{0x2287, 713},{0x2295, 768},{0x2297, 768},{0x22a5, 658},{0x22c5, 250},{0x2320, 686},{0x2321, 686},{0x2329, 329},{0x232a, 329},{0x25ca, 494},{0x2660, 753},{0x2663, 753},{0x2665, 753},{0x2666, 753},{0xf6d9, 790},{0xf6da, 790},{0xf6db, 890},{0xf8e5, 500},{0xf8e6, 603},{0xf8e7, 1000},{0xf8e8, 790},{0xf8e9, 790},{0xf8ea, 786},{0xf8eb, 384},{0xf8ec, 384},{0xf8ed, 384},{0xf8ee, 384},{0xf8ef, 384},{0xf8f0, 384},{0xf8f1, 494},{0xf8f2, 494},{0xf8f3, 494},{0xf8f4, 494},{0xf8f5, 686},{0xf8f6, 384},{0xf8f7, 384},{0xf8f8, 384},{0xf8f9, 384},{0xf8fa, 384},{0xf8fb, 384},{0xf8fc, 494},{0xf8fd, 494},{0xf8fe, 494},{0xf8ff, 790}}},
+{"/Times-Bold", {{' ', 250},{'!', 333},{'"', 555},{'#', 500},{'$', 500},{'%', 1000},{'&', 833}, {'\'', 278},{'(', 333},{')', 333},{'*', 500},{'+', 570},{',', 250},{'-', 333},{'.', 250},{'/', 278},{'0', 500},{'1', 500},{'2', 500},{'3', 500},{'4', 500},{'5', 500},{'6', 500},{'7', 500},{'8', 500},{'9', 500},{':', 333},{';', 333},{'<', 570},{'=', 570},{'>', 570},{'?', 500},{'@', 930},{'A', 722},{'B', 667},{'C', 722},{'D', 722},{'E', 667},{'F', 611},{'G', 778},{'H', 778},{'I', 389},{'J', 500},{'K', 778},{'L', 667},{'M', 944},{'N', 722},{'O', 778},{'P', 611},{'Q', 778},{'R', 722},{'S', 556},{'T', 667},{'U', 722},{'V', 722},{'W', 1000},{'X', 722},{'Y', 722},{'Z', 667},{'[', 333},{'\\', 278},{']', 333},{'^', 581},{'_', 500},{'`', 333},{'a', 500},{'b', 556},{'c', 444},{'d', 556},{'e', 444},{'f', 333},{'g', 500},{'h', 556},{'i', 278},{'j', 333},{'k', 556},{'l', 278},{'m', 833},{'n', 556},{'o', 500},{'p', 556},{'q', 556},{'r', 444},{'s', 389},{'t', 333},{'u', 556},{'v', 500},{'w', 722},{'x', 500},{'y', 500},{'z', 444},{'{', 394},{'|', 220},{'}', 394},{'~', 520},{0xa1, 333},{0xa2, 500},{0xa3, 500},{0xa4, 500},{0xa5, 500},{0xa6, 220},{0xa7, 500},{0xa8, 333},{0xa9, 747},{0xaa, 300},{0xab, 500},{0xac, 570},{0xae, 747},{0xaf, 333},{0xb0, 400},{0xb1, 570},{0xb2, 300},{0xb3, 300},{0xb4, 333},{0xb5, 556},{0xb6, 540},{0xb7, 250},{0xb8, 333},{0xb9, 300},{0xba, 330},{0xbb, 500},{0xbc, 750},{0xbd, 750},{0xbe, 750},{0xbf, 500},{0xc0, 722},{0xc1, 722},{0xc2, 722},{0xc3, 722},{0xc4, 722},{0xc5, 722},{0xc6, 1000},{0xc7, 722},{0xc8, 667},{0xc9, 667},{0xca, 667},{0xcb, 667},{0xcc, 389},{0xcd, 389},{0xce, 389},{0xcf, 389},{0xd0, 722},{0xd1, 722},{0xd2, 778},{0xd3, 778},{0xd4, 778},{0xd5, 778},{0xd6, 778},{0xd7, 570},{0xd8, 778},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 722},{0xde, 611},{0xdf, 556},{0xe0, 500},{0xe1, 500},{0xe2, 500},{0xe3, 500},{0xe4, 500},{0xe5, 500},{0xe6, 722},{0xe7, 444},{0xe8, 444},{0xe9, 444},{0xea, 444},{0xeb, 444},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 500},{0xf1, 556},{0xf2, 500},{0xf3, 500},{0xf4, 500},{0xf5, 500},{0xf6, 500},{0xf7, 570},{0xf8, 500},{0xf9, 556},{0xfa, 556},{0xfb, 556},{0xfc, 556},{0xfd, 500},{0xfe, 556},{0xff, 500},{0x0100, 722},{0x0101, 500},{0x0102, 722},{0x0103, 500},{0x0104, 722},{0x0105, 500},{0x0106, 722},{0x0107, 444},{0x010c, 722},{0x010d, 444},{0x010e, 722},{0x010f, 672},{0x0110, 722},{0x0111, 556},{0x0112, 667},{0x0113, 444},{0x0116, 667},{0x0117, 444},{0x0118, 667},{0x0119, 444},{0x011a, 667},{0x011b, 444},{0x011e, 778},{0x011f, 500},{0x0122, 778},{0x0123, 500},{0x012a, 389},{0x012b, 278},{0x012e, 389},{0x012f, 278},{0x0130, 389},{0x0131, 278},{0x0136, 778},{0x0137, 556},{0x0139, 667},{0x013a, 278},{0x013b, 667},{0x013c, 278},{0x013d, 667},{0x013e, 394},{0x0141, 667},{0x0142, 278},{0x0143, 722},{0x0144, 556},{0x0145, 722},{0x0146, 556},{0x0147, 722},{0x0148, 556},{0x014c, 778},{0x014d, 500},{0x0150, 778},{0x0151, 500},{0x0152, 1000},{0x0153, 722},{0x0154, 722},{0x0155, 444},{0x0156, 722},{0x0157, 444},{0x0158, 722},{0x0159, 444},{0x015a, 556},{0x015b, 389},{0x015e, 556},{0x015f, 389},{0x0160, 556},{0x0161, 389},{0x0162, 667},{0x0163, 333},{0x0164, 667},{0x0165, 416},{0x016a, 722},{0x016b, 556},{0x016e, 722},{0x016f, 556},{0x0170, 722},{0x0171, 556},{0x0172, 722},{0x0173, 556},{0x0178, 722},{0x0179, 667},{0x017a, 444},{0x017b, 667},{0x017c, 444},{0x017d, 667},{0x017e, 444},{0x0192, 500},{0x0218, 556},{0x0219, 389},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 500},{0x2014, 1000},{0x2018, 333},{0x2019, 333},{0x201a, 333},{0x201c, 500},{0x201d, 500},{0x201e, 500},{0x2020, 500},{0x2021, 500},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 1000},{0x2202, 494},{0x2206, 612},{0x2211, 600},{0x2212, 570},{0x221a, 549},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 494},{0xf6c3, 250},{0xfb01, 556},{0xfb02, 556}}},
+{"/Times-BoldItalic", {{' ', 250},{'!', 389},{'"', 555},{'#', 500},{'$', 500},{'%', 833},{'&', 778}, {'\'', 278},{'(', 333},{')', 333},{'*', 500},{'+', 570},{',', 250},{'-', 333},{'.', 250},{'/', 278},{'0', 500},{'1', 500},{'2', 500},{'3', 500},{'4', 500},{'5', 500},{'6', 500},{'7', 500},{'8', 500},{'9', 500},{':', 333},{';', 333},{'<', 570},{'=', 570},{'>', 570},{'?', 500},{'@', 832},{'A', 667},{'B', 667},{'C', 667},{'D', 722},{'E', 667},{'F', 667},{'G', 722},{'H', 778},{'I', 389},{'J', 500},{'K', 667},{'L', 611},{'M', 889},{'N', 722},{'O', 722},{'P', 611},{'Q', 722},{'R', 667},{'S', 556},{'T', 611},{'U', 722},{'V', 667},{'W', 889},{'X', 667},{'Y', 611},{'Z', 611},{'[', 333},{'\\', 278},{']', 333},{'^', 570},{'_', 500},{'`', 333},{'a', 500},{'b', 500},{'c', 444},{'d', 500},{'e', 444},{'f', 333},{'g', 500},{'h', 556},{'i', 278},{'j', 278},{'k', 500},{'l', 278},{'m', 778},{'n', 556},{'o', 500},{'p', 500},{'q', 500},{'r', 389},{'s', 389},{'t', 278},{'u', 556},{'v', 444},{'w', 667},{'x', 500},{'y', 444},{'z', 389},{'{', 348},{'|', 220},{'}', 348},{'~', 570},{0xa1, 389},{0xa2, 500},{0xa3, 500},{0xa4, 500},{0xa5, 500},{0xa6, 220},{0xa7, 500},{0xa8, 333},{0xa9, 747},{0xaa, 266},{0xab, 500},{0xac, 606},{0xae, 747},{0xaf, 333},{0xb0, 400},{0xb1, 570},{0xb2, 300},{0xb3, 300},{0xb4, 333},{0xb5, 576},{0xb6, 500},{0xb7, 250},{0xb8, 333},{0xb9, 300},{0xba, 300},{0xbb, 500},{0xbc, 750},{0xbd, 750},{0xbe, 750},{0xbf, 500},{0xc0, 667},{0xc1, 667},{0xc2, 667},{0xc3, 667},{0xc4, 667},{0xc5, 667},{0xc6, 944},{0xc7, 667},{0xc8, 667},{0xc9, 667},{0xca, 667},{0xcb, 667},{0xcc, 389},{0xcd, 389},{0xce, 389},{0xcf, 389},{0xd0, 722},{0xd1, 722},{0xd2, 722},{0xd3, 722},{0xd4, 722},{0xd5, 722},{0xd6, 722},{0xd7, 570},{0xd8, 722},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 611},{0xde, 611},{0xdf, 500},{0xe0, 500},{0xe1, 500},{0xe2, 500},{0xe3, 500},{0xe4, 500},{0xe5, 500},{0xe6, 722},{0xe7, 444},{0xe8, 444},{0xe9, 444},{0xea, 444},{0xeb, 444},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 500},{0xf1, 556},{0xf2, 500},{0xf3, 500},{0xf4, 500},{0xf5, 500},{0xf6, 500},{0xf7, 570},{0xf8, 500},{0xf9, 556},{0xfa, 556},{0xfb, 556},{0xfc, 556},{0xfd, 444},{0xfe, 500},{0xff, 444},{0x0100, 667},{0x0101, 500},{0x0102, 667},{0x0103, 500},{0x0104, 667},{0x0105, 500},{0x0106, 667},{0x0107, 444},{0x010c, 667},{0x010d, 444},{0x010e, 722},{0x010f, 608},{0x0110, 722},{0x0111, 500},{0x0112, 667},{0x0113, 444},{0x0116, 667},{0x0117, 444},{0x0118, 667},{0x0119, 444},{0x011a, 667},{0x011b, 444},{0x011e, 722},{0x011f, 500},{0x0122, 722},{0x0123, 500},{0x012a, 389},{0x012b, 278},{0x012e, 389},{0x012f, 278},{0x0130, 389},{0x0131, 278},{0x0136, 667},{0x0137, 500},{0x0139, 611},{0x013a, 278},{0x013b, 611},{0x013c, 278},{0x013d, 611},{0x013e, 382},{0x0141, 611},{0x0142, 278},{0x0143, 722},{0x0144, 556},{0x0145, 722},{0x0146, 556},{0x0147, 722},{0x0148, 556},{0x014c, 722},{0x014d, 500},{0x0150, 722},{0x0151, 500},{0x0152, 944},{0x0153, 722},{0x0154, 667},{0x0155, 389},{0x0156, 667},{0x0157, 389},{0x0158, 667},{0x0159, 389},{0x015a, 556},{0x015b, 389},{0x015e, 556},{0x015f, 389},{0x0160, 556},{0x0161, 389},{0x0162, 611},{0x0163, 278},{0x0164, 611},{0x0165, 366},{0x016a, 722},{0x016b, 556},{0x016e, 722},{0x016f, 556},{0x0170, 722},{0x0171, 556},{0x0172, 722},{0x0173, 556},{0x0178, 611},{0x0179, 611},{0x017a, 389},{0x017b, 611},{0x017c, 389},{0x017d, 611},{0x017e, 389},{0x0192, 500},{0x0218, 556},{0x0219, 389},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 500},{0x2014, 1000},{0x2018, 333},{0x2019, 333},{0x201a, 333},{0x201c, 500},{0x201d, 500},{0x201e, 500},{0x2020, 500},{0x2021, 500},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 1000},{0x2202, 494},{0x2206, 612},{0x2211, 600},{0x2212, 606},{0x221a, 549},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 494},{0xf6c3, 250},{0xfb01, 556},{0xfb02, 556}}},
+{"/Times-Italic", {{' ', 250},{'!', 333},{'"', 420},{'#', 500},{'$', 500},{'%', 833},{'&', 778}, {'\'', 214},{'(', 333},{')', 333},{'*', 500},{'+', 675},{',', 250},{'-', 333},{'.', 250},{'/', 278},{'0', 500},{'1', 500},{'2', 500},{'3', 500},{'4', 500},{'5', 500},{'6', 500},{'7', 500},{'8', 500},{'9', 500},{':', 333},{';', 333},{'<', 675},{'=', 675},{'>', 675},{'?', 500},{'@', 920},{'A', 611},{'B', 611},{'C', 667},{'D', 722},{'E', 611},{'F', 611},{'G', 722},{'H', 722},{'I', 333},{'J', 444},{'K', 667},{'L', 556},{'M', 833},{'N', 667},{'O', 722},{'P', 611},{'Q', 722},{'R', 611},{'S', 500},{'T', 556},{'U', 722},{'V', 611},{'W', 833},{'X', 611},{'Y', 556},{'Z', 556},{'[', 389},{'\\', 278},{']', 389},{'^', 422},{'_', 500},{'`', 333},{'a', 500},{'b', 500},{'c', 444},{'d', 500},{'e', 444},{'f', 278},{'g', 500},{'h', 500},{'i', 278},{'j', 278},{'k', 444},{'l', 278},{'m', 722},{'n', 500},{'o', 500},{'p', 500},{'q', 500},{'r', 389},{'s', 389},{'t', 278},{'u', 500},{'v', 444},{'w', 667},{'x', 444},{'y', 444},{'z', 389},{'{', 400},{'|', 275},{'}', 400},{'~', 541},{0xa1, 389},{0xa2, 500},{0xa3, 500},{0xa4, 500},{0xa5, 500},{0xa6, 275},{0xa7, 500},{0xa8, 333},{0xa9, 760},{0xaa, 276},{0xab, 500},{0xac, 675},{0xae, 760},{0xaf, 333},{0xb0, 400},{0xb1, 675},{0xb2, 300},{0xb3, 300},{0xb4, 333},{0xb5, 500},{0xb6, 523},{0xb7, 250},{0xb8, 333},{0xb9, 300},{0xba, 310},{0xbb, 500},{0xbc, 750},{0xbd, 750},{0xbe, 750},{0xbf, 500},{0xc0, 611},{0xc1, 611},{0xc2, 611},{0xc3, 611},{0xc4, 611},{0xc5, 611},{0xc6, 889},{0xc7, 667},{0xc8, 611},{0xc9, 611},{0xca, 611},{0xcb, 611},{0xcc, 333},{0xcd, 333},{0xce, 333},{0xcf, 333},{0xd0, 722},{0xd1, 667},{0xd2, 722},{0xd3, 722},{0xd4, 722},{0xd5, 722},{0xd6, 722},{0xd7, 675},{0xd8, 722},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 556},{0xde, 611},{0xdf, 500},{0xe0, 500},{0xe1, 500},{0xe2, 500},{0xe3, 500},{0xe4, 500},{0xe5, 500},{0xe6, 667},{0xe7, 444},{0xe8, 444},{0xe9, 444},{0xea, 444},{0xeb, 444},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 500},{0xf1, 500},{0xf2, 500},{0xf3, 500},{0xf4, 500},{0xf5, 500},{0xf6, 500},{0xf7, 675},{0xf8, 500},{0xf9, 500},{0xfa, 500},{0xfb, 500},{0xfc, 500},{0xfd, 444},{0xfe, 500},{0xff, 444},{0x0100, 611},{0x0101, 500},{0x0102, 611},{0x0103, 500},{0x0104, 611},{0x0105, 500},{0x0106, 667},{0x0107, 444},{0x010c, 667},{0x010d, 444},{0x010e, 722},{0x010f, 544},{0x0110, 722},{0x0111, 500},{0x0112, 611},{0x0113, 444},{0x0116, 611},{0x0117, 444},{0x0118, 611},{0x0119, 444},{0x011a, 611},{0x011b, 444},{0x011e, 722},{0x011f, 500},{0x0122, 722},{0x0123, 500},{0x012a, 333},{0x012b, 278},{0x012e, 333},{0x012f, 278},{0x0130, 333},{0x0131, 278},{0x0136, 667},{0x0137, 444},{0x0139, 556},{0x013a, 278},{0x013b, 556},{0x013c, 278},{0x013d, 611},{0x013e, 300},{0x0141, 556},{0x0142, 278},{0x0143, 667},{0x0144, 500},{0x0145, 667},{0x0146, 500},{0x0147, 667},{0x0148, 500},{0x014c, 722},{0x014d, 500},{0x0150, 722},{0x0151, 500},{0x0152, 944},{0x0153, 667},{0x0154, 611},{0x0155, 389},{0x0156, 611},{0x0157, 389},{0x0158, 611},{0x0159, 389},{0x015a, 500},{0x015b, 389},{0x015e, 500},{0x015f, 389},{0x0160, 500},{0x0161, 389},{0x0162, 556},{0x0163, 278},{0x0164, 556},{0x0165, 300},{0x016a, 722},{0x016b, 500},{0x016e, 722},{0x016f, 500},{0x0170, 722},{0x0171, 500},{0x0172, 722},{0x0173, 500},{0x0178, 556},{0x0179, 556},{0x017a, 389},{0x017b, 556},{0x017c, 389},{0x017d, 556},{0x017e, 389},{0x0192, 500},{0x0218, 500},{0x0219, 389},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 500},{0x2014, 889},{0x2018, 333},{0x2019, 333},{0x201a, 333},{0x201c, 556},{0x201d, 556},{0x201e, 556},{0x2020, 500},{0x2021, 500},{0x2022, 350},{0x2026, 889},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 980},{0x2202, 476},{0x2206, 612},{0x2211, 600},{0x2212, 675},{0x221a, 453},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 471},{0xf6c3, 250},{0xfb01, 500},{0xfb02, 500}}},
+{"/Times-Roman", {{' ', 250},{'!', 333},{'"', 408},{'#', 500},{'$', 500},{'%', 833},{'&', 778}, {'\'', 180},{'(', 333},{')', 333},{'*', 500},{'+', 564},{',', 250},{'-', 333},{'.', 250},{'/', 278},{'0', 500},{'1', 500},{'2', 500},{'3', 500},{'4', 500},{'5', 500},{'6', 500},{'7', 500},{'8', 500},{'9', 500},{':', 278},{';', 278},{'<', 564},{'=', 564},{'>', 564},{'?', 444},{'@', 921},{'A', 722},{'B', 667},{'C', 667},{'D', 722},{'E', 611},{'F', 556},{'G', 722},{'H', 722},{'I', 333},{'J', 389},{'K', 722},{'L', 611},{'M', 889},{'N', 722},{'O', 722},{'P', 556},{'Q', 722},{'R', 667},{'S', 556},{'T', 611},{'U', 722},{'V', 722},{'W', 944},{'X', 722},{'Y', 722},{'Z', 611},{'[', 333},{'\\', 278},{']', 333},{'^', 469},{'_', 500},{'`', 333},{'a', 444},{'b', 500},{'c', 444},{'d', 500},{'e', 444},{'f', 333},{'g', 500},{'h', 500},{'i', 278},{'j', 278},{'k', 500},{'l', 278},{'m', 778},{'n', 500},{'o', 500},{'p', 500},{'q', 500},{'r', 333},{'s', 389},{'t', 278},{'u', 500},{'v', 500},{'w', 722},{'x', 500},{'y', 500},{'z', 444},{'{', 480},{'|', 200},{'}', 480},{'~', 541},{0xa1, 333},{0xa2, 500},{0xa3, 500},{0xa4, 500},{0xa5, 500},{0xa6, 200},{0xa7, 500},{0xa8, 333},{0xa9, 760},{0xaa, 276},{0xab, 500},{0xac, 564},{0xae, 760},{0xaf, 333},{0xb0, 400},{0xb1, 564},{0xb2, 300},{0xb3, 300},{0xb4, 333},{0xb5, 500},{0xb6, 453},{0xb7, 250},{0xb8, 333},{0xb9, 300},{0xba, 310},{0xbb, 500},{0xbc, 750},{0xbd, 750},{0xbe, 750},{0xbf, 444},{0xc0, 722},{0xc1, 722},{0xc2, 722},{0xc3, 722},{0xc4, 722},{0xc5, 722},{0xc6, 889},{0xc7, 667},{0xc8, 611},{0xc9, 611},{0xca, 611},{0xcb, 611},{0xcc, 333},{0xcd, 333},{0xce, 333},{0xcf, 333},{0xd0, 722},{0xd1, 722},{0xd2, 722},{0xd3, 722},{0xd4, 722},{0xd5, 722},{0xd6, 722},{0xd7, 564},{0xd8, 722},{0xd9, 722},{0xda, 722},{0xdb, 722},{0xdc, 722},{0xdd, 722},{0xde, 556},{0xdf, 500},{0xe0, 444},{0xe1, 444},{0xe2, 444},{0xe3, 444},{0xe4, 444},{0xe5, 444},{0xe6, 667},{0xe7, 444},{0xe8, 444},{0xe9, 444},{0xea, 444},{0xeb, 444},{0xec, 278},{0xed, 278},{0xee, 278},{0xef, 278},{0xf0, 500},{0xf1, 500},{0xf2, 500},{0xf3, 500},{0xf4, 500},{0xf5, 500},{0xf6, 500},{0xf7, 564},{0xf8, 500},{0xf9, 500},{0xfa, 500},{0xfb, 500},{0xfc, 500},{0xfd, 500},{0xfe, 500},{0xff, 500},{0x0100, 722},{0x0101, 444},{0x0102, 722},{0x0103, 444},{0x0104, 722},{0x0105, 444},{0x0106, 667},{0x0107, 444},{0x010c, 667},{0x010d, 444},{0x010e, 722},{0x010f, 588},{0x0110, 722},{0x0111, 500},{0x0112, 611},{0x0113, 444},{0x0116, 611},{0x0117, 444},{0x0118, 611},{0x0119, 444},{0x011a, 611},{0x011b, 444},{0x011e, 722},{0x011f, 500},{0x0122, 722},{0x0123, 500},{0x012a, 333},{0x012b, 278},{0x012e, 333},{0x012f, 278},{0x0130, 333},{0x0131, 278},{0x0136, 722},{0x0137, 500},{0x0139, 611},{0x013a, 278},{0x013b, 611},{0x013c, 278},{0x013d, 611},{0x013e, 344},{0x0141, 611},{0x0142, 278},{0x0143, 722},{0x0144, 500},{0x0145, 722},{0x0146, 500},{0x0147, 722},{0x0148, 500},{0x014c, 722},{0x014d, 500},{0x0150, 722},{0x0151, 500},{0x0152, 889},{0x0153, 722},{0x0154, 667},{0x0155, 333},{0x0156, 667},{0x0157, 333},{0x0158, 667},{0x0159, 333},{0x015a, 556},{0x015b, 389},{0x015e, 556},{0x015f, 389},{0x0160, 556},{0x0161, 389},{0x0162, 611},{0x0163, 278},{0x0164, 611},{0x0165, 326},{0x016a, 722},{0x016b, 500},{0x016e, 722},{0x016f, 500},{0x0170, 722},{0x0171, 500},{0x0172, 722},{0x0173, 500},{0x0178, 722},{0x0179, 611},{0x017a, 444},{0x017b, 611},{0x017c, 444},{0x017d, 611},{0x017e, 444},{0x0192, 500},{0x0218, 556},{0x0219, 389},{0x02c6, 333},{0x02c7, 333},{0x02d8, 333},{0x02d9, 333},{0x02da, 333},{0x02db, 333},{0x02dc, 333},{0x02dd, 333},{0x2013, 500},{0x2014, 1000},{0x2018, 333},{0x2019, 333},{0x201a, 333},{0x201c, 444},{0x201d, 444},{0x201e, 444},{0x2020, 500},{0x2021, 500},{0x2022, 350},{0x2026, 1000},{0x2030, 1000},{0x2039, 333},{0x203a, 333},{0x2044, 167},{0x2122, 980},{0x2202, 476},{0x2206, 612},{0x2211, 600},{0x2212, 564},{0x221a, 453},{0x2260, 549},{0x2264, 549},{0x2265, 549},{0x25ca, 471},{0xf6c3, 250},{0xfb01, 556},{0xfb02, 556}}},
+{"/ZapfDingbats", {{'\x01', 974},{'\x02', 961},{'\x03', 980},{'\x04', 719},{'\x05', 789},{'\x06', 494},{'\x07', 552},{'\x08', 537},{'\t', 577},{'\n', 692},{'\x0b', 960},{'\x0c', 939},{'\r', 549},{'\x0e', 855},{'\x0f', 911},{'\x10', 933},{'\x11', 945},{'\x12', 974},{'\x13', 755},{'\x14', 846},{'\x15', 762},{'\x16', 761},{'\x17', 571},{'\x18', 677},{'\x19', 763},{'\x1a', 760},{'\x1b', 759},{'\x1c', 754},{'\x1d', 786},{'\x1e', 788},{'\x1f', 788},{' ', 790},{'!', 793},{'"', 794},{'#', 816},{'$', 823},{'%', 789},{'&', 841}, {'\'', 823},{'(', 833},{')', 816},{'*', 831},{'+', 923},{',', 744},{'-', 723},{'.', 749},{'/', 790},{'0', 792},{'1', 695},{'2', 776},{'3', 768},{'4', 792},{'5', 759},{'6', 707},{'7', 708},{'8', 682},{'9', 701},{':', 826},{';', 815},{'<', 789},{'=', 789},{'>', 707},{'?', 687},{'@', 696},{'A', 689},{'B', 786},{'C', 787},{'D', 713},{'E', 791},{'F', 785},{'G', 791},{'H', 873},{'I', 761},{'J', 762},{'K', 759},{'L', 892},{'M', 892},{'N', 788},{'O', 784},{'Q', 438},{'R', 138},{'S', 277},{'T', 415},{'U', 509},{'V', 410},{'W', 234},{'X', 234},{'Y', 390},{'Z', 390},{'[', 276},{'\\', 276},{']', 317},{'^', 317},{'_', 334},{'`', 334},{'a', 392},{'b', 392},{'c', 668},{'d', 668},{'e', 732},{'f', 544},{'g', 544},{'h', 910},{'i', 911},{'j', 667},{'k', 760},{'l', 760},{'m', 626},{'n', 694},{'o', 595},{'p', 776},{'u', 690},{'v', 791},{'w', 790},{'x', 788},{'y', 788},{'z', 788},{'{', 788},{'|', 788},{'}', 788},{'~', 788},{0x7f, 788},{0x80, 788},{0x81, 788},{0x82, 788},{0x83, 788},{0x84, 788},{0x85, 788},{0x86, 788},{0x87, 788},{0x88, 788},{0x89, 788},{0x8a, 788},{0x8b, 788},{0x8c, 788},{0x8d, 788},{0x8e, 788},{0x8f, 788},{0x90, 788},{0x91, 788},{0x92, 788},{0x93, 788},{0x94, 788},{0x95, 788},{0x96, 788},{0x97, 788},{0x98, 788},{0x99, 788},{0x9a, 788},{0x9b, 788},{0x9c, 788},{0x9d, 788},{0x9e, 788},{0x9f, 788},{0xa0, 894},{0xa1, 838},{0xa2, 924},{0xa3, 1016},{0xa4, 458},{0xa5, 924},{0xa6, 918},{0xa7, 927},{0xa8, 928},{0xa9, 928},{0xaa, 834},{0xab, 873},{0xac, 828},{0xad, 924},{0xae, 917},{0xaf, 930},{0xb0, 931},{0xb1, 463},{0xb2, 883},{0xb3, 836},{0xb4, 867},{0xb5, 696},{0xb6, 874},{0xb7, 760},{0xb8, 946},{0xb9, 865},{0xba, 967},{0xbb, 831},{0xbc, 873},{0xbd, 927},{0xbe, 970},{0xbf, 918},{0xc0, 748},{0xc1, 836},{0xc2, 771},{0xc3, 888},{0xc4, 748},{0xc5, 771},{0xc6, 888},{0xc7, 867},{0xc8, 696},{0xc9, 874},{0xca, 974},{0xcb, 762},{0xcc, 759},{0xcd, 509},{0xce, 410}}}}
@@ -0,0 +1,287 @@
+#include <string>
+#include <cstdint>
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "utf.h"
+
+using namespace std;
+
+namespace
+{
+    enum : uint32_t { HIGH_SURROGATE_FIRST = 0xD800, LOW_SURROGATE_FIRST = 0xDC00, SURROGATE_LAST = 0xDFFF };
+
+    uint32_t get_unit(const char *s)
+    {
+        return (static_cast<uint32_t>(static_cast<unsigned char>(s[0])) << 8) | static_cast<unsigned char>(s[1]);
+    }
+
+    bool is_surrogate(uint32_t unit)
+    {
+        return unit >= HIGH_SURROGATE_FIRST && unit <= SURROGATE_LAST;
+    }
+
+    //converts leading units which are not surrogates. Returns number of converted bytes of s
+    size_t append_bmp_scalar(string &result, const char *s, size_t len)
+    {
+        size_t i = 0;
+        for (; i + 1 < len; i += 2)
+        {
+            const uint32_t unit = get_unit(s + i);
+            if (is_surrogate(unit)) break;
+            append_utf8(result, unit);
+        }
+        return i;
+    }
+
+    size_t utf8_length_scalar(const char *s, size_t len)
+    {
+        size_t result = 0;
+        //Count all first-bytes (the ones that don't match 10xxxxxx).
+        for (size_t i = 0; i < len; ++i) result += (s[i] & 0xc0) != 0x80;
+        return result;
+    }
+
+#ifdef __SSE2__
+    //utf8 of units: lead bytes and lengths of 1 byte (ascii), 2 bytes (up to 0x7FF) and 3 bytes (the rest of BMP).
+    //Bytes of every unit are written at once, the next unit overwrites the bytes after its length
+    size_t append_bmp_sse2(string &result, const char *s, size_t len)
+    {
+        enum { BLOCK = sizeof(__m128i), UNITS = BLOCK / 2 };
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + BLOCK <= len; i += BLOCK)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+            const __m128i u = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+            const __m128i surrogate = _mm_cmpeq_epi16(_mm_and_si128(u, _mm_set1_epi16(0xF800)),
+                                                      _mm_set1_epi16(0xD800));
+            if (_mm_movemask_epi8(surrogate) != 0) break;
+            const __m128i one = _mm_cmpeq_epi16(_mm_and_si128(u, _mm_set1_epi16(0xFF80)), zero);
+            const size_t size = result.size();
+            if (_mm_movemask_epi8(one) == 0xFFFF)
+            {
+                result.resize(size + UNITS);
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(&result[size]), _mm_packus_epi16(u, zero));
+                continue;
+            }
+            const __m128i two = _mm_cmpeq_epi16(_mm_and_si128(u, _mm_set1_epi16(0xF800)), zero);
+            const __m128i lead2 = _mm_or_si128(_mm_srli_epi16(u, 6), _mm_set1_epi16(0xC0));
+            const __m128i lead3 = _mm_or_si128(_mm_srli_epi16(u, 12), _mm_set1_epi16(0xE0));
+            const __m128i middle = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(u, 6), _mm_set1_epi16(0x3F)),
+                                                _mm_set1_epi16(0x80));
+            const __m128i last = _mm_or_si128(_mm_and_si128(u, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+            __m128i lead = _mm_or_si128(_mm_and_si128(two, lead2), _mm_andnot_si128(two, lead3));
+            lead = _mm_or_si128(_mm_and_si128(one, u), _mm_andnot_si128(one, lead));
+            const __m128i second = _mm_or_si128(_mm_and_si128(two, last), _mm_andnot_si128(two, middle));
+            //masks are -1, so length is 3 - one - two
+            const __m128i length = _mm_add_epi16(_mm_add_epi16(_mm_set1_epi16(3), one), two);
+            unsigned char bytes[BLOCK * 2];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes), _mm_packus_epi16(lead, second));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes + BLOCK), _mm_packus_epi16(last, length));
+            result.resize(size + UNITS * 3);
+            char *out = &result[size];
+            for (size_t j = 0; j < UNITS; ++j)
+            {
+                out[0] = bytes[j];
+                out[1] = bytes[j + UNITS];
+                out[2] = bytes[j + BLOCK];
+                out += bytes[j + BLOCK + UNITS];
+            }
+            result.resize(out - result.data());
+        }
+        return i + append_bmp_scalar(result, s + i, min(len - i, static_cast<size_t>(BLOCK)));
+    }
+
+    size_t utf8_length_sse2(const char *s, size_t len)
+    {
+        enum { BLOCK = sizeof(__m128i) };
+        //signed bytes above -65 (0xBF) are not 10xxxxxx
+        const __m128i threshold = _mm_set1_epi8(-65);
+        size_t result = 0;
+        size_t i = 0;
+        for (; i + BLOCK <= len; i += BLOCK)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+            result += __builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(v, threshold)));
+        }
+        return result + utf8_length_scalar(s + i, len - i);
+    }
+#endif //__SSE2__
+
+#if defined(__x86_64__) && defined(__GNUC__)
+    __attribute__((target("avx2"))) size_t append_bmp_avx2(string &result, const char *s, size_t len)
+    {
+        enum { BLOCK = sizeof(__m256i), UNITS = BLOCK / 2 };
+        const __m256i zero = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + BLOCK <= len; i += BLOCK)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+            const __m256i u = _mm256_or_si256(_mm256_slli_epi16(v, 8), _mm256_srli_epi16(v, 8));
+            const __m256i surrogate = _mm256_cmpeq_epi16(_mm256_and_si256(u, _mm256_set1_epi16(0xF800)),
+                                                         _mm256_set1_epi16(0xD800));
+            if (_mm256_movemask_epi8(surrogate) != 0) break;
+            const __m256i one = _mm256_cmpeq_epi16(_mm256_and_si256(u, _mm256_set1_epi16(0xFF80)), zero);
+            const size_t size = result.size();
+            //packus works inside 128 bit lanes, so low quadwords of both lanes are gathered
+            if (static_cast<uint32_t>(_mm256_movemask_epi8(one)) == 0xFFFFFFFF)
+            {
+                __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(u, zero), 0xD8);
+                result.resize(size + UNITS);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&result[size]), _mm256_castsi256_si128(packed));
+                continue;
+            }
+            const __m256i two = _mm256_cmpeq_epi16(_mm256_and_si256(u, _mm256_set1_epi16(0xF800)), zero);
+            const __m256i lead2 = _mm256_or_si256(_mm256_srli_epi16(u, 6), _mm256_set1_epi16(0xC0));
+            const __m256i lead3 = _mm256_or_si256(_mm256_srli_epi16(u, 12), _mm256_set1_epi16(0xE0));
+            const __m256i middle = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(u, 6), _mm256_set1_epi16(0x3F)),
+                                                   _mm256_set1_epi16(0x80));
+            const __m256i last = _mm256_or_si256(_mm256_and_si256(u, _mm256_set1_epi16(0x3F)), _mm256_set1_epi16(0x80));
+            const __m256i lead = _mm256_blendv_epi8(_mm256_blendv_epi8(lead3, lead2, two), u, one);
+            const __m256i second = _mm256_blendv_epi8(middle, last, two);
+            const __m256i length = _mm256_add_epi16(_mm256_add_epi16(_mm256_set1_epi16(3), one), two);
+            unsigned char bytes[BLOCK * 2];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(bytes),
+                                _mm256_permute4x64_epi64(_mm256_packus_epi16(lead, second), 0xD8));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(bytes + BLOCK),
+                                _mm256_permute4x64_epi64(_mm256_packus_epi16(last, length), 0xD8));
+            result.resize(size + UNITS * 3);
+            char *out = &result[size];
+            for (size_t j = 0; j < UNITS; ++j)
+            {
+                out[0] = bytes[j];
+                out[1] = bytes[j + UNITS];
+                out[2] = bytes[j + BLOCK];
+                out += bytes[j + BLOCK + UNITS];
+            }
+            result.resize(out - result.data());
+        }
+        return i + append_bmp_sse2(result, s + i, len - i);
+    }
+
+    __attribute__((target("avx2"))) size_t utf8_length_avx2(const char *s, size_t len)
+    {
+        enum { BLOCK = sizeof(__m256i) };
+        const __m256i threshold = _mm256_set1_epi8(-65);
+        size_t result = 0;
+        size_t i = 0;
+        for (; i + BLOCK <= len; i += BLOCK)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+            result += __builtin_popcount(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, threshold))));
+        }
+        return result + utf8_length_sse2(s + i, len - i);
+    }
+
+    const bool has_avx2 = (__builtin_cpu_init(), __builtin_cpu_supports("avx2"));
+
+    size_t append_bmp(string &result, const char *s, size_t len)
+    {
+        return has_avx2? append_bmp_avx2(result, s, len) : append_bmp_sse2(result, s, len);
+    }
+
+    size_t get_utf8_length(const char *s, size_t len)
+    {
+        return has_avx2? utf8_length_avx2(s, len) : utf8_length_sse2(s, len);
+    }
+#elif defined(__SSE2__)
+    size_t append_bmp(string &result, const char *s, size_t len)
+    {
+        return append_bmp_sse2(result, s, len);
+    }
+
+    size_t get_utf8_length(const char *s, size_t len)
+    {
+        return utf8_length_sse2(s, len);
+    }
+#else
+    size_t append_bmp(string &result, const char *s, size_t len)
+    {
+        return append_bmp_scalar(result, s, len);
+    }
+
+    size_t get_utf8_length(const char *s, size_t len)
+    {
+        return utf8_length_scalar(s, len);
+    }
+#endif
+}
+
+size_t utf8_length(const string &s)
+{
+    return get_utf8_length(s.data(), s.length());
+}
+
+void append_utf8(string &s, uint32_t code_point)
+{
+    if (code_point < 0x80)
+    {
+        s.push_back(code_point);
+    }
+    else if (code_point < 0x800)
+    {
+        s.push_back(0xC0 | (code_point >> 6));
+        s.push_back(0x80 | (code_point & 0x3F));
+    }
+    else if (code_point < 0x10000)
+    {
+        s.push_back(0xE0 | (code_point >> 12));
+        s.push_back(0x80 | ((code_point >> 6) & 0x3F));
+        s.push_back(0x80 | (code_point & 0x3F));
+    }
+    else
+    {
+        s.push_back(0xF0 | (code_point >> 18));
+        s.push_back(0x80 | ((code_point >> 12) & 0x3F));
+        s.push_back(0x80 | ((code_point >> 6) & 0x3F));
+        s.push_back(0x80 | (code_point & 0x3F));
+    }
+}
+
+void append_utf16be(string &result, const char *s, size_t len)
+{
+    for (size_t i = 0; i + 1 < len;)
+    {
+        uint32_t unit = get_unit(s + i);
+        if (!is_surrogate(unit))
+        {
+            i += append_bmp(result, s + i, len - i);
+            continue;
+        }
+        uint32_t low = (unit < LOW_SURROGATE_FIRST && i + 3 < len)? get_unit(s + i + 2) : 0;
+        if (low < LOW_SURROGATE_FIRST || low > SURROGATE_LAST)
+        {
+            ++i;
+            continue;
+        }
+        append_utf8(result, 0x10000 + ((unit - HIGH_SURROGATE_FIRST) << 10) + (low - LOW_SURROGATE_FIRST));
+        i += 4;
+    }
+}
+
+void append_utf32be(string &result, const char *s, size_t len)
+{
+    for (size_t i = 0; i + 3 < len;)
+    {
+        uint32_t code_point = (get_unit(s + i) << 16) | get_unit(s + i + 2);
+        if (code_point > 0x10FFFF || (code_point >= HIGH_SURROGATE_FIRST && code_point <= SURROGATE_LAST))
+        {
+            ++i;
+            continue;
+        }
+        append_utf8(result, code_point);
+        i += 4;
+    }
+}
+
+string utf16be2utf8(const string &s)
+{
+    string result;
+    result.reserve(s.length() + s.length() / 2);
+    append_utf16be(result, s.data(), s.length());
+    return result;
+}
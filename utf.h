@@ -0,0 +1,17 @@
+#ifndef UTF_H
+#define UTF_H
+
+#include <string>
+#include <cstdint>
+
+//number of characters in utf8 string
+size_t utf8_length(const std::string &s);
+void append_utf8(std::string &s, uint32_t code_point);
+//appends utf16be string converted to utf8. Like iconv in skip mode, on invalid or incomplete unit
+//one byte is skipped and conversion goes on
+void append_utf16be(std::string &result, const char *s, size_t len);
+std::string utf16be2utf8(const std::string &s);
+//appends utf32be string converted to utf8, skipping bytes like append_utf16be
+void append_utf32be(std::string &result, const char *s, size_t len);
+
+#endif //UTF_H